@@ -0,0 +1,86 @@
+#
+# Convert binary log file (*.bin) into the CSV log file
+#
+# The output CSV file has the same layout as the log written with `log_file_format = CSV`,
+# so the plot scripts can be used without modification.
+#
+# arg[1] : input_file : binary log file ex. 220627_142946_default.bin
+# arg[2] : output_file : (optional) output CSV file. The extension of the input file is replaced with `.csv` when omitted.
+#
+
+#
+# Import
+#
+import argparse
+import os
+import struct
+
+MAGIC = b'S2ELOGB\x00'
+SUPPORTED_VERSION = 1
+COLUMN_TYPE_DOUBLE = 0
+COLUMN_TYPE_TEXT = 1
+
+def read_exact(file, size):
+  data = file.read(size)
+  if len(data) != size:
+    raise EOFError
+  return data
+
+def read_uint32(file):
+  return struct.unpack('<I', read_exact(file, 4))[0]
+
+def read_header(file):
+  if file.read(len(MAGIC)) != MAGIC:
+    raise ValueError('The file is not a S2E binary log file.')
+  version = read_uint32(file)
+  if version != SUPPORTED_VERSION:
+    raise ValueError('Unsupported binary log version: ' + str(version))
+
+  number_of_segments = read_uint32(file)
+  csv_header = ''
+  columns = []
+  for _ in range(number_of_segments):
+    header_length = read_uint32(file)
+    csv_header += read_exact(file, header_length).decode('utf-8')
+    number_of_columns = read_uint32(file)
+    for _ in range(number_of_columns):
+      column_type, precision = struct.unpack('<BB', read_exact(file, 2))
+      columns.append((column_type, precision))
+  return csv_header, columns
+
+def convert(input_file_name, output_file_name):
+  with open(input_file_name, 'rb') as input_file, open(output_file_name, 'w', newline='') as output_file:
+    csv_header, columns = read_header(input_file)
+    output_file.write(csv_header + '\n')
+
+    # `std::setprecision(n)` with the default float field is equivalent to `%.ng`
+    formats = ['%.' + str(max(precision, 1)) + 'g,' for _, precision in columns]
+    number_of_records = 0
+    while len(columns) > 0:
+      line = []
+      try:
+        for (column_type, _), value_format in zip(columns, formats):
+          if column_type == COLUMN_TYPE_DOUBLE:
+            line.append(value_format % struct.unpack('<d', read_exact(input_file, 8))[0])
+          elif column_type == COLUMN_TYPE_TEXT:
+            line.append(read_exact(input_file, read_uint32(input_file)).decode('utf-8'))
+          else:
+            raise ValueError('Unknown column type: ' + str(column_type))
+      except EOFError:
+        break  # Incomplete record at the end of the file is discarded
+      output_file.write(''.join(line) + '\n')
+      number_of_records += 1
+  return number_of_records
+
+if __name__ == '__main__':
+  aparser = argparse.ArgumentParser()
+  aparser.add_argument('input_file', type=str, help='binary log file like "220627_142946_default.bin"')
+  aparser.add_argument('output_file', type=str, nargs='?', help='output CSV file')
+  args = aparser.parse_args()
+
+  output_file_name = args.output_file
+  if output_file_name is None:
+    output_file_name = os.path.splitext(args.input_file)[0] + '.csv'
+
+  number_of_records = convert(args.input_file, output_file_name)
+  print('Converted ' + str(number_of_records) + ' records into ' + output_file_name)
@@ -0,0 +1,42 @@
+#!/bin/bash
+# Execute a Monte-Carlo simulation in multiple local processes and merge the summaries
+# Usage: run_distributed_monte_carlo.sh <number of processes> <number of cases> <output directory> <simulation executable> [arguments...]
+#   The number of cases is number_of_executions in the initialize file, and the summary rows of the other case indices are rejected.
+#   Each process executes a shard of the cases with --monte_carlo_shard=<i>/<n> and writes <output directory>/summary_<i>.csv.
+#   The merged statistics are written into <output directory>/summary_statistics.csv.
+#   Set MERGE_MONTE_CARLO_SUMMARY to the path of merge_monte_carlo_summary when it is not in PATH.
+
+if [ $# -lt 4 ]; then
+  echo "Usage: $0 <number of processes> <number of cases> <output directory> <simulation executable> [arguments...]"
+  exit 1
+fi
+
+NUMBER_OF_PROCESSES=$1
+NUMBER_OF_CASES=$2
+DIR_OUTPUT=$3
+shift 3
+MERGE_TOOL=${MERGE_MONTE_CARLO_SUMMARY:-merge_monte_carlo_summary}
+
+mkdir -p $DIR_OUTPUT
+
+PIDS=()
+for ((i = 0; i < NUMBER_OF_PROCESSES; i++)); do
+  "$@" --monte_carlo_shard=$i/$NUMBER_OF_PROCESSES --monte_carlo_summary=$DIR_OUTPUT/summary_$i.csv > $DIR_OUTPUT/shard_$i.log 2>&1 &
+  PIDS+=($!)
+done
+
+RESULT=0
+for ((i = 0; i < NUMBER_OF_PROCESSES; i++)); do
+  if ! wait ${PIDS[$i]}; then
+    echo "Shard $i/$NUMBER_OF_PROCESSES failed: see $DIR_OUTPUT/shard_$i.log"
+    RESULT=1
+  fi
+done
+
+SUMMARY_FILES=()
+for ((i = 0; i < NUMBER_OF_PROCESSES; i++)); do
+  SUMMARY_FILES+=($DIR_OUTPUT/summary_$i.csv)
+done
+$MERGE_TOOL $DIR_OUTPUT/summary_statistics.csv "${SUMMARY_FILES[@]}" --number_of_cases=$NUMBER_OF_CASES || RESULT=1
+
+exit $RESULT
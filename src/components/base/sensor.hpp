@@ -10,6 +10,7 @@
 #include <library/math/vector.hpp>
 #include <library/randomization/normal_randomization.hpp>
 #include <library/randomization/random_walk.hpp>
+#include <library/utilities/snapshot.hpp>
 
 /**
  * @class Sensor
@@ -40,6 +41,17 @@ class Sensor {
    */
   ~Sensor();
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the noise states into the snapshot
+   */
+  void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the noise states from the snapshot
+   */
+  void RestoreSnapshot(Snapshot& snapshot);
+
  protected:
   libra::Vector<N> bias_noise_c_;  //!< Constant bias noise at the component frame
 
@@ -27,6 +27,20 @@ Sensor<N>::Sensor(const libra::Matrix<N, N>& scale_factor, const libra::Vector<N
 template <size_t N>
 Sensor<N>::~Sensor() {}
 
+template <size_t N>
+void Sensor<N>::SaveSnapshot(Snapshot& snapshot) const {
+  snapshot.Write(bias_noise_c_);
+  snapshot.WriteArray(normal_random_noise_c_, N);
+  random_walk_noise_c_.SaveSnapshot(snapshot);
+}
+
+template <size_t N>
+void Sensor<N>::RestoreSnapshot(Snapshot& snapshot) {
+  snapshot.Read(bias_noise_c_);
+  snapshot.ReadArray(normal_random_noise_c_, N);
+  random_walk_noise_c_.RestoreSnapshot(snapshot);
+}
+
 template <size_t N>
 libra::Vector<N> Sensor<N>::Measure(const libra::Vector<N> true_value_c) {
   libra::Vector<N> calc_value_c;
@@ -84,6 +84,24 @@ std::string ForceGenerator::GetLogValue() const {
   return str_tmp;
 }
 
+void ForceGenerator::SaveSnapshot(Snapshot& snapshot) const {
+  snapshot.Write(ordered_force_b_N_);
+  snapshot.Write(generated_force_b_N_);
+  snapshot.Write(generated_force_i_N_);
+  snapshot.Write(generated_force_rtn_N_);
+  snapshot.Write(magnitude_noise_);
+  snapshot.Write(direction_noise_);
+}
+
+void ForceGenerator::RestoreSnapshot(Snapshot& snapshot) {
+  snapshot.Read(ordered_force_b_N_);
+  snapshot.Read(generated_force_b_N_);
+  snapshot.Read(generated_force_i_N_);
+  snapshot.Read(generated_force_rtn_N_);
+  snapshot.Read(magnitude_noise_);
+  snapshot.Read(direction_noise_);
+}
+
 libra::Quaternion ForceGenerator::GenerateDirectionNoiseQuaternion(libra::Vector<3> true_direction, const double error_standard_deviation_rad) {
   libra::Vector<3> random_direction;
   random_direction[0] = direction_noise_;
@@ -11,6 +11,7 @@
 #include <library/logger/logger.hpp>
 #include <library/math/vector.hpp>
 #include <library/randomization/normal_randomization.hpp>
+#include <library/utilities/snapshot.hpp>
 
 /*
  * @class ForceGenerator
@@ -59,6 +60,17 @@ class ForceGenerator : public Component, public ILoggable {
    */
   virtual std::string GetLogValue() const;
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the ordered force, the noise states, and the generated force into the snapshot
+   */
+  void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the ordered force, the noise states, and the generated force from the snapshot
+   */
+  void RestoreSnapshot(Snapshot& snapshot);
+
   // Getter
   /**
    * @fn GetGeneratedForce_b_N
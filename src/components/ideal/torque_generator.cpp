@@ -57,6 +57,20 @@ std::string TorqueGenerator::GetLogValue() const {
   return str_tmp;
 }
 
+void TorqueGenerator::SaveSnapshot(Snapshot& snapshot) const {
+  snapshot.Write(ordered_torque_b_Nm_);
+  snapshot.Write(generated_torque_b_Nm_);
+  snapshot.Write(magnitude_noise_);
+  snapshot.Write(direction_noise_);
+}
+
+void TorqueGenerator::RestoreSnapshot(Snapshot& snapshot) {
+  snapshot.Read(ordered_torque_b_Nm_);
+  snapshot.Read(generated_torque_b_Nm_);
+  snapshot.Read(magnitude_noise_);
+  snapshot.Read(direction_noise_);
+}
+
 libra::Quaternion TorqueGenerator::GenerateDirectionNoiseQuaternion(libra::Vector<3> true_direction, const double error_standard_deviation_rad) {
   libra::Vector<3> random_direction;
   random_direction[0] = direction_noise_;
@@ -11,6 +11,7 @@
 #include <library/logger/logger.hpp>
 #include <library/math/vector.hpp>
 #include <library/randomization/normal_randomization.hpp>
+#include <library/utilities/snapshot.hpp>
 
 /*
  * @class TorqueGenerator
@@ -59,6 +60,17 @@ class TorqueGenerator : public Component, public ILoggable {
    */
   virtual std::string GetLogValue() const;
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the ordered torque, the noise states, and the generated torque into the snapshot
+   */
+  void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the ordered torque, the noise states, and the generated torque from the snapshot
+   */
+  void RestoreSnapshot(Snapshot& snapshot);
+
   // Getter
   /**
    * @fn GetGeneratedTorque_b_Nm
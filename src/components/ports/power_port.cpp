@@ -74,3 +74,17 @@ void PowerPort::InitializeWithInitializeFile(const std::string file_name) {
   double assumed_power_consumption_W = initialize_file.ReadDouble(section_name.c_str(), "assumed_power_consumption_W");
   this->SetAssumedPowerConsumption_W(assumed_power_consumption_W);
 }
+
+void PowerPort::SaveSnapshot(Snapshot& snapshot) const {
+  snapshot.Write(is_on_);
+  snapshot.Write(voltage_V_);
+  snapshot.Write(current_consumption_A_);
+  snapshot.Write(assumed_power_consumption_W_);
+}
+
+void PowerPort::RestoreSnapshot(Snapshot& snapshot) {
+  snapshot.Read(is_on_);
+  snapshot.Read(voltage_V_);
+  snapshot.Read(current_consumption_A_);
+  snapshot.Read(assumed_power_consumption_W_);
+}
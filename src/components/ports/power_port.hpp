@@ -6,6 +6,7 @@
 #ifndef S2E_COMPONENTS_PORTS_POWER_PORT_HPP_
 #define S2E_COMPONENTS_PORTS_POWER_PORT_HPP_
 
+#include <library/utilities/snapshot.hpp>
 #include <string>
 
 /**
@@ -113,6 +114,17 @@ class PowerPort {
    */
   void InitializeWithInitializeFile(const std::string file_name);
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the switch state, the voltage, and the current consumption into the snapshot
+   */
+  void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the switch state, the voltage, and the current consumption from the snapshot
+   */
+  void RestoreSnapshot(Snapshot& snapshot);
+
  private:
   // PCU setting parameters
   const int kPortId;        //!< ID of the power port
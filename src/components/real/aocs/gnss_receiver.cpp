@@ -6,6 +6,7 @@
 #include "gnss_receiver.hpp"
 
 #include <environment/global/physical_constants.hpp>
+#include <library/math/simd.hpp>
 #include <library/randomization/global_randomization.hpp>
 #include <string>
 
@@ -26,7 +27,9 @@ GnssReceiver::GnssReceiver(const int prescaler, ClockGenerator* clock_generator,
       antenna_model_(antenna_model),
       dynamics_(dynamics),
       gnss_satellites_(gnss_satellites),
-      simulation_time_(simulation_time) {}
+      simulation_time_(simulation_time) {
+  InitializeTargetSatellites();
+}
 GnssReceiver::GnssReceiver(const int prescaler, ClockGenerator* clock_generator, PowerPort* power_port, const int component_id,
                            const std::string gnss_id, const int max_channel, const AntennaModel antenna_model,
                            const libra::Vector<3> antenna_position_b_m, const libra::Quaternion quaternion_b2c, const double half_width_rad,
@@ -45,7 +48,32 @@ GnssReceiver::GnssReceiver(const int prescaler, ClockGenerator* clock_generator,
       antenna_model_(antenna_model),
       dynamics_(dynamics),
       gnss_satellites_(gnss_satellites),
-      simulation_time_(simulation_time) {}
+      simulation_time_(simulation_time) {
+  InitializeTargetSatellites();
+}
+
+void GnssReceiver::InitializeTargetSatellites() {
+  cos_half_width_ = cos(half_width_rad_ * libra::deg_to_rad);
+
+  // check if gnss ID is compatible with the receiver
+  const int gnss_num = gnss_satellites_->GetNumOfSatellites();
+  for (int i = 0; i < gnss_num; i++) {
+    std::string id_tmp = gnss_satellites_->GetIDFromIndex(i);
+    if (gnss_id_.find(id_tmp[0]) == std::string::npos) continue;
+    target_satellite_indices_.push_back(i);
+    target_satellite_ids_.push_back(id_tmp);
+  }
+
+  // The arrays are padded to the SIMD width with zero
+  const size_t lane_num = libra::PackedDouble::kNumberOfLanes;
+  const size_t array_size = (target_satellite_indices_.size() + lane_num - 1) / lane_num * lane_num;
+  target_position_x_i_m_.assign(array_size, 0.0);
+  target_position_y_i_m_.assign(array_size, 0.0);
+  target_position_z_i_m_.assign(array_size, 0.0);
+  cone_inner_products_m_.assign(array_size, 0.0);
+  horizon_inner_products_m2_.assign(array_size, 0.0);
+  squared_distances_m2_.assign(array_size, 0.0);
+}
 
 void GnssReceiver::MainRoutine(const int time_count) {
   UNUSED(time_count);
@@ -96,7 +124,7 @@ void GnssReceiver::CheckAntennaSimple(const libra::Vector<3> pos_true_eci_, libr
 
 void GnssReceiver::CheckAntennaCone(const libra::Vector<3> pos_true_eci_, libra::Quaternion quaternion_i2b) {
   // Cone model
-  libra::Vector<3> gnss_sat_pos_i, ant_pos_i, antenna_to_satellite_i_m, ant2gnss_i_n, sat2ant_i;
+  libra::Vector<3> ant_pos_i, antenna_to_satellite_i_m, sat2ant_i;
   gnss_information_list_.clear();
 
   // antenna normal vector at inertial frame
@@ -111,41 +139,56 @@ void GnssReceiver::CheckAntennaCone(const libra::Vector<3> pos_true_eci_, libra:
   // initialize
   visible_satellite_number_ = 0;
 
-  int gnss_num = gnss_satellites_->GetNumOfSatellites();
+  // gnss positions as structure of arrays
+  const size_t target_num = target_satellite_indices_.size();
+  for (size_t k = 0; k < target_num; k++) {
+    const libra::Vector<3> gnss_sat_pos_i = gnss_satellites_->GetSatellitePositionEci(target_satellite_indices_[k]);
+    target_position_x_i_m_[k] = gnss_sat_pos_i[0];
+    target_position_y_i_m_[k] = gnss_sat_pos_i[1];
+    target_position_z_i_m_[k] = gnss_sat_pos_i[2];
+  }
 
-  for (int i = 0; i < gnss_num; i++) {
-    // check if gnss ID is compatible with the receiver
-    std::string id_tmp = gnss_satellites_->GetIDFromIndex(i);
-    if (gnss_id_.find(id_tmp[0]) == std::string::npos) continue;
+  // inner products for the cone and horizon checks of all target satellites
+  using libra::PackedDouble;
+  const PackedDouble ant_pos_x = PackedDouble::Broadcast(ant_pos_i[0]);
+  const PackedDouble ant_pos_y = PackedDouble::Broadcast(ant_pos_i[1]);
+  const PackedDouble ant_pos_z = PackedDouble::Broadcast(ant_pos_i[2]);
+  const PackedDouble direction_x = PackedDouble::Broadcast(antenna_direction_i[0]);
+  const PackedDouble direction_y = PackedDouble::Broadcast(antenna_direction_i[1]);
+  const PackedDouble direction_z = PackedDouble::Broadcast(antenna_direction_i[2]);
+  for (size_t k = 0; k < target_position_x_i_m_.size(); k += PackedDouble::kNumberOfLanes) {
+    const PackedDouble relative_x = PackedDouble::Load(&target_position_x_i_m_[k]) - ant_pos_x;
+    const PackedDouble relative_y = PackedDouble::Load(&target_position_y_i_m_[k]) - ant_pos_y;
+    const PackedDouble relative_z = PackedDouble::Load(&target_position_z_i_m_[k]) - ant_pos_z;
+    (direction_x * relative_x + direction_y * relative_y + direction_z * relative_z).Store(&cone_inner_products_m_[k]);
+    (ant_pos_x * relative_x + ant_pos_y * relative_y + ant_pos_z * relative_z).Store(&horizon_inner_products_m2_[k]);
+    (relative_x * relative_x + relative_y * relative_y + relative_z * relative_z).Store(&squared_distances_m2_[k]);
+  }
 
-    // compute direction from sat to gnss in body-fixed frame
-    gnss_sat_pos_i = gnss_satellites_->GetSatellitePositionEci(i);
-    antenna_to_satellite_i_m = gnss_sat_pos_i - ant_pos_i;
-    double normalizer = 1 / antenna_to_satellite_i_m.CalcNorm();
-    ant2gnss_i_n = normalizer * antenna_to_satellite_i_m;
+  const double Re = environment::earth_equatorial_radius_m;
+  const double ant_pos_norm2_m2 = InnerProduct(ant_pos_i, ant_pos_i);
+  for (size_t k = 0; k < target_num; k++) {
+    // check gnss sats are in the antenna cone
+    const double distance_m = sqrt(squared_distances_m2_[k]);
+    if (cone_inner_products_m_[k] <= cos_half_width_ * distance_m) continue;
 
     // check gnss sats are visible from antenna
-    double Re = environment::earth_equatorial_radius_m;
-    double inner1 = InnerProduct(ant_pos_i, gnss_sat_pos_i);
-    int is_visible_ant2gnss = 0;
-    if (inner1 > 0)
-      is_visible_ant2gnss = 1;
-    else {
-      Vector<3> tmp = ant_pos_i + InnerProduct(-ant_pos_i, ant2gnss_i_n) * antenna_to_satellite_i_m;
-      if (tmp.CalcNorm() < Re)
+    // inner product of the antenna and gnss positions = horizon inner product + |antenna position|^2
+    if (horizon_inner_products_m2_[k] + ant_pos_norm2_m2 <= 0.0) {
+      // distance from the antenna to the closest point of the line of sight to the earth center
+      const double closest_point_m = -horizon_inner_products_m2_[k] / distance_m;
+      if (closest_point_m > 0.0 && ant_pos_norm2_m2 - closest_point_m * closest_point_m < Re * Re) {
         // There is earth between antenna and gnss
-        is_visible_ant2gnss = 0;
-      else
-        // There is not earth between antenna and gnss
-        is_visible_ant2gnss = 1;
+        continue;
+      }
     }
 
-    double inner2 = InnerProduct(antenna_direction_i, ant2gnss_i_n);
-    if (inner2 > cos(half_width_rad_ * libra::deg_to_rad) && is_visible_ant2gnss) {
-      // is visible
-      visible_satellite_number_++;
-      SetGnssInfo(antenna_to_satellite_i_m, quaternion_i2b, id_tmp);
-    }
+    // is visible
+    visible_satellite_number_++;
+    antenna_to_satellite_i_m[0] = target_position_x_i_m_[k] - ant_pos_i[0];
+    antenna_to_satellite_i_m[1] = target_position_y_i_m_[k] - ant_pos_i[1];
+    antenna_to_satellite_i_m[2] = target_position_z_i_m_[k] - ant_pos_i[2];
+    SetGnssInfo(antenna_to_satellite_i_m, quaternion_i2b, target_satellite_ids_[k]);
   }
 
   if (visible_satellite_number_ > 0)
@@ -235,3 +278,60 @@ std::string GnssReceiver::GetLogValue() const  // For logs
 
   return str_tmp;
 }
+
+void GnssReceiver::SaveSnapshot(Snapshot& snapshot) const {
+  snapshot.Write(random_noise_i_x_);
+  snapshot.Write(random_noise_i_y_);
+  snapshot.Write(random_noise_i_z_);
+  snapshot.Write(position_eci_m_);
+  snapshot.Write(velocity_eci_m_s_);
+  snapshot.Write(position_ecef_m_);
+  snapshot.Write(velocity_ecef_m_s_);
+  snapshot.Write(position_llh_);
+  snapshot.Write(utc_);
+  snapshot.Write(gps_time_week_);
+  snapshot.Write(gps_time_s_);
+  snapshot.Write(is_gnss_visible_);
+  snapshot.Write(visible_satellite_number_);
+  // The information list has the IDs of variable length
+  snapshot.Write(gnss_information_list_.size());
+  for (const GnssInfo& gnss_info : gnss_information_list_) {
+    snapshot.Write(gnss_info.ID.size());
+    snapshot.WriteArray(gnss_info.ID.data(), gnss_info.ID.size());
+    snapshot.Write(gnss_info.latitude_rad);
+    snapshot.Write(gnss_info.longitude_rad);
+    snapshot.Write(gnss_info.distance_m);
+  }
+}
+
+void GnssReceiver::RestoreSnapshot(Snapshot& snapshot) {
+  snapshot.Read(random_noise_i_x_);
+  snapshot.Read(random_noise_i_y_);
+  snapshot.Read(random_noise_i_z_);
+  snapshot.Read(position_eci_m_);
+  snapshot.Read(velocity_eci_m_s_);
+  snapshot.Read(position_ecef_m_);
+  snapshot.Read(velocity_ecef_m_s_);
+  snapshot.Read(position_llh_);
+  snapshot.Read(utc_);
+  snapshot.Read(gps_time_week_);
+  snapshot.Read(gps_time_s_);
+  snapshot.Read(is_gnss_visible_);
+  snapshot.Read(visible_satellite_number_);
+  size_t number_of_information = 0;
+  if (!snapshot.Read(number_of_information)) return;
+  std::vector<GnssInfo> gnss_information_list;
+  for (size_t i = 0; i < number_of_information; i++) {
+    GnssInfo gnss_info;
+    size_t id_length = 0;
+    if (!snapshot.Read(id_length)) return;
+    std::vector<char> id(id_length);
+    if (!snapshot.ReadArray(id.data(), id_length)) return;
+    gnss_info.ID.assign(id.begin(), id.end());
+    snapshot.Read(gnss_info.latitude_rad);
+    snapshot.Read(gnss_info.longitude_rad);
+    if (!snapshot.Read(gnss_info.distance_m)) return;
+    gnss_information_list.push_back(gnss_info);
+  }
+  gnss_information_list_ = gnss_information_list;
+}
@@ -13,6 +13,7 @@
 #include <library/logger/loggable.hpp>
 #include <library/math/quaternion.hpp>
 #include <library/randomization/normal_randomization.hpp>
+#include <library/utilities/snapshot.hpp>
 
 #include "../../base/component.hpp"
 
@@ -140,6 +141,17 @@ class GnssReceiver : public Component, public ILoggable {
    */
   virtual std::string GetLogValue() const;
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the noise states and the observed values into the snapshot
+   */
+  void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the noise states and the observed values from the snapshot
+   */
+  void RestoreSnapshot(Snapshot& snapshot);
+
  protected:
   // Parameters for receiver
   const int component_id_;                 //!< Receiver ID
@@ -166,12 +178,28 @@ class GnssReceiver : public Component, public ILoggable {
   int visible_satellite_number_ = 0;             //!< Number of visible GNSS satellites
   std::vector<GnssInfo> gnss_information_list_;  //!< Information List of visible GNSS satellites
 
+  // Visibility check of the cone model
+  double cos_half_width_ = 0.0;                    //!< Cosine of the half width of the antenna cone
+  std::vector<int> target_satellite_indices_;      //!< Indices of the GNSS satellites in the constellations of gnss_id_
+  std::vector<std::string> target_satellite_ids_;  //!< IDs of the target GNSS satellites
+  std::vector<double> target_position_x_i_m_;      //!< X positions of the target GNSS satellites in the ECI frame [m]
+  std::vector<double> target_position_y_i_m_;      //!< Y positions of the target GNSS satellites in the ECI frame [m]
+  std::vector<double> target_position_z_i_m_;      //!< Z positions of the target GNSS satellites in the ECI frame [m]
+  std::vector<double> cone_inner_products_m_;      //!< Inner products of the antenna direction and the antenna to satellite vectors [m]
+  std::vector<double> horizon_inner_products_m2_;  //!< Inner products of the antenna position and the antenna to satellite vectors [m2]
+  std::vector<double> squared_distances_m2_;       //!< Squared distances between the antenna and the target GNSS satellites [m2]
+
   // References
   const Dynamics* dynamics_;               //!< Dynamics of spacecraft
   const GnssSatellites* gnss_satellites_;  //!< Information of GNSS satellites
   const SimulationTime* simulation_time_;  //!< Simulation time
 
   // Internal Functions
+  /**
+   * @fn InitializeTargetSatellites
+   * @brief Make the list of the GNSS satellites in the constellations of gnss_id_ and the work arrays of the cone model
+   */
+  void InitializeTargetSatellites();
   /**
    * @fn CheckAntenna
    * @brief Check the antenna can detect GNSS signal
@@ -192,6 +220,8 @@ class GnssReceiver : public Component, public ILoggable {
    * @fn CheckAntennaCone
    * @brief Check the antenna can detect GNSS signal with Cone mode
    * @note The visible GNSS satellites are counted by using GNSS satellite position and the antenna direction with cone antenna pattern
+   *       The inner products of all target satellites are calculated together over the arrays of the positions, and then the satellites
+   *       hidden by the earth or out of the cone are skipped before the GnssInfo is made.
    * @param [in] position_true_i_m: True position of the spacecraft in the ECI frame [m]
    * @param [in] quaternion_i2b: True attitude of the spacecraft expressed by quaternion from the inertial frame to the body-fixed frame
    */
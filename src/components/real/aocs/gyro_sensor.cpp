@@ -42,3 +42,13 @@ std::string GyroSensor::GetLogValue() const {
 
   return str_tmp;
 }
+
+void GyroSensor::SaveSnapshot(Snapshot& snapshot) const {
+  Sensor::SaveSnapshot(snapshot);
+  snapshot.Write(angular_velocity_c_rad_s_);
+}
+
+void GyroSensor::RestoreSnapshot(Snapshot& snapshot) {
+  Sensor::RestoreSnapshot(snapshot);
+  snapshot.Read(angular_velocity_c_rad_s_);
+}
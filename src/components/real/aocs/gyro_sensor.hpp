@@ -9,6 +9,7 @@
 #include <dynamics/dynamics.hpp>
 #include <library/logger/loggable.hpp>
 #include <library/math/quaternion.hpp>
+#include <library/utilities/snapshot.hpp>
 
 #include "../../base/component.hpp"
 #include "../../base/sensor.hpp"
@@ -71,6 +72,17 @@ class GyroSensor : public Component, public Sensor<kGyroDimension>, public ILogg
    */
   virtual std::string GetLogValue() const override;
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the noise states and the observed angular velocity into the snapshot
+   */
+  void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the noise states and the observed angular velocity from the snapshot
+   */
+  void RestoreSnapshot(Snapshot& snapshot);
+
   /**
    * @fn GetMeasuredAngularVelocity_c_rad_s
    * @brief Return observed angular velocity of the component frame with respect to the inertial frame
@@ -8,34 +8,41 @@
 
 #include "library/initialize/initialize_file_access.hpp"
 
-// In order to share processing among initialization functions, variables should also be shared. These variables have internal linkages and cannot be
-// referenced from the outside.
 namespace {
-int prescaler;
-int fast_prescaler;
-double step_width_s;
-double main_routine_time_step_s;
-double jitter_update_interval_s;
-double rotor_inertia_kgm2;
-double max_torque_Nm;
-double max_velocity;
-libra::Quaternion quaternion_b2c;
-libra::Vector<3> position_b_m;
-double dead_time_s;
-libra::Vector<3> ordinary_lag_coef(1.0);
-libra::Vector<3> coasting_lag_coefficients(1.0);
-bool is_calc_jitter_enabled;
-bool is_log_jitter_enabled;
-std::vector<std::vector<double>> radial_force_harmonics_coefficients;
-std::vector<std::vector<double>> radial_torque_harmonics_coefficients;
-double structural_resonance_frequency_Hz;
-double damping_factor;
-double bandwidth;
-bool considers_structural_resonance;
-bool drive_flag;
-double init_velocity_rad_s;
-
-void InitParams(int actuator_id, std::string file_name, double prop_step, double compo_update_step) {
+/*
+ * @struct ReactionWheelParameters
+ * @brief Parameters of the reaction wheel read from the initialize file
+ * @note The parameters are local to each initialization, so that the reaction wheels can be initialized in parallel threads
+ */
+struct ReactionWheelParameters {
+  int prescaler;                                                          //!< Prescaler of the main routine
+  int fast_prescaler;                                                     //!< Prescaler of the fast update
+  double step_width_s;                                                    //!< Step width of the ODE [s]
+  double main_routine_time_step_s;                                        //!< Time step of the main routine [s]
+  double jitter_update_interval_s;                                        //!< Update interval of the jitter [s]
+  double rotor_inertia_kgm2;                                              //!< Moment of inertia of the rotor [kgm2]
+  double max_torque_Nm;                                                   //!< Maximum output torque [Nm]
+  double max_velocity;                                                    //!< Maximum angular velocity [rpm]
+  libra::Quaternion quaternion_b2c;                                       //!< Quaternion from body frame to component frame
+  libra::Vector<3> position_b_m;                                          //!< Position in the body frame [m]
+  double dead_time_s;                                                     //!< Dead time [s]
+  libra::Vector<3> ordinary_lag_coef{1.0};                                //!< Coefficients of the first order lag in driving
+  libra::Vector<3> coasting_lag_coefficients{1.0};                        //!< Coefficients of the first order lag in coasting
+  bool is_calc_jitter_enabled;                                            //!< Enable flag of the jitter calculation
+  bool is_log_jitter_enabled;                                             //!< Enable flag of the jitter logging
+  std::vector<std::vector<double>> radial_force_harmonics_coefficients;   //!< Coefficients of the radial force harmonics
+  std::vector<std::vector<double>> radial_torque_harmonics_coefficients;  //!< Coefficients of the radial torque harmonics
+  double structural_resonance_frequency_Hz;                               //!< Structural resonance frequency [Hz]
+  double damping_factor;                                                  //!< Damping factor of the structural resonance
+  double bandwidth;                                                       //!< Bandwidth of the structural resonance
+  bool considers_structural_resonance;                                    //!< Flag to consider the structural resonance
+  bool drive_flag;                                                        //!< Initial motor drive flag
+  double init_velocity_rad_s;                                             //!< Initial angular velocity [rad/s]
+};
+
+ReactionWheelParameters InitParams(int actuator_id, std::string file_name, double prop_step, double compo_update_step) {
+  ReactionWheelParameters parameters;
+
   // Access Parameters
   IniAccess rwmodel_conf(file_name);
   const std::string st_actuator_num = std::to_string(static_cast<long long>(actuator_id));
@@ -45,18 +52,18 @@ void InitParams(int actuator_id, std::string file_name, double prop_step, double
   const char* RWsection = section_tmp.data();
 
   // Read ini file
-  prescaler = rwmodel_conf.ReadInt(RWsection, "prescaler");
-  if (prescaler <= 1) prescaler = 1;
-  fast_prescaler = rwmodel_conf.ReadInt(RWsection, "fast_prescaler");
-  if (fast_prescaler <= 1) fast_prescaler = 1;
-  rotor_inertia_kgm2 = rwmodel_conf.ReadDouble(RWsection, "moment_of_inertia_kgm2");
-  max_torque_Nm = rwmodel_conf.ReadDouble(RWsection, "max_output_torque_Nm");
-  max_velocity = rwmodel_conf.ReadDouble(RWsection, "max_angular_velocity_rpm");
+  parameters.prescaler = rwmodel_conf.ReadInt(RWsection, "prescaler");
+  if (parameters.prescaler <= 1) parameters.prescaler = 1;
+  parameters.fast_prescaler = rwmodel_conf.ReadInt(RWsection, "fast_prescaler");
+  if (parameters.fast_prescaler <= 1) parameters.fast_prescaler = 1;
+  parameters.rotor_inertia_kgm2 = rwmodel_conf.ReadDouble(RWsection, "moment_of_inertia_kgm2");
+  parameters.max_torque_Nm = rwmodel_conf.ReadDouble(RWsection, "max_output_torque_Nm");
+  parameters.max_velocity = rwmodel_conf.ReadDouble(RWsection, "max_angular_velocity_rpm");
 
   std::string direction_determination_mode;
   direction_determination_mode = rwmodel_conf.ReadString(RWsection, "direction_determination_mode");
   if (direction_determination_mode == "QUATERNION") {
-    rwmodel_conf.ReadQuaternion(RWsection, "quaternion_b2c", quaternion_b2c);
+    rwmodel_conf.ReadQuaternion(RWsection, "quaternion_b2c", parameters.quaternion_b2c);
   } else  // direction_determination_mode == "DIRECTION"
   {
     libra::Vector<3> direction_b;
@@ -64,63 +71,69 @@ void InitParams(int actuator_id, std::string file_name, double prop_step, double
     libra::Vector<3> direction_c(0.0);
     direction_c[2] = 1.0;
     libra::Quaternion q(direction_b, direction_c);
-    quaternion_b2c = q.Conjugate();
+    parameters.quaternion_b2c = q.Conjugate();
   }
 
-  rwmodel_conf.ReadVector(RWsection, "position_b_m", position_b_m);
-  dead_time_s = rwmodel_conf.ReadDouble(RWsection, "dead_time_s");
-  // rwmodel_conf.ReadVector(RWsection, "first_order_lag_coefficient", ordinary_lag_coef);　// TODO: Fix bug
-  // rwmodel_conf.ReadVector(RWsection, "coasting_lag_coefficient", coasting_lag_coefficients); // TODO: Fix bug
+  rwmodel_conf.ReadVector(RWsection, "position_b_m", parameters.position_b_m);
+  parameters.dead_time_s = rwmodel_conf.ReadDouble(RWsection, "dead_time_s");
+  // rwmodel_conf.ReadVector(RWsection, "first_order_lag_coefficient", parameters.ordinary_lag_coef);　// TODO: Fix bug
+  // rwmodel_conf.ReadVector(RWsection, "coasting_lag_coefficient", parameters.coasting_lag_coefficients); // TODO: Fix bug
 
-  is_calc_jitter_enabled = rwmodel_conf.ReadEnable(RWsection, "jitter_calculation");
-  is_log_jitter_enabled = rwmodel_conf.ReadEnable(RWsection, "jitter_logging");
+  parameters.is_calc_jitter_enabled = rwmodel_conf.ReadEnable(RWsection, "jitter_calculation");
+  parameters.is_log_jitter_enabled = rwmodel_conf.ReadEnable(RWsection, "jitter_logging");
 
   std::string radial_force_harmonics_coef_path = rwmodel_conf.ReadString(RWsection, "radial_force_harmonics_coefficient_file");
   std::string radial_torque_harmonics_coef_path = rwmodel_conf.ReadString(RWsection, "radial_torque_harmonics_coefficient_file");
   int harmonics_degree = rwmodel_conf.ReadInt(RWsection, "harmonics_degree");
   IniAccess conf_radial_force_harmonics(radial_force_harmonics_coef_path);
   IniAccess conf_radial_torque_harmonics(radial_torque_harmonics_coef_path);
-  conf_radial_force_harmonics.ReadCsvDouble(radial_force_harmonics_coefficients, harmonics_degree);
-  conf_radial_torque_harmonics.ReadCsvDouble(radial_torque_harmonics_coefficients, harmonics_degree);
+  conf_radial_force_harmonics.ReadCsvDouble(parameters.radial_force_harmonics_coefficients, harmonics_degree);
+  conf_radial_torque_harmonics.ReadCsvDouble(parameters.radial_torque_harmonics_coefficients, harmonics_degree);
 
-  structural_resonance_frequency_Hz = rwmodel_conf.ReadDouble(RWsection, "structural_resonance_frequency_Hz");
-  damping_factor = rwmodel_conf.ReadDouble(RWsection, "damping_factor");
-  bandwidth = rwmodel_conf.ReadDouble(RWsection, "bandwidth");
-  considers_structural_resonance = rwmodel_conf.ReadEnable(RWsection, "considers_structural_resonance");
+  parameters.structural_resonance_frequency_Hz = rwmodel_conf.ReadDouble(RWsection, "structural_resonance_frequency_Hz");
+  parameters.damping_factor = rwmodel_conf.ReadDouble(RWsection, "damping_factor");
+  parameters.bandwidth = rwmodel_conf.ReadDouble(RWsection, "bandwidth");
+  parameters.considers_structural_resonance = rwmodel_conf.ReadEnable(RWsection, "considers_structural_resonance");
 
-  drive_flag = rwmodel_conf.ReadBoolean(RWsection, "initial_motor_drive_flag");
-  init_velocity_rad_s = rwmodel_conf.ReadDouble(RWsection, "initial_angular_velocity_rad_s");
+  parameters.drive_flag = rwmodel_conf.ReadBoolean(RWsection, "initial_motor_drive_flag");
+  parameters.init_velocity_rad_s = rwmodel_conf.ReadDouble(RWsection, "initial_angular_velocity_rad_s");
 
   // Calc periods
-  step_width_s = prop_step;
-  main_routine_time_step_s = prescaler * compo_update_step;
-  jitter_update_interval_s = fast_prescaler * compo_update_step;
+  parameters.step_width_s = prop_step;
+  parameters.main_routine_time_step_s = parameters.prescaler * compo_update_step;
+  parameters.jitter_update_interval_s = parameters.fast_prescaler * compo_update_step;
+
+  return parameters;
 }
 }  // namespace
 
 ReactionWheel InitReactionWheel(ClockGenerator* clock_generator, int actuator_id, std::string file_name, double prop_step, double compo_update_step) {
-  InitParams(actuator_id, file_name, prop_step, compo_update_step);
+  const ReactionWheelParameters parameters = InitParams(actuator_id, file_name, prop_step, compo_update_step);
 
-  ReactionWheel rwmodel(prescaler, fast_prescaler, clock_generator, actuator_id, step_width_s, main_routine_time_step_s, jitter_update_interval_s,
-                        rotor_inertia_kgm2, max_torque_Nm, max_velocity, quaternion_b2c, position_b_m, dead_time_s, ordinary_lag_coef,
-                        coasting_lag_coefficients, is_calc_jitter_enabled, is_log_jitter_enabled, radial_force_harmonics_coefficients,
-                        radial_torque_harmonics_coefficients, structural_resonance_frequency_Hz, damping_factor, bandwidth,
-                        considers_structural_resonance, drive_flag, init_velocity_rad_s);
+  ReactionWheel rwmodel(parameters.prescaler, parameters.fast_prescaler, clock_generator, actuator_id, parameters.step_width_s,
+                        parameters.main_routine_time_step_s, parameters.jitter_update_interval_s, parameters.rotor_inertia_kgm2,
+                        parameters.max_torque_Nm, parameters.max_velocity, parameters.quaternion_b2c, parameters.position_b_m, parameters.dead_time_s,
+                        parameters.ordinary_lag_coef, parameters.coasting_lag_coefficients, parameters.is_calc_jitter_enabled,
+                        parameters.is_log_jitter_enabled, parameters.radial_force_harmonics_coefficients,
+                        parameters.radial_torque_harmonics_coefficients, parameters.structural_resonance_frequency_Hz, parameters.damping_factor,
+                        parameters.bandwidth, parameters.considers_structural_resonance, parameters.drive_flag, parameters.init_velocity_rad_s);
 
   return rwmodel;
 }
 
 ReactionWheel InitReactionWheel(ClockGenerator* clock_generator, PowerPort* power_port, int actuator_id, std::string file_name, double prop_step,
                                 double compo_update_step) {
-  InitParams(actuator_id, file_name, prop_step, compo_update_step);
+  const ReactionWheelParameters parameters = InitParams(actuator_id, file_name, prop_step, compo_update_step);
 
   power_port->InitializeWithInitializeFile(file_name);
 
-  ReactionWheel rwmodel(prescaler, fast_prescaler, clock_generator, power_port, actuator_id, step_width_s, main_routine_time_step_s,
-                        jitter_update_interval_s, rotor_inertia_kgm2, max_torque_Nm, max_velocity, quaternion_b2c, position_b_m, dead_time_s,
-                        ordinary_lag_coef, coasting_lag_coefficients, is_calc_jitter_enabled, is_log_jitter_enabled,
-                        radial_force_harmonics_coefficients, radial_torque_harmonics_coefficients, structural_resonance_frequency_Hz, damping_factor,
-                        bandwidth, considers_structural_resonance, drive_flag, init_velocity_rad_s);
+  ReactionWheel rwmodel(parameters.prescaler, parameters.fast_prescaler, clock_generator, power_port, actuator_id, parameters.step_width_s,
+                        parameters.main_routine_time_step_s, parameters.jitter_update_interval_s, parameters.rotor_inertia_kgm2,
+                        parameters.max_torque_Nm, parameters.max_velocity, parameters.quaternion_b2c, parameters.position_b_m, parameters.dead_time_s,
+                        parameters.ordinary_lag_coef, parameters.coasting_lag_coefficients, parameters.is_calc_jitter_enabled,
+                        parameters.is_log_jitter_enabled, parameters.radial_force_harmonics_coefficients,
+                        parameters.radial_torque_harmonics_coefficients, parameters.structural_resonance_frequency_Hz, parameters.damping_factor,
+                        parameters.bandwidth, parameters.considers_structural_resonance, parameters.drive_flag, parameters.init_velocity_rad_s);
 
   return rwmodel;
 }
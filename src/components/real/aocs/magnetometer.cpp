@@ -45,3 +45,13 @@ std::string Magnetometer::GetLogValue() const {
 
   return str_tmp;
 }
+
+void Magnetometer::SaveSnapshot(Snapshot& snapshot) const {
+  Sensor::SaveSnapshot(snapshot);
+  snapshot.Write(magnetic_field_c_nT_);
+}
+
+void Magnetometer::RestoreSnapshot(Snapshot& snapshot) {
+  Sensor::RestoreSnapshot(snapshot);
+  snapshot.Read(magnetic_field_c_nT_);
+}
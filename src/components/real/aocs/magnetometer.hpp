@@ -9,6 +9,7 @@
 #include <environment/local/local_environment.hpp>
 #include <library/logger/loggable.hpp>
 #include <library/math/quaternion.hpp>
+#include <library/utilities/snapshot.hpp>
 
 #include "../../base/component.hpp"
 #include "../../base/sensor.hpp"
@@ -71,6 +72,17 @@ class Magnetometer : public Component, public Sensor<kMagnetometerDimension>, pu
    */
   virtual std::string GetLogValue() const override;
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the noise states and the observed magnetic field into the snapshot
+   */
+  void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the noise states and the observed magnetic field from the snapshot
+   */
+  void RestoreSnapshot(Snapshot& snapshot);
+
   /**
    * @fn GetMeasuredMagneticField_c_nT
    * @brief Return observed magnetic field on the component frame
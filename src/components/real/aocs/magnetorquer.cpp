@@ -109,3 +109,21 @@ std::string Magnetorquer::GetLogValue() const {
 
   return str_tmp;
 }
+
+void Magnetorquer::SaveSnapshot(Snapshot& snapshot) const {
+  snapshot.Write(torque_b_Nm_);
+  snapshot.Write(output_magnetic_moment_c_Am2_);
+  snapshot.Write(output_magnetic_moment_b_Am2_);
+  snapshot.Write(bias_noise_c_Am2_);
+  random_walk_c_Am2_.SaveSnapshot(snapshot);
+  snapshot.WriteArray(random_noise_c_Am2_, kMtqDimension);
+}
+
+void Magnetorquer::RestoreSnapshot(Snapshot& snapshot) {
+  snapshot.Read(torque_b_Nm_);
+  snapshot.Read(output_magnetic_moment_c_Am2_);
+  snapshot.Read(output_magnetic_moment_b_Am2_);
+  snapshot.Read(bias_noise_c_Am2_);
+  random_walk_c_Am2_.RestoreSnapshot(snapshot);
+  snapshot.ReadArray(random_noise_c_Am2_, kMtqDimension);
+}
@@ -13,6 +13,7 @@
 #include <library/math/vector.hpp>
 #include <library/randomization/normal_randomization.hpp>
 #include <library/randomization/random_walk.hpp>
+#include <library/utilities/snapshot.hpp>
 
 #include "../../base/component.hpp"
 
@@ -96,6 +97,17 @@ class Magnetorquer : public Component, public ILoggable {
    */
   virtual std::string GetLogValue() const override;
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the noise states and the output magnetic moment into the snapshot
+   */
+  void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the noise states and the output magnetic moment from the snapshot
+   */
+  void RestoreSnapshot(Snapshot& snapshot);
+
   /**
    * @fn GetOutputTorque_b_Nm
    * @brief Return output torque in the body fixed frame [Nm]
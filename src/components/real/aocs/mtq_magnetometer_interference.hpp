@@ -6,6 +6,8 @@
 #ifndef S2E_COMPONENTS_REAL_AOCS_MTQ_MAGNETOMETER_INTERFERENCE_HPP_
 #define S2E_COMPONENTS_REAL_AOCS_MTQ_MAGNETOMETER_INTERFERENCE_HPP_
 
+#include <library/utilities/snapshot.hpp>
+
 #include "magnetometer.hpp"
 #include "magnetorquer.hpp"
 
@@ -28,10 +30,21 @@ class MtqMagnetometerInterference {
    */
   void UpdateInterference(void);
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the added bias into the snapshot
+   */
+  inline void SaveSnapshot(Snapshot& snapshot) const { snapshot.Write(previous_added_bias_c_nT_); }
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the added bias from the snapshot. The magnetometer bias restored together includes it.
+   */
+  inline void RestoreSnapshot(Snapshot& snapshot) { snapshot.Read(previous_added_bias_c_nT_); }
+
  protected:
   size_t polynomial_degree_;                                              //!< Polynomial degree
   std::vector<libra::Matrix<3, 3>> additional_bias_by_mtq_coefficients_;  //!< Polynomial coefficients of additional bias noise
-  libra::Vector<3> previous_added_bias_c_nT_{0.0};
+  libra::Vector<3> previous_added_bias_c_nT_{0.0};                        //!< Bias added to the magnetometer at the last update [nT]
 
   Magnetometer& magnetometer_;        //!< Magnetometer
   const Magnetorquer& magnetorquer_;  //!< Magnetorquer
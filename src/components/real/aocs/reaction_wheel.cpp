@@ -220,3 +220,37 @@ std::string ReactionWheel::GetLogValue() const {
 
   return str_tmp;
 }
+
+void ReactionWheel::SaveSnapshot(Snapshot& snapshot) const {
+  snapshot.Write(drive_flag_);
+  snapshot.Write(velocity_limit_rpm_);
+  snapshot.Write(target_acceleration_rad_s2_);
+  snapshot.Write(acceleration_delay_buffer_);
+  snapshot.Write(angular_acceleration_rad_s2_);
+  snapshot.Write(angular_velocity_rpm_);
+  snapshot.Write(angular_velocity_rad_s_);
+  snapshot.Write(output_torque_b_Nm_);
+  snapshot.Write(angular_momentum_b_Nms_);
+  // The lag coefficients and the target of the ODE are set again in CalcTorque
+  snapshot.Write(ode_angular_velocity_.GetIndependentVariable());
+  snapshot.Write(ode_angular_velocity_.GetState());
+  rw_jitter_.SaveSnapshot(snapshot);
+}
+
+void ReactionWheel::RestoreSnapshot(Snapshot& snapshot) {
+  snapshot.Read(drive_flag_);
+  snapshot.Read(velocity_limit_rpm_);
+  snapshot.Read(target_acceleration_rad_s2_);
+  snapshot.Read(acceleration_delay_buffer_);
+  snapshot.Read(angular_acceleration_rad_s2_);
+  snapshot.Read(angular_velocity_rpm_);
+  snapshot.Read(angular_velocity_rad_s_);
+  snapshot.Read(output_torque_b_Nm_);
+  snapshot.Read(angular_momentum_b_Nms_);
+  double independent_variable = ode_angular_velocity_.GetIndependentVariable();
+  Vector<1> state(ode_angular_velocity_.GetAngularVelocity_rad_s());
+  snapshot.Read(independent_variable);
+  snapshot.Read(state);
+  ode_angular_velocity_.Setup(independent_variable, state);
+  rw_jitter_.RestoreSnapshot(snapshot);
+}
@@ -9,6 +9,7 @@
 #include <library/logger/loggable.hpp>
 #include <library/logger/logger.hpp>
 #include <library/math/vector.hpp>
+#include <library/utilities/snapshot.hpp>
 #include <limits>
 #include <string>
 #include <vector>
@@ -132,6 +133,17 @@ class ReactionWheel : public Component, public ILoggable {
    */
   virtual std::string GetLogValue() const override;
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the rotor states, the control delay buffer, and the jitter states into the snapshot
+   */
+  void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the rotor states, the control delay buffer, and the jitter states from the snapshot
+   */
+  void RestoreSnapshot(Snapshot& snapshot);
+
   // Getter
   /**
    * @fn GetOutputTorque_b_Nm
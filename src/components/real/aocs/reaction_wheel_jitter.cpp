@@ -126,3 +126,41 @@ void ReactionWheelJitter::CalcCoefficients() {
   coefficients_[5] = 4.0 - 4.0 * damping_factor_ * update_interval_s_ * structural_resonance_angular_frequency_Hz_ +
                      pow(update_interval_s_, 2.0) * pow(structural_resonance_angular_frequency_Hz_, 2.0);
 }
+
+void ReactionWheelJitter::SaveSnapshot(Snapshot& snapshot) const {
+  snapshot.Write(jitter_force_rotation_phase_);
+  snapshot.Write(jitter_torque_rotation_phase_);
+  snapshot.Write(unfiltered_jitter_force_n_c_);
+  snapshot.Write(unfiltered_jitter_force_n_1_c_);
+  snapshot.Write(unfiltered_jitter_force_n_2_c_);
+  snapshot.Write(unfiltered_jitter_torque_n_c_);
+  snapshot.Write(unfiltered_jitter_torque_n_1_c_);
+  snapshot.Write(unfiltered_jitter_torque_n_2_c_);
+  snapshot.Write(filtered_jitter_force_n_c_);
+  snapshot.Write(filtered_jitter_force_n_1_c_);
+  snapshot.Write(filtered_jitter_force_n_2_c_);
+  snapshot.Write(filtered_jitter_torque_n_c_);
+  snapshot.Write(filtered_jitter_torque_n_1_c_);
+  snapshot.Write(filtered_jitter_torque_n_2_c_);
+  snapshot.Write(jitter_force_b_N_);
+  snapshot.Write(jitter_torque_b_Nm_);
+}
+
+void ReactionWheelJitter::RestoreSnapshot(Snapshot& snapshot) {
+  snapshot.Read(jitter_force_rotation_phase_);
+  snapshot.Read(jitter_torque_rotation_phase_);
+  snapshot.Read(unfiltered_jitter_force_n_c_);
+  snapshot.Read(unfiltered_jitter_force_n_1_c_);
+  snapshot.Read(unfiltered_jitter_force_n_2_c_);
+  snapshot.Read(unfiltered_jitter_torque_n_c_);
+  snapshot.Read(unfiltered_jitter_torque_n_1_c_);
+  snapshot.Read(unfiltered_jitter_torque_n_2_c_);
+  snapshot.Read(filtered_jitter_force_n_c_);
+  snapshot.Read(filtered_jitter_force_n_1_c_);
+  snapshot.Read(filtered_jitter_force_n_2_c_);
+  snapshot.Read(filtered_jitter_torque_n_c_);
+  snapshot.Read(filtered_jitter_torque_n_1_c_);
+  snapshot.Read(filtered_jitter_torque_n_2_c_);
+  snapshot.Read(jitter_force_b_N_);
+  snapshot.Read(jitter_torque_b_Nm_);
+}
@@ -9,6 +9,7 @@
 #pragma once
 #include <library/math/quaternion.hpp>
 #include <library/math/vector.hpp>
+#include <library/utilities/snapshot.hpp>
 #include <vector>
 
 /*
@@ -71,6 +72,17 @@ class ReactionWheelJitter {
     return considers_structural_resonance_ ? filtered_jitter_torque_n_c_ : unfiltered_jitter_torque_n_c_;
   }
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the rotation phases and the difference equation states into the snapshot
+   */
+  void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the rotation phases and the difference equation states from the snapshot
+   */
+  void RestoreSnapshot(Snapshot& snapshot);
+
  private:
   std::vector<std::vector<double>> radial_force_harmonics_coefficients_;   //!< Coefficients for radial force harmonics
   std::vector<std::vector<double>> radial_torque_harmonics_coefficients_;  //!< Coefficients for radial torque harmonics
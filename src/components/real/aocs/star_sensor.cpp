@@ -68,6 +68,11 @@ StarSensor::StarSensor(const int prescaler, ClockGenerator* clock_generator, Pow
 void StarSensor::Initialize() {
   measured_quaternion_i2c_ = libra::Quaternion(0.0, 0.0, 0.0, 1.0);
 
+  const LocalCelestialInformation& local_celestial_information = local_environment_->GetCelestialInformation();
+  sun_handle_ = local_celestial_information.GetBodyHandle("SUN");
+  earth_handle_ = local_celestial_information.GetBodyHandle("EARTH");
+  moon_handle_ = local_celestial_information.GetBodyHandle("MOON");
+
   // Decide delay buffer size
   max_delay_ = int(output_delay_ * 2 / step_time_s_);
   if (max_delay_ <= 0) max_delay_ = 1;
@@ -126,9 +131,9 @@ void StarSensor::update(const LocalCelestialInformation* local_celestial_informa
 
 void StarSensor::AllJudgement(const LocalCelestialInformation* local_celestial_information, const Attitude* attitude) {
   int judgement = 0;
-  judgement = SunJudgement(local_celestial_information->GetPositionFromSpacecraft_b_m("SUN"));
-  judgement += EarthJudgement(local_celestial_information->GetPositionFromSpacecraft_b_m("EARTH"));
-  judgement += MoonJudgement(local_celestial_information->GetPositionFromSpacecraft_b_m("MOON"));
+  judgement = SunJudgement(local_celestial_information->GetPositionFromSpacecraft_b_m(sun_handle_));
+  judgement += EarthJudgement(local_celestial_information->GetPositionFromSpacecraft_b_m(earth_handle_));
+  judgement += MoonJudgement(local_celestial_information->GetPositionFromSpacecraft_b_m(moon_handle_));
   judgement += CaptureRateJudgement(attitude->GetAngularVelocity_b_rad_s());
   if (judgement > 0)
     error_flag_ = true;
@@ -197,6 +202,28 @@ std::string StarSensor::GetLogValue() const {
   return str_tmp;
 }
 
+void StarSensor::SaveSnapshot(Snapshot& snapshot) const {
+  snapshot.Write(measured_quaternion_i2c_);
+  snapshot.Write(rotation_noise_);
+  snapshot.Write(orthogonal_direction_noise_);
+  snapshot.Write(sight_direction_noise_);
+  snapshot.Write(delay_buffer_);
+  snapshot.Write(buffer_position_);
+  snapshot.Write(update_count_);
+  snapshot.Write(error_flag_);
+}
+
+void StarSensor::RestoreSnapshot(Snapshot& snapshot) {
+  snapshot.Read(measured_quaternion_i2c_);
+  snapshot.Read(rotation_noise_);
+  snapshot.Read(orthogonal_direction_noise_);
+  snapshot.Read(sight_direction_noise_);
+  snapshot.Read(delay_buffer_);
+  snapshot.Read(buffer_position_);
+  snapshot.Read(update_count_);
+  snapshot.Read(error_flag_);
+}
+
 double StarSensor::CalAngleVector_rad(const Vector<3>& vector1, const Vector<3>& vector2) {
   libra::Vector<3> vect1_normal = vector1.CalcNormalizedVector();
   libra::Vector<3> vect2_normal = vector2.CalcNormalizedVector();
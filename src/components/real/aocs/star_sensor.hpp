@@ -13,6 +13,7 @@
 #include <library/math/vector.hpp>
 #include <library/randomization/minimal_standard_linear_congruential_generator_with_shuffle.hpp>
 #include <library/randomization/normal_randomization.hpp>
+#include <library/utilities/snapshot.hpp>
 #include <vector>
 
 #include "../../base/component.hpp"
@@ -94,6 +95,17 @@ class StarSensor : public Component, public ILoggable {
    */
   virtual std::string GetLogValue() const override;
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the noise states, the delay buffer, and the observed quaternion into the snapshot
+   */
+  void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the noise states, the delay buffer, and the observed quaternion from the snapshot
+   */
+  void RestoreSnapshot(Snapshot& snapshot);
+
   /**
    * @fn GetMeasuredQuaternion_i2c
    * @brief Return observed quaternion from the inertial frame to the component frame
@@ -138,6 +150,9 @@ class StarSensor : public Component, public ILoggable {
   // Observed variables
   const Dynamics* dynamics_;                   //!< Dynamics information
   const LocalEnvironment* local_environment_;  //!< Local environment information
+  CelestialBodyHandle sun_handle_;             //!< Handle of the sun
+  CelestialBodyHandle earth_handle_;           //!< Handle of the earth
+  CelestialBodyHandle moon_handle_;            //!< Handle of the moon
 
   // Internal functions
   /**
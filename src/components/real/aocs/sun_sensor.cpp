@@ -42,6 +42,8 @@ SunSensor::SunSensor(const int prescaler, ClockGenerator* clock_generator, Power
 }
 
 void SunSensor::Initialize(const double random_noise_standard_deviation_rad, const double bias_noise_standard_deviation_rad) {
+  sun_handle_ = local_celestial_information_->GetBodyHandle("SUN");
+
   // Bias
   NormalRand nr(0.0, bias_noise_standard_deviation_rad, global_randomization.MakeSeed());
   bias_noise_alpha_rad_ += nr;
@@ -58,7 +60,7 @@ void SunSensor::MainRoutine(const int time_count) {
 }
 
 void SunSensor::Measure() {
-  libra::Vector<3> sun_pos_b = local_celestial_information_->GetPositionFromSpacecraft_b_m("SUN");
+  libra::Vector<3> sun_pos_b = local_celestial_information_->GetPositionFromSpacecraft_b_m(sun_handle_);
   libra::Vector<3> sun_dir_b = sun_pos_b.CalcNormalizedVector();
 
   sun_direction_true_c_ = quaternion_b2c_.FrameConversion(sun_dir_b);  // Frame conversion from body to component
@@ -149,3 +151,27 @@ string SunSensor::GetLogValue() const {
 
   return str_tmp;
 }
+
+void SunSensor::SaveSnapshot(Snapshot& snapshot) const {
+  snapshot.Write(sun_direction_true_c_);
+  snapshot.Write(measured_sun_direction_c_);
+  snapshot.Write(alpha_rad_);
+  snapshot.Write(beta_rad_);
+  snapshot.Write(sun_detected_flag_);
+  snapshot.Write(random_noise_alpha_);
+  snapshot.Write(random_noise_beta_);
+  snapshot.Write(bias_noise_alpha_rad_);
+  snapshot.Write(bias_noise_beta_rad_);
+}
+
+void SunSensor::RestoreSnapshot(Snapshot& snapshot) {
+  snapshot.Read(sun_direction_true_c_);
+  snapshot.Read(measured_sun_direction_c_);
+  snapshot.Read(alpha_rad_);
+  snapshot.Read(beta_rad_);
+  snapshot.Read(sun_detected_flag_);
+  snapshot.Read(random_noise_alpha_);
+  snapshot.Read(random_noise_beta_);
+  snapshot.Read(bias_noise_alpha_rad_);
+  snapshot.Read(bias_noise_beta_rad_);
+}
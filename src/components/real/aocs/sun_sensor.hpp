@@ -12,6 +12,7 @@
 #include <library/math/quaternion.hpp>
 #include <library/math/vector.hpp>
 #include <library/randomization/normal_randomization.hpp>
+#include <library/utilities/snapshot.hpp>
 
 #include "../../base/component.hpp"
 
@@ -78,6 +79,17 @@ class SunSensor : public Component, public ILoggable {
    */
   virtual std::string GetLogValue() const override;
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the noise states and the observed sun direction into the snapshot
+   */
+  void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the noise states and the observed sun direction from the snapshot
+   */
+  void RestoreSnapshot(Snapshot& snapshot);
+
   // Getter
   inline bool GetSunDetectedFlag() const { return sun_detected_flag_; };
   inline const libra::Vector<3> GetMeasuredSunDirection_c() const { return measured_sun_direction_c_; };
@@ -108,6 +120,7 @@ class SunSensor : public Component, public ILoggable {
   // Measured variables
   const SolarRadiationPressureEnvironment* srp_environment_;      //!< Solar Radiation Pressure environment
   const LocalCelestialInformation* local_celestial_information_;  //!< Local celestial information
+  CelestialBodyHandle sun_handle_;                                //!< Handle of the sun
 
   // functions
   /**
@@ -0,0 +1,214 @@
+/**
+ * @file test_gnss_receiver.cpp
+ * @brief Test codes for the cone antenna model and the snapshot of GnssReceiver class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <ctime>
+#include <environment/global/clock_generator.hpp>
+#include <environment/global/physical_constants.hpp>
+#include <library/math/constants.hpp>
+#include <vector>
+
+#include "gnss_receiver.hpp"
+
+/**
+ * @class GnssReceiverConeTest
+ * @brief GnssReceiver to call the cone model directly
+ */
+class GnssReceiverConeTest : public GnssReceiver {
+ public:
+  using GnssReceiver::CheckAntennaCone;
+  using GnssReceiver::GnssReceiver;
+  inline int GetVisibleSatelliteNumber() const { return visible_satellite_number_; }
+  inline int GetIsGnssVisible() const { return is_gnss_visible_; }
+};
+
+/**
+ * @class GnssReceiverConeFixture
+ * @brief Fixture with three GPS satellites fixed in the ECEF frame and a receiver with the antenna cone of 10 deg
+ */
+class GnssReceiverConeFixture : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    simulation_time_ = new SimulationTime(86400.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, "2023/01/01 00:00:00.0", 0.0);
+    tm start_tm = {};
+    start_tm.tm_year = 2023 - 1900;
+    start_tm.tm_mon = 0;
+    start_tm.tm_mday = 1;
+    const double start_unix_time = (double)mktime(&start_tm);
+
+    // G01, G02, and G03 on the X, Y, and Z axes of the ECEF frame
+    GnssProductFile file;
+    file.format = GnssProductFileFormat::kSp3;
+    file.time_interval_s = 900.0;
+    file.number_of_epochs = 24;
+    file.number_of_satellites = 3;
+    for (int epoch_index = 0; epoch_index < file.number_of_epochs; epoch_index++) {
+      GnssProductEpoch epoch;
+      epoch.unix_time = start_unix_time + (epoch_index - 12) * file.time_interval_s;
+      epoch.greenwich_sidereal_time_rad = 0.0;
+      epoch.record_begin = file.records.size();
+      for (int gnss_satellite_id = 0; gnss_satellite_id < file.number_of_satellites; gnss_satellite_id++) {
+        GnssProductRecord record = {gnss_satellite_id, 0, {0.0, 0.0, 0.0}, 100.0};
+        record.position_km[gnss_satellite_id] = 26560.0;
+        file.records.push_back(record);
+      }
+      epoch.record_end = file.records.size();
+      file.epochs.push_back(epoch);
+    }
+    const std::vector<GnssProductFile> files = {file};
+    gnss_satellites_ = new GnssSatellites(true);
+    gnss_satellites_->Init(files, 0, 9, kNotUse, files, ".sp3", 3, kNotUse, files, 0, 9, kNotUse, files, ".sp3", 3, kNotUse);
+    gnss_satellites_->SetUp(simulation_time_);
+
+    // The antenna is placed at the origin of the body frame, and directs +Z of the body frame
+    receiver_ = new GnssReceiverConeTest(1, &clock_generator_, 0, "G", 8, AntennaModel::kCone, libra::Vector<3>(0.0),
+                                         libra::Quaternion(0.0, 0.0, 0.0, 1.0), 10.0, libra::Vector<3>(0.0), nullptr, gnss_satellites_,
+                                         simulation_time_);
+  }
+  void TearDown() override {
+    delete receiver_;
+    delete gnss_satellites_;
+    delete simulation_time_;
+  }
+
+  /**
+   * @brief Return the receiver position whose line of sight to the GNSS satellite passes the earth center at the closest distance
+   * @param [in] satellite_position_i_m: Position of the GNSS satellite in the ECI frame [m]
+   * @param [in] closest_distance_m: Closest distance of the line of sight from the earth center [m]
+   * @param [in] radius_m: Distance of the receiver from the earth center [m]
+   */
+  static libra::Vector<3> CalcReceiverPosition_i_m(const libra::Vector<3> satellite_position_i_m, const double closest_distance_m,
+                                                  const double radius_m) {
+    // Unit vectors u to the GNSS satellite and v perpendicular to it
+    const libra::Vector<3> u = satellite_position_i_m.CalcNormalizedVector();
+    const libra::Vector<3> v = libra::GenerateOrthogonalUnitVector(u);
+    // The line of sight passes the closest point c along w
+    const double cos_angle = closest_distance_m / satellite_position_i_m.CalcNorm();
+    const double sin_angle = sqrt(1.0 - cos_angle * cos_angle);
+    const libra::Vector<3> c = closest_distance_m * (cos_angle * u + sin_angle * v);
+    const libra::Vector<3> w = -sin_angle * u + cos_angle * v;
+    // The GNSS satellite is at the negative side of w, and the receiver is at the positive side
+    return c + sqrt(radius_m * radius_m - closest_distance_m * closest_distance_m) * w;
+  }
+  /**
+   * @brief Check the cone model with the attitude whose antenna directs the rotated direction from the receiver to the GNSS satellite
+   * @param [in] receiver_position_i_m: Position of the receiver in the ECI frame [m]
+   * @param [in] satellite_position_i_m: Position of the GNSS satellite in the ECI frame [m]
+   * @param [in] pointing_error_deg: Angle between the antenna direction and the GNSS satellite [deg]
+   */
+  void CheckAntennaCone(const libra::Vector<3> receiver_position_i_m, const libra::Vector<3> satellite_position_i_m,
+                        const double pointing_error_deg) {
+    const libra::Vector<3> line_of_sight_i = satellite_position_i_m - receiver_position_i_m;
+    const libra::Vector<3> axis_i = libra::OuterProduct(line_of_sight_i, receiver_position_i_m).CalcNormalizedVector();
+    const libra::Quaternion error(axis_i, pointing_error_deg * libra::deg_to_rad);
+    const libra::Vector<3> antenna_direction_i = error.InverseFrameConversion(line_of_sight_i);
+    libra::Vector<3> antenna_direction_b(0.0);
+    antenna_direction_b[2] = 1.0;
+    const libra::Quaternion quaternion_i2b(antenna_direction_b, antenna_direction_i);
+    receiver_->CheckAntennaCone(receiver_position_i_m, quaternion_i2b);
+  }
+
+  ClockGenerator clock_generator_;
+  SimulationTime* simulation_time_;
+  GnssSatellites* gnss_satellites_;
+  GnssReceiverConeTest* receiver_;
+};
+
+/**
+ * @brief Test for the GNSS satellite hidden by the earth
+ */
+TEST_F(GnssReceiverConeFixture, BehindEarth) {
+  const libra::Vector<3> satellite_position_i_m = gnss_satellites_->GetSatellitePositionEci(0);
+  ASSERT_NEAR(26560.0e3, satellite_position_i_m.CalcNorm(), 1.0e-3);
+
+  // The receiver at the opposite side of the earth
+  const libra::Vector<3> receiver_position_i_m = -7000.0e3 / satellite_position_i_m.CalcNorm() * satellite_position_i_m;
+  CheckAntennaCone(receiver_position_i_m, satellite_position_i_m, 0.0);
+  EXPECT_EQ(0, receiver_->GetVisibleSatelliteNumber());
+  EXPECT_EQ(0, receiver_->GetIsGnssVisible());
+
+  // The line of sight passes 100 km below the limb
+  const double earth_radius_m = environment::earth_equatorial_radius_m;
+  CheckAntennaCone(CalcReceiverPosition_i_m(satellite_position_i_m, earth_radius_m - 100.0e3, 7000.0e3), satellite_position_i_m, 0.0);
+  EXPECT_EQ(0, receiver_->GetVisibleSatelliteNumber());
+  EXPECT_EQ(0, receiver_->GetIsGnssVisible());
+}
+
+/**
+ * @brief Test for the GNSS satellite above the limb
+ */
+TEST_F(GnssReceiverConeFixture, AboveLimb) {
+  const double earth_radius_m = environment::earth_equatorial_radius_m;
+  for (int gnss_satellite_id = 0; gnss_satellite_id < 3; gnss_satellite_id++) {
+    const libra::Vector<3> satellite_position_i_m = gnss_satellites_->GetSatellitePositionEci(gnss_satellite_id);
+    // The line of sight passes 100 km above the limb, and the GNSS satellite is below the local horizon of the receiver
+    const libra::Vector<3> receiver_position_i_m = CalcReceiverPosition_i_m(satellite_position_i_m, earth_radius_m + 100.0e3, 7000.0e3);
+    ASSERT_LT(libra::InnerProduct(receiver_position_i_m, satellite_position_i_m - receiver_position_i_m), 0.0);
+
+    CheckAntennaCone(receiver_position_i_m, satellite_position_i_m, 0.0);
+    ASSERT_EQ(1, receiver_->GetVisibleSatelliteNumber());
+    EXPECT_EQ(1, receiver_->GetIsGnssVisible());
+    const GnssInfo gnss_info = receiver_->GetGnssInfo(0);
+    EXPECT_EQ(gnss_satellites_->GetIDFromIndex(gnss_satellite_id), gnss_info.ID);
+    EXPECT_NEAR((satellite_position_i_m - receiver_position_i_m).CalcNorm(), gnss_info.distance_m, 1.0e-6);
+    // The GNSS satellite is on the antenna boresight
+    EXPECT_NEAR(libra::pi_2, gnss_info.latitude_rad, 1.0e-6);
+
+    // The receiver above the GNSS satellite
+    CheckAntennaCone(1.1 * satellite_position_i_m, satellite_position_i_m, 0.0);
+    EXPECT_EQ(1, receiver_->GetVisibleSatelliteNumber());
+  }
+}
+
+/**
+ * @brief Test for the GNSS satellite outside of the antenna cone
+ */
+TEST_F(GnssReceiverConeFixture, OutsideCone) {
+  const double earth_radius_m = environment::earth_equatorial_radius_m;
+  const libra::Vector<3> satellite_position_i_m = gnss_satellites_->GetSatellitePositionEci(1);
+  const libra::Vector<3> receiver_position_i_m = CalcReceiverPosition_i_m(satellite_position_i_m, earth_radius_m + 100.0e3, 7000.0e3);
+
+  // Inside and outside of the half width of 10 deg
+  CheckAntennaCone(receiver_position_i_m, satellite_position_i_m, 9.0);
+  EXPECT_EQ(1, receiver_->GetVisibleSatelliteNumber());
+  CheckAntennaCone(receiver_position_i_m, satellite_position_i_m, 11.0);
+  EXPECT_EQ(0, receiver_->GetVisibleSatelliteNumber());
+  EXPECT_EQ(0, receiver_->GetIsGnssVisible());
+  CheckAntennaCone(receiver_position_i_m, satellite_position_i_m, -11.0);
+  EXPECT_EQ(0, receiver_->GetVisibleSatelliteNumber());
+
+  // The antenna directs the opposite direction
+  CheckAntennaCone(receiver_position_i_m, satellite_position_i_m, 180.0);
+  EXPECT_EQ(0, receiver_->GetVisibleSatelliteNumber());
+}
+
+/**
+ * @brief Test for the snapshot of the visible GNSS satellite information
+ */
+TEST_F(GnssReceiverConeFixture, Snapshot) {
+  const double earth_radius_m = environment::earth_equatorial_radius_m;
+  const libra::Vector<3> satellite_position_i_m = gnss_satellites_->GetSatellitePositionEci(2);
+  const libra::Vector<3> receiver_position_i_m = CalcReceiverPosition_i_m(satellite_position_i_m, earth_radius_m + 100.0e3, 7000.0e3);
+  CheckAntennaCone(receiver_position_i_m, satellite_position_i_m, 0.0);
+  ASSERT_EQ(1, receiver_->GetVisibleSatelliteNumber());
+  const GnssInfo gnss_info = receiver_->GetGnssInfo(0);
+
+  Snapshot snapshot;
+  receiver_->SaveSnapshot(snapshot);
+  CheckAntennaCone(receiver_position_i_m, satellite_position_i_m, 180.0);
+  ASSERT_EQ(0, receiver_->GetVisibleSatelliteNumber());
+
+  snapshot.Rewind();
+  receiver_->RestoreSnapshot(snapshot);
+  EXPECT_TRUE(snapshot.IsEnd());
+  EXPECT_EQ(1, receiver_->GetVisibleSatelliteNumber());
+  EXPECT_EQ(1, receiver_->GetIsGnssVisible());
+  const GnssInfo restored_gnss_info = receiver_->GetGnssInfo(0);
+  EXPECT_EQ(gnss_info.ID, restored_gnss_info.ID);
+  EXPECT_EQ(gnss_info.latitude_rad, restored_gnss_info.latitude_rad);
+  EXPECT_EQ(gnss_info.longitude_rad, restored_gnss_info.longitude_rad);
+  EXPECT_EQ(gnss_info.distance_m, restored_gnss_info.distance_m);
+}
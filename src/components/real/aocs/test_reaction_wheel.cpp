@@ -0,0 +1,71 @@
+/**
+ * @file test_reaction_wheel.cpp
+ * @brief Test codes for the snapshot of ReactionWheel class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <environment/global/clock_generator.hpp>
+#include <vector>
+
+#include "reaction_wheel.hpp"
+
+/**
+ * @brief Make a reaction wheel with the jitter and the structural resonance
+ * @param [in] clock_generator: Clock generator
+ */
+static ReactionWheel* MakeReactionWheel(ClockGenerator* clock_generator) {
+  const std::vector<std::vector<double>> radial_force_harmonics_coefficients = {{1.0, 1.0e-6}, {2.0, 5.0e-7}};
+  const std::vector<std::vector<double>> radial_torque_harmonics_coefficients = {{1.0, 1.0e-7}, {3.0, 2.0e-8}};
+  libra::Vector<3> driving_lag_coefficients(0.0);
+  driving_lag_coefficients[0] = 1.0;
+  driving_lag_coefficients[1] = 0.1;
+  libra::Vector<3> coasting_lag_coefficients(0.0);
+  coasting_lag_coefficients[0] = 1.0;
+  coasting_lag_coefficients[1] = 10.0;
+  return new ReactionWheel(1, 1, clock_generator, 0, 0.01, 0.1, 0.1, 1.0e-4, 0.01, 6000.0, libra::Quaternion(0.0, 0.0, 0.0, 1.0),
+                           libra::Vector<3>(0.0), 0.3, driving_lag_coefficients, coasting_lag_coefficients, true, false,
+                           radial_force_harmonics_coefficients, radial_torque_harmonics_coefficients, 100.0, 0.1, 1.0, true, true, 10.0);
+}
+
+/**
+ * @brief Run the reaction wheel and return the angular velocities, the jitter forces, and the output torques
+ * @param [in] reaction_wheel: Reaction wheel
+ * @param [in] number_of_steps: Number of steps
+ */
+static std::vector<double> RunReactionWheel(ReactionWheel& reaction_wheel, const int number_of_steps) {
+  std::vector<double> outputs;
+  for (int step = 0; step < number_of_steps; step++) {
+    reaction_wheel.SetTargetTorque_rw_Nm(step < number_of_steps / 2 ? 0.005 : -0.002);
+    reaction_wheel.MainRoutine(step);
+    reaction_wheel.FastUpdate();
+    outputs.push_back(reaction_wheel.GetAngularVelocity_rad_s());
+    for (size_t axis = 0; axis < 3; axis++) {
+      outputs.push_back(reaction_wheel.GetJitterForce_b_N()[axis]);
+      outputs.push_back(reaction_wheel.GetOutputTorque_b_Nm()[axis]);
+    }
+  }
+  return outputs;
+}
+
+/**
+ * @brief Test for the branch restored into the reaction wheel with the different initial jitter phases
+ */
+TEST(ReactionWheel, Snapshot) {
+  ClockGenerator clock_generator;
+  ReactionWheel* reaction_wheel = MakeReactionWheel(&clock_generator);
+  ReactionWheel* restored_reaction_wheel = MakeReactionWheel(&clock_generator);
+
+  // The control delay buffer and the jitter filter have states at the branch time
+  RunReactionWheel(*reaction_wheel, 7);
+  Snapshot snapshot;
+  reaction_wheel->SaveSnapshot(snapshot);
+  const std::vector<double> outputs = RunReactionWheel(*reaction_wheel, 20);
+
+  snapshot.Rewind();
+  restored_reaction_wheel->RestoreSnapshot(snapshot);
+  EXPECT_TRUE(snapshot.IsEnd());
+  EXPECT_EQ(outputs, RunReactionWheel(*restored_reaction_wheel, 20));
+
+  delete reaction_wheel;
+  delete restored_reaction_wheel;
+}
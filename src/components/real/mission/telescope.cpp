@@ -28,6 +28,10 @@ Telescope::Telescope(ClockGenerator* clock_generator, const libra::Quaternion& q
       attitude_(attitude),
       hipparcos_(hipparcos),
       local_celestial_information_(local_celestial_information) {
+  sun_handle_ = local_celestial_information_->GetBodyHandle("SUN");
+  earth_handle_ = local_celestial_information_->GetBodyHandle("EARTH");
+  moon_handle_ = local_celestial_information_->GetBodyHandle("MOON");
+
   is_sun_in_forbidden_angle = true;
   is_earth_in_forbidden_angle = true;
   is_moon_in_forbidden_angle = true;
@@ -36,6 +40,8 @@ Telescope::Telescope(ClockGenerator* clock_generator, const libra::Quaternion& q
   y_field_of_view_rad = y_number_of_pix_ * y_fov_per_pix_;
   assert(x_field_of_view_rad < libra::pi_2);  // Avoid the case that the field of view is over 90 degrees
   assert(y_field_of_view_rad < libra::pi_2);
+  // Angle to the corner of the field of view
+  star_search_angle_rad_ = atan(sqrt(pow(tan(x_field_of_view_rad), 2.0) + pow(tan(y_field_of_view_rad), 2.0)));
 
   sight_direction_c_ = Vector<3>(0);
   sight_direction_c_[0] = 1;  // (1,0,0) at component frame, Sight direction vector
@@ -59,13 +65,15 @@ Telescope::~Telescope() {}
 void Telescope::MainRoutine(const int time_count) {
   UNUSED(time_count);
   // Check forbidden angle
-  is_sun_in_forbidden_angle = JudgeForbiddenAngle(local_celestial_information_->GetPositionFromSpacecraft_b_m("SUN"), sun_forbidden_angle_rad_);
-  is_earth_in_forbidden_angle = JudgeForbiddenAngle(local_celestial_information_->GetPositionFromSpacecraft_b_m("EARTH"), earth_forbidden_angle_rad_);
-  is_moon_in_forbidden_angle = JudgeForbiddenAngle(local_celestial_information_->GetPositionFromSpacecraft_b_m("MOON"), moon_forbidden_angle_rad_);
+  is_sun_in_forbidden_angle = JudgeForbiddenAngle(local_celestial_information_->GetPositionFromSpacecraft_b_m(sun_handle_), sun_forbidden_angle_rad_);
+  is_earth_in_forbidden_angle =
+      JudgeForbiddenAngle(local_celestial_information_->GetPositionFromSpacecraft_b_m(earth_handle_), earth_forbidden_angle_rad_);
+  is_moon_in_forbidden_angle =
+      JudgeForbiddenAngle(local_celestial_information_->GetPositionFromSpacecraft_b_m(moon_handle_), moon_forbidden_angle_rad_);
   // Position calculation of celestial bodies from CelesInfo
-  Observe(sun_position_image_sensor, local_celestial_information_->GetPositionFromSpacecraft_b_m("SUN"));
-  Observe(earth_position_image_sensor, local_celestial_information_->GetPositionFromSpacecraft_b_m("EARTH"));
-  Observe(moon_position_image_sensor, local_celestial_information_->GetPositionFromSpacecraft_b_m("MOON"));
+  Observe(sun_position_image_sensor, local_celestial_information_->GetPositionFromSpacecraft_b_m(sun_handle_));
+  Observe(earth_position_image_sensor, local_celestial_information_->GetPositionFromSpacecraft_b_m(earth_handle_));
+  Observe(moon_position_image_sensor, local_celestial_information_->GetPositionFromSpacecraft_b_m(moon_handle_));
   // Position calculation of stars from Hipparcos Catalogue
   // No update when Hipparocos Catalogue was not readed
   if (hipparcos_->IsCalcEnabled) ObserveStars();
@@ -107,10 +115,15 @@ void Telescope::ObserveStars() {
   Quaternion quaternion_i2b = attitude_->GetQuaternion_i2b();
 
   star_list_in_sight.clear();  // Clear first
-  size_t count = 0;            // Counter for while loop
 
-  while (star_list_in_sight.size() < number_of_logged_stars_) {
-    libra::Vector<3> target_b = hipparcos_->GetStarDirection_b(count, quaternion_i2b);
+  // Only the stars near the sight direction are tested in ascending order of the magnitude
+  const libra::Vector<3> sight_i = quaternion_i2b.InverseFrameConversion(quaternion_b2c_.InverseFrameConversion(sight_direction_c_));
+  const std::vector<size_t> candidates = hipparcos_->FindStarsInCone(sight_i, star_search_angle_rad_);
+
+  for (const size_t rank : candidates) {
+    if (star_list_in_sight.size() >= number_of_logged_stars_) break;
+
+    libra::Vector<3> target_b = hipparcos_->GetStarDirection_b(rank, quaternion_i2b);
     libra::Vector<3> target_c = quaternion_b2c_.FrameConversion(target_b);
 
     double arg_x = atan2(target_c[2], target_c[0]);  // Angle from X-axis on XZ plane in the component frame
@@ -118,34 +131,28 @@ void Telescope::ObserveStars() {
 
     if (abs(arg_x) <= x_field_of_view_rad && abs(arg_y) <= y_field_of_view_rad) {
       Star star;
-      star.hipparcos_data.hipparcos_id = hipparcos_->GetHipparcosId(count);
-      star.hipparcos_data.visible_magnitude = hipparcos_->GetVisibleMagnitude(count);
-      star.hipparcos_data.right_ascension_deg = hipparcos_->GetRightAscension_deg(count);
-      star.hipparcos_data.declination_deg = hipparcos_->GetDeclination_deg(count);
+      star.hipparcos_data.hipparcos_id = hipparcos_->GetHipparcosId(rank);
+      star.hipparcos_data.visible_magnitude = hipparcos_->GetVisibleMagnitude(rank);
+      star.hipparcos_data.right_ascension_deg = hipparcos_->GetRightAscension_deg(rank);
+      star.hipparcos_data.declination_deg = hipparcos_->GetDeclination_deg(rank);
       star.position_image_sensor[0] = x_number_of_pix_ / 2.0 * tan(arg_x) / tan(x_field_of_view_rad) + x_number_of_pix_ / 2.0;
       star.position_image_sensor[1] = y_number_of_pix_ / 2.0 * tan(arg_y) / tan(y_field_of_view_rad) + y_number_of_pix_ / 2.0;
 
       star_list_in_sight.push_back(star);
     }
+  }
 
-    count++;
-
-    // If read all catalogue, fill -1 and break the loop
-    if (count >= hipparcos_->GetCatalogueSize()) {
-      while (star_list_in_sight.size() < number_of_logged_stars_) {
-        Star star;
-        star.hipparcos_data.hipparcos_id = -1;
-        star.hipparcos_data.visible_magnitude = -1;
-        star.hipparcos_data.right_ascension_deg = -1;
-        star.hipparcos_data.declination_deg = -1;
-        star.position_image_sensor[0] = -1;
-        star.position_image_sensor[1] = -1;
-
-        star_list_in_sight.push_back(star);
-      }
+  // If not enough stars are in sight, fill -1
+  while (star_list_in_sight.size() < number_of_logged_stars_) {
+    Star star;
+    star.hipparcos_data.hipparcos_id = -1;
+    star.hipparcos_data.visible_magnitude = -1;
+    star.hipparcos_data.right_ascension_deg = -1;
+    star.hipparcos_data.declination_deg = -1;
+    star.position_image_sensor[0] = -1;
+    star.position_image_sensor[1] = -1;
 
-      break;
-    }
+    star_list_in_sight.push_back(star);
   }
 }
 
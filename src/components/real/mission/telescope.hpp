@@ -72,12 +72,13 @@ class Telescope : public Component, public ILoggable {
   double earth_forbidden_angle_rad_;  //!< Earth forbidden angle [rad]
   double moon_forbidden_angle_rad_;   //!< Moon forbidden angle [rad]
 
-  int x_number_of_pix_;        //!< Number of pixel on X-axis in the image plane
-  int y_number_of_pix_;        //!< Number of pixel on Y-axis in the image plane
-  double x_fov_per_pix_;       //!< Field of view per pixel of X-axis in the image plane [rad/pix]
-  double y_fov_per_pix_;       //!< Field of view per pixel of Y-axis in the image plane [rad/pix]
-  double x_field_of_view_rad;  //!< Field of view of X-axis in the image plane [rad/pix]
-  double y_field_of_view_rad;  //!< Field of view of Y-axis in the image plane [rad/pix]
+  int x_number_of_pix_;           //!< Number of pixel on X-axis in the image plane
+  int y_number_of_pix_;           //!< Number of pixel on Y-axis in the image plane
+  double x_fov_per_pix_;          //!< Field of view per pixel of X-axis in the image plane [rad/pix]
+  double y_fov_per_pix_;          //!< Field of view per pixel of Y-axis in the image plane [rad/pix]
+  double x_field_of_view_rad;     //!< Field of view of X-axis in the image plane [rad/pix]
+  double y_field_of_view_rad;     //!< Field of view of Y-axis in the image plane [rad/pix]
+  double star_search_angle_rad_;  //!< Half angle of the cone which includes the field of view to search the stars [rad]
 
   bool is_sun_in_forbidden_angle = false;    //!< Is the sun in the forbidden angle
   bool is_earth_in_forbidden_angle = false;  //!< Is the earth in the forbidden angle
@@ -122,6 +123,9 @@ class Telescope : public Component, public ILoggable {
   const Attitude* attitude_;                                      //!< Attitude information
   const HipparcosCatalogue* hipparcos_;                           //!< Star information
   const LocalCelestialInformation* local_celestial_information_;  //!< Local celestial information
+  CelestialBodyHandle sun_handle_;                                //!< Handle of the sun
+  CelestialBodyHandle earth_handle_;                              //!< Handle of the earth
+  CelestialBodyHandle moon_handle_;                               //!< Handle of the moon
 
   // Override ILoggable
   /**
@@ -52,3 +52,16 @@ std::string PowerControlUnit::GetLogValue() const {
   std::string str_tmp = "";
   return str_tmp;
 }
+
+void PowerControlUnit::SaveSnapshot(Snapshot& snapshot) const {
+  // The ports are saved in the order of the port ID
+  for (const auto& power_port : power_ports_) {
+    if (power_port.second != nullptr) power_port.second->SaveSnapshot(snapshot);
+  }
+}
+
+void PowerControlUnit::RestoreSnapshot(Snapshot& snapshot) {
+  for (const auto& power_port : power_ports_) {
+    if (power_port.second != nullptr) power_port.second->RestoreSnapshot(snapshot);
+  }
+}
@@ -8,6 +8,7 @@
 
 #include <components/ports/power_port.hpp>
 #include <library/logger/loggable.hpp>
+#include <library/utilities/snapshot.hpp>
 #include <map>
 
 #include "../../base/component.hpp"
@@ -56,6 +57,17 @@ class PowerControlUnit : public Component, public ILoggable {
    */
   std::string GetLogValue() const override;
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the states of the power ports into the snapshot
+   */
+  void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the states of the power ports from the snapshot
+   */
+  void RestoreSnapshot(Snapshot& snapshot);
+
   /**
    * @fn GetPowerPort
    * @brief Return power port information
@@ -23,6 +23,7 @@ SolarArrayPanel::SolarArrayPanel(const int prescaler, ClockGenerator* clock_gene
       srp_environment_(srp_environment),
       local_celestial_information_(local_celestial_information),
       compo_step_time_s_(component_step_time_s) {
+  sun_handle_ = local_celestial_information_->GetBodyHandle("SUN");
   voltage_V_ = 0.0;
   power_generation_W_ = 0.0;
 }
@@ -59,6 +60,7 @@ SolarArrayPanel::SolarArrayPanel(ClockGenerator* clock_generator, int component_
       srp_environment_(srp_environment),
       local_celestial_information_(local_celestial_information),
       compo_step_time_s_(0.1) {
+  sun_handle_ = local_celestial_information_->GetBodyHandle("SUN");
   voltage_V_ = 0.0;
   power_generation_W_ = 0.0;
 }
@@ -74,6 +76,7 @@ SolarArrayPanel::SolarArrayPanel(const SolarArrayPanel& obj)
       transmission_efficiency_(obj.transmission_efficiency_),
       srp_environment_(obj.srp_environment_),
       local_celestial_information_(obj.local_celestial_information_),
+      sun_handle_(obj.sun_handle_),
       compo_step_time_s_(obj.compo_step_time_s_) {
   voltage_V_ = 0.0;
   power_generation_W_ = 0.0;
@@ -104,7 +107,7 @@ void SolarArrayPanel::MainRoutine(const int time_count) {
                           cell_area_m2_ * number_of_parallel_ * number_of_series_ * InnerProduct(normal_vector_, normalized_sun_direction_body);
   } else {
     const auto power_density = srp_environment_->GetPowerDensity_W_m2();
-    libra::Vector<3> sun_pos_b = local_celestial_information_->GetPositionFromSpacecraft_b_m("SUN");
+    libra::Vector<3> sun_pos_b = local_celestial_information_->GetPositionFromSpacecraft_b_m(sun_handle_);
     libra::Vector<3> sun_dir_b = sun_pos_b.CalcNormalizedVector();
     power_generation_W_ = cell_efficiency_ * transmission_efficiency_ * power_density * cell_area_m2_ * number_of_parallel_ * number_of_series_ *
                           InnerProduct(normal_vector_, sun_dir_b);
@@ -117,6 +117,7 @@ class SolarArrayPanel : public Component, public ILoggable {
 
   const SolarRadiationPressureEnvironment* const srp_environment_;  //!< Solar Radiation Pressure environment
   const LocalCelestialInformation* local_celestial_information_;    //!< Local celestial information
+  CelestialBodyHandle sun_handle_;                                  //!< Handle of the sun
 
   double voltage_V_;           //!< Voltage [V]
   double power_generation_W_;  //!< Generated power [W]
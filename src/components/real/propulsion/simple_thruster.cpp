@@ -92,6 +92,22 @@ std::string SimpleThruster::GetLogValue() const {
   return str_tmp;
 }
 
+void SimpleThruster::SaveSnapshot(Snapshot& snapshot) const {
+  snapshot.Write(duty_);
+  snapshot.Write(magnitude_random_noise_);
+  snapshot.Write(direction_random_noise_);
+  snapshot.Write(output_thrust_b_N_);
+  snapshot.Write(output_torque_b_Nm_);
+}
+
+void SimpleThruster::RestoreSnapshot(Snapshot& snapshot) {
+  snapshot.Read(duty_);
+  snapshot.Read(magnitude_random_noise_);
+  snapshot.Read(direction_random_noise_);
+  snapshot.Read(output_thrust_b_N_);
+  snapshot.Read(output_torque_b_Nm_);
+}
+
 double SimpleThruster::CalcThrustMagnitude() { return duty_ * thrust_magnitude_max_N_; }
 
 libra::Vector<3> SimpleThruster::CalcThrustDirection() {
@@ -11,6 +11,7 @@
 #include <library/math/quaternion.hpp>
 #include <library/math/vector.hpp>
 #include <library/randomization/normal_randomization.hpp>
+#include <library/utilities/snapshot.hpp>
 #include <simulation/spacecraft/structure/structure.hpp>
 
 #include "../../base/component.hpp"
@@ -87,6 +88,17 @@ class SimpleThruster : public Component, public ILoggable {
    */
   virtual std::string GetLogValue() const override;
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the duty, the noise states, and the generated thrust into the snapshot
+   */
+  void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the duty, the noise states, and the generated thrust from the snapshot
+   */
+  void RestoreSnapshot(Snapshot& snapshot);
+
   // Getter
   /**
    * @fn GetOutputThrust_b_N
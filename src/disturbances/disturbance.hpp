@@ -8,6 +8,7 @@
 
 #include "../environment/local/local_environment.hpp"
 #include "../library/math/vector.hpp"
+#include "../library/utilities/snapshot.hpp"
 
 /**
  * @class Disturbance
@@ -82,6 +83,28 @@ class Disturbance : public ILoggable {
    */
   virtual inline bool IsAttitudeDependent() { return is_attitude_dependent_; }
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the disturbance force, torque, and acceleration into the snapshot
+   * @note The position dependent disturbances keep the values until the next orbit propagation step
+   */
+  virtual void SaveSnapshot(Snapshot& snapshot) const {
+    snapshot.Write(force_b_N_);
+    snapshot.Write(torque_b_Nm_);
+    snapshot.Write(acceleration_b_m_s2_);
+    snapshot.Write(acceleration_i_m_s2_);
+  }
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the disturbance force, torque, and acceleration from the snapshot
+   */
+  virtual void RestoreSnapshot(Snapshot& snapshot) {
+    snapshot.Read(force_b_N_);
+    snapshot.Read(torque_b_Nm_);
+    snapshot.Read(acceleration_b_m_s2_);
+    snapshot.Read(acceleration_i_m_s2_);
+  }
+
  protected:
   bool is_calculation_enabled_;           //!< Flag to calculate the disturbance
   bool is_attitude_dependent_;            //!< Flag to show the disturbance depends on attitude information
@@ -48,6 +48,24 @@ void Disturbances::Update(const LocalEnvironment& local_environment, const Dynam
   }
 }
 
+void Disturbances::SaveSnapshot(Snapshot& snapshot) const {
+  for (auto disturbance : disturbances_list_) {
+    disturbance->SaveSnapshot(snapshot);
+  }
+  snapshot.Write(total_torque_b_Nm_);
+  snapshot.Write(total_force_b_N_);
+  snapshot.Write(total_acceleration_i_m_s2_);
+}
+
+void Disturbances::RestoreSnapshot(Snapshot& snapshot) {
+  for (auto disturbance : disturbances_list_) {
+    disturbance->RestoreSnapshot(snapshot);
+  }
+  snapshot.Read(total_torque_b_Nm_);
+  snapshot.Read(total_force_b_N_);
+  snapshot.Read(total_acceleration_i_m_s2_);
+}
+
 void Disturbances::LogSetup(Logger& logger) {
   for (auto disturbance : disturbances_list_) {
     logger.AddLogList(disturbance);
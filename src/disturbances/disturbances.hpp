@@ -51,6 +51,17 @@ class Disturbances {
    */
   void LogSetup(Logger& logger);
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the states of all disturbances into the snapshot
+   */
+  void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the states of all disturbances from the snapshot
+   */
+  void RestoreSnapshot(Snapshot& snapshot);
+
   /**
    * @fn GetTorque
    * @brief Return total disturbance torque in the body frame [Nm]
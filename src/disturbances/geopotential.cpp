@@ -14,6 +14,7 @@
 
 #include "../library/logger/log_utility.hpp"
 #include "../library/utilities/macros.hpp"
+#include "../library/utilities/shared_data_store.hpp"
 
 // #define DEBUG_GEOPOTENTIAL
 
@@ -30,23 +31,30 @@ Geopotential::Geopotential(const int degree, const std::string file_path, const
   } else if (degree_ <= 1) {
     degree_ = 0;
   }
-  // coefficients
-  c_.assign(degree_ + 1, std::vector<double>(degree_ + 1, 0.0));
-  s_.assign(degree_ + 1, std::vector<double>(degree_ + 1, 0.0));
-  // For actual EGM model, c_[0][0] should be 1.0
-  // In S2E, 0 degree term is inside the SimpleCircularOrbit calculation
-  c_[0][0] = 0.0;
-  if (degree_ >= 2) {
-    if (!ReadCoefficientsEgm96(file_path)) {
-      degree_ = 0;
-      std::cout << "degree of Geopotential set as " << degree_ << "\n";
-    }
+  if (degree_ < 2) return;
+
+  // The coefficients are read once in a process, and the instances with the same file and degree share the tables of GravityPotential
+  const std::string key = file_path + "#" + std::to_string(degree_);
+  std::shared_ptr<const GravityPotential> geopotential =
+      SharedDataStore<GravityPotential>::GetOrLoad(key, [this, &file_path]() -> std::shared_ptr<const GravityPotential> {
+        // For actual EGM model, c[0][0] should be 1.0
+        // In S2E, 0 degree term is inside the SimpleCircularOrbit calculation
+        std::vector<std::vector<double>> c(degree_ + 1, std::vector<double>(degree_ + 1, 0.0));
+        std::vector<std::vector<double>> s(degree_ + 1, std::vector<double>(degree_ + 1, 0.0));
+        if (!ReadCoefficientsEgm96(file_path, c, s)) return nullptr;
+        return std::make_shared<const GravityPotential>(degree_, c, s);
+      });
+  if (geopotential == nullptr) {
+    degree_ = 0;
+    std::cout << "degree of Geopotential set as " << degree_ << "\n";
+    return;
   }
   // Initialize GravityPotential
-  geopotential_ = GravityPotential(degree, c_, s_);
+  geopotential_ = *geopotential;
 }
 
-bool Geopotential::ReadCoefficientsEgm96(std::string file_name) {
+bool Geopotential::ReadCoefficientsEgm96(const std::string file_name, std::vector<std::vector<double>> &c,
+                                         std::vector<std::vector<double>> &s) const {
   std::ifstream coeff_file(file_name);
   if (!coeff_file.is_open()) {
     std::cerr << "File open error: Geopotential\n";
@@ -62,8 +70,8 @@ bool Geopotential::ReadCoefficientsEgm96(std::string file_name) {
     std::istringstream streamline(line);
     streamline >> n >> m >> c_nm_norm >> s_nm_norm;
 
-    c_[n][m] = c_nm_norm;
-    s_[n][m] = s_nm_norm;
+    c[n][m] = c_nm_norm;
+    s[n][m] = s_nm_norm;
   }
   return true;
 }
@@ -33,8 +33,6 @@ class Geopotential : public Disturbance {
   Geopotential(const Geopotential &obj) : Disturbance(obj) {
     geopotential_ = obj.geopotential_;
     degree_ = obj.degree_;
-    c_ = obj.c_;
-    s_ = obj.s_;
   }
 
   ~Geopotential() {}
@@ -47,6 +45,18 @@ class Geopotential : public Disturbance {
    */
   virtual void Update(const LocalEnvironment &local_environment, const Dynamics &dynamics);
 
+  /**
+   * @fn CalcBatch_ecef
+   * @brief Calculate the acceleration, and optionally the partial derivative, for multiple positions at once
+   * @note Use this for multi-satellite cases or the state transition matrix propagation instead of repeated single calculations.
+   *       Update does not use this function, since it calculates only the position of the spacecraft.
+   * @param [in,out] batch: Positions in the ECEF frame [m] and the calculated results
+   * @param [in] is_partial_derivative_enabled: Calculate the partial derivative of acceleration too
+   */
+  inline void CalcBatch_ecef(GravityPotentialBatch &batch, const bool is_partial_derivative_enabled = false) const {
+    geopotential_.CalcBatch_xcxf(batch, is_partial_derivative_enabled);
+  }
+
   // Override ILoggable
   /**
    * @fn GetLogHeader
@@ -61,10 +71,8 @@ class Geopotential : public Disturbance {
 
  private:
   GravityPotential geopotential_;
-  size_t degree_;                       //!< Maximum degree setting to calculate the geo-potential
-  std::vector<std::vector<double>> c_;  //!< Cosine coefficients
-  std::vector<std::vector<double>> s_;  //!< Sine coefficients
-  Vector<3> acceleration_ecef_m_s2_;    //!< Calculated acceleration in the ECEF frame [m/s2]
+  size_t degree_;                     //!< Maximum degree setting to calculate the geo-potential
+  Vector<3> acceleration_ecef_m_s2_;  //!< Calculated acceleration in the ECEF frame [m/s2]
 
   // debug
   libra::Vector<3> debug_pos_ecef_m_;  //!< Spacecraft position in ECEF frame [m]
@@ -74,8 +82,10 @@ class Geopotential : public Disturbance {
    * @fn ReadCoefficientsEgm96
    * @brief Read the geo-potential coefficients for the EGM96 model
    * @param [in] file_name: Coefficient file name
+   * @param [out] c: Cosine coefficients
+   * @param [out] s: Sine coefficients
    */
-  bool ReadCoefficientsEgm96(std::string file_name);
+  bool ReadCoefficientsEgm96(const std::string file_name, std::vector<std::vector<double>> &c, std::vector<std::vector<double>> &s) const;
 };
 
 /**
@@ -14,6 +14,7 @@
 
 #include "../library/logger/log_utility.hpp"
 #include "../library/utilities/macros.hpp"
+#include "../library/utilities/shared_data_store.hpp"
 
 #define DEBUG_LUNAR_GRAVITY_FIELD
 
@@ -33,23 +34,31 @@ LunarGravityField::LunarGravityField(const int degree, const std::string file_pa
   } else if (degree_ <= 1) {
     degree_ = 0;
   }
-  // coefficients
-  c_.assign(degree_ + 1, std::vector<double>(degree_ + 1, 0.0));
-  s_.assign(degree_ + 1, std::vector<double>(degree_ + 1, 0.0));
-  // For actual GRGM model, c_[0][0] should be 1.0
-  // In S2E, 0 degree term is inside the RK4 orbit calculation
-  c_[0][0] = 0.0;
-  if (degree_ >= 2) {
-    if (!ReadCoefficientsGrgm1200a(file_path)) {
-      degree_ = 0;
-      std::cout << "degree of LunarGravityField set as " << degree_ << "\n";
-    }
+  if (degree_ < 2) return;
+
+  // The coefficients are read once in a process, and the instances with the same file and degree share the tables of GravityPotential
+  const std::string key = file_path + "#" + std::to_string(degree_);
+  std::shared_ptr<const GravityPotential> lunar_potential =
+      SharedDataStore<GravityPotential>::GetOrLoad(key, [this, &file_path]() -> std::shared_ptr<const GravityPotential> {
+        // For actual GRGM model, c[0][0] should be 1.0
+        // In S2E, 0 degree term is inside the RK4 orbit calculation
+        std::vector<std::vector<double>> c(degree_ + 1, std::vector<double>(degree_ + 1, 0.0));
+        std::vector<std::vector<double>> s(degree_ + 1, std::vector<double>(degree_ + 1, 0.0));
+        double reference_radius_km, gravity_constants_km3_s2;
+        if (!ReadCoefficientsGrgm1200a(file_path, reference_radius_km, gravity_constants_km3_s2, c, s)) return nullptr;
+        return std::make_shared<const GravityPotential>(degree_, c, s, gravity_constants_km3_s2 * 1e9, reference_radius_km * 1e3);
+      });
+  if (lunar_potential == nullptr) {
+    degree_ = 0;
+    std::cout << "degree of LunarGravityField set as " << degree_ << "\n";
+    return;
   }
   // Initialize GravityPotential
-  lunar_potential_ = GravityPotential(degree, c_, s_, gravity_constants_km3_s2_ * 1e9, reference_radius_km_ * 1e3);
+  lunar_potential_ = *lunar_potential;
 }
 
-bool LunarGravityField::ReadCoefficientsGrgm1200a(std::string file_name) {
+bool LunarGravityField::ReadCoefficientsGrgm1200a(const std::string file_name, double &reference_radius_km, double &gravity_constants_km3_s2,
+                                                  std::vector<std::vector<double>> &c, std::vector<std::vector<double>> &s) const {
   std::ifstream coeff_file(file_name);
   if (!coeff_file.is_open()) {
     std::cerr << "File open error: LunarGravityField\n";
@@ -59,9 +68,9 @@ bool LunarGravityField::ReadCoefficientsGrgm1200a(std::string file_name) {
   // Read header
   std::string line, cell;
   getline(coeff_file, cell, ',');
-  reference_radius_km_ = std::stod(cell);
+  reference_radius_km = std::stod(cell);
   getline(coeff_file, cell, ',');
-  gravity_constants_km3_s2_ = std::stod(cell);
+  gravity_constants_km3_s2 = std::stod(cell);
   // next line
   getline(coeff_file, line);
 
@@ -80,8 +89,8 @@ bool LunarGravityField::ReadCoefficientsGrgm1200a(std::string file_name) {
     // next line
     getline(coeff_file, line);
 
-    c_[n][m] = c_nm_norm;
-    s_[n][m] = s_nm_norm;
+    c[n][m] = c_nm_norm;
+    s[n][m] = s_nm_norm;
   }
   return true;
 }
@@ -32,11 +32,7 @@ class LunarGravityField : public Disturbance {
    */
   LunarGravityField(const LunarGravityField &obj) : Disturbance(obj) {
     lunar_potential_ = obj.lunar_potential_;
-    reference_radius_km_ = obj.reference_radius_km_;
-    gravity_constants_km3_s2_ = obj.gravity_constants_km3_s2_;
     degree_ = obj.degree_;
-    c_ = obj.c_;
-    s_ = obj.s_;
   }
 
   ~LunarGravityField() {}
@@ -49,6 +45,17 @@ class LunarGravityField : public Disturbance {
    */
   virtual void Update(const LocalEnvironment &local_environment, const Dynamics &dynamics);
 
+  /**
+   * @fn CalcBatch_mcmf
+   * @brief Calculate the acceleration, and optionally the partial derivative, for multiple positions at once
+   * @note Use this for multi-satellite cases or the state transition matrix propagation instead of repeated single calculations
+   * @param [in,out] batch: Positions in the MCMF frame [m] and the calculated results
+   * @param [in] is_partial_derivative_enabled: Calculate the partial derivative of acceleration too
+   */
+  inline void CalcBatch_mcmf(GravityPotentialBatch &batch, const bool is_partial_derivative_enabled = false) const {
+    lunar_potential_.CalcBatch_xcxf(batch, is_partial_derivative_enabled);
+  }
+
   // Override ILoggable
   /**
    * @fn GetLogHeader
@@ -63,12 +70,8 @@ class LunarGravityField : public Disturbance {
 
  private:
   GravityPotential lunar_potential_;
-  double reference_radius_km_;
-  double gravity_constants_km3_s2_;
-  size_t degree_;                       //!< Maximum degree setting to calculate the geo-potential
-  std::vector<std::vector<double>> c_;  //!< Cosine coefficients
-  std::vector<std::vector<double>> s_;  //!< Sine coefficients
-  Vector<3> acceleration_mcmf_m_s2_;    //!< Calculated acceleration in the MCMF(Moon Centered Moon Fixed) frame [m/s2]
+  size_t degree_;                     //!< Maximum degree setting to calculate the geo-potential
+  Vector<3> acceleration_mcmf_m_s2_;  //!< Calculated acceleration in the MCMF(Moon Centered Moon Fixed) frame [m/s2]
 
   // debug
   libra::Vector<3> debug_pos_mcmf_m_;  //!< Spacecraft position in MCMF frame [m]
@@ -78,8 +81,13 @@ class LunarGravityField : public Disturbance {
    * @fn ReadCoefficientsGrgm1200a
    * @brief Read the lunar gravity field coefficients for the GRGM1200A model
    * @param [in] file_name: Coefficient file name
+   * @param [out] reference_radius_km: Reference radius of the model [km]
+   * @param [out] gravity_constants_km3_s2: Gravity constant of the model [km3/s2]
+   * @param [out] c: Cosine coefficients
+   * @param [out] s: Sine coefficients
    */
-  bool ReadCoefficientsGrgm1200a(std::string file_name);
+  bool ReadCoefficientsGrgm1200a(const std::string file_name, double &reference_radius_km, double &gravity_constants_km3_s2,
+                                 std::vector<std::vector<double>> &c, std::vector<std::vector<double>> &s) const;
 };
 
 /**
@@ -10,6 +10,8 @@
 
 #include "../library/logger/loggable.hpp"
 #include "../library/math/vector.hpp"
+#include "../library/randomization/normal_randomization.hpp"
+#include "../library/randomization/random_walk.hpp"
 #include "../simulation/spacecraft/structure/residual_magnetic_moment.hpp"
 #include "disturbance.hpp"
 
@@ -35,6 +37,17 @@ class MagneticDisturbance : public Disturbance {
    */
   virtual void Update(const LocalEnvironment& local_environment, const Dynamics& dynamics);
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Override SaveSnapshot function of Disturbance to add the RMM noise states
+   */
+  virtual void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Override RestoreSnapshot function of Disturbance to add the RMM noise states
+   */
+  virtual void RestoreSnapshot(Snapshot& snapshot);
+
   // Override ILoggable
   /**
    * @fn GetLogHeader
@@ -52,6 +65,8 @@ class MagneticDisturbance : public Disturbance {
 
   libra::Vector<3> rmm_b_Am2_;                              //!< True RMM of the spacecraft in the body frame [Am2]
   const ResidualMagneticMoment& residual_magnetic_moment_;  //!< RMM parameters
+  RandomWalk<3> random_walk_;                               //!< Random walk noise of RMM [Am2]
+  libra::NormalRand normal_random_;                         //!< White noise of RMM [Am2]
 
   /**
    * @fn CalcRMM
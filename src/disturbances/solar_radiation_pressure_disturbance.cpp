@@ -17,7 +17,11 @@ SolarRadiationPressureDisturbance::SolarRadiationPressureDisturbance(const std::
 void SolarRadiationPressureDisturbance::Update(const LocalEnvironment& local_environment, const Dynamics& dynamics) {
   UNUSED(dynamics);
 
-  libra::Vector<3> sun_position_from_sc_b_m = local_environment.GetCelestialInformation().GetPositionFromSpacecraft_b_m("SUN");
+  if (!is_sun_handle_resolved_) {
+    sun_handle_ = local_environment.GetCelestialInformation().GetBodyHandle("SUN");
+    is_sun_handle_resolved_ = true;
+  }
+  libra::Vector<3> sun_position_from_sc_b_m = local_environment.GetCelestialInformation().GetPositionFromSpacecraft_b_m(sun_handle_);
   CalcTorqueForce(sun_position_from_sc_b_m, local_environment.GetSolarRadiationPressure().GetPressure_N_m2());
 }
 
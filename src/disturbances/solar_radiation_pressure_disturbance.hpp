@@ -56,6 +56,9 @@ class SolarRadiationPressureDisturbance : public SurfaceForce {
    * @param [in] item: Solar pressure [N/m^2]
    */
   void CalcCoefficients(const libra::Vector<3>& input_direction_b, const double item);
+
+  bool is_sun_handle_resolved_ = false;  //!< Flag to show the sun handle is resolved
+  CelestialBodyHandle sun_handle_;       //!< Handle of the sun (resolved at the first update)
 };
 
 /**
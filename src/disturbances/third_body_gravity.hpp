@@ -9,6 +9,7 @@
 #include <cassert>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "../library/logger/loggable.hpp"
 #include "../library/math/vector.hpp"
@@ -43,6 +44,7 @@ class ThirdBodyGravity : public Disturbance {
 
  private:
   std::set<std::string> third_body_list_;                 //!< List of celestial bodies to calculate the third body disturbances
+  std::vector<CelestialBodyHandle> third_body_handles_;   //!< Handles of the third bodies (resolved at the first update)
   libra::Vector<3> third_body_acceleration_i_m_s2_{0.0};  //!< Calculated third body disturbance acceleration in the inertial frame [m/s2]
 
   // Override classes for ILoggable
@@ -31,16 +31,38 @@ std::string Attitude::GetLogHeader() const {
   return str_tmp;
 }
 
-std::string Attitude::GetLogValue() const {
-  std::string str_tmp = "";
+std::string Attitude::GetLogValue() const { return FormatLogValue(); }
 
-  str_tmp += WriteVector(angular_velocity_b_rad_s_);
-  str_tmp += WriteQuaternion(quaternion_i2b_);
-  str_tmp += WriteVector(torque_b_Nm_);
-  str_tmp += WriteScalar(angular_momentum_total_Nms_);
-  str_tmp += WriteScalar(kinetic_energy_J_);
+void Attitude::AppendLogValue(LogRecord& record) const {
+  record.AddVector(angular_velocity_b_rad_s_);
+  record.AddQuaternion(quaternion_i2b_);
+  record.AddVector(torque_b_Nm_);
+  record.AddScalar(angular_momentum_total_Nms_);
+  record.AddScalar(kinetic_energy_J_);
+}
 
-  return str_tmp;
+void Attitude::SaveSnapshot(Snapshot& snapshot) const {
+  snapshot.Write(angular_velocity_b_rad_s_);
+  snapshot.Write(quaternion_i2b_);
+  snapshot.Write(torque_b_Nm_);
+  snapshot.Write(angular_momentum_spacecraft_b_Nms_);
+  snapshot.Write(angular_momentum_reaction_wheel_b_Nms_);
+  snapshot.Write(angular_momentum_total_b_Nms_);
+  snapshot.Write(angular_momentum_total_i_Nms_);
+  snapshot.Write(angular_momentum_total_Nms_);
+  snapshot.Write(kinetic_energy_J_);
+}
+
+void Attitude::RestoreSnapshot(Snapshot& snapshot) {
+  snapshot.Read(angular_velocity_b_rad_s_);
+  snapshot.Read(quaternion_i2b_);
+  snapshot.Read(torque_b_Nm_);
+  snapshot.Read(angular_momentum_spacecraft_b_Nms_);
+  snapshot.Read(angular_momentum_reaction_wheel_b_Nms_);
+  snapshot.Read(angular_momentum_total_b_Nms_);
+  snapshot.Read(angular_momentum_total_i_Nms_);
+  snapshot.Read(angular_momentum_total_Nms_);
+  snapshot.Read(kinetic_energy_J_);
 }
 
 void Attitude::SetParameters(const MonteCarloSimulationExecutor& mc_simulator) {
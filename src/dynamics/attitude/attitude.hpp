@@ -9,6 +9,7 @@
 #include <library/logger/loggable.hpp>
 #include <library/math/matrix_vector.hpp>
 #include <library/math/quaternion.hpp>
+#include <library/utilities/snapshot.hpp>
 #include <simulation/monte_carlo_simulation/simulation_object.hpp>
 #include <string>
 
@@ -98,6 +99,17 @@ class Attitude : public ILoggable, public SimulationObject {
    */
   virtual void Propagate(const double end_time_s) = 0;
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the attitude state into the snapshot
+   */
+  virtual void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the attitude state from the snapshot
+   */
+  virtual void RestoreSnapshot(Snapshot& snapshot);
+
   // Override ILoggable
   /**
    * @fn GetLogHeader
@@ -109,6 +121,11 @@ class Attitude : public ILoggable, public SimulationObject {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(LogRecord& record) const;
 
   // SimulationObject for McSim
   virtual void SetParameters(const MonteCarloSimulationExecutor& mc_simulator);
@@ -36,6 +36,18 @@ void AttitudeRk4::SetParameters(const MonteCarloSimulationExecutor& mc_simulator
   CalcAngularMomentum();
 }
 
+void AttitudeRk4::SaveSnapshot(Snapshot& snapshot) const {
+  Attitude::SaveSnapshot(snapshot);
+  snapshot.Write(current_propagation_time_s_);
+  snapshot.Write(previous_inertia_tensor_kgm2_);
+}
+
+void AttitudeRk4::RestoreSnapshot(Snapshot& snapshot) {
+  Attitude::RestoreSnapshot(snapshot);
+  snapshot.Read(current_propagation_time_s_);
+  snapshot.Read(previous_inertia_tensor_kgm2_);
+}
+
 void AttitudeRk4::Propagate(const double end_time_s) {
   if (!is_calc_enabled_) return;
 
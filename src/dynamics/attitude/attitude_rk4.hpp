@@ -47,6 +47,17 @@ class AttitudeRk4 : public Attitude {
    */
   virtual void SetParameters(const MonteCarloSimulationExecutor& mc_simulator);
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the attitude state and the propagation time into the snapshot
+   */
+  virtual void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the attitude state and the propagation time from the snapshot
+   */
+  virtual void RestoreSnapshot(Snapshot& snapshot);
+
  private:
   double current_propagation_time_s_;                   //!< current time [sec]
   libra::Matrix<3, 3> inverse_inertia_tensor_;          //!< Inverse of inertia tensor
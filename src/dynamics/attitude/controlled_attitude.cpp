@@ -20,6 +20,8 @@ ControlledAttitude::ControlledAttitude(const AttitudeControlMode main_mode, cons
       local_celestial_information_(local_celestial_information),
       orbit_(orbit) {
   quaternion_i2b_ = quaternion_i2b;
+  sun_handle_ = local_celestial_information_->GetBodyHandle("SUN");
+  earth_handle_ = local_celestial_information_->GetBodyHandle("EARTH");
 
   Initialize();
 }
@@ -53,6 +55,28 @@ void ControlledAttitude::Initialize(void) {
   return;
 }
 
+void ControlledAttitude::SaveSnapshot(Snapshot& snapshot) const {
+  Attitude::SaveSnapshot(snapshot);
+  snapshot.Write(main_mode_);
+  snapshot.Write(sub_mode_);
+  snapshot.Write(main_target_direction_b_);
+  snapshot.Write(sub_target_direction_b_);
+  snapshot.Write(previous_calc_time_s_);
+  snapshot.Write(previous_quaternion_i2b_);
+  snapshot.Write(previous_omega_b_rad_s_);
+}
+
+void ControlledAttitude::RestoreSnapshot(Snapshot& snapshot) {
+  Attitude::RestoreSnapshot(snapshot);
+  snapshot.Read(main_mode_);
+  snapshot.Read(sub_mode_);
+  snapshot.Read(main_target_direction_b_);
+  snapshot.Read(sub_target_direction_b_);
+  snapshot.Read(previous_calc_time_s_);
+  snapshot.Read(previous_quaternion_i2b_);
+  snapshot.Read(previous_omega_b_rad_s_);
+}
+
 void ControlledAttitude::Propagate(const double end_time_s) {
   libra::Vector<3> main_direction_i, sub_direction_i;
   if (!is_calc_enabled_) return;
@@ -76,18 +100,18 @@ void ControlledAttitude::Propagate(const double end_time_s) {
 libra::Vector<3> ControlledAttitude::CalcTargetDirection_i(AttitudeControlMode mode) {
   libra::Vector<3> direction;
   if (mode == AttitudeControlMode::kSunPointing) {
-    direction = local_celestial_information_->GetPositionFromSpacecraft_i_m("SUN");
+    direction = local_celestial_information_->GetPositionFromSpacecraft_i_m(sun_handle_);
     // When the local_celestial_information is not initialized. FIXME: This is temporary codes for attitude initialize.
     if (direction.CalcNorm() == 0.0) {
-      libra::Vector<3> sun_position_i_m = local_celestial_information_->GetGlobalInformation().GetPositionFromCenter_i_m("SUN");
+      libra::Vector<3> sun_position_i_m = local_celestial_information_->GetGlobalInformation().GetPositionFromCenter_i_m(sun_handle_);
       libra::Vector<3> spacecraft_position_i_m = orbit_->GetPosition_i_m();
       direction = sun_position_i_m - spacecraft_position_i_m;
     }
   } else if (mode == AttitudeControlMode::kEarthCenterPointing) {
-    direction = local_celestial_information_->GetPositionFromSpacecraft_i_m("EARTH");
+    direction = local_celestial_information_->GetPositionFromSpacecraft_i_m(earth_handle_);
     // When the local_celestial_information is not initialized. FIXME: This is temporary codes for attitude initialize.
     if (direction.CalcNorm() == 0.0) {
-      libra::Vector<3> earth_position_i_m = local_celestial_information_->GetGlobalInformation().GetPositionFromCenter_i_m("EARTH");
+      libra::Vector<3> earth_position_i_m = local_celestial_information_->GetGlobalInformation().GetPositionFromCenter_i_m(earth_handle_);
       libra::Vector<3> spacecraft_position_i_m = orbit_->GetPosition_i_m();
       direction = earth_position_i_m - spacecraft_position_i_m;
     }
@@ -97,6 +97,17 @@ class ControlledAttitude : public Attitude {
    */
   virtual void Propagate(const double end_time_s);
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the attitude state and the control mode into the snapshot
+   */
+  virtual void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the attitude state and the control mode from the snapshot
+   */
+  virtual void RestoreSnapshot(Snapshot& snapshot);
+
  private:
   AttitudeControlMode main_mode_;              //!< Main control mode
   AttitudeControlMode sub_mode_;               //!< Sub control mode
@@ -112,6 +123,8 @@ class ControlledAttitude : public Attitude {
   // Inputs
   const LocalCelestialInformation* local_celestial_information_;  //!< Local celestial information
   const Orbit* orbit_;                                            //!< Orbit information
+  CelestialBodyHandle sun_handle_;                                //!< Handle of the sun
+  CelestialBodyHandle earth_handle_;                              //!< Handle of the earth
 
   // Local functions
   /**
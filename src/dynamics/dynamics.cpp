@@ -23,6 +23,7 @@ Dynamics::~Dynamics() {
 void Dynamics::Initialize(const SimulationConfiguration* simulation_configuration, const SimulationTime* simulation_time, const int spacecraft_id,
                           Structure* structure, RelativeInformation* relative_information) {
   const LocalCelestialInformation& local_celestial_information = local_environment_->GetCelestialInformation();
+  sun_handle_ = local_celestial_information.GetBodyHandle("SUN");
   // Initialize
   orbit_ = InitOrbit(&(local_celestial_information.GetGlobalInformation()), simulation_configuration->spacecraft_file_list_[spacecraft_id],
                      simulation_time->GetOrbitRkStepTime_s(), simulation_time->GetCurrentTime_jd(),
@@ -49,11 +50,7 @@ void Dynamics::Update(const SimulationTime* simulation_time, const LocalCelestia
 
   // Thermal
   if (simulation_time->GetThermalPropagateFlag()) {
-    std::string sun_str = "SUN";
-    char* c_sun = new char[sun_str.size() + 1];
-    std::char_traits<char>::copy(c_sun, sun_str.c_str(), sun_str.size() + 1);  // string -> char*
-    temperature_->Propagate(local_celestial_information->GetPositionFromSpacecraft_b_m(c_sun), simulation_time->GetElapsedTime_s());
-    delete[] c_sun;
+    temperature_->Propagate(local_celestial_information->GetPositionFromSpacecraft_b_m(sun_handle_), simulation_time->GetElapsedTime_s());
   }
 }
 
@@ -63,6 +60,18 @@ void Dynamics::ClearForceTorque(void) {
   orbit_->SetAcceleration_i_m_s2(zero);
 }
 
+void Dynamics::SaveSnapshot(Snapshot& snapshot) const {
+  attitude_->SaveSnapshot(snapshot);
+  orbit_->SaveSnapshot(snapshot);
+  temperature_->SaveSnapshot(snapshot);
+}
+
+void Dynamics::RestoreSnapshot(Snapshot& snapshot) {
+  attitude_->RestoreSnapshot(snapshot);
+  orbit_->RestoreSnapshot(snapshot);
+  temperature_->RestoreSnapshot(snapshot);
+}
+
 void Dynamics::LogSetup(Logger& logger) {
   logger.AddLogList(attitude_);
   logger.AddLogList(orbit_);
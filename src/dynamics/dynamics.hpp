@@ -85,6 +85,17 @@ class Dynamics {
    */
   void ClearForceTorque(void);
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the states of the attitude, orbit, and thermal dynamics into the snapshot
+   */
+  void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the states of the attitude, orbit, and thermal dynamics from the snapshot
+   */
+  void RestoreSnapshot(Snapshot& snapshot);
+
   /**
    * @fn GetAttitude
    * @brief Return Attitude class
@@ -105,6 +116,11 @@ class Dynamics {
    * @brief Return Attitude class to change the Attitude
    */
   inline Attitude& SetAttitude() const { return *attitude_; }
+  /**
+   * @fn SetOrbit
+   * @brief Return Orbit class to change the Orbit
+   */
+  inline Orbit& SetOrbit() const { return *orbit_; }
 
  private:
   Attitude* attitude_;                         //!< Attitude dynamics
@@ -112,6 +128,7 @@ class Dynamics {
   Temperature* temperature_;                   //!< Thermal dynamics
   const Structure* structure_;                 //!< Structure information
   const LocalEnvironment* local_environment_;  //!< Local environment
+  CelestialBodyHandle sun_handle_;             //!< Handle of the sun
 
   /**
    * @fn Initialize
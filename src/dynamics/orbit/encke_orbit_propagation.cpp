@@ -124,3 +124,40 @@ double EnckeOrbitPropagation::CalcQFunction(libra::Vector<3> difference_position
 
   return q_func;
 }
+
+void EnckeOrbitPropagation::SaveSnapshot(Snapshot& snapshot) const {
+  Orbit::SaveSnapshot(snapshot);
+  snapshot.Write(reference_position_i_m_);
+  snapshot.Write(reference_velocity_i_m_s_);
+  const OrbitalElements& oe = reference_kepler_orbit.GetOrbitalElements();
+  snapshot.Write(oe.GetEpoch_jday());
+  snapshot.Write(oe.GetSemiMajorAxis_m());
+  snapshot.Write(oe.GetEccentricity());
+  snapshot.Write(oe.GetInclination_rad());
+  snapshot.Write(oe.GetRaan_rad());
+  snapshot.Write(oe.GetArgPerigee_rad());
+  snapshot.Write(difference_position_i_m_);
+  snapshot.Write(difference_velocity_i_m_s_);
+  snapshot.Write(propagation_time_s_);
+  snapshot.Write(GetIndependentVariable());
+  snapshot.Write(GetState());
+}
+
+void EnckeOrbitPropagation::RestoreSnapshot(Snapshot& snapshot) {
+  Orbit::RestoreSnapshot(snapshot);
+  snapshot.Read(reference_position_i_m_);
+  snapshot.Read(reference_velocity_i_m_s_);
+  double elements[6];
+  if (snapshot.ReadArray(elements, 6)) {
+    OrbitalElements oe_ref(elements[0], elements[1], elements[2], elements[3], elements[4], elements[5]);
+    reference_kepler_orbit = KeplerOrbit(gravity_constant_m3_s2_, oe_ref);
+  }
+  snapshot.Read(difference_position_i_m_);
+  snapshot.Read(difference_velocity_i_m_s_);
+  snapshot.Read(propagation_time_s_);
+  double independent_variable = GetIndependentVariable();
+  libra::Vector<6> state = GetState();
+  snapshot.Read(independent_variable);
+  snapshot.Read(state);
+  Setup(independent_variable, state);
+}
@@ -55,6 +55,17 @@ class EnckeOrbitPropagation : public Orbit, public libra::OrdinaryDifferentialEq
    */
   virtual void DerivativeFunction(double t, const libra::Vector<6>& state, libra::Vector<6>& rhs);
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the orbit state, the reference orbit, and the difference orbit into the snapshot
+   */
+  virtual void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the orbit state, the reference orbit, and the difference orbit from the snapshot
+   */
+  virtual void RestoreSnapshot(Snapshot& snapshot);
+
  private:
   // General
   const double gravity_constant_m3_s2_;  //!< Gravity constant of the center body [m3/s2]
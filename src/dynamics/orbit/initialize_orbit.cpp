@@ -10,6 +10,7 @@
 #include "kepler_orbit_propagation.hpp"
 #include "relative_orbit.hpp"
 #include "rk4_orbit_propagation.hpp"
+#include "rkf_orbit_propagation.hpp"
 #include "sgp4_orbit_propagation.hpp"
 
 Orbit* InitOrbit(const CelestialInformation* celestial_information, std::string initialize_file, double step_width_s, double current_time_jd,
@@ -96,6 +97,20 @@ Orbit* InitOrbit(const CelestialInformation* celestial_information, std::string
     double error_tolerance = conf.ReadDouble(section_, "error_tolerance");
     orbit = new EnckeOrbitPropagation(celestial_information, gravity_constant_m3_s2, step_width_s, current_time_jd, position_i_m, velocity_i_m_s,
                                       error_tolerance);
+  } else if (propagate_mode == "RKF") {
+    // initialize RKF orbit propagator with adaptive step width
+    libra::Vector<3> position_i_m;
+    libra::Vector<3> velocity_i_m_s;
+    libra::Vector<6> pos_vel = InitializePosVel(initialize_file, current_time_jd, gravity_constant_m3_s2);
+    for (size_t i = 0; i < 3; i++) {
+      position_i_m[i] = pos_vel[i];
+      velocity_i_m_s[i] = pos_vel[i + 3];
+    }
+
+    double local_error_tolerance = conf.ReadDouble(section_, "local_error_tolerance");
+    double maximum_step_s = conf.ReadDouble(section_, "maximum_step_s");
+    orbit = new RkfOrbitPropagation(celestial_information, gravity_constant_m3_s2, step_width_s, position_i_m, velocity_i_m_s, local_error_tolerance,
+                                    maximum_step_s);
   } else {
     std::cerr << "ERROR: orbit propagation mode: " << propagate_mode << " is not defined!" << std::endl;
     std::cerr << "The orbit mode is automatically set as RK4" << std::endl;
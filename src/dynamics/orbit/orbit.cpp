@@ -28,6 +28,26 @@ libra::Quaternion Orbit::CalcQuaternion_i2lvlh() const {
   return q_i2lvlh.Normalize();
 }
 
+void Orbit::SaveSnapshot(Snapshot& snapshot) const {
+  snapshot.Write(spacecraft_position_i_m_);
+  snapshot.Write(spacecraft_position_ecef_m_);
+  snapshot.Write(spacecraft_geodetic_position_);
+  snapshot.Write(spacecraft_velocity_i_m_s_);
+  snapshot.Write(spacecraft_velocity_b_m_s_);
+  snapshot.Write(spacecraft_velocity_ecef_m_s_);
+  snapshot.Write(spacecraft_acceleration_i_m_s2_);
+}
+
+void Orbit::RestoreSnapshot(Snapshot& snapshot) {
+  snapshot.Read(spacecraft_position_i_m_);
+  snapshot.Read(spacecraft_position_ecef_m_);
+  snapshot.Read(spacecraft_geodetic_position_);
+  snapshot.Read(spacecraft_velocity_i_m_s_);
+  snapshot.Read(spacecraft_velocity_b_m_s_);
+  snapshot.Read(spacecraft_velocity_ecef_m_s_);
+  snapshot.Read(spacecraft_acceleration_i_m_s2_);
+}
+
 void Orbit::TransformEciToEcef(void) {
   libra::Matrix<3, 3> dcm_i_to_xcxf = celestial_information_->GetEarthRotation().GetDcmJ2000ToXcxf();
   spacecraft_position_ecef_m_ = dcm_i_to_xcxf * spacecraft_position_i_m_;
@@ -70,16 +90,14 @@ std::string Orbit::GetLogHeader() const {
   return str_tmp;
 }
 
-std::string Orbit::GetLogValue() const {
-  std::string str_tmp = "";
-
-  str_tmp += WriteVector(spacecraft_position_i_m_, 16);
-  str_tmp += WriteVector(spacecraft_velocity_i_m_s_, 10);
-  str_tmp += WriteVector(spacecraft_velocity_b_m_s_, 10);
-  str_tmp += WriteVector(spacecraft_acceleration_i_m_s2_, 10);
-  str_tmp += WriteScalar(spacecraft_geodetic_position_.GetLatitude_rad());
-  str_tmp += WriteScalar(spacecraft_geodetic_position_.GetLongitude_rad());
-  str_tmp += WriteScalar(spacecraft_geodetic_position_.GetAltitude_m());
+std::string Orbit::GetLogValue() const { return FormatLogValue(); }
 
-  return str_tmp;
+void Orbit::AppendLogValue(LogRecord& record) const {
+  record.AddVector(spacecraft_position_i_m_, 16);
+  record.AddVector(spacecraft_velocity_i_m_s_, 10);
+  record.AddVector(spacecraft_velocity_b_m_s_, 10);
+  record.AddVector(spacecraft_acceleration_i_m_s2_, 10);
+  record.AddScalar(spacecraft_geodetic_position_.GetLatitude_rad());
+  record.AddScalar(spacecraft_geodetic_position_.GetLongitude_rad());
+  record.AddScalar(spacecraft_geodetic_position_.GetAltitude_m());
 }
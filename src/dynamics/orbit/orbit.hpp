@@ -15,6 +15,8 @@
 #include <library/math/matrix_vector.hpp>
 #include <library/math/quaternion.hpp>
 #include <library/math/vector.hpp>
+#include <library/utilities/macros.hpp>
+#include <library/utilities/snapshot.hpp>
 
 /**
  * @enum OrbitPropagateMode
@@ -25,7 +27,8 @@ enum class OrbitPropagateMode {
   kSgp4,           //!< SGP4 propagation using TLE without thruster maneuver
   kRelativeOrbit,  //!< Relative dynamics (for formation flying simulation)
   kKepler,         //!< Kepler orbit propagation without disturbances and thruster maneuver
-  kEncke           //!< Encke orbit propagation with disturbances and thruster maneuver
+  kEncke,          //!< Encke orbit propagation with disturbances and thruster maneuver
+  kRkf             //!< Runge-Kutta-Fehlberg propagation with adaptive step width and dense output with disturbances and thruster maneuver
 };
 
 /**
@@ -63,6 +66,13 @@ class Orbit : public ILoggable {
    * @param [in] current_time_jd: Current Julian day [day]
    */
   virtual void Propagate(const double end_time_s, const double current_time_jd) = 0;
+  /**
+   * @fn SetStepLimitTime_s
+   * @brief Set the time which an integration step must not step over (e.g. a predicted discontinuity of the disturbance)
+   * @note Only the propagation with the adaptive step width uses it
+   * @param [in] time_s: Limit time [sec]
+   */
+  virtual void SetStepLimitTime_s(const double time_s) { UNUSED(time_s); }
 
   /**
    * @fn UpdateByAttitude
@@ -172,6 +182,17 @@ class Orbit : public ILoggable {
    */
   libra::Quaternion CalcQuaternion_i2lvlh() const;
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the orbit state into the snapshot
+   */
+  virtual void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the orbit state from the snapshot
+   */
+  virtual void RestoreSnapshot(Snapshot& snapshot);
+
   // Override ILoggable
   /**
    * @fn GetLogHeader
@@ -183,6 +204,11 @@ class Orbit : public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(LogRecord& record) const;
 
  protected:
   const CelestialInformation* celestial_information_;  //!< Celestial information
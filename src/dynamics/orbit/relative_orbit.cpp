@@ -158,3 +158,24 @@ void RelativeOrbit::DerivativeFunction(double t, const libra::Vector<6>& state,
   rhs = system_matrix_ * state;
   (void)t;
 }
+
+void RelativeOrbit::SaveSnapshot(Snapshot& snapshot) const {
+  Orbit::SaveSnapshot(snapshot);
+  snapshot.Write(relative_position_lvlh_m_);
+  snapshot.Write(relative_velocity_lvlh_m_s_);
+  snapshot.Write(propagation_time_s_);
+  snapshot.Write(GetIndependentVariable());
+  snapshot.Write(GetState());
+}
+
+void RelativeOrbit::RestoreSnapshot(Snapshot& snapshot) {
+  Orbit::RestoreSnapshot(snapshot);
+  snapshot.Read(relative_position_lvlh_m_);
+  snapshot.Read(relative_velocity_lvlh_m_s_);
+  snapshot.Read(propagation_time_s_);
+  double independent_variable = GetIndependentVariable();
+  libra::Vector<6> state = GetState();
+  snapshot.Read(independent_variable);
+  snapshot.Read(state);
+  Setup(independent_variable, state);
+}
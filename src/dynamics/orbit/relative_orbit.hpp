@@ -67,6 +67,17 @@ class RelativeOrbit : public Orbit, public libra::OrdinaryDifferentialEquation<6
    */
   virtual void DerivativeFunction(double t, const Vector<6>& state, Vector<6>& rhs);
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the orbit state and the relative state into the snapshot
+   */
+  virtual void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the orbit state and the relative state from the snapshot
+   */
+  virtual void RestoreSnapshot(Snapshot& snapshot);
+
  private:
   double gravity_constant_m3_s2_;         //!< Gravity constant of the center body [m3/s2]
   unsigned int reference_spacecraft_id_;  //!< Reference satellite ID
@@ -86,3 +86,20 @@ void Rk4OrbitPropagation::Propagate(const double end_time_s, const double curren
   TransformEciToEcef();
   TransformEcefToGeodetic();
 }
+
+void Rk4OrbitPropagation::SaveSnapshot(Snapshot& snapshot) const {
+  Orbit::SaveSnapshot(snapshot);
+  snapshot.Write(propagation_time_s_);
+  snapshot.Write(GetIndependentVariable());
+  snapshot.Write(GetState());
+}
+
+void Rk4OrbitPropagation::RestoreSnapshot(Snapshot& snapshot) {
+  Orbit::RestoreSnapshot(snapshot);
+  snapshot.Read(propagation_time_s_);
+  double independent_variable = GetIndependentVariable();
+  libra::Vector<6> state = GetState();
+  snapshot.Read(independent_variable);
+  snapshot.Read(state);
+  Setup(independent_variable, state);
+}
@@ -54,6 +54,17 @@ class Rk4OrbitPropagation : public Orbit, public libra::OrdinaryDifferentialEqua
    */
   virtual void Propagate(const double end_time_s, const double current_time_jd);
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the orbit state and the integration state into the snapshot
+   */
+  virtual void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the orbit state and the integration state from the snapshot
+   */
+  virtual void RestoreSnapshot(Snapshot& snapshot);
+
  private:
   double gravity_constant_m3_s2_;  //!< Gravity constant [m3/s2]
   double propagation_time_s_;      //!< Simulation current time for numerical integration by RK4 [sec]
@@ -0,0 +1,142 @@
+/**
+ * @file rkf_orbit_propagation.cpp
+ * @brief Class to propagate spacecraft orbit with Runge-Kutta-Fehlberg method with adaptive step width and dense output
+ */
+#include "rkf_orbit_propagation.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <library/utilities/macros.hpp>
+
+RkfOrbitPropagation::RkfOrbitPropagation(const CelestialInformation* celestial_information, const double gravity_constant_m3_s2,
+                                         const double initial_step_s, const libra::Vector<3> position_i_m, const libra::Vector<3> velocity_i_m_s,
+                                         const double error_tolerance, const double max_step_s, const double initial_time_s)
+    : Orbit(celestial_information),
+      gravity_constant_m3_s2_(gravity_constant_m3_s2),
+      error_tolerance_(error_tolerance),
+      max_step_s_(max_step_s),
+      numerical_integrator_(initial_step_s, *this),
+      step_start_time_s_(initial_time_s),
+      step_end_time_s_(initial_time_s),
+      next_step_s_(std::min(std::max(initial_step_s, kMinStep_s), max_step_s)),
+      propagation_time_s_(initial_time_s),
+      step_acceleration_i_m_s2_(0.0) {
+  propagate_mode_ = OrbitPropagateMode::kRkf;
+
+  spacecraft_acceleration_i_m_s2_.FillUp(0.0);
+  spacecraft_position_i_m_ = position_i_m;
+  spacecraft_velocity_i_m_s_ = velocity_i_m_s;
+  Restart();
+
+  TransformEciToEcef();
+  TransformEcefToGeodetic();
+}
+
+RkfOrbitPropagation::~RkfOrbitPropagation() {}
+
+libra::Vector<6> RkfOrbitPropagation::DerivativeFunction(const double time_s, const libra::Vector<6>& state) const {
+  UNUSED(time_s);
+
+  const double r3 = pow(state[0] * state[0] + state[1] * state[1] + state[2] * state[2], 1.5);
+
+  libra::Vector<6> rhs;
+  for (size_t i = 0; i < 3; i++) {
+    rhs[i] = state[i + 3];
+    rhs[i + 3] = step_acceleration_i_m_s2_[i] - gravity_constant_m3_s2_ / r3 * state[i];
+  }
+  return rhs;
+}
+
+void RkfOrbitPropagation::Propagate(const double end_time_s, const double current_time_jd) {
+  UNUSED(current_time_jd);
+
+  if (!is_calc_enabled_) return;
+
+  // The latest step was integrated with the acceleration at its beginning.
+  // Restart when the position error caused by the acceleration change in the rest of the step exceeds the tolerance.
+  const double remaining_step_s = step_end_time_s_ - propagation_time_s_;
+  const double acceleration_change_m_s2 = (spacecraft_acceleration_i_m_s2_ - step_acceleration_i_m_s2_).CalcNorm();
+  if (remaining_step_s > 0.0 && 0.5 * acceleration_change_m_s2 * remaining_step_s * remaining_step_s > error_tolerance_) {
+    Restart();
+  }
+
+  while (step_end_time_s_ < end_time_s - kTimeTolerance_s) {
+    Step();
+  }
+
+  // Dense output
+  libra::Vector<6> state;
+  const double step_s = step_end_time_s_ - step_start_time_s_;
+  if (step_s < kTimeTolerance_s || step_end_time_s_ - end_time_s < kTimeTolerance_s) {
+    state = numerical_integrator_.GetState();
+  } else {
+    state = numerical_integrator_.CalcInterpolationState((end_time_s - step_start_time_s_) / step_s);
+  }
+  propagation_time_s_ = end_time_s;
+
+  for (size_t i = 0; i < 3; i++) {
+    spacecraft_position_i_m_[i] = state[i];
+    spacecraft_velocity_i_m_s_[i] = state[i + 3];
+  }
+
+  TransformEciToEcef();
+  TransformEcefToGeodetic();
+}
+
+void RkfOrbitPropagation::SaveSnapshot(Snapshot& snapshot) const {
+  Orbit::SaveSnapshot(snapshot);
+  snapshot.Write(propagation_time_s_);
+  snapshot.Write(next_step_s_);
+}
+
+void RkfOrbitPropagation::RestoreSnapshot(Snapshot& snapshot) {
+  Orbit::RestoreSnapshot(snapshot);
+  snapshot.Read(propagation_time_s_);
+  snapshot.Read(next_step_s_);
+  // The slopes of the latest step are not stored, so the integration restarts from the dense output at the restored time
+  Restart();
+}
+
+void RkfOrbitPropagation::Restart() {
+  libra::Vector<6> state;
+  for (size_t i = 0; i < 3; i++) {
+    state[i] = spacecraft_position_i_m_[i];
+    state[i + 3] = spacecraft_velocity_i_m_s_[i];
+  }
+  numerical_integrator_.SetState(propagation_time_s_, state);
+  step_start_time_s_ = propagation_time_s_;
+  step_end_time_s_ = propagation_time_s_;
+}
+
+void RkfOrbitPropagation::Step() {
+  const libra::Vector<6> start_state = numerical_integrator_.GetState();
+  step_acceleration_i_m_s2_ = spacecraft_acceleration_i_m_s2_;
+
+  while (true) {
+    // The step is shortened to end at the limit time
+    const bool is_limited = step_limit_time_s_ > step_end_time_s_ + kMinStep_s && step_limit_time_s_ < step_end_time_s_ + next_step_s_;
+    const double step_s = is_limited ? step_limit_time_s_ - step_end_time_s_ : next_step_s_;
+    numerical_integrator_.SetStepWidth(step_s);
+    numerical_integrator_.Integrate();
+
+    // Step width control (4th order error estimation)
+    const double error = numerical_integrator_.GetLocalTruncationError();
+    double scale = kMaxStepScale;
+    if (error > 0.0) scale = std::min(kMaxStepScale, std::max(kMinStepScale, kSafetyFactor * pow(error_tolerance_ / error, 0.2)));
+
+    if (error <= error_tolerance_ || step_s <= kMinStep_s) {
+      // Accept. The step width of the integrator is kept until the next step for the interpolation.
+      step_start_time_s_ = step_end_time_s_;
+      step_end_time_s_ += step_s;
+      // The shortened step width is not used for the step width control
+      if (!is_limited) next_step_s_ = std::min(max_step_s_, std::max(kMinStep_s, step_s * scale));
+      number_of_steps_++;
+      return;
+    }
+
+    // Reject and retry with the smaller step
+    numerical_integrator_.SetState(step_end_time_s_, start_state);
+    next_step_s_ = std::max(kMinStep_s, step_s * scale);
+    number_of_rejected_steps_++;
+  }
+}
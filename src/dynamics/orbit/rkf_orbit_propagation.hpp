@@ -0,0 +1,127 @@
+/**
+ * @file rkf_orbit_propagation.hpp
+ * @brief Class to propagate spacecraft orbit with Runge-Kutta-Fehlberg method with adaptive step width and dense output
+ */
+
+#ifndef S2E_DYNAMICS_ORBIT_RKF_ORBIT_PROPAGATION_HPP_
+#define S2E_DYNAMICS_ORBIT_RKF_ORBIT_PROPAGATION_HPP_
+
+#include <environment/global/celestial_information.hpp>
+#include <library/numerical_integration/runge_kutta_fehlberg.hpp>
+
+#include "orbit.hpp"
+
+/**
+ * @class RkfOrbitPropagation
+ * @brief Class to propagate spacecraft orbit with Runge-Kutta-Fehlberg method with adaptive step width and dense output
+ * @details The integration step width is controlled by the local truncation error and is independent of the simulation step.
+ *          The state at the requested time is calculated with the interpolation of the latest step, so the step is not shortened to land on it.
+ *          The disturbance acceleration is sampled at the beginning of each integration step and held during the step. When the acceleration
+ *          changes so much that the held value violates the error tolerance (e.g. thruster firing), the integration restarts at the latest
+ *          output time.
+ */
+class RkfOrbitPropagation : public Orbit, public libra::numerical_integration::InterfaceOde<6> {
+ public:
+  /**
+   * @fn RkfOrbitPropagation
+   * @brief Constructor
+   * @param [in] celestial_information: Celestial information
+   * @param [in] gravity_constant_m3_s2: Gravity constant [m3/s2]
+   * @param [in] initial_step_s: Initial step width [sec]
+   * @param [in] position_i_m: Initial value of position in the inertial frame [m]
+   * @param [in] velocity_i_m_s: Initial value of velocity in the inertial frame [m/s]
+   * @param [in] error_tolerance: Tolerance of the local truncation error of the position [m] and velocity [m/s] vector
+   * @param [in] max_step_s: Maximum step width [sec]
+   * @param [in] initial_time_s: Initial time [sec]
+   */
+  RkfOrbitPropagation(const CelestialInformation* celestial_information, const double gravity_constant_m3_s2, const double initial_step_s,
+                      const libra::Vector<3> position_i_m, const libra::Vector<3> velocity_i_m_s, const double error_tolerance,
+                      const double max_step_s, const double initial_time_s = 0.0);
+  /**
+   * @fn ~RkfOrbitPropagation
+   * @brief Destructor
+   */
+  ~RkfOrbitPropagation();
+
+  // Override InterfaceOde
+  /**
+   * @fn DerivativeFunction
+   * @brief Right Hand Side of ordinary difference equation
+   * @param [in] time_s: Time as independent variable [sec]
+   * @param [in] state: Position and velocity as state vector
+   * @return Differentiated value of state vector
+   */
+  virtual libra::Vector<6> DerivativeFunction(const double time_s, const libra::Vector<6>& state) const;
+
+  // Override Orbit
+  /**
+   * @fn Propagate
+   * @brief Propagate orbit
+   * @param [in] end_time_s: End time of simulation [sec]
+   * @param [in] current_time_jd: Current Julian day [day]
+   */
+  virtual void Propagate(const double end_time_s, const double current_time_jd);
+  /**
+   * @fn SetStepLimitTime_s
+   * @brief Set the time which an integration step must not step over. The step is shortened to end at the time.
+   * @param [in] time_s: Limit time [sec]
+   */
+  virtual void SetStepLimitTime_s(const double time_s) { step_limit_time_s_ = time_s; }
+
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the orbit state and the step width into the snapshot
+   */
+  virtual void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the orbit state and the step width from the snapshot, and restart the integration from the restored state
+   */
+  virtual void RestoreSnapshot(Snapshot& snapshot);
+
+  // Getter
+  /**
+   * @fn GetNumberOfSteps
+   * @brief Return number of accepted integration steps
+   */
+  inline size_t GetNumberOfSteps() const { return number_of_steps_; }
+  /**
+   * @fn GetNumberOfRejectedSteps
+   * @brief Return number of rejected integration steps
+   */
+  inline size_t GetNumberOfRejectedSteps() const { return number_of_rejected_steps_; }
+
+ private:
+  double gravity_constant_m3_s2_;  //!< Gravity constant [m3/s2]
+  double error_tolerance_;         //!< Tolerance of the local truncation error
+  double max_step_s_;              //!< Maximum step width [sec]
+
+  libra::numerical_integration::RungeKuttaFehlberg<6> numerical_integrator_;  //!< Numerical integrator
+  double step_start_time_s_;                                                  //!< Start time of the latest step [sec]
+  double step_end_time_s_;                                                    //!< End time of the latest step [sec]
+  double next_step_s_;                                                        //!< Step width for the next step [sec]
+  double propagation_time_s_;                                                 //!< Time of the latest output state [sec]
+  double step_limit_time_s_ = -1.0;                                           //!< Time which a step must not step over [sec]
+  libra::Vector<3> step_acceleration_i_m_s2_;                                 //!< Acceleration held in the latest step in the inertial frame [m/s2]
+  size_t number_of_steps_ = 0;                                                //!< Number of accepted steps
+  size_t number_of_rejected_steps_ = 0;                                       //!< Number of rejected steps
+
+  static constexpr double kSafetyFactor = 0.9;        //!< Safety factor of the step width control
+  static constexpr double kMinStepScale = 0.2;        //!< Minimum scale of the step width per step
+  static constexpr double kMaxStepScale = 5.0;        //!< Maximum scale of the step width per step
+  static constexpr double kMinStep_s = 1.0e-3;        //!< Minimum step width [sec]
+  static constexpr double kTimeTolerance_s = 1.0e-9;  //!< Tolerance to judge the step end reaches the requested time [sec]
+
+  /**
+   * @fn Restart
+   * @brief Restart the integration from the latest output state
+   */
+  void Restart();
+  /**
+   * @fn Step
+   * @brief Execute an integration step with the step width control
+   */
+  void Step();
+};
+
+#endif  // S2E_DYNAMICS_ORBIT_RKF_ORBIT_PROPAGATION_HPP_
@@ -0,0 +1,174 @@
+/**
+ * @file test_rkf_orbit_propagation.cpp
+ * @brief Test codes for RkfOrbitPropagation class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdio>
+#include <library/orbit/chebyshev_ephemeris.hpp>
+#include <library/utilities/macros.hpp>
+#include <memory>
+#include <vector>
+
+#include "rkf_orbit_propagation.hpp"
+
+static const double kGravityConstant_m3_s2 = 3.986004418e14;
+static const double kSemiMajorAxis_m = 7.5e6;
+static const double kEccentricity = 0.1;
+static const double kInclination_rad = 0.5;
+
+/**
+ * @brief Analytic solution of the two-body orbit which starts at the perigee
+ * @param [in] time_s: Elapsed time from the perigee [sec]
+ * @param [out] position_i_m: Position in the inertial frame [m]
+ * @param [out] velocity_i_m_s: Velocity in the inertial frame [m/s]
+ */
+static void CalcTwoBodyOrbit(const double time_s, libra::Vector<3>& position_i_m, libra::Vector<3>& velocity_i_m_s) {
+  const double mean_motion_rad_s = sqrt(kGravityConstant_m3_s2 / pow(kSemiMajorAxis_m, 3.0));
+  const double mean_anomaly_rad = mean_motion_rad_s * time_s;
+  double eccentric_anomaly_rad = mean_anomaly_rad;
+  for (size_t i = 0; i < 20; i++) {
+    eccentric_anomaly_rad -= (eccentric_anomaly_rad - kEccentricity * sin(eccentric_anomaly_rad) - mean_anomaly_rad) /
+                             (1.0 - kEccentricity * cos(eccentric_anomaly_rad));
+  }
+  const double semi_minor_axis_m = kSemiMajorAxis_m * sqrt(1.0 - kEccentricity * kEccentricity);
+  const double eccentric_anomaly_rate_rad_s = mean_motion_rad_s / (1.0 - kEccentricity * cos(eccentric_anomaly_rad));
+  const double x_m = kSemiMajorAxis_m * (cos(eccentric_anomaly_rad) - kEccentricity);
+  const double y_m = semi_minor_axis_m * sin(eccentric_anomaly_rad);
+  const double vx_m_s = -kSemiMajorAxis_m * sin(eccentric_anomaly_rad) * eccentric_anomaly_rate_rad_s;
+  const double vy_m_s = semi_minor_axis_m * cos(eccentric_anomaly_rad) * eccentric_anomaly_rate_rad_s;
+
+  // The orbital plane is inclined around the X axis
+  position_i_m[0] = x_m;
+  position_i_m[1] = y_m * cos(kInclination_rad);
+  position_i_m[2] = y_m * sin(kInclination_rad);
+  velocity_i_m_s[0] = vx_m_s;
+  velocity_i_m_s[1] = vy_m_s * cos(kInclination_rad);
+  velocity_i_m_s[2] = vy_m_s * sin(kInclination_rad);
+}
+
+/**
+ * @brief Ephemeris of the center body, which stays at the origin
+ */
+static void SampleCenterBody(const double time_s, double state[6]) {
+  UNUSED(time_s);
+  for (size_t i = 0; i < 6; i++) state[i] = 0.0;
+}
+
+/**
+ * @class RkfOrbitPropagationFixture
+ * @brief Celestial information made from the precomputed ephemeris file without SPICE
+ */
+class RkfOrbitPropagationFixture : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ChebyshevEphemerisTimeSystem time_system;
+    ChebyshevEphemerisWriter writer(0.0, 86400.0, "J2000", "NONE", "EARTH", time_system);
+    const double radii_m[3] = {6378137.0, 6378137.0, 6356752.0};
+    writer.AddBody(399, "EARTH", kGravityConstant_m3_s2, radii_m, SampleCenterBody, 1.0);
+    ASSERT_TRUE(writer.Write(kEphemerisFilePath));
+    std::shared_ptr<const ChebyshevEphemeris> ephemeris = std::make_shared<const ChebyshevEphemeris>(kEphemerisFilePath);
+    ASSERT_TRUE(ephemeris->IsLoaded());
+    // The body IDs are owned by the celestial information
+    int* body_ids = new int[1];
+    body_ids[0] = 399;
+    celestial_information_ = std::make_unique<CelestialInformation>(ephemeris, RotationMode::kIdle, 1, body_ids);
+  }
+  void TearDown() override {
+    celestial_information_.reset();
+    std::remove(kEphemerisFilePath);
+  }
+
+  /**
+   * @brief Make the propagation which starts at the perigee of the two-body orbit
+   * @param [in] error_tolerance: Tolerance of the local truncation error
+   */
+  std::unique_ptr<RkfOrbitPropagation> MakePropagation(const double error_tolerance) {
+    libra::Vector<3> position_i_m, velocity_i_m_s;
+    CalcTwoBodyOrbit(0.0, position_i_m, velocity_i_m_s);
+    std::unique_ptr<RkfOrbitPropagation> propagation = std::make_unique<RkfOrbitPropagation>(
+        celestial_information_.get(), kGravityConstant_m3_s2, 10.0, position_i_m, velocity_i_m_s, error_tolerance, 600.0);
+    propagation->SetIsCalcEnabled(true);
+    return propagation;
+  }
+
+  static constexpr const char* kEphemerisFilePath = "test_rkf_orbit_propagation.bin";
+  std::unique_ptr<CelestialInformation> celestial_information_;
+};
+
+/**
+ * @brief Test for the error of the adaptive steps compared with the analytic solution over one orbit
+ */
+TEST_F(RkfOrbitPropagationFixture, TwoBody) {
+  const double period_s = 2.0 * M_PI * sqrt(pow(kSemiMajorAxis_m, 3.0) / kGravityConstant_m3_s2);
+  const double output_step_s = 60.0;
+  const size_t number_of_outputs = (size_t)(period_s / output_step_s);
+  const double tolerances[] = {1.0, 1.0e-4};
+  std::vector<double> max_errors_m, max_velocity_errors_m_s;
+  std::vector<size_t> numbers_of_steps;
+  for (const double tolerance : tolerances) {
+    std::unique_ptr<RkfOrbitPropagation> propagation = MakePropagation(tolerance);
+    double max_error_m = 0.0, max_velocity_error_m_s = 0.0;
+    for (size_t i = 1; i <= number_of_outputs; i++) {
+      const double time_s = output_step_s * i;
+      propagation->Propagate(time_s, 0.0);
+      libra::Vector<3> position_i_m, velocity_i_m_s;
+      CalcTwoBodyOrbit(time_s, position_i_m, velocity_i_m_s);
+      max_error_m = std::max(max_error_m, (propagation->GetPosition_i_m() - position_i_m).CalcNorm());
+      max_velocity_error_m_s = std::max(max_velocity_error_m_s, (propagation->GetVelocity_i_m_s() - velocity_i_m_s).CalcNorm());
+    }
+    max_errors_m.push_back(max_error_m);
+    max_velocity_errors_m_s.push_back(max_velocity_error_m_s);
+    numbers_of_steps.push_back(propagation->GetNumberOfSteps());
+  }
+
+  // The integration steps are longer than the output step with the loose tolerance
+  EXPECT_LT(numbers_of_steps[0], number_of_outputs);
+  EXPECT_GT(numbers_of_steps[1], numbers_of_steps[0]);
+  // The global error decreases with the tolerance
+  EXPECT_LT(max_errors_m[0], 100.0);
+  EXPECT_LT(max_velocity_errors_m_s[0], 0.1);
+  EXPECT_LT(max_errors_m[1], 0.01);
+  EXPECT_LT(max_velocity_errors_m_s[1], 2.0e-5);
+  EXPECT_LT(max_errors_m[1], 1.0e-3 * max_errors_m[0]);
+}
+
+/**
+ * @brief Test for the dense output at the times between the integration steps
+ */
+TEST_F(RkfOrbitPropagationFixture, DenseOutput) {
+  const double end_time_s = 3000.0;
+  const double fine_step_s = 7.0;
+  const double coarse_step_s = 300.0;
+
+  // The integration steps do not depend on the output times
+  std::unique_ptr<RkfOrbitPropagation> fine_propagation = MakePropagation(1.0e-2);
+  std::unique_ptr<RkfOrbitPropagation> coarse_propagation = MakePropagation(1.0e-2);
+  size_t number_of_checked_outputs = 0;
+  double max_dense_error_m = 0.0, max_dense_velocity_error_m_s = 0.0;
+  for (double time_s = fine_step_s; time_s <= end_time_s; time_s += fine_step_s) {
+    fine_propagation->Propagate(time_s, 0.0);
+    libra::Vector<3> position_i_m, velocity_i_m_s;
+    CalcTwoBodyOrbit(time_s, position_i_m, velocity_i_m_s);
+    max_dense_error_m = std::max(max_dense_error_m, (fine_propagation->GetPosition_i_m() - position_i_m).CalcNorm());
+    max_dense_velocity_error_m_s = std::max(max_dense_velocity_error_m_s, (fine_propagation->GetVelocity_i_m_s() - velocity_i_m_s).CalcNorm());
+
+    const double coarse_time_s = coarse_step_s * (number_of_checked_outputs + 1);
+    if (time_s + fine_step_s > coarse_time_s) {
+      // Compare at the last fine output before the coarse time, which is between the integration steps
+      coarse_propagation->Propagate(time_s, 0.0);
+      for (size_t i = 0; i < 3; i++) {
+        EXPECT_NEAR(fine_propagation->GetPosition_i_m()[i], coarse_propagation->GetPosition_i_m()[i], 1.0e-6);
+        EXPECT_NEAR(fine_propagation->GetVelocity_i_m_s()[i], coarse_propagation->GetVelocity_i_m_s()[i], 1.0e-9);
+      }
+      number_of_checked_outputs++;
+    }
+  }
+  EXPECT_EQ(10u, number_of_checked_outputs);
+  EXPECT_LT(max_dense_error_m, 0.2);
+  EXPECT_LT(max_dense_velocity_error_m_s, 2.0e-4);
+  // Most of the outputs are interpolated in the integration steps
+  EXPECT_EQ(fine_propagation->GetNumberOfSteps(), coarse_propagation->GetNumberOfSteps());
+  EXPECT_LT(fine_propagation->GetNumberOfSteps(), (size_t)(end_time_s / fine_step_s) / 5);
+}
@@ -0,0 +1,195 @@
+/**
+ * @file benchmark_temperature.cpp
+ * @brief Micro-benchmark of Temperature class with synthetic thermal networks
+ * @note The reference implementation is the former Temperature which uses the dense matrices, calculates pow(T, 4) for every pair, and
+ *       allocates the vectors at every stage. The stage temperatures are used in the reference as in the current implementation.
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <environment/global/physical_constants.hpp>
+#include <vector>
+
+#include "temperature.hpp"
+
+/**
+ * @class ReferenceTemperature
+ * @brief Former implementation of Temperature with the dense matrices and per-stage vectors
+ */
+class ReferenceTemperature {
+ public:
+  ReferenceTemperature(const std::vector<std::vector<double>> conductance_matrix_W_K, const std::vector<std::vector<double>> radiation_matrix_m2,
+                       std::vector<Node> nodes, std::vector<Heatload> heatloads, const double propagation_step_s)
+      : conductance_matrix_W_K_(conductance_matrix_W_K),
+        radiation_matrix_m2_(radiation_matrix_m2),
+        nodes_(nodes),
+        heatloads_(heatloads),
+        node_num_((int)nodes.size()),
+        propagation_step_s_(propagation_step_s) {}
+
+  void Propagate(const double time_end_s) {
+    while (time_end_s - propagation_time_s_ - propagation_step_s_ > 1.0e-6) {
+      CalcRungeOneStep(propagation_time_s_, propagation_step_s_);
+      propagation_time_s_ += propagation_step_s_;
+    }
+    CalcRungeOneStep(propagation_time_s_, time_end_s - propagation_time_s_);
+    propagation_time_s_ = time_end_s;
+  }
+
+  inline const std::vector<Node>& GetNodes() const { return nodes_; }
+
+ private:
+  std::vector<std::vector<double>> conductance_matrix_W_K_;
+  std::vector<std::vector<double>> radiation_matrix_m2_;
+  std::vector<Node> nodes_;
+  std::vector<Heatload> heatloads_;
+  int node_num_;
+  double propagation_step_s_;
+  double propagation_time_s_ = 0.0;
+
+  void CalcRungeOneStep(const double time_now_s, const double time_step_s) {
+    std::vector<double> temperatures_now_K(node_num_);
+    for (int i = 0; i < node_num_; i++) temperatures_now_K[i] = nodes_[i].GetTemperature_K();
+
+    std::vector<double> k1(node_num_), k2(node_num_), k3(node_num_), k4(node_num_);
+    std::vector<double> xk2(node_num_), xk3(node_num_), xk4(node_num_);
+    k1 = CalcTemperatureDifferentials(temperatures_now_K, time_now_s);
+    for (int i = 0; i < node_num_; i++) xk2[i] = temperatures_now_K[i] + (time_step_s / 2.0) * k1[i];
+    k2 = CalcTemperatureDifferentials(xk2, time_now_s + time_step_s / 2.0);
+    for (int i = 0; i < node_num_; i++) xk3[i] = temperatures_now_K[i] + (time_step_s / 2.0) * k2[i];
+    k3 = CalcTemperatureDifferentials(xk3, time_now_s + time_step_s / 2.0);
+    for (int i = 0; i < node_num_; i++) xk4[i] = temperatures_now_K[i] + time_step_s * k3[i];
+    k4 = CalcTemperatureDifferentials(xk4, time_now_s + time_step_s);
+
+    std::vector<double> temperatures_next_K(node_num_);
+    for (int i = 0; i < node_num_; i++) {
+      temperatures_next_K[i] = temperatures_now_K[i] + (time_step_s / 6.0) * (k1[i] + 2.0 * k2[i] + 2.0 * k3[i] + k4[i]);
+    }
+    for (int i = 0; i < node_num_; i++) nodes_[i].SetTemperature_K(temperatures_next_K[i]);
+  }
+
+  std::vector<double> CalcTemperatureDifferentials(std::vector<double> temperatures_K, const double t) {
+    std::vector<double> differentials_K_s(node_num_);
+    for (int i = 0; i < node_num_; i++) {
+      heatloads_[i].SetElapsedTime_s(t);
+      if (nodes_[i].GetNodeType() != NodeType::kDiffusive) continue;
+      heatloads_[i].CalcInternalHeatload();
+      heatloads_[i].UpdateTotalHeatload();
+      double conductive_heat_input_W = 0;
+      double radiative_heat_input_W = 0;
+      for (int j = 0; j < node_num_; j++) {
+        conductive_heat_input_W += conductance_matrix_W_K_[i][j] * (temperatures_K[j] - temperatures_K[i]);
+        radiative_heat_input_W += environment::stefan_boltzmann_constant_W_m2K4 * radiation_matrix_m2_[i][j] *
+                                  (pow(temperatures_K[j], 4) - pow(temperatures_K[i], 4));
+      }
+      differentials_K_s[i] = (conductive_heat_input_W + radiative_heat_input_W + heatloads_[i].GetTotalHeatload_W()) / nodes_[i].GetCapacity_J_K();
+    }
+    return differentials_K_s;
+  }
+};
+
+/**
+ * @struct SyntheticNetwork
+ * @brief Synthetic thermal network
+ */
+struct SyntheticNetwork {
+  std::vector<std::vector<double>> conductance_matrix_W_K;
+  std::vector<std::vector<double>> radiation_matrix_m2;
+  std::vector<Node> nodes;
+  std::vector<Heatload> heatloads;
+};
+
+/**
+ * @fn MakeSyntheticNetwork
+ * @brief Make a sparse network: each node conducts to the four neighbors on a ring and radiates to four other nodes and deep space
+ * @param [in] diffusive_node_num: Number of the diffusive nodes. A boundary node for deep space is added at the end.
+ */
+static SyntheticNetwork MakeSyntheticNetwork(const size_t diffusive_node_num) {
+  const size_t node_num = diffusive_node_num + 1;
+  const size_t space = diffusive_node_num;
+  SyntheticNetwork network;
+  network.conductance_matrix_W_K.assign(node_num, std::vector<double>(node_num, 0.0));
+  network.radiation_matrix_m2.assign(node_num, std::vector<double>(node_num, 0.0));
+
+  unsigned long long state = 0x2545f4914f6cdd1dULL;
+  auto random = [&state]() {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return (double)(state % 1000000) / 1000000.0;
+  };
+  auto couple = [](std::vector<std::vector<double>>& matrix, const size_t i, const size_t j, const double value) {
+    matrix[i][j] = value;
+    matrix[j][i] = value;
+  };
+
+  libra::Vector<3> normal_vector_b(0.0);
+  normal_vector_b[0] = 1.0;
+  const std::vector<double> time_table_s = {0.0, 500.0, 1000.0};
+  for (size_t i = 0; i < diffusive_node_num; i++) {
+    for (size_t d = 1; d <= 2 && d < diffusive_node_num; d++) {
+      couple(network.conductance_matrix_W_K, i, (i + d) % diffusive_node_num, 0.1 + random());
+    }
+    for (size_t d = 0; d < 2; d++) {
+      const size_t j = (size_t)(random() * (double)diffusive_node_num);
+      if (j != i) couple(network.radiation_matrix_m2, i, j, 0.01 * random());
+    }
+    couple(network.radiation_matrix_m2, i, space, 0.05 * random());
+
+    network.nodes.push_back(
+        Node((int)i, "node", NodeType::kDiffusive, 0, 270.0 + 40.0 * random(), 100.0 + 900.0 * random(), 0.3, 0.1, normal_vector_b));
+    const double power_W = 5.0 * random();
+    network.heatloads.push_back(Heatload((int)i, time_table_s, {power_W, 0.5 * power_W, power_W}));
+  }
+  network.nodes.push_back(Node((int)space, "space", NodeType::kBoundary, 0, 3.0, 1.0, 0.0, 0.0, normal_vector_b));
+  network.heatloads.push_back(Heatload((int)space, time_table_s, {0.0, 0.0, 0.0}));
+  return network;
+}
+
+/**
+ * @fn MeasureTime_us
+ * @brief Measure the average execution time of the function [us]
+ */
+template <typename Function>
+static double MeasureTime_us(const size_t number_of_calls, Function function) {
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < number_of_calls; i++) function(i);
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count() / (double)number_of_calls;
+}
+
+int main(int argc, char* argv[]) {
+  // Usage: benchmark_temperature [max_node_num]
+  const size_t max_node_num = (argc > 1) ? (size_t)atoi(argv[1]) : 2000;
+  const size_t node_nums[] = {50, 500, 2000};
+  const double step_s = 1.0;
+
+  printf("nodes, couplings, reference_step_us, step_us, max_temperature_difference_K\n");
+  for (size_t node_num : node_nums) {
+    if (node_num > max_node_num) break;
+
+    SyntheticNetwork network = MakeSyntheticNetwork(node_num);
+    ReferenceTemperature reference(network.conductance_matrix_W_K, network.radiation_matrix_m2, network.nodes, network.heatloads, step_s);
+    Temperature target(network.conductance_matrix_W_K, network.radiation_matrix_m2, network.nodes, network.heatloads, {}, {},
+                       (int)network.nodes.size(), step_s, true, SolarCalcSetting::kDisable, false);
+    const ThermalNetwork thermal_network(network.conductance_matrix_W_K, network.radiation_matrix_m2);
+
+    libra::Vector<3> sun_direction_b(0.0);
+    sun_direction_b[0] = 1.5e11;
+    const size_t number_of_steps = 4000000 / (node_num * node_num) + 10;
+    const double reference_step_us = MeasureTime_us(number_of_steps, [&](size_t i) { reference.Propagate((double)(i + 1) * step_s); });
+    const double step_us = MeasureTime_us(number_of_steps, [&](size_t i) { target.Propagate(sun_direction_b, (double)(i + 1) * step_s); });
+
+    double max_difference_K = 0.0;
+    const std::vector<Node> nodes = target.GetNodes();
+    for (size_t i = 0; i < nodes.size(); i++) {
+      max_difference_K = fmax(max_difference_K, fabs(nodes[i].GetTemperature_K() - reference.GetNodes()[i].GetTemperature_K()));
+    }
+
+    printf("%zu, %zu, %f, %f, %e\n", node_num, thermal_network.GetNumberOfCouplings(), reference_step_us, step_us, max_difference_K);
+  }
+
+  return 0;
+}
@@ -6,6 +6,7 @@
 #include "initialize_temperature.hpp"
 
 #include <environment/global/simulation_time.hpp>
+#include <iostream>
 #include <library/initialize/initialize_file_access.hpp>
 #include <string>
 
@@ -93,6 +94,14 @@ Temperature* InitTemperature(const std::string file_name, const double rk_prop_s
 
   bool debug = mainIni.ReadEnable("THERMAL", "debug");
 
+  ThermalIntegrationMethod integration_method = ThermalIntegrationMethod::kRk4;
+  string integration_method_str = mainIni.ReadString("THERMAL", "integration_method");
+  if (integration_method_str == "IMPLICIT") {
+    integration_method = ThermalIntegrationMethod::kImplicit;
+  } else if (!integration_method_str.empty() && integration_method_str != "RK4") {
+    std::cerr << "WARNING: thermal integration method: " << integration_method_str << " is not defined! RK4 is used." << std::endl;
+  }
+
   // Read Heatloads from CSV File
   string filepath_heatload = file_path + "heatload.csv";
   IniAccess conf_heatload(filepath_heatload);
@@ -143,6 +152,6 @@ Temperature* InitTemperature(const std::string file_name, const double rk_prop_s
 
   Temperature* temperature;
   temperature = new Temperature(conductance_matrix, radiation_matrix, node_list, heatload_list, heater_list, heater_controller_list, node_num,
-                                rk_prop_step_s, is_calc_enabled, solar_calc_setting, debug);
+                                rk_prop_step_s, is_calc_enabled, solar_calc_setting, debug, integration_method);
   return temperature;
 }
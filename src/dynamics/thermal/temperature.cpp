@@ -8,16 +8,15 @@
 #include <cmath>
 #include <environment/global/physical_constants.hpp>
 #include <iostream>
-#include <library/utilities/macros.hpp>
 #include <vector>
 
 using namespace std;
 
 Temperature::Temperature(const vector<vector<double>> conductance_matrix_W_K, const vector<vector<double>> radiation_matrix_m2, vector<Node> nodes,
                          vector<Heatload> heatloads, vector<Heater> heaters, vector<HeaterController> heater_controllers, const int node_num,
-                         const double propagation_step_s, const bool is_calc_enabled, const SolarCalcSetting solar_calc_setting, const bool debug)
-    : conductance_matrix_W_K_(conductance_matrix_W_K),
-      radiation_matrix_m2_(radiation_matrix_m2),
+                         const double propagation_step_s, const bool is_calc_enabled, const SolarCalcSetting solar_calc_setting, const bool debug,
+                         const ThermalIntegrationMethod integration_method)
+    : thermal_network_(conductance_matrix_W_K, radiation_matrix_m2),
       nodes_(nodes),
       heatloads_(heatloads),
       heaters_(heaters),
@@ -26,8 +25,21 @@ Temperature::Temperature(const vector<vector<double>> conductance_matrix_W_K, co
       propagation_step_s_(propagation_step_s),  // ルンゲクッタ積分時間刻み幅
       is_calc_enabled_(is_calc_enabled),
       solar_calc_setting_(solar_calc_setting),
-      debug_(debug) {
+      debug_(debug),
+      integration_method_(integration_method) {
   propagation_time_s_ = 0;
+  temperatures_now_K_.resize(node_num_);
+  stage_temperatures_K_.resize(node_num_);
+  stage_temperatures4_K4_.resize(node_num_);
+  stage_differentials_K_s_.resize(node_num_);
+  weighted_differentials_K_s_.resize(node_num_);
+  if (integration_method_ == ThermalIntegrationMethod::kImplicit) {
+    stage_base_temperatures_K_.resize(node_num_);
+    newton_residuals_W_.resize(node_num_);
+    newton_corrections_K_.resize(node_num_);
+    jacobian_diagonal_W_K_.resize(node_num_);
+    jacobian_off_diagonal_W_K_.resize(thermal_network_.GetNumberOfCouplings());
+  }
   if (debug_) {
     PrintParams();
   }
@@ -40,17 +52,25 @@ Temperature::Temperature() {
   solar_calc_setting_ = SolarCalcSetting::kDisable;
   is_calc_enabled_ = false;
   debug_ = false;
+  integration_method_ = ThermalIntegrationMethod::kRk4;
 }
 
 Temperature::~Temperature() {}
 
 void Temperature::Propagate(libra::Vector<3> sun_direction_b, const double time_end_s) {
   if (!is_calc_enabled_) return;
+  auto one_step = [&](const double time_step_s) {
+    if (integration_method_ == ThermalIntegrationMethod::kImplicit) {
+      CalcImplicitOneStep(propagation_time_s_, time_step_s, sun_direction_b, node_num_);
+    } else {
+      CalcRungeOneStep(propagation_time_s_, time_step_s, sun_direction_b, node_num_);
+    }
+  };
   while (time_end_s - propagation_time_s_ - propagation_step_s_ > 1.0e-6) {
-    CalcRungeOneStep(propagation_time_s_, propagation_step_s_, sun_direction_b, node_num_);
+    one_step(propagation_step_s_);
     propagation_time_s_ += propagation_step_s_;
   }
-  CalcRungeOneStep(propagation_time_s_, time_end_s - propagation_time_s_, sun_direction_b, node_num_);
+  one_step(time_end_s - propagation_time_s_);
   propagation_time_s_ = time_end_s;
   UpdateHeaterStatus();
 
@@ -78,73 +98,153 @@ void Temperature::Propagate(libra::Vector<3> sun_direction_b, const double time_
 }
 
 void Temperature::CalcRungeOneStep(double time_now_s, double time_step_s, libra::Vector<3> sun_direction_b, int node_num) {
-  vector<double> temperatures_now_K(node_num);
   for (int i = 0; i < node_num; i++) {
-    temperatures_now_K[i] = nodes_[i].GetTemperature_K();
+    temperatures_now_K_[i] = nodes_[i].GetTemperature_K();
   }
 
-  vector<double> k1(node_num), k2(node_num), k3(node_num), k4(node_num);
-  vector<double> xk2(node_num), xk3(node_num), xk4(node_num);
+  UpdateSolarHeatloads(sun_direction_b, node_num);
 
-  k1 = CalcTemperatureDifferentials(temperatures_now_K, time_now_s, sun_direction_b, node_num);
+  // RK4 stages: the temperatures of a stage are calculated with the differentials of the previous stage
+  CalcTemperatureDifferentials(temperatures_now_K_, time_now_s, node_num, stage_differentials_K_s_);
   for (int i = 0; i < node_num; i++) {
-    xk2[i] = temperatures_now_K[i] + (time_step_s / 2.0) * k1[i];
+    weighted_differentials_K_s_[i] = stage_differentials_K_s_[i];
+  }
+  const double stage_ratios[3] = {0.5, 0.5, 1.0};
+  const double stage_weights[3] = {2.0, 2.0, 1.0};
+  for (int stage = 0; stage < 3; stage++) {
+    const double stage_step_s = stage_ratios[stage] * time_step_s;
+    for (int i = 0; i < node_num; i++) {
+      stage_temperatures_K_[i] = temperatures_now_K_[i] + stage_step_s * stage_differentials_K_s_[i];
+    }
+    CalcTemperatureDifferentials(stage_temperatures_K_, time_now_s + stage_step_s, node_num, stage_differentials_K_s_);
+    for (int i = 0; i < node_num; i++) {
+      weighted_differentials_K_s_[i] += stage_weights[stage] * stage_differentials_K_s_[i];
+    }
   }
 
-  k2 = CalcTemperatureDifferentials(xk2, (time_now_s + time_step_s / 2.0), sun_direction_b, node_num);
   for (int i = 0; i < node_num; i++) {
-    xk3[i] = temperatures_now_K[i] + (time_step_s / 2.0) * k2[i];
+    nodes_[i].SetTemperature_K(temperatures_now_K_[i] + (time_step_s / 6.0) * weighted_differentials_K_s_[i]);
   }
+}
 
-  k3 = CalcTemperatureDifferentials(xk3, (time_now_s + time_step_s / 2.0), sun_direction_b, node_num);
+void Temperature::CalcImplicitOneStep(double time_now_s, double time_step_s, libra::Vector<3> sun_direction_b, int node_num) {
+  const double gamma = 1.0 - 1.0 / sqrt(2.0);
+  const double gamma_step_s = gamma * time_step_s;
   for (int i = 0; i < node_num; i++) {
-    xk4[i] = temperatures_now_K[i] + time_step_s * k3[i];
+    temperatures_now_K_[i] = nodes_[i].GetTemperature_K();
   }
+  UpdateSolarHeatloads(sun_direction_b, node_num);
 
-  k4 = CalcTemperatureDifferentials(xk4, (time_now_s + time_step_s), sun_direction_b, node_num);
+  // Stage 1: Y1 = y_n + gamma * h * f(t_n + gamma * h, Y1)
+  for (int i = 0; i < node_num; i++) {
+    stage_base_temperatures_K_[i] = temperatures_now_K_[i];
+    stage_temperatures_K_[i] = temperatures_now_K_[i];
+  }
+  bool is_converged = SolveImplicitStage(time_now_s + gamma_step_s, gamma_step_s, node_num);
 
-  vector<double> temperatures_next_K(node_num);
+  // Stage 2: Y2 = y_n + (1 - gamma) * h * f(t_n + gamma * h, Y1) + gamma * h * f(t_n + h, Y2), and y_n+1 = Y2
+  // f(t_n + gamma * h, Y1) is recovered from the stage 1 equation to avoid the evaluation error
   for (int i = 0; i < node_num; i++) {
-    temperatures_next_K[i] = temperatures_now_K[i] + (time_step_s / 6.0) * (k1[i] + 2.0 * k2[i] + 2.0 * k3[i] + k4[i]);
+    stage_base_temperatures_K_[i] = temperatures_now_K_[i] + ((1.0 - gamma) / gamma) * (stage_temperatures_K_[i] - temperatures_now_K_[i]);
   }
+  is_converged &= SolveImplicitStage(time_now_s + time_step_s, gamma_step_s, node_num);
 
+  if (!is_converged && !is_convergence_warned_) {
+    cerr << "WARNING: Newton iteration of the implicit thermal integration does not converge at " << time_now_s << " s" << endl;
+    is_convergence_warned_ = true;
+  }
   for (int i = 0; i < node_num; i++) {
-    nodes_[i].SetTemperature_K(temperatures_next_K[i]);
+    nodes_[i].SetTemperature_K(stage_temperatures_K_[i]);
   }
 }
 
-vector<double> Temperature::CalcTemperatureDifferentials(vector<double> temperatures_K, double t, libra::Vector<3> sun_direction, int node_num) {
-  // TODO: consider the following unused arguments are really needed
-  UNUSED(temperatures_K);
+bool Temperature::SolveImplicitStage(double time_s, double gamma_step_s, int node_num) {
+  // The heatloads do not depend on the temperatures
+  UpdateHeatloads(time_s, node_num);
 
-  vector<double> differentials_K_s(node_num);
+  for (size_t iteration = 0; iteration < kMaxNewtonIteration; iteration++) {
+    for (int i = 0; i < node_num; i++) {
+      const double temperature2_K2 = stage_temperatures_K_[i] * stage_temperatures_K_[i];
+      stage_temperatures4_K4_[i] = temperature2_K2 * temperature2_K2;
+    }
+
+    // Newton matrix: C - gamma * h * dQ/dT, and residual: gamma * h * Q(Y) - C * (Y - base), which are the stage equation multiplied by C
+    thermal_network_.CalcHeatInputJacobian_W_K(stage_temperatures_K_.data(), jacobian_diagonal_W_K_.data(), jacobian_off_diagonal_W_K_.data());
+    for (int i = 0; i < node_num; i++) {
+      const size_t coupling_begin = thermal_network_.GetFirstCouplingIndex(i);
+      const size_t coupling_end = thermal_network_.GetFirstCouplingIndex(i + 1);
+      if (nodes_[i].GetNodeType() == NodeType::kDiffusive) {
+        const double capacity_J_K = nodes_[i].GetCapacity_J_K();
+        double heat_input_W = thermal_network_.CalcHeatInput_W(i, stage_temperatures_K_.data(), stage_temperatures4_K4_.data());
+        heat_input_W += heatloads_[i].GetTotalHeatload_W();
+        newton_residuals_W_[i] = gamma_step_s * heat_input_W - capacity_J_K * (stage_temperatures_K_[i] - stage_base_temperatures_K_[i]);
+        jacobian_diagonal_W_K_[i] = capacity_J_K - gamma_step_s * jacobian_diagonal_W_K_[i];
+        for (size_t k = coupling_begin; k < coupling_end; k++) jacobian_off_diagonal_W_K_[k] *= -gamma_step_s;
+      } else {
+        // Temperatures of the boundary nodes are fixed
+        newton_residuals_W_[i] = 0.0;
+        jacobian_diagonal_W_K_[i] = 1.0;
+        for (size_t k = coupling_begin; k < coupling_end; k++) jacobian_off_diagonal_W_K_[k] = 0.0;
+      }
+    }
+
+    if (!thermal_network_.SolveLinearSystem(jacobian_diagonal_W_K_.data(), jacobian_off_diagonal_W_K_.data(), newton_residuals_W_.data(),
+                                            newton_corrections_K_.data())) {
+      return false;
+    }
+    double max_correction_K = 0.0;
+    for (int i = 0; i < node_num; i++) {
+      stage_temperatures_K_[i] += newton_corrections_K_[i];
+      max_correction_K = fmax(max_correction_K, fabs(newton_corrections_K_[i]));
+    }
+    if (max_correction_K < kNewtonTolerance_K) return true;
+  }
+  return false;
+}
+
+void Temperature::UpdateSolarHeatloads(libra::Vector<3> sun_direction_b, int node_num) {
+  // The sun direction is constant in the step
+  if (solar_calc_setting_ != SolarCalcSetting::kEnable) return;
   for (int i = 0; i < node_num; i++) {
-    heatloads_[i].SetElapsedTime_s(t);
     if (nodes_[i].GetNodeType() == NodeType::kDiffusive) {
-      if (solar_calc_setting_ == SolarCalcSetting::kEnable) {
-        double solar_radiation_W = nodes_[i].CalcSolarRadiation_W(sun_direction);
-        heatloads_[i].SetSolarHeatload_W(solar_radiation_W);
-      }
+      double solar_radiation_W = nodes_[i].CalcSolarRadiation_W(sun_direction_b);
+      heatloads_[i].SetSolarHeatload_W(solar_radiation_W);
+    }
+  }
+}
+
+void Temperature::UpdateHeatloads(double time_s, int node_num) {
+  for (int i = 0; i < node_num; i++) {
+    heatloads_[i].SetElapsedTime_s(time_s);
+    if (nodes_[i].GetNodeType() == NodeType::kDiffusive) {
       double heater_power_W = GetHeaterPower_W(i);
       heatloads_[i].SetHeaterHeatload_W(heater_power_W);
       heatloads_[i].CalcInternalHeatload();
       heatloads_[i].UpdateTotalHeatload();
+    }
+  }
+}
+
+void Temperature::CalcTemperatureDifferentials(const vector<double>& temperatures_K, double t, int node_num, vector<double>& differentials_K_s) {
+  // The fourth power is calculated once for each node instead of each pair of nodes
+  for (int i = 0; i < node_num; i++) {
+    const double temperature2_K2 = temperatures_K[i] * temperatures_K[i];
+    stage_temperatures4_K4_[i] = temperature2_K2 * temperature2_K2;
+  }
+
+  UpdateHeatloads(t, node_num);
+  for (int i = 0; i < node_num; i++) {
+    if (nodes_[i].GetNodeType() == NodeType::kDiffusive) {
       double total_heatload_W = heatloads_[i].GetTotalHeatload_W();  // Total heatload (solar + internal + heater)[W]
 
-      double conductive_heat_input_W = 0;
-      double radiative_heat_input_W = 0;
-      for (int j = 0; j < node_num; j++) {
-        conductive_heat_input_W += conductance_matrix_W_K_[i][j] * (nodes_[j].GetTemperature_K() - nodes_[i].GetTemperature_K());
-        radiative_heat_input_W += environment::stefan_boltzmann_constant_W_m2K4 * radiation_matrix_m2_[i][j] *
-                                  (pow(nodes_[j].GetTemperature_K(), 4) - pow(nodes_[i].GetTemperature_K(), 4));
-      }
-      double total_heat_input_W = conductive_heat_input_W + radiative_heat_input_W + total_heatload_W;
+      // Conductive and radiative heat input [W]
+      double coupling_heat_input_W = thermal_network_.CalcHeatInput_W(i, temperatures_K.data(), stage_temperatures4_K4_.data());
+      double total_heat_input_W = coupling_heat_input_W + total_heatload_W;
       differentials_K_s[i] = total_heat_input_W / nodes_[i].GetCapacity_J_K();
     } else if (nodes_[i].GetNodeType() == NodeType::kBoundary) {
       differentials_K_s[i] = 0;
     }
   }
-  return differentials_K_s;
 }
 
 double Temperature::GetHeaterPower_W(int node_id) {
@@ -156,6 +256,43 @@ double Temperature::GetHeaterPower_W(int node_id) {
   return heater_power_W;
 }
 
+void Temperature::SaveSnapshot(Snapshot& snapshot) const {
+  snapshot.Write(propagation_time_s_);
+  for (const Node& node : nodes_) {
+    snapshot.Write(node.GetTemperature_K());
+  }
+  for (const Heater& heater : heaters_) {
+    snapshot.Write(heater.GetHeaterStatus());
+  }
+  for (const Heatload& heatload : heatloads_) {
+    snapshot.Write(heatload.GetSolarHeatload_W());
+    snapshot.Write(heatload.GetInternalHeatload_W());
+    snapshot.Write(heatload.GetHeaterHeatload_W());
+  }
+}
+
+void Temperature::RestoreSnapshot(Snapshot& snapshot) {
+  snapshot.Read(propagation_time_s_);
+  for (Node& node : nodes_) {
+    double temperature_K = node.GetTemperature_K();
+    snapshot.Read(temperature_K);
+    node.SetTemperature_K(temperature_K);
+  }
+  for (Heater& heater : heaters_) {
+    HeaterStatus heater_status = heater.GetHeaterStatus();
+    snapshot.Read(heater_status);
+    heater.SetHeaterStatus(heater_status);
+  }
+  for (Heatload& heatload : heatloads_) {
+    double heatload_W[3] = {heatload.GetSolarHeatload_W(), heatload.GetInternalHeatload_W(), heatload.GetHeaterHeatload_W()};
+    snapshot.ReadArray(heatload_W, 3);
+    heatload.SetSolarHeatload_W(heatload_W[0]);
+    heatload.SetInternalHeatload_W(heatload_W[1]);
+    heatload.SetHeaterHeatload_W(heatload_W[2]);
+    heatload.UpdateTotalHeatload();
+  }
+}
+
 void Temperature::UpdateHeaterStatus(void) {
   // [FIXME] Heater status doesn't get updated...
   for (auto itr = nodes_.begin(); itr != nodes_.end(); ++itr) {
@@ -219,14 +356,14 @@ void Temperature::PrintParams(void) {
   cout << "Cij:" << endl;
   for (int i = 0; i < (node_num_); i++) {
     for (int j = 0; j < (node_num_); j++) {
-      cout << std::setprecision(4) << conductance_matrix_W_K_[i][j] << "  ";
+      cout << std::setprecision(4) << thermal_network_.GetConductance_W_K(i, j) << "  ";
     }
     cout << endl;
   }
   cout << "Rij:" << endl;
   for (int i = 0; i < (node_num_); i++) {
     for (int j = 0; j < (node_num_); j++) {
-      cout << std::setprecision(4) << radiation_matrix_m2_[i][j] << "  ";
+      cout << std::setprecision(4) << thermal_network_.GetRadiation_m2(i, j) << "  ";
     }
     cout << endl;
   }
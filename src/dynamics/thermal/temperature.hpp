@@ -7,6 +7,7 @@
 #define S2E_DYNAMICS_THERMAL_TEMPERATURE_HPP_
 
 #include <library/logger/loggable.hpp>
+#include <library/utilities/snapshot.hpp>
 #include <string>
 #include <vector>
 
@@ -14,6 +15,7 @@
 #include "heater_controller.hpp"
 #include "heatload.hpp"
 #include "node.hpp"
+#include "thermal_network.hpp"
 
 /**
  * @enum SolarCalcSetting
@@ -24,24 +26,51 @@ enum class SolarCalcSetting {
   kDisable,
 };
 
+/**
+ * @enum ThermalIntegrationMethod
+ * @brief Numerical integration method of the thermal equilibrium equation
+ */
+enum class ThermalIntegrationMethod {
+  kRk4,       //!< Explicit 4th order Runge-Kutta method
+  kImplicit,  //!< L-stable 2 stage singly diagonally implicit Runge-Kutta (SDIRK) method for stiff networks and large steps
+};
+
 /**
  * @class Temperature
  * @brief class to calculate temperature of all nodes
  */
 class Temperature : public ILoggable {
  protected:
-  std::vector<std::vector<double>> conductance_matrix_W_K_;  // Coupling of node i and node j by heat conduction [W/K]
-  std::vector<std::vector<double>> radiation_matrix_m2_;     // Coupling of node i and node j by thermal radiation [m2]
-  std::vector<Node> nodes_;                                  // vector of nodes
-  std::vector<Heatload> heatloads_;                          // vector of heatloads
-  std::vector<Heater> heaters_;                              // vector of heaters
-  std::vector<HeaterController> heater_controllers_;         // vector of heater controllers
-  int node_num_;                                             // number of nodes
-  double propagation_step_s_;                                // propagation step [s]
-  double propagation_time_s_;            // Incremented time inside class Temperature [s], finish propagation when reaching end_time
-  bool is_calc_enabled_;                 // Whether temperature calculation is enabled
-  SolarCalcSetting solar_calc_setting_;  // setting for solar calculation
-  bool debug_;                           // Activate debug output or not
+  ThermalNetwork thermal_network_;                    // Coupling of node i and node j by heat conduction and thermal radiation
+  std::vector<Node> nodes_;                           // vector of nodes
+  std::vector<Heatload> heatloads_;                   // vector of heatloads
+  std::vector<Heater> heaters_;                       // vector of heaters
+  std::vector<HeaterController> heater_controllers_;  // vector of heater controllers
+  int node_num_;                                      // number of nodes
+  double propagation_step_s_;                         // propagation step [s]
+  double propagation_time_s_;                         // Incremented time inside class Temperature [s], finish propagation when reaching end_time
+  bool is_calc_enabled_;                              // Whether temperature calculation is enabled
+  SolarCalcSetting solar_calc_setting_;               // setting for solar calculation
+  bool debug_;                                        // Activate debug output or not
+  ThermalIntegrationMethod integration_method_;       // Numerical integration method
+
+  // Buffers reused in each RK4 step
+  std::vector<double> temperatures_now_K_;          // Temperatures at the beginning of the step [K]
+  std::vector<double> stage_temperatures_K_;        // Temperatures at the stage [K]
+  std::vector<double> stage_temperatures4_K4_;      // Fourth power of the temperatures at the stage [K^4]
+  std::vector<double> stage_differentials_K_s_;     // Differentials at the stage [K/s]
+  std::vector<double> weighted_differentials_K_s_;  // Weighted sum of the differentials of the stages [K/s]
+
+  // Buffers reused in each implicit step
+  std::vector<double> stage_base_temperatures_K_;  // Explicit part of the stage temperatures [K]
+  std::vector<double> newton_residuals_W_;         // Residuals of the stage equation multiplied by the capacities [W]
+  std::vector<double> newton_corrections_K_;       // Corrections of the stage temperatures in the Newton iteration [K]
+  std::vector<double> jacobian_diagonal_W_K_;      // Diagonal elements of the Newton matrix [W/K]
+  std::vector<double> jacobian_off_diagonal_W_K_;  // Off-diagonal elements of the Newton matrix [W/K]
+  bool is_convergence_warned_ = false;             // Whether the convergence failure of the Newton iteration is already warned
+
+  static const size_t kMaxNewtonIteration = 20;         // Maximum number of the Newton iterations in a stage
+  static constexpr double kNewtonTolerance_K = 1.0e-6;  // Convergence tolerance of the Newton iteration [K]
 
   /**
    * @fn CalcRungeOneStep
@@ -53,18 +82,56 @@ class Temperature : public ILoggable {
    * @param[in] node_num: Number of nodes
    */
   void CalcRungeOneStep(double time_now_s, double time_step_s, libra::Vector<3> sun_direction_b, int node_num);
+  /**
+   * @fn CalcImplicitOneStep
+   * @brief Calculate one step of the L-stable 2 stage SDIRK method for thermal equilibrium equation and update temperatures of nodes
+   * @note gamma = 1 - 1/sqrt(2). Each stage solves Y = base + gamma * h * f(t, Y) with the Newton method and the sparse Jacobian.
+   *
+   * @param[in] time_now_s: Current elapsed time [s]
+   * @param[in] time_step_s: Time step [s]
+   * @param[in] sun_direction_b: Sun direction in body frame
+   * @param[in] node_num: Number of nodes
+   */
+  void CalcImplicitOneStep(double time_now_s, double time_step_s, libra::Vector<3> sun_direction_b, int node_num);
+  /**
+   * @fn SolveImplicitStage
+   * @brief Solve the stage equation Y = base + gamma_step * f(t, Y) with the Newton method
+   * @note The base temperatures are stage_base_temperatures_K_, and the initial guess and the solution are stage_temperatures_K_.
+   *
+   * @param[in] time_s: Elapsed time of the stage [s]
+   * @param[in] gamma_step_s: Time step multiplied by the diagonal coefficient [s]
+   * @param[in] node_num: Number of nodes
+   * @return True when the Newton iteration converges
+   */
+  bool SolveImplicitStage(double time_s, double gamma_step_s, int node_num);
+  /**
+   * @fn UpdateSolarHeatloads
+   * @brief Update solar heatloads of the diffusive nodes when the solar calculation is enabled
+   *
+   * @param[in] sun_direction_b: Sun direction in body frame
+   * @param[in] node_num: Number of nodes
+   */
+  void UpdateSolarHeatloads(libra::Vector<3> sun_direction_b, int node_num);
+  /**
+   * @fn UpdateHeatloads
+   * @brief Update heater, internal, and total heatloads of the diffusive nodes at the time
+   *
+   * @param[in] time_s: Elapsed time [s]
+   * @param[in] node_num: Number of nodes
+   */
+  void UpdateHeatloads(double time_s, int node_num);
   /**
    * @fn CalcTemperatureDifferentials
    * @brief Calculate differential of thermal equilibrium equation
+   * @note The solar heatloads are calculated in CalcRungeOneStep since the sun direction is constant in the step.
    *
-   * @param temperatures_K: [UNUSED] Temperatures of each node [K]
-   * @param time_now_s: Current elapsed time [s]
-   * @param sun_direction_b: Sun direction in body frame
-   * @param node_num: Number of nodes
-   * @return std::vector<double>: Differential of thermal equilibrium equation at time now
+   * @param[in] temperatures_K: Temperatures of each node [K]
+   * @param[in] time_now_s: Current elapsed time [s]
+   * @param[in] node_num: Number of nodes
+   * @param[out] differentials_K_s: Differential of thermal equilibrium equation at time now [K/s]
    */
-  std::vector<double> CalcTemperatureDifferentials(std::vector<double> temperatures_K, double time_now_s, const libra::Vector<3> sun_direction_b,
-                                                   int node_num);
+  void CalcTemperatureDifferentials(const std::vector<double>& temperatures_K, double time_now_s, int node_num,
+                                    std::vector<double>& differentials_K_s);
 
  public:
   /**
@@ -82,11 +149,12 @@ class Temperature : public ILoggable {
    * @param is_calc_enabled: Whether calculation is enabled
    * @param solar_calc_setting: Solar calculation settings
    * @param debug: Whether debug is enabled
+   * @param integration_method: Numerical integration method
    */
   Temperature(const std::vector<std::vector<double>> conductance_matrix_W_K, const std::vector<std::vector<double>> radiation_matrix_m2,
               std::vector<Node> nodes, std::vector<Heatload> heatloads, std::vector<Heater> heaters, std::vector<HeaterController> heater_controllers,
               const int node_num, const double propagation_step_s, const bool is_calc_enabled, const SolarCalcSetting solar_calc_setting,
-              const bool debug);
+              const bool debug, const ThermalIntegrationMethod integration_method = ThermalIntegrationMethod::kRk4);
   /**
    * @fn Temperature
    * @brief Construct a new Temperature object, used when thermal calculation is disabled.
@@ -141,6 +209,17 @@ class Temperature : public ILoggable {
    */
   void UpdateHeaterStatus(void);
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the node temperatures, the heater status, and the heatloads into the snapshot
+   */
+  void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the node temperatures, the heater status, and the heatloads from the snapshot
+   */
+  void RestoreSnapshot(Snapshot& snapshot);
+
   /**
    * @fn PrintParams
    * @brief Print parameters of tempearture in debug console
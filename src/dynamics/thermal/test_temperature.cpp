@@ -0,0 +1,191 @@
+/**
+ * @file test_temperature.cpp
+ * @brief Test codes for Temperature class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <environment/global/physical_constants.hpp>
+#include <vector>
+
+#include "temperature.hpp"
+
+/**
+ * @struct TestNetwork
+ * @brief Small thermal network for the test
+ */
+struct TestNetwork {
+  std::vector<std::vector<double>> conductance_matrix_W_K;
+  std::vector<std::vector<double>> radiation_matrix_m2;
+  std::vector<Node> nodes;
+  std::vector<Heatload> heatloads;
+};
+
+/**
+ * @brief Make a network of three diffusive nodes and a boundary node of deep space
+ * @note Node 0 and node 2 are not coupled, node 2 does not radiate, and the diagonal elements are not zero.
+ * @param [in] conductance_scale: Scale factor of the conductances to make the network stiff
+ */
+static TestNetwork MakeTestNetwork(const double conductance_scale = 1.0) {
+  TestNetwork network;
+  network.conductance_matrix_W_K = {
+      {5.0, 0.8, 0.0, 0.0},
+      {0.8, 0.0, 1.5, 0.0},
+      {0.0, 1.5, 0.0, 0.0},
+      {0.0, 0.0, 0.0, 2.0},
+  };
+  for (auto& row : network.conductance_matrix_W_K) {
+    for (auto& conductance_W_K : row) conductance_W_K *= conductance_scale;
+  }
+  network.radiation_matrix_m2 = {
+      {0.0, 0.02, 0.0, 0.3},
+      {0.02, 0.0, 0.0, 0.1},
+      {0.0, 0.0, 0.0, 0.0},
+      {0.3, 0.1, 0.0, 0.0},
+  };
+
+  libra::Vector<3> normal_vector_b(0.0);
+  normal_vector_b[0] = 1.0;
+  const double initial_temperatures_K[3] = {290.0, 310.0, 330.0};
+  const double capacities_J_K[3] = {500.0, 200.0, 80.0};
+  const double powers_W[3] = {10.0, 0.0, 3.0};
+  const std::vector<double> time_table_s = {0.0, 1000.0, 2000.0};
+  for (int i = 0; i < 3; i++) {
+    network.nodes.push_back(Node(i, "node", NodeType::kDiffusive, 0, initial_temperatures_K[i], capacities_J_K[i], 0.0, 0.0, normal_vector_b));
+    network.heatloads.push_back(Heatload(i, time_table_s, {powers_W[i], 0.5 * powers_W[i], powers_W[i]}));
+  }
+  network.nodes.push_back(Node(3, "space", NodeType::kBoundary, 0, 3.0, 1.0, 0.0, 0.0, normal_vector_b));
+  network.heatloads.push_back(Heatload(3, time_table_s, {0.0, 0.0, 0.0}));
+  return network;
+}
+
+/**
+ * @brief Make Temperature of the network
+ */
+static Temperature MakeTemperature(const TestNetwork& network, const double step_s, const ThermalIntegrationMethod integration_method) {
+  return Temperature(network.conductance_matrix_W_K, network.radiation_matrix_m2, network.nodes, network.heatloads, {}, {},
+                     (int)network.nodes.size(), step_s, true, SolarCalcSetting::kDisable, false, integration_method);
+}
+
+/**
+ * @brief Calculate the differentials with the dense matrices as the former Temperature class
+ */
+static std::vector<double> CalcDenseDifferentials_K_s(TestNetwork& network, const std::vector<double>& temperatures_K, const double time_s) {
+  const size_t node_num = network.nodes.size();
+  std::vector<double> differentials_K_s(node_num, 0.0);
+  for (size_t i = 0; i < node_num; i++) {
+    if (network.nodes[i].GetNodeType() != NodeType::kDiffusive) continue;
+    network.heatloads[i].SetElapsedTime_s(time_s);
+    network.heatloads[i].CalcInternalHeatload();
+    network.heatloads[i].UpdateTotalHeatload();
+    double heat_input_W = network.heatloads[i].GetTotalHeatload_W();
+    for (size_t j = 0; j < node_num; j++) {
+      heat_input_W += network.conductance_matrix_W_K[i][j] * (temperatures_K[j] - temperatures_K[i]);
+      heat_input_W += environment::stefan_boltzmann_constant_W_m2K4 * network.radiation_matrix_m2[i][j] *
+                      (pow(temperatures_K[j], 4) - pow(temperatures_K[i], 4));
+    }
+    differentials_K_s[i] = heat_input_W / network.nodes[i].GetCapacity_J_K();
+  }
+  return differentials_K_s;
+}
+
+/**
+ * @brief Calculate one RK4 step with the dense matrices
+ */
+static std::vector<double> CalcDenseRungeOneStep_K(TestNetwork& network, const std::vector<double>& temperatures_K, const double time_s,
+                                                   const double step_s) {
+  const size_t node_num = temperatures_K.size();
+  std::vector<double> stage_K(node_num);
+  const std::vector<double> k1 = CalcDenseDifferentials_K_s(network, temperatures_K, time_s);
+  for (size_t i = 0; i < node_num; i++) stage_K[i] = temperatures_K[i] + 0.5 * step_s * k1[i];
+  const std::vector<double> k2 = CalcDenseDifferentials_K_s(network, stage_K, time_s + 0.5 * step_s);
+  for (size_t i = 0; i < node_num; i++) stage_K[i] = temperatures_K[i] + 0.5 * step_s * k2[i];
+  const std::vector<double> k3 = CalcDenseDifferentials_K_s(network, stage_K, time_s + 0.5 * step_s);
+  for (size_t i = 0; i < node_num; i++) stage_K[i] = temperatures_K[i] + step_s * k3[i];
+  const std::vector<double> k4 = CalcDenseDifferentials_K_s(network, stage_K, time_s + step_s);
+
+  std::vector<double> next_K(node_num);
+  for (size_t i = 0; i < node_num; i++) next_K[i] = temperatures_K[i] + step_s / 6.0 * (k1[i] + 2.0 * k2[i] + 2.0 * k3[i] + k4[i]);
+  return next_K;
+}
+
+/**
+ * @brief Test for the RK4 steps with the sparse network compared with the dense matrices
+ */
+TEST(Temperature, Rk4) {
+  TestNetwork network = MakeTestNetwork();
+  const double step_s = 5.0;
+  Temperature temperature = MakeTemperature(network, step_s, ThermalIntegrationMethod::kRk4);
+  libra::Vector<3> sun_direction_b(0.0);
+  sun_direction_b[0] = 1.0;
+
+  std::vector<double> reference_K;
+  for (const auto& node : network.nodes) reference_K.push_back(node.GetTemperature_K());
+  for (int step = 0; step < 10; step++) {
+    reference_K = CalcDenseRungeOneStep_K(network, reference_K, step * step_s, step_s);
+    temperature.Propagate(sun_direction_b, (step + 1) * step_s);
+
+    const std::vector<Node> nodes = temperature.GetNodes();
+    for (size_t i = 0; i < nodes.size(); i++) {
+      EXPECT_NEAR(reference_K[i], nodes[i].GetTemperature_K(), 1.0e-10);
+    }
+    // Boundary node is fixed
+    EXPECT_DOUBLE_EQ(3.0, nodes[3].GetTemperature_K());
+  }
+  // The temperatures are changed by the couplings
+  EXPECT_GT(fabs(reference_K[0] - 290.0), 0.1);
+}
+
+/**
+ * @brief Test for the implicit steps compared with the small RK4 steps on a non-stiff network
+ */
+TEST(Temperature, ImplicitNonStiff) {
+  const TestNetwork network = MakeTestNetwork();
+  Temperature implicit_temperature = MakeTemperature(network, 2.0, ThermalIntegrationMethod::kImplicit);
+  Temperature rk4_temperature = MakeTemperature(network, 0.1, ThermalIntegrationMethod::kRk4);
+  libra::Vector<3> sun_direction_b(0.0);
+  sun_direction_b[0] = 1.0;
+
+  implicit_temperature.Propagate(sun_direction_b, 300.0);
+  rk4_temperature.Propagate(sun_direction_b, 300.0);
+  const std::vector<Node> implicit_nodes = implicit_temperature.GetNodes();
+  const std::vector<Node> rk4_nodes = rk4_temperature.GetNodes();
+  for (size_t i = 0; i < implicit_nodes.size(); i++) {
+    EXPECT_NEAR(rk4_nodes[i].GetTemperature_K(), implicit_nodes[i].GetTemperature_K(), 1.0e-4);
+  }
+  EXPECT_DOUBLE_EQ(3.0, implicit_nodes[3].GetTemperature_K());
+}
+
+/**
+ * @brief Test for the implicit steps on a stiff network with a step much larger than the time constant
+ */
+TEST(Temperature, ImplicitStiff) {
+  // The time constant between node 1 and node 2 is about 5 ms
+  const TestNetwork network = MakeTestNetwork(1.0e4);
+  const double step_s = 10.0;
+  Temperature temperature = MakeTemperature(network, step_s, ThermalIntegrationMethod::kImplicit);
+  libra::Vector<3> sun_direction_b(0.0);
+  sun_direction_b[0] = 1.0;
+
+  for (int step = 0; step < 100; step++) {
+    temperature.Propagate(sun_direction_b, (step + 1) * step_s);
+    const std::vector<Node> nodes = temperature.GetNodes();
+    for (size_t i = 0; i < 3; i++) {
+      ASSERT_TRUE(std::isfinite(nodes[i].GetTemperature_K()));
+      EXPECT_GT(nodes[i].GetTemperature_K(), 3.0);
+      EXPECT_LT(nodes[i].GetTemperature_K(), 340.0);
+    }
+    // Boundary node is fixed
+    EXPECT_DOUBLE_EQ(3.0, nodes[3].GetTemperature_K());
+  }
+  // The strongly coupled nodes are equalized without the oscillation
+  const std::vector<Node> nodes = temperature.GetNodes();
+  EXPECT_NEAR(nodes[0].GetTemperature_K(), nodes[1].GetTemperature_K(), 0.1);
+  EXPECT_NEAR(nodes[1].GetTemperature_K(), nodes[2].GetTemperature_K(), 0.1);
+
+  // RK4 with the same step is unstable
+  Temperature rk4_temperature = MakeTemperature(network, step_s, ThermalIntegrationMethod::kRk4);
+  rk4_temperature.Propagate(sun_direction_b, 10.0 * step_s);
+  const double rk4_temperature_K = rk4_temperature.GetNodes()[1].GetTemperature_K();
+  EXPECT_FALSE(std::isfinite(rk4_temperature_K) && rk4_temperature_K < 1.0e4);
+}
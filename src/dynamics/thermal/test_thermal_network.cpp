@@ -0,0 +1,139 @@
+/**
+ * @file test_thermal_network.cpp
+ * @brief Test codes for ThermalNetwork class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <environment/global/physical_constants.hpp>
+#include <vector>
+
+#include "thermal_network.hpp"
+
+/**
+ * @brief Calculate heat input to a node with the dense matrices as the former Temperature class
+ */
+static double CalcDenseHeatInput_W(const std::vector<std::vector<double>>& conductance_matrix_W_K,
+                                   const std::vector<std::vector<double>>& radiation_matrix_m2, const std::vector<double>& temperatures_K,
+                                   const size_t i) {
+  double heat_input_W = 0.0;
+  for (size_t j = 0; j < temperatures_K.size(); j++) {
+    heat_input_W += conductance_matrix_W_K[i][j] * (temperatures_K[j] - temperatures_K[i]);
+    heat_input_W +=
+        environment::stefan_boltzmann_constant_W_m2K4 * radiation_matrix_m2[i][j] * (pow(temperatures_K[j], 4) - pow(temperatures_K[i], 4));
+  }
+  return heat_input_W;
+}
+
+/**
+ * @brief Test for the heat input with the CSR couplings compared with the dense matrices
+ */
+TEST(ThermalNetwork, HeatInput) {
+  // Node 3 is the boundary node of deep space. Node 0 and node 2 are not coupled, and the diagonal elements are not zero.
+  const std::vector<std::vector<double>> conductance_matrix_W_K = {
+      {5.0, 0.8, 0.0, 0.0},
+      {0.8, 0.0, 1.5, 0.0},
+      {0.0, 1.5, 0.0, 0.0},
+      {0.0, 0.0, 0.0, 2.0},
+  };
+  const std::vector<std::vector<double>> radiation_matrix_m2 = {
+      {0.0, 0.02, 0.0, 0.3},
+      {0.02, 0.0, 0.0, 0.1},
+      {0.0, 0.0, 0.0, 0.0},
+      {0.3, 0.1, 0.0, 0.0},
+  };
+  const ThermalNetwork network(conductance_matrix_W_K, radiation_matrix_m2);
+  EXPECT_EQ(4u, network.GetNumberOfNodes());
+  // 0-1, 0-3, 1-0, 1-2, 1-3, 2-1, 3-0, 3-1
+  EXPECT_EQ(8u, network.GetNumberOfCouplings());
+  EXPECT_DOUBLE_EQ(0.8, network.GetConductance_W_K(0, 1));
+  EXPECT_DOUBLE_EQ(0.0, network.GetConductance_W_K(0, 2));
+  EXPECT_DOUBLE_EQ(0.0, network.GetConductance_W_K(0, 0));
+  EXPECT_DOUBLE_EQ(0.3, network.GetRadiation_m2(3, 0));
+  EXPECT_DOUBLE_EQ(0.0, network.GetRadiation_m2(2, 3));
+
+  const std::vector<double> temperatures_K = {290.0, 310.0, 330.0, 3.0};
+  std::vector<double> temperatures4_K4(temperatures_K.size());
+  for (size_t i = 0; i < temperatures_K.size(); i++) temperatures4_K4[i] = pow(temperatures_K[i], 4);
+  for (size_t i = 0; i < temperatures_K.size(); i++) {
+    const double reference_W = CalcDenseHeatInput_W(conductance_matrix_W_K, radiation_matrix_m2, temperatures_K, i);
+    EXPECT_NEAR(reference_W, network.CalcHeatInput_W(i, temperatures_K.data(), temperatures4_K4.data()), 1.0e-12 * (1.0 + fabs(reference_W)));
+  }
+}
+
+/**
+ * @brief Test for the Jacobian of the heat input compared with the central difference of the dense heat input
+ */
+TEST(ThermalNetwork, HeatInputJacobian) {
+  const std::vector<std::vector<double>> conductance_matrix_W_K = {
+      {0.0, 0.8, 0.0, 0.0},
+      {0.8, 0.0, 1.5, 0.0},
+      {0.0, 1.5, 0.0, 0.0},
+      {0.0, 0.0, 0.0, 0.0},
+  };
+  const std::vector<std::vector<double>> radiation_matrix_m2 = {
+      {0.0, 0.02, 0.0, 0.3},
+      {0.02, 0.0, 0.0, 0.1},
+      {0.0, 0.0, 0.0, 0.0},
+      {0.3, 0.1, 0.0, 0.0},
+  };
+  const ThermalNetwork network(conductance_matrix_W_K, radiation_matrix_m2);
+  const size_t node_num = network.GetNumberOfNodes();
+  const std::vector<double> temperatures_K = {290.0, 310.0, 330.0, 3.0};
+  std::vector<double> diagonal_W_K(node_num), off_diagonal_W_K(network.GetNumberOfCouplings());
+  network.CalcHeatInputJacobian_W_K(temperatures_K.data(), diagonal_W_K.data(), off_diagonal_W_K.data());
+
+  // Column j of the Jacobian is the multiplication with the unit vector j
+  const double delta_K = 1.0e-3;
+  for (size_t j = 0; j < node_num; j++) {
+    std::vector<double> unit(node_num, 0.0), column_W_K(node_num, 0.0);
+    unit[j] = 1.0;
+    network.MultiplyMatrix(diagonal_W_K.data(), off_diagonal_W_K.data(), unit.data(), column_W_K.data());
+
+    std::vector<double> plus_K = temperatures_K, minus_K = temperatures_K;
+    plus_K[j] += delta_K;
+    minus_K[j] -= delta_K;
+    for (size_t i = 0; i < node_num; i++) {
+      const double reference_W_K = (CalcDenseHeatInput_W(conductance_matrix_W_K, radiation_matrix_m2, plus_K, i) -
+                                    CalcDenseHeatInput_W(conductance_matrix_W_K, radiation_matrix_m2, minus_K, i)) /
+                                   (2.0 * delta_K);
+      EXPECT_NEAR(reference_W_K, column_W_K[i], 1.0e-6);
+    }
+  }
+}
+
+/**
+ * @brief Test for the linear solver with a non-symmetric matrix of the network sparsity pattern
+ */
+TEST(ThermalNetwork, SolveLinearSystem) {
+  // Chain of 20 nodes with the zero couplings except the neighbors
+  const size_t node_num = 20;
+  std::vector<std::vector<double>> conductance_matrix_W_K(node_num, std::vector<double>(node_num, 0.0));
+  for (size_t i = 0; i + 1 < node_num; i++) {
+    conductance_matrix_W_K[i][i + 1] = 1.0;
+    conductance_matrix_W_K[i + 1][i] = 1.0;
+  }
+  ThermalNetwork network(conductance_matrix_W_K, {});
+  ASSERT_EQ(2 * (node_num - 1), network.GetNumberOfCouplings());
+
+  // Diagonally dominant non-symmetric matrix
+  std::vector<double> diagonal(node_num), off_diagonal(network.GetNumberOfCouplings());
+  for (size_t i = 0; i < node_num; i++) diagonal[i] = 4.0 + 0.1 * (double)i;
+  for (size_t k = 0; k < off_diagonal.size(); k++) off_diagonal[k] = (k % 2 == 0) ? -1.0 : -0.5;
+  std::vector<double> solution(node_num), rhs(node_num);
+  for (size_t i = 0; i < node_num; i++) solution[i] = sin((double)i);
+  network.MultiplyMatrix(diagonal.data(), off_diagonal.data(), solution.data(), rhs.data());
+
+  std::vector<double> x(node_num, 0.0);
+  EXPECT_TRUE(network.SolveLinearSystem(diagonal.data(), off_diagonal.data(), rhs.data(), x.data()));
+  for (size_t i = 0; i < node_num; i++) {
+    EXPECT_NEAR(solution[i], x[i], 1.0e-10);
+  }
+
+  // Zero right hand side
+  std::vector<double> zero(node_num, 0.0);
+  EXPECT_TRUE(network.SolveLinearSystem(diagonal.data(), off_diagonal.data(), zero.data(), x.data()));
+  for (size_t i = 0; i < node_num; i++) {
+    EXPECT_DOUBLE_EQ(0.0, x[i]);
+  }
+}
@@ -0,0 +1,141 @@
+/**
+ * @file thermal_network.cpp
+ * @brief Sparse thermal couplings between nodes
+ */
+
+#include "thermal_network.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <environment/global/physical_constants.hpp>
+
+ThermalNetwork::ThermalNetwork() : row_offsets_(1, 0) {}
+
+ThermalNetwork::ThermalNetwork(const std::vector<std::vector<double>>& conductance_matrix_W_K,
+                               const std::vector<std::vector<double>>& radiation_matrix_m2) {
+  const size_t node_num = conductance_matrix_W_K.size();
+  row_offsets_.reserve(node_num + 1);
+  row_offsets_.push_back(0);
+  for (size_t i = 0; i < node_num; i++) {
+    for (size_t j = 0; j < node_num; j++) {
+      if (i == j) continue;
+      const double conductance_W_K = conductance_matrix_W_K[i][j];
+      const double radiation_m2 = (i < radiation_matrix_m2.size() && j < radiation_matrix_m2[i].size()) ? radiation_matrix_m2[i][j] : 0.0;
+      if (conductance_W_K == 0.0 && radiation_m2 == 0.0) continue;
+      column_indices_.push_back(j);
+      conductances_W_K_.push_back(conductance_W_K);
+      radiations_W_K4_.push_back(environment::stefan_boltzmann_constant_W_m2K4 * radiation_m2);
+    }
+    row_offsets_.push_back(column_indices_.size());
+  }
+
+  residual_.assign(node_num, 0.0);
+  shadow_residual_.assign(node_num, 0.0);
+  search_direction_.assign(node_num, 0.0);
+  preconditioned_vector_.assign(node_num, 0.0);
+  multiplied_vector_.assign(node_num, 0.0);
+  stabilization_vector_.assign(node_num, 0.0);
+}
+
+void ThermalNetwork::CalcHeatInputJacobian_W_K(const double* temperatures_K, double* diagonal_W_K, double* off_diagonal_W_K) const {
+  const size_t node_num = GetNumberOfNodes();
+  for (size_t i = 0; i < node_num; i++) {
+    const double temperature3_K3 = temperatures_K[i] * temperatures_K[i] * temperatures_K[i];
+    double diagonal = 0.0;
+    for (size_t k = row_offsets_[i]; k < row_offsets_[i + 1]; k++) {
+      const double temperature_j_K = temperatures_K[column_indices_[k]];
+      off_diagonal_W_K[k] = conductances_W_K_[k] + 4.0 * radiations_W_K4_[k] * temperature_j_K * temperature_j_K * temperature_j_K;
+      diagonal -= conductances_W_K_[k] + 4.0 * radiations_W_K4_[k] * temperature3_K3;
+    }
+    diagonal_W_K[i] = diagonal;
+  }
+}
+
+void ThermalNetwork::MultiplyMatrix(const double* diagonal, const double* off_diagonal, const double* x, double* y) const {
+  const size_t node_num = GetNumberOfNodes();
+  for (size_t i = 0; i < node_num; i++) {
+    double sum = diagonal[i] * x[i];
+    for (size_t k = row_offsets_[i]; k < row_offsets_[i + 1]; k++) {
+      sum += off_diagonal[k] * x[column_indices_[k]];
+    }
+    y[i] = sum;
+  }
+}
+
+bool ThermalNetwork::SolveLinearSystem(const double* diagonal, const double* off_diagonal, const double* rhs, double* x,
+                                       const double relative_tolerance) {
+  const size_t node_num = GetNumberOfNodes();
+  auto dot = [node_num](const std::vector<double>& a, const std::vector<double>& b) {
+    double sum = 0.0;
+    for (size_t i = 0; i < node_num; i++) sum += a[i] * b[i];
+    return sum;
+  };
+
+  // Initial guess: Jacobi preconditioned right hand side
+  for (size_t i = 0; i < node_num; i++) x[i] = rhs[i] / diagonal[i];
+  MultiplyMatrix(diagonal, off_diagonal, x, multiplied_vector_.data());
+  double rhs_norm2 = 0.0;
+  for (size_t i = 0; i < node_num; i++) {
+    residual_[i] = rhs[i] - multiplied_vector_[i];
+    shadow_residual_[i] = residual_[i];
+    search_direction_[i] = 0.0;
+    multiplied_vector_[i] = 0.0;
+    rhs_norm2 += rhs[i] * rhs[i];
+  }
+  const double tolerance2 = relative_tolerance * relative_tolerance * rhs_norm2;
+  if (dot(residual_, residual_) <= tolerance2) return true;
+
+  double rho = 1.0, alpha = 1.0, omega = 1.0;
+  const size_t max_iteration = 2 * node_num + 10;
+  for (size_t iteration = 0; iteration < max_iteration; iteration++) {
+    const double rho_next = dot(shadow_residual_, residual_);
+    if (rho_next == 0.0) return false;
+    const double beta = (rho_next / rho) * (alpha / omega);
+    rho = rho_next;
+    for (size_t i = 0; i < node_num; i++) {
+      search_direction_[i] = residual_[i] + beta * (search_direction_[i] - omega * multiplied_vector_[i]);
+      preconditioned_vector_[i] = search_direction_[i] / diagonal[i];
+    }
+    MultiplyMatrix(diagonal, off_diagonal, preconditioned_vector_.data(), multiplied_vector_.data());
+    const double denominator = dot(shadow_residual_, multiplied_vector_);
+    if (denominator == 0.0) return false;
+    alpha = rho / denominator;
+    for (size_t i = 0; i < node_num; i++) {
+      x[i] += alpha * preconditioned_vector_[i];
+      residual_[i] -= alpha * multiplied_vector_[i];
+    }
+    if (dot(residual_, residual_) <= tolerance2) return true;
+
+    for (size_t i = 0; i < node_num; i++) preconditioned_vector_[i] = residual_[i] / diagonal[i];
+    MultiplyMatrix(diagonal, off_diagonal, preconditioned_vector_.data(), stabilization_vector_.data());
+    const double stabilization_norm2 = dot(stabilization_vector_, stabilization_vector_);
+    if (stabilization_norm2 == 0.0) return false;
+    omega = dot(stabilization_vector_, residual_) / stabilization_norm2;
+    for (size_t i = 0; i < node_num; i++) {
+      x[i] += omega * preconditioned_vector_[i];
+      residual_[i] -= omega * stabilization_vector_[i];
+    }
+    if (dot(residual_, residual_) <= tolerance2) return true;
+    if (omega == 0.0 || !std::isfinite(omega)) return false;
+  }
+  return false;
+}
+
+double ThermalNetwork::GetConductance_W_K(const size_t i, const size_t j) const {
+  const size_t k = FindCoupling(i, j);
+  return k < column_indices_.size() ? conductances_W_K_[k] : 0.0;
+}
+
+double ThermalNetwork::GetRadiation_m2(const size_t i, const size_t j) const {
+  const size_t k = FindCoupling(i, j);
+  return k < column_indices_.size() ? radiations_W_K4_[k] / environment::stefan_boltzmann_constant_W_m2K4 : 0.0;
+}
+
+size_t ThermalNetwork::FindCoupling(const size_t i, const size_t j) const {
+  if (i + 1 >= row_offsets_.size()) return column_indices_.size();
+  const auto begin = column_indices_.begin() + row_offsets_[i];
+  const auto end = column_indices_.begin() + row_offsets_[i + 1];
+  const auto itr = std::lower_bound(begin, end, j);
+  if (itr == end || *itr != j) return column_indices_.size();
+  return (size_t)(itr - column_indices_.begin());
+}
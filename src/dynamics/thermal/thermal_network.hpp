@@ -0,0 +1,132 @@
+/**
+ * @file thermal_network.hpp
+ * @brief Sparse thermal couplings between nodes
+ */
+
+#ifndef S2E_DYNAMICS_THERMAL_THERMAL_NETWORK_HPP_
+#define S2E_DYNAMICS_THERMAL_THERMAL_NETWORK_HPP_
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @class ThermalNetwork
+ * @brief Sparse thermal couplings between nodes
+ * @details The conductive and radiative couplings are stored together in the compressed sparse row (CSR) format.
+ *          The zero couplings and the diagonal elements are not stored since they do not contribute to the heat input.
+ *          The radiative couplings are multiplied by the Stefan-Boltzmann constant in advance.
+ *          The Jacobian of the heat input has the same sparsity pattern with the couplings and the diagonal elements, and the linear system
+ *          with the pattern is solved with the BiCGSTAB method for the implicit integration.
+ */
+class ThermalNetwork {
+ public:
+  /**
+   * @fn ThermalNetwork
+   * @brief Default constructor without nodes
+   */
+  ThermalNetwork();
+  /**
+   * @fn ThermalNetwork
+   * @brief Constructor
+   * @param [in] conductance_matrix_W_K: (node_num x node_num) matrix with heat conductance values [W/K]
+   * @param [in] radiation_matrix_m2: (node_num x node_num) matrix with radiative connection values [m2]
+   */
+  ThermalNetwork(const std::vector<std::vector<double>>& conductance_matrix_W_K, const std::vector<std::vector<double>>& radiation_matrix_m2);
+
+  /**
+   * @fn CalcHeatInput_W
+   * @brief Calculate heat input to a node by conduction and radiation
+   * @param [in] node_index: Index of the node
+   * @param [in] temperatures_K: Temperatures of all nodes [K]
+   * @param [in] temperatures4_K4: Fourth power of the temperatures of all nodes [K^4]
+   * @return Heat input [W]
+   */
+  inline double CalcHeatInput_W(const size_t node_index, const double* temperatures_K, const double* temperatures4_K4) const {
+    const double temperature_K = temperatures_K[node_index];
+    const double temperature4_K4 = temperatures4_K4[node_index];
+    double heat_input_W = 0.0;
+    for (size_t k = row_offsets_[node_index]; k < row_offsets_[node_index + 1]; k++) {
+      const size_t j = column_indices_[k];
+      heat_input_W += conductances_W_K_[k] * (temperatures_K[j] - temperature_K) + radiations_W_K4_[k] * (temperatures4_K4[j] - temperature4_K4);
+    }
+    return heat_input_W;
+  }
+
+  /**
+   * @fn CalcHeatInputJacobian_W_K
+   * @brief Calculate Jacobian of the heat input with respect to the temperatures
+   * @param [in] temperatures_K: Temperatures of all nodes [K]
+   * @param [out] diagonal_W_K: Diagonal elements (size: number of nodes) [W/K]
+   * @param [out] off_diagonal_W_K: Off-diagonal elements in the order of the stored couplings (size: number of couplings) [W/K]
+   */
+  void CalcHeatInputJacobian_W_K(const double* temperatures_K, double* diagonal_W_K, double* off_diagonal_W_K) const;
+  /**
+   * @fn MultiplyMatrix
+   * @brief Multiply a matrix with the sparsity pattern of the network and a vector
+   * @param [in] diagonal: Diagonal elements of the matrix
+   * @param [in] off_diagonal: Off-diagonal elements of the matrix in the order of the stored couplings
+   * @param [in] x: Vector
+   * @param [out] y: Result of the multiplication
+   */
+  void MultiplyMatrix(const double* diagonal, const double* off_diagonal, const double* x, double* y) const;
+  /**
+   * @fn SolveLinearSystem
+   * @brief Solve a linear system with the sparsity pattern of the network with the Jacobi preconditioned BiCGSTAB method
+   * @param [in] diagonal: Diagonal elements of the matrix (must be non-zero)
+   * @param [in] off_diagonal: Off-diagonal elements of the matrix in the order of the stored couplings
+   * @param [in] rhs: Right hand side vector
+   * @param [out] x: Solution
+   * @param [in] relative_tolerance: Tolerance of the residual norm relative to the norm of the right hand side
+   * @return True when the solution converges
+   */
+  bool SolveLinearSystem(const double* diagonal, const double* off_diagonal, const double* rhs, double* x, const double relative_tolerance = 1.0e-12);
+
+  // Getter
+  /**
+   * @fn GetNumberOfNodes
+   * @brief Return number of nodes
+   */
+  inline size_t GetNumberOfNodes() const { return row_offsets_.size() - 1; }
+  /**
+   * @fn GetNumberOfCouplings
+   * @brief Return number of stored couplings
+   */
+  inline size_t GetNumberOfCouplings() const { return column_indices_.size(); }
+  /**
+   * @fn GetFirstCouplingIndex
+   * @brief Return index of the first stored coupling of the node. The couplings of the node end at the first coupling of the next node.
+   */
+  inline size_t GetFirstCouplingIndex(const size_t node_index) const { return row_offsets_[node_index]; }
+  /**
+   * @fn GetConductance_W_K
+   * @brief Return heat conductance between node i and node j [W/K]
+   */
+  double GetConductance_W_K(const size_t i, const size_t j) const;
+  /**
+   * @fn GetRadiation_m2
+   * @brief Return radiative connection between node i and node j [m2]
+   */
+  double GetRadiation_m2(const size_t i, const size_t j) const;
+
+ private:
+  std::vector<size_t> row_offsets_;       //!< Offset of the first coupling of each node (size: node_num + 1)
+  std::vector<size_t> column_indices_;    //!< Index of the coupled node
+  std::vector<double> conductances_W_K_;  //!< Heat conductance [W/K]
+  std::vector<double> radiations_W_K4_;   //!< Radiative connection multiplied by the Stefan-Boltzmann constant [W/K^4]
+
+  // Work vectors of the linear solver
+  std::vector<double> residual_;               //!< Residual
+  std::vector<double> shadow_residual_;        //!< Initial residual
+  std::vector<double> search_direction_;       //!< Search direction
+  std::vector<double> preconditioned_vector_;  //!< Preconditioned search direction or residual
+  std::vector<double> multiplied_vector_;      //!< Matrix multiplied preconditioned search direction
+  std::vector<double> stabilization_vector_;   //!< Matrix multiplied preconditioned residual
+
+  /**
+   * @fn FindCoupling
+   * @brief Return index of the coupling between node i and node j, or the number of couplings when it is not stored
+   */
+  size_t FindCoupling(const size_t i, const size_t j) const;
+};
+
+#endif  // S2E_DYNAMICS_THERMAL_THERMAL_NETWORK_HPP_
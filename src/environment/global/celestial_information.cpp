@@ -1,7 +1,7 @@
 /**
  * @file celestial_information.cpp
  * @brief Class to manage the information related with the celestial bodies
- * @details This class uses SPICE to get the information of celestial bodies
+ * @details This class uses SPICE or the precomputed ephemeris file to get the information of celestial bodies
  */
 
 #include "celestial_information.hpp"
@@ -13,10 +13,16 @@
 #include <algorithm>
 #include <iostream>
 #include <locale>
+#include <mutex>
 #include <sstream>
 
 #include "library/initialize/initialize_file_access.hpp"
 #include "library/logger/log_utility.hpp"
+#include "library/utilities/shared_data_store.hpp"
+
+// CSPICE is not thread-safe. The calls are serialized for the simulation cases executed in parallel.
+// The precomputed ephemeris file is evaluated without the lock.
+static std::recursive_mutex spice_mutex;
 
 CelestialInformation::CelestialInformation(const std::string inertial_frame_name, const std::string aberration_correction_setting,
                                            const std::string center_body_name, const RotationMode rotation_mode,
@@ -35,6 +41,8 @@ CelestialInformation::CelestialInformation(const std::string inertial_frame_name
   celestial_body_mean_radius_m_ = new double[number_of_selected_bodies_];
   celestial_body_planetographic_radii_m_ = new double[num_of_state];
 
+  std::lock_guard<std::recursive_mutex> lock(spice_mutex);
+
   // Acquisition of gravity constant
   for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
     SpiceInt planet_id = selected_body_ids_[i];
@@ -63,6 +71,66 @@ CelestialInformation::CelestialInformation(const std::string inertial_frame_name
     celestial_body_mean_radius_m_[i] = pow(rx * ry * rz, 1.0 / 3.0);
   }
 
+  // Resolve the names for the SPICE query
+  for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
+    SpiceInt planet_id = selected_body_ids_[i];
+    SpiceBoolean found;
+    const int kMaxNameLength = 100;
+    char name_buffer[kMaxNameLength];
+    bodc2n_c(planet_id, kMaxNameLength, name_buffer, (SpiceBoolean*)&found);
+    selected_body_names_.push_back(name_buffer);
+
+    // Add `BARYCENTER` if needed
+    std::string planet_name = name_buffer;
+    if (planet_name == "MARS" || planet_name == "JUPITER" || planet_name == "SATURN" || planet_name == "URANUS" || planet_name == "NEPTUNE" ||
+        planet_name == "PLUTO") {
+      planet_name += "_BARYCENTER";
+    }
+    spice_target_names_.push_back(planet_name);
+  }
+
+  center_body_handle_ = GetBodyHandle(center_body_name_.c_str());
+
+  // Initialize rotation
+  earth_rotation_ = new CelestialRotation(rotation_mode_, center_body_name_);
+}
+
+CelestialInformation::CelestialInformation(const std::shared_ptr<const ChebyshevEphemeris> chebyshev_ephemeris, const RotationMode rotation_mode,
+                                           const unsigned int number_of_selected_body, int* selected_body_ids)
+    : number_of_selected_bodies_(number_of_selected_body),
+      selected_body_ids_(selected_body_ids),
+      inertial_frame_name_(chebyshev_ephemeris->GetInertialFrameName()),
+      center_body_name_(chebyshev_ephemeris->GetCenterBodyName()),
+      aberration_correction_setting_(chebyshev_ephemeris->GetAberrationCorrectionSetting()),
+      chebyshev_ephemeris_(chebyshev_ephemeris),
+      rotation_mode_(rotation_mode) {
+  // Initialize list
+  unsigned int num_of_state = number_of_selected_bodies_ * 3;
+  celestial_body_position_from_center_i_m_ = new double[num_of_state];
+  celestial_body_velocity_from_center_i_m_s_ = new double[num_of_state];
+  celestial_body_gravity_constant_m3_s2_ = new double[number_of_selected_bodies_];
+  celestial_body_mean_radius_m_ = new double[number_of_selected_bodies_];
+  celestial_body_planetographic_radii_m_ = new double[num_of_state];
+
+  // Acquisition of body constants from the file
+  for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
+    size_t index = 0;
+    for (size_t j = 0; j < chebyshev_ephemeris_->GetNumberOfBodies(); j++) {
+      if (chebyshev_ephemeris_->GetBodyId(j) == selected_body_ids_[i]) index = j;
+    }
+    chebyshev_body_indices_.push_back(index);
+    selected_body_names_.push_back(chebyshev_ephemeris_->GetBodyName(index));
+
+    celestial_body_gravity_constant_m3_s2_[i] = chebyshev_ephemeris_->GetGravityConstant_m3_s2(index);
+    const double* radii_m = chebyshev_ephemeris_->GetRadii_m(index);
+    for (int j = 0; j < 3; j++) {
+      celestial_body_planetographic_radii_m_[i * 3 + j] = radii_m[j];
+    }
+    celestial_body_mean_radius_m_[i] = pow(radii_m[0] * radii_m[1] * radii_m[2], 1.0 / 3.0);
+  }
+
+  center_body_handle_ = GetBodyHandle(center_body_name_.c_str());
+
   // Initialize rotation
   earth_rotation_ = new CelestialRotation(rotation_mode_, center_body_name_);
 }
@@ -72,6 +140,12 @@ CelestialInformation::CelestialInformation(const CelestialInformation& obj)
       inertial_frame_name_(obj.inertial_frame_name_),
       center_body_name_(obj.center_body_name_),
       aberration_correction_setting_(obj.aberration_correction_setting_),
+      center_body_handle_(obj.center_body_handle_),
+      selected_body_names_(obj.selected_body_names_),
+      spice_target_names_(obj.spice_target_names_),
+      ephemeris_caches_(obj.ephemeris_caches_),
+      chebyshev_ephemeris_(obj.chebyshev_ephemeris_),
+      chebyshev_body_indices_(obj.chebyshev_body_indices_),
       rotation_mode_(obj.rotation_mode_) {
   unsigned int num_of_state = number_of_selected_bodies_ * 3;
 
@@ -104,24 +178,49 @@ CelestialInformation::~CelestialInformation() {
 }
 
 void CelestialInformation::UpdateAllObjectsInformation(const double current_time_jd) {
-  // Convert time
-  SpiceDouble ephemeris_time;
-  std::string julian_date = "jd " + std::to_string(current_time_jd);
-  str2et_c(julian_date.c_str(), &ephemeris_time);
+  // Convert time from the Julian day in UTC to the ephemeris time
+  const double kJulianDateJ2000_day = 2451545.0;
+  const double kSecondsPerDay = 86400.0;
+  const double utc_s = (current_time_jd - kJulianDateJ2000_day) * kSecondsPerDay;
+
+  // Update celestial body orbit with the precomputed ephemeris file
+  if (chebyshev_ephemeris_ != nullptr) {
+    const double ephemeris_time_s = chebyshev_ephemeris_->ConvertUtcToEphemerisTime_s(utc_s);
+    for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
+      double state_m[6];
+      const bool is_in_span = chebyshev_ephemeris_->CalcState(chebyshev_body_indices_[i], ephemeris_time_s, state_m);
+      if (!is_in_span && !is_out_of_ephemeris_span_warned_) {
+        std::cerr << "Warning: The simulation time is out of the span of the precomputed ephemeris file." << std::endl;
+        is_out_of_ephemeris_span_warned_ = true;
+      }
+      for (int j = 0; j < 3; j++) {
+        celestial_body_position_from_center_i_m_[i * 3 + j] = state_m[j];
+        celestial_body_velocity_from_center_i_m_s_[i * 3 + j] = state_m[j + 3];
+      }
+    }
+    earth_rotation_->Update(current_time_jd);
+    return;
+  }
+
+  std::lock_guard<std::recursive_mutex> lock(spice_mutex);
+  SpiceDouble delta_et_s;
+  deltet_c(utc_s, "UTC", &delta_et_s);
+  const SpiceDouble ephemeris_time = utc_s + delta_et_s;
 
   // Update celestial body orbit
   for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
-    SpiceInt planet_id = selected_body_ids_[i];
-
-    // Acquisition of body name from id
-    SpiceBoolean found;
-    const int kMaxNameLength = 100;
-    char name_buffer[kMaxNameLength];
-    bodc2n_c(planet_id, kMaxNameLength, name_buffer, (SpiceBoolean*)&found);
-
     // Acquisition of position and velocity
+    if (!ephemeris_caches_.empty()) {
+      double state_m[6];
+      ephemeris_caches_[i].GetState(ephemeris_time, state_m);
+      for (int j = 0; j < 3; j++) {
+        celestial_body_position_from_center_i_m_[i * 3 + j] = state_m[j];
+        celestial_body_velocity_from_center_i_m_s_[i * 3 + j] = state_m[j + 3];
+      }
+      continue;
+    }
     SpiceDouble orbit_buffer_km[6];
-    GetPlanetOrbit(name_buffer, ephemeris_time, (SpiceDouble*)orbit_buffer_km);
+    GetPlanetOrbit(spice_target_names_[i].c_str(), ephemeris_time, (SpiceDouble*)orbit_buffer_km);
     // Convert unit [km], [km/s] to [m], [m/s]
     for (int j = 0; j < 3; j++) {
       celestial_body_position_from_center_i_m_[i * 3 + j] = orbit_buffer_km[j] * 1000.0;
@@ -133,8 +232,76 @@ void CelestialInformation::UpdateAllObjectsInformation(const double current_time
   earth_rotation_->Update(current_time_jd);
 }
 
+void CelestialInformation::EnableEphemerisCache(const double tolerance_m) {
+  ephemeris_caches_.clear();
+  // The precomputed ephemeris file is already evaluated without SPICE
+  if (chebyshev_ephemeris_ != nullptr) return;
+  for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
+    ephemeris_caches_.push_back(EphemerisCache(CreateSpiceSampleFunction(i), tolerance_m));
+  }
+}
+
+bool CelestialInformation::WriteChebyshevEphemeris(const std::string file_path, const double start_time_s, const double end_time_s,
+                                                   const double tolerance_m) const {
+  if (chebyshev_ephemeris_ != nullptr) {
+    std::cerr << "Error: The precomputed ephemeris file can be written only with SPICE." << std::endl;
+    return false;
+  }
+
+  std::lock_guard<std::recursive_mutex> lock(spice_mutex);
+
+  // Time system defined in the leapseconds kernel
+  ChebyshevEphemerisTimeSystem time_system;
+  SpiceInt number_of_values;
+  SpiceBoolean found;
+  gdpool_c("DELTET/DELTA_T_A", 0, 1, &number_of_values, &time_system.delta_t_a_s, &found);
+  gdpool_c("DELTET/K", 0, 1, &number_of_values, &time_system.k_s, &found);
+  gdpool_c("DELTET/EB", 0, 1, &number_of_values, &time_system.eb, &found);
+  gdpool_c("DELTET/M", 0, 2, &number_of_values, time_system.m_rad, &found);
+  const int kMaxLeapSecondsValues = 200;
+  time_system.leap_seconds.resize(kMaxLeapSecondsValues);
+  gdpool_c("DELTET/DELTA_AT", 0, kMaxLeapSecondsValues, &number_of_values, time_system.leap_seconds.data(), &found);
+  time_system.leap_seconds.resize(found ? number_of_values : 0);
+
+  ChebyshevEphemerisWriter writer(start_time_s, end_time_s, inertial_frame_name_, aberration_correction_setting_, center_body_name_, time_system);
+  for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
+    const double error_m = writer.AddBody(selected_body_ids_[i], selected_body_names_[i], celestial_body_gravity_constant_m3_s2_[i],
+                                          &celestial_body_planetographic_radii_m_[i * 3], CreateSpiceSampleFunction(i), tolerance_m);
+    std::cout << selected_body_names_[i] << ": interval " << writer.GetInterval_s(i) << " s, fitting error " << error_m << " m" << std::endl;
+  }
+  return writer.Write(file_path);
+}
+
+EphemerisCache::SampleFunction CelestialInformation::CreateSpiceSampleFunction(const unsigned int id) const {
+  const std::string target = spice_target_names_[id];
+  const std::string frame = inertial_frame_name_;
+  const std::string aberration_correction = aberration_correction_setting_;
+  const std::string observer = center_body_name_;
+  return [target, frame, aberration_correction, observer](const double ephemeris_time, double state[6]) {
+    std::lock_guard<std::recursive_mutex> lock(spice_mutex);
+    SpiceDouble lt;
+    spkezr_c(target.c_str(), ephemeris_time, frame.c_str(), aberration_correction.c_str(), observer.c_str(), (SpiceDouble*)state, &lt);
+    // Convert unit [km], [km/s] to [m], [m/s]
+    for (int j = 0; j < 6; j++) state[j] *= 1000.0;
+  };
+}
+
 int CelestialInformation::CalcBodyIdFromName(const char* body_name) const {
   int index = 0;
+  if (chebyshev_ephemeris_ != nullptr) {
+    std::string name = body_name;
+    std::locale loc = std::locale::classic();
+    std::transform(name.begin(), name.end(), name.begin(), [loc](char c) { return std::toupper(c, loc); });
+    for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
+      if (selected_body_names_[i] == name) {
+        index = i;
+        break;
+      }
+    }
+    return index;
+  }
+
+  std::lock_guard<std::recursive_mutex> lock(spice_mutex);
   SpiceInt planet_id;
   SpiceBoolean found;
 
@@ -150,15 +317,9 @@ int CelestialInformation::CalcBodyIdFromName(const char* body_name) const {
 }
 
 std::string CelestialInformation::GetLogHeader() const {
-  SpiceBoolean found;
-  const int kMaxNameLength = 100;
-  char name_buffer[kMaxNameLength];
   std::string str_tmp = "";
   for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
-    SpiceInt planet_id = selected_body_ids_[i];
-    // Acquisition of body name from id
-    bodc2n_c(planet_id, kMaxNameLength, name_buffer, (SpiceBoolean*)&found);
-    std::string name = name_buffer;
+    std::string name = selected_body_names_[i];
 
     std::locale loc = std::locale::classic();
     std::transform(name.begin(), name.end(), name.begin(), [loc](char c) { return std::tolower(c, loc); });
@@ -172,46 +333,88 @@ std::string CelestialInformation::GetLogHeader() const {
   return str_tmp;
 }
 
-std::string CelestialInformation::GetLogValue() const {
-  std::string str_tmp = "";
+std::string CelestialInformation::GetLogValue() const { return FormatLogValue(); }
+
+void CelestialInformation::AppendLogValue(LogRecord& record) const {
   for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
     for (int j = 0; j < 3; j++) {
-      str_tmp += WriteScalar(celestial_body_position_from_center_i_m_[i * 3 + j]);
+      record.AddScalar(celestial_body_position_from_center_i_m_[i * 3 + j]);
     }
     for (int j = 0; j < 3; j++) {
-      str_tmp += WriteScalar(celestial_body_velocity_from_center_i_m_s_[i * 3 + j]);
+      record.AddScalar(celestial_body_velocity_from_center_i_m_s_[i * 3 + j]);
     }
   }
-  return str_tmp;
 }
 
 void CelestialInformation::GetPlanetOrbit(const char* planet_name, const double et, double orbit[6]) {
-  // Add `BARYCENTER` if needed
-  std::string planet_name_string = planet_name;
-  if (strcmp(planet_name, "MARS") == 0 || strcmp(planet_name, "JUPITER") == 0 || strcmp(planet_name, "SATURN") == 0 ||
-      strcmp(planet_name, "URANUS") == 0 || strcmp(planet_name, "NEPTUNE") == 0 || strcmp(planet_name, "PLUTO") == 0) {
-    planet_name_string += "_BARYCENTER";
-  }
-
   // Get orbit
+  std::lock_guard<std::recursive_mutex> lock(spice_mutex);
   SpiceDouble lt;
-  spkezr_c((ConstSpiceChar*)planet_name_string.c_str(), (SpiceDouble)et, (ConstSpiceChar*)inertial_frame_name_.c_str(),
+  spkezr_c((ConstSpiceChar*)planet_name, (SpiceDouble)et, (ConstSpiceChar*)inertial_frame_name_.c_str(),
            (ConstSpiceChar*)aberration_correction_setting_.c_str(), (ConstSpiceChar*)center_body_name_.c_str(), (SpiceDouble*)orbit,
            (SpiceDouble*)&lt);
   return;
 }
 
-CelestialInformation* InitCelestialInformation(std::string file_name) {
+CelestialInformation* InitCelestialInformation(std::string file_name, const bool is_spice_forced) {
   IniAccess ini_file(file_name);
   const char* section = "CELESTIAL_INFORMATION";
   const char* furnsh_section = "CSPICE_KERNELS";
 
+  // Read Rotation setting
+  RotationMode rotation_mode;
+  std::string rotation_mode_temp = ini_file.ReadString(section, "rotation_mode");
+  if (rotation_mode_temp == "Idle") {
+    rotation_mode = RotationMode::kIdle;
+  } else if (rotation_mode_temp == "Simple") {
+    rotation_mode = RotationMode::kSimple;
+  } else if (rotation_mode_temp == "Full") {
+    rotation_mode = RotationMode::kFull;
+  } else  // if rotation_mode is neither Idle, Simple, nor Full, set rotation_mode to Idle
+  {
+    rotation_mode = RotationMode::kIdle;
+  }
+
+  const int num_of_selected_body = ini_file.ReadInt(section, "number_of_selected_body");
+  int* selected_body = new int[num_of_selected_body];
+
+  // Precomputed ephemeris file setting
+  if (!is_spice_forced && ini_file.ReadEnable(section, "chebyshev_ephemeris")) {
+    std::string ephemeris_file_path = ini_file.ReadString(section, "chebyshev_ephemeris_file");
+    // The file is mapped once in a process and shared by the instances
+    std::shared_ptr<const ChebyshevEphemeris> chebyshev_ephemeris = SharedDataStore<ChebyshevEphemeris>::GetOrLoad(
+        ephemeris_file_path, [&ephemeris_file_path]() -> std::shared_ptr<const ChebyshevEphemeris> {
+          std::shared_ptr<const ChebyshevEphemeris> ephemeris = std::make_shared<const ChebyshevEphemeris>(ephemeris_file_path);
+          if (!ephemeris->IsLoaded()) return nullptr;
+          return ephemeris;
+        });
+    bool is_all_found = chebyshev_ephemeris != nullptr;
+    for (int i = 0; is_all_found && i < num_of_selected_body; i++) {
+      std::string selected_body_i = "selected_body_name(" + std::to_string(i) + ")";
+      const int index = chebyshev_ephemeris->FindBody(ini_file.ReadString(section, selected_body_i.c_str()));
+      if (index < 0) {
+        std::cerr << "Error: " << selected_body_i << " is not included in " << ephemeris_file_path << std::endl;
+        is_all_found = false;
+        break;
+      }
+      selected_body[i] = chebyshev_ephemeris->GetBodyId(index);
+    }
+
+    if (is_all_found) {
+      CelestialInformation* celestial_info = new CelestialInformation(chebyshev_ephemeris, rotation_mode, num_of_selected_body, selected_body);
+      celestial_info->is_log_enabled_ = ini_file.ReadEnable(section, INI_LOG_LABEL);
+      return celestial_info;
+    }
+    std::cerr << "The ephemeris is calculated with SPICE." << std::endl;
+  }
+
   // Read SPICE setting
   std::string inertial_frame = ini_file.ReadString(section, "inertial_frame");
   std::string aber_cor = ini_file.ReadString(section, "aberration_correction");
   std::string center_obj = ini_file.ReadString(section, "center_object");
 
   // SPICE Furnsh
+  std::lock_guard<std::recursive_mutex> lock(spice_mutex);
   std::vector<std::string> keywords = {"tls", "tpc1", "tpc2", "tpc3", "bsp"};
   for (size_t i = 0; i < keywords.size(); i++) {
     std::string fname = ini_file.ReadString(furnsh_section, keywords[i].c_str());
@@ -219,8 +422,6 @@ CelestialInformation* InitCelestialInformation(std::string file_name) {
   }
 
   // Initialize celestial body list
-  const int num_of_selected_body = ini_file.ReadInt(section, "number_of_selected_body");
-  int* selected_body = new int[num_of_selected_body];
   for (int i = 0; i < num_of_selected_body; i++) {
     // Convert body name to SPICE ID
     std::string selected_body_i = "selected_body_name(" + std::to_string(i) + ")";
@@ -236,23 +437,16 @@ CelestialInformation* InitCelestialInformation(std::string file_name) {
     selected_body[i] = planet_id;
   }
 
-  // Read Rotation setting
-  RotationMode rotation_mode;
-  std::string rotation_mode_temp = ini_file.ReadString(section, "rotation_mode");
-  if (rotation_mode_temp == "Idle") {
-    rotation_mode = RotationMode::kIdle;
-  } else if (rotation_mode_temp == "Simple") {
-    rotation_mode = RotationMode::kSimple;
-  } else if (rotation_mode_temp == "Full") {
-    rotation_mode = RotationMode::kFull;
-  } else  // if rotation_mode is neither Idle, Simple, nor Full, set rotation_mode to Idle
-  {
-    rotation_mode = RotationMode::kIdle;
-  }
-
   CelestialInformation* celestial_info;
   celestial_info = new CelestialInformation(inertial_frame, aber_cor, center_obj, rotation_mode, num_of_selected_body, selected_body);
 
+  // Ephemeris cache setting
+  if (ini_file.ReadEnable(section, "ephemeris_cache")) {
+    double tolerance_m = ini_file.ReadDouble(section, "ephemeris_cache_tolerance_m");
+    if (tolerance_m <= 0.0) tolerance_m = 1.0;
+    celestial_info->EnableEphemerisCache(tolerance_m);
+  }
+
   // log setting
   celestial_info->is_log_enabled_ = ini_file.ReadEnable(section, INI_LOG_LABEL);
 
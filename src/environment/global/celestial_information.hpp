@@ -1,20 +1,50 @@
 /**
  * @file celestial_information.hpp
  * @brief Class to manage the information related with the celestial bodies
- * @details This class uses SPICE to get the information of celestial bodies
+ * @details This class uses SPICE or the precomputed ephemeris file to get the information of celestial bodies
  */
 
 #ifndef S2E_ENVIRONMENT_GLOBAL_CELESTIAL_INFORMATION_HPP_
 #define S2E_ENVIRONMENT_GLOBAL_CELESTIAL_INFORMATION_HPP_
 
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "celestial_rotation.hpp"
 #include "library/logger/loggable.hpp"
 #include "library/math/vector.hpp"
+#include "library/orbit/chebyshev_ephemeris.hpp"
+#include "library/orbit/ephemeris_cache.hpp"
+
+/**
+ * @class CelestialBodyHandle
+ * @brief Handle of a selected celestial body to access its information without the name lookup
+ * @note Get the handle once at the initialization with CelestialInformation::GetBodyHandle and use it in the periodic update
+ */
+class CelestialBodyHandle {
+ public:
+  /**
+   * @fn CelestialBodyHandle
+   * @brief Constructor
+   * @param [in] index: ID of CelestialInformation list
+   */
+  explicit CelestialBodyHandle(const unsigned int index = 0) : index_(index) {}
+
+  /**
+   * @fn GetIndex
+   * @brief Return ID of CelestialInformation list
+   */
+  inline unsigned int GetIndex() const { return index_; }
+
+ private:
+  unsigned int index_;  //!< ID of CelestialInformation list
+};
 
 /**
  * @class CelestialInformation
  * @brief Class to manage the information related with the celestial bodies
- * @details This class uses SPICE to get the information of celestial bodies
+ * @details This class uses SPICE or the precomputed ephemeris file to get the information of celestial bodies
  */
 class CelestialInformation : public ILoggable {
  public:
@@ -30,6 +60,17 @@ class CelestialInformation : public ILoggable {
    */
   CelestialInformation(const std::string inertial_frame_name, const std::string aberration_correction_setting, const std::string center_body_name,
                        const RotationMode rotation_mode, const unsigned int number_of_selected_body, int* selected_body_ids);
+  /**
+   * @fn CelestialInformation
+   * @brief Constructor with the precomputed ephemeris file
+   * @note The inertial frame, the aberration correction, and the center body are defined by the file. SPICE is not used.
+   * @param [in] chebyshev_ephemeris: Precomputed ephemeris file
+   * @param [in] rotation_mode: Designation of rotation model
+   * @param [in] number_of_selected_body: Number of selected body
+   * @param [in] selected_body_ids: SPICE IDs of selected bodies (must be included in the file)
+   */
+  CelestialInformation(const std::shared_ptr<const ChebyshevEphemeris> chebyshev_ephemeris, const RotationMode rotation_mode,
+                       const unsigned int number_of_selected_body, int* selected_body_ids);
   /**
    * @fn CelestialInformation
    * @brief Copy constructor
@@ -52,6 +93,11 @@ class CelestialInformation : public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(LogRecord& record) const;
 
   /**
    * @fn UpdateAllObjectsInformation
@@ -60,6 +106,23 @@ class CelestialInformation : public ILoggable {
    */
   void UpdateAllObjectsInformation(const double current_time_jd);
 
+  /**
+   * @fn EnableEphemerisCache
+   * @brief Serve the position and velocity of the selected bodies by interpolation of SPICE results sampled at coarse nodes
+   * @param [in] tolerance_m: Tolerance of the interpolation error of position [m]
+   */
+  void EnableEphemerisCache(const double tolerance_m);
+  /**
+   * @fn WriteChebyshevEphemeris
+   * @brief Fit the SPICE ephemerides of the selected bodies and write them into the precomputed ephemeris file
+   * @param [in] file_path: Path to the file
+   * @param [in] start_time_s: Start ephemeris time from J2000 [s]
+   * @param [in] end_time_s: End ephemeris time from J2000 [s]
+   * @param [in] tolerance_m: Tolerance of the fitting error of position [m]
+   * @return True when the file is written
+   */
+  bool WriteChebyshevEphemeris(const std::string file_path, const double start_time_s, const double end_time_s, const double tolerance_m) const;
+
   // Getters
   // Orbit information
   /**
@@ -78,10 +141,13 @@ class CelestialInformation : public ILoggable {
    * @brief Return position from the center body in the inertial frame [m]
    * @param [in] body_name: Name of the body defined in the SPICE
    */
-  inline libra::Vector<3> GetPositionFromCenter_i_m(const char* body_name) const {
-    int id = CalcBodyIdFromName(body_name);
-    return GetPositionFromCenter_i_m(id);
-  }
+  inline libra::Vector<3> GetPositionFromCenter_i_m(const char* body_name) const { return GetPositionFromCenter_i_m(GetBodyHandle(body_name)); }
+  /**
+   * @fn GetPositionFromCenter_i_m
+   * @brief Return position from the center body in the inertial frame [m]
+   * @param [in] handle: Handle of the body
+   */
+  inline libra::Vector<3> GetPositionFromCenter_i_m(const CelestialBodyHandle handle) const { return GetPositionFromCenter_i_m(handle.GetIndex()); }
 
   /**
    * @fn GetVelocityFromCenter_i_m_s
@@ -99,9 +165,14 @@ class CelestialInformation : public ILoggable {
    * @brief Return velocity from the center body in the inertial frame [m/s]
    * @param [in] body_name: Name of the body defined in the SPICE
    */
-  inline libra::Vector<3> GetVelocityFromCenter_i_m_s(const char* body_name) const {
-    int id = CalcBodyIdFromName(body_name);
-    return GetVelocityFromCenter_i_m_s(id);
+  inline libra::Vector<3> GetVelocityFromCenter_i_m_s(const char* body_name) const { return GetVelocityFromCenter_i_m_s(GetBodyHandle(body_name)); }
+  /**
+   * @fn GetVelocityFromCenter_i_m_s
+   * @brief Return velocity from the center body in the inertial frame [m/s]
+   * @param [in] handle: Handle of the body
+   */
+  inline libra::Vector<3> GetVelocityFromCenter_i_m_s(const CelestialBodyHandle handle) const {
+    return GetVelocityFromCenter_i_m_s(handle.GetIndex());
   }
 
   // Gravity constants
@@ -110,15 +181,18 @@ class CelestialInformation : public ILoggable {
    * @brief Return gravity constant of the celestial body [m^3/s^2]
    * @param [in] body_name: Name of the body defined in the SPICE
    */
-  inline double GetGravityConstant_m3_s2(const char* body_name) const {
-    int index = CalcBodyIdFromName(body_name);
-    return celestial_body_gravity_constant_m3_s2_[index];
-  }
+  inline double GetGravityConstant_m3_s2(const char* body_name) const { return GetGravityConstant_m3_s2(GetBodyHandle(body_name)); }
+  /**
+   * @fn GetGravityConstant_m3_s2
+   * @brief Return gravity constant of the celestial body [m^3/s^2]
+   * @param [in] handle: Handle of the body
+   */
+  inline double GetGravityConstant_m3_s2(const CelestialBodyHandle handle) const { return celestial_body_gravity_constant_m3_s2_[handle.GetIndex()]; }
   /**
    * @fn GetCenterBodyGravityConstant_m3_s2
    * @brief Return gravity constant of the center body [m^3/s^2]
    */
-  inline double GetCenterBodyGravityConstant_m3_s2(void) const { return GetGravityConstant_m3_s2(center_body_name_.c_str()); }
+  inline double GetCenterBodyGravityConstant_m3_s2(void) const { return GetGravityConstant_m3_s2(center_body_handle_); }
 
   // Shape information
   /**
@@ -137,19 +211,25 @@ class CelestialInformation : public ILoggable {
    * @brief Return 3 axis planetographic radii of a celestial body [m]
    * @param [in] body_name: Name of the body defined in the SPICE
    */
-  inline libra::Vector<3> GetRadiiFromName_m(const char* body_name) const {
-    int id = CalcBodyIdFromName(body_name);
-    return GetRadii_m(id);
-  }
+  inline libra::Vector<3> GetRadiiFromName_m(const char* body_name) const { return GetRadii_m(GetBodyHandle(body_name)); }
+  /**
+   * @fn GetRadii_m
+   * @brief Return 3 axis planetographic radii of a celestial body [m]
+   * @param [in] handle: Handle of the body
+   */
+  inline libra::Vector<3> GetRadii_m(const CelestialBodyHandle handle) const { return GetRadii_m(handle.GetIndex()); }
   /**
    * @fn GetMeanRadiusFromName_m
    * @brief Return mean radius of a celestial body [m]
-   * @param [in] id: ID of CelestialInformation list
+   * @param [in] body_name: Name of the body defined in the SPICE
    */
-  inline double GetMeanRadiusFromName_m(const char* body_name) const {
-    int index = CalcBodyIdFromName(body_name);
-    return celestial_body_mean_radius_m_[index];
-  }
+  inline double GetMeanRadiusFromName_m(const char* body_name) const { return GetMeanRadius_m(GetBodyHandle(body_name)); }
+  /**
+   * @fn GetMeanRadius_m
+   * @brief Return mean radius of a celestial body [m]
+   * @param [in] handle: Handle of the body
+   */
+  inline double GetMeanRadius_m(const CelestialBodyHandle handle) const { return celestial_body_mean_radius_m_[handle.GetIndex()]; }
 
   // Parameters
   /**
@@ -162,11 +242,22 @@ class CelestialInformation : public ILoggable {
    * @brief Return SPICE IDs of selected bodies
    */
   inline const int* GetSelectedBodyIds(void) const { return selected_body_ids_; }
+  /**
+   * @fn GetSelectedBodyName
+   * @brief Return name of a selected body
+   * @param [in] id: ID of CelestialInformation list
+   */
+  inline std::string GetSelectedBodyName(const unsigned int id) const { return selected_body_names_[id]; }
   /**
    * @fn GetCenterBodyName
    * @brief Return name of the center body
    */
   inline std::string GetCenterBodyName(void) const { return center_body_name_; }
+  /**
+   * @fn GetCenterBodyHandle
+   * @brief Return handle of the center body
+   */
+  inline CelestialBodyHandle GetCenterBodyHandle(void) const { return center_body_handle_; }
 
   // Members
   /**
@@ -183,6 +274,13 @@ class CelestialInformation : public ILoggable {
    * @return ID of CelestialInformation list
    */
   int CalcBodyIdFromName(const char* body_name) const;
+  /**
+   * @fn GetBodyHandle
+   * @brief Return handle of a selected body
+   * @note The name lookup is executed in this function, so call it at the initialization and keep the handle
+   * @param [in] body_name: Celestial body name
+   */
+  inline CelestialBodyHandle GetBodyHandle(const char* body_name) const { return CelestialBodyHandle(CalcBodyIdFromName(body_name)); }
   /**
    * @fn DebugOutput
    * @brief Debug output
@@ -197,6 +295,13 @@ class CelestialInformation : public ILoggable {
   std::string center_body_name_;               //!< Center object name of inertial frame
   std::string aberration_correction_setting_;  //!< Stellar aberration correction
                                                //!< Ref：http://fermi.gsfc.nasa.gov/ssc/library/fug/051108/Aberration_Julie.ppt
+  CelestialBodyHandle center_body_handle_;                         //!< Handle of the center body
+  std::vector<std::string> selected_body_names_;                   //!< Names of the selected bodies
+  std::vector<std::string> spice_target_names_;                    //!< Names of the selected bodies for the SPICE query (resolved at construction)
+  std::vector<EphemerisCache> ephemeris_caches_;                   //!< Ephemeris caches of the selected bodies (empty when the cache is disabled)
+  std::shared_ptr<const ChebyshevEphemeris> chebyshev_ephemeris_;  //!< Precomputed ephemeris file (nullptr when SPICE is used)
+  std::vector<size_t> chebyshev_body_indices_;                     //!< Indices of the selected bodies in the precomputed ephemeris file
+  bool is_out_of_ephemeris_span_warned_ = false;                   //!< Flag of the warning for the time out of the file span
 
   // Calculated values
   double* celestial_body_position_from_center_i_m_;    //!< Position vector list at inertial frame [m]
@@ -216,18 +321,26 @@ class CelestialInformation : public ILoggable {
    * @fn GetPlanetOrbit
    * @brief Get position/velocity of planet.
    * @note This is an override function of SPICE's spkezr_c (https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/spkezr_c.html)
-   * @param [in] planet_name: Nama of planet defined by SPICE
+   * @param [in] planet_name: Name of planet for the SPICE query (e.g. MARS_BARYCENTER)
    * @param [in] et: Ephemeris time
    * @param [out] orbit: Cartesian state vector representing the position and velocity of the target body relative to the specified observer.
    */
   void GetPlanetOrbit(const char* planet_name, const double et, double orbit[6]);
+  /**
+   * @fn CreateSpiceSampleFunction
+   * @brief Create a function to sample the position [m] and velocity [m/s] of a selected body from SPICE at an ephemeris time
+   * @note The settings are captured by value so that the function does not refer to this object
+   * @param [in] id: ID of CelestialInformation list
+   */
+  EphemerisCache::SampleFunction CreateSpiceSampleFunction(const unsigned int id) const;
 };
 
 /**
  *@fn InitCelestialInfo
  *@brief Initialize function for CelestialInformation class
  *@param [in] file_name: Path to the initialize function
+ *@param [in] is_spice_forced: Use SPICE even if the precomputed ephemeris file is enabled
  */
-CelestialInformation* InitCelestialInformation(std::string file_name);
+CelestialInformation* InitCelestialInformation(std::string file_name, const bool is_spice_forced = false);
 
 #endif  // S2E_ENVIRONMENT_GLOBAL_CELESTIAL_INFORMATION_HPP_
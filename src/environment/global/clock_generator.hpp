@@ -7,6 +7,7 @@
 #define S2E_ENVIRONMENT_GLOBAL_CLOCK_GENERATOR_HPP_
 
 #include <components/base/interface_tickable.hpp>
+#include <library/utilities/snapshot.hpp>
 #include <vector>
 
 #include "simulation_time.hpp"
@@ -52,6 +53,17 @@ class ClockGenerator {
    */
   inline void ClearTimerCount(void) { timer_count_ = 0; }
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the timer count into the snapshot
+   */
+  inline void SaveSnapshot(Snapshot& snapshot) const { snapshot.Write(timer_count_); }
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the timer count from the snapshot
+   */
+  inline void RestoreSnapshot(Snapshot& snapshot) { snapshot.Read(timer_count_); }
+
  private:
   std::vector<ITickable*> components_;  //!< Component list fot tick
   unsigned int timer_count_;            //!< Timer count TODO: change to long?
@@ -0,0 +1,32 @@
+/**
+ * @file convert_hipparcos_catalogue.cpp
+ * @brief Tool to convert the Hipparcos catalogue CSV file into the binary catalogue file
+ * @details Usage: convert_hipparcos_catalogue <CSV catalogue file> <binary catalogue file> [max magnitude]
+ *          The stars brighter than the max magnitude (all stars by default) are stored in ascending order of the magnitude with their unit vectors
+ *          and the sky index, so the CSV file does not need to be sorted. The binary file can be set to catalogue_file_path in HIPPARCOS_CATALOGUE
+ *          section instead of the CSV file.
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "hipparcos_catalogue.hpp"
+
+int main(int argc, char* argv[]) {
+  if (argc < 3) {
+    std::cerr << "Usage: " << argv[0] << " <CSV catalogue file> <binary catalogue file> [max magnitude]" << std::endl;
+    return 1;
+  }
+  const std::string csv_file_path = argv[1];
+  const std::string binary_file_path = argv[2];
+  const double kAllStarsMagnitude = 100.0;
+  const double max_magnitude = (argc >= 4) ? atof(argv[3]) : kAllStarsMagnitude;
+
+  HipparcosCatalogue catalogue(max_magnitude, csv_file_path);
+  if (!catalogue.ReadContents(csv_file_path, ',')) return 1;
+  if (!catalogue.WriteBinaryCatalogue(binary_file_path)) return 1;
+
+  std::cout << "Converted " << catalogue.GetCatalogueSize() << " stars: " << binary_file_path << std::endl;
+  return 0;
+}
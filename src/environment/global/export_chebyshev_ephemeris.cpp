@@ -0,0 +1,56 @@
+/**
+ * @file export_chebyshev_ephemeris.cpp
+ * @brief Tool to export the ephemerides of a scenario into the precomputed ephemeris file
+ * @details Usage: export_chebyshev_ephemeris <simulation base ini file> [output file]
+ *          The bodies, frames, and kernels are read from CELESTIAL_INFORMATION and CSPICE_KERNELS sections, and the time span is read from
+ *          TIME section with a margin of one day. The output file is chebyshev_ephemeris_file in CELESTIAL_INFORMATION section by default.
+ */
+
+#include <SpiceUsr.h>
+
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+#include "celestial_information.hpp"
+#include "library/initialize/initialize_file_access.hpp"
+
+int main(int argc, char* argv[]) {
+  if (argc < 2) {
+    std::cerr << "Usage: " << argv[0] << " <simulation base ini file> [output file]" << std::endl;
+    return 1;
+  }
+  const std::string ini_file_path = argv[1];
+  IniAccess ini_file(ini_file_path);
+  const char* section = "CELESTIAL_INFORMATION";
+
+  std::string output_file_path = ini_file.ReadString(section, "chebyshev_ephemeris_file");
+  if (argc >= 3) output_file_path = argv[2];
+  double tolerance_m = ini_file.ReadDouble(section, "chebyshev_ephemeris_tolerance_m");
+  if (tolerance_m <= 0.0) tolerance_m = 0.1;
+
+  // Time span of the scenario
+  const std::string start_time_utc = ini_file.ReadString("TIME", "simulation_start_time_utc");
+  const double duration_s = ini_file.ReadDouble("TIME", "simulation_duration_s");
+  int year, month, day, hour, minute;
+  double second;
+  if (sscanf(start_time_utc.c_str(), "%d/%d/%d %d:%d:%lf", &year, &month, &day, &hour, &minute, &second) != 6) {
+    std::cerr << "Error: Invalid simulation_start_time_utc: " << start_time_utc << std::endl;
+    return 1;
+  }
+
+  CelestialInformation* celestial_information = InitCelestialInformation(ini_file_path, true);
+
+  char iso_time[64];
+  snprintf(iso_time, sizeof(iso_time), "%04d-%02d-%02dT%02d:%02d:%06.3f", year, month, day, hour, minute, second);
+  SpiceDouble start_time_s;
+  str2et_c(iso_time, &start_time_s);
+  const double kMargin_s = 86400.0;
+
+  const bool is_written = celestial_information->WriteChebyshevEphemeris(output_file_path, start_time_s - kMargin_s,
+                                                                         start_time_s + duration_s + kMargin_s, tolerance_m);
+  delete celestial_information;
+  if (!is_written) return 1;
+  std::cout << "Exported: " << output_file_path << std::endl;
+  return 0;
+}
@@ -45,3 +45,11 @@ void GlobalEnvironment::LogSetup(Logger& logger) {
 }
 
 void GlobalEnvironment::Reset(void) { simulation_time_->ResetClock(); }
+
+void GlobalEnvironment::SaveSnapshot(Snapshot& snapshot) const { simulation_time_->SaveSnapshot(snapshot); }
+
+void GlobalEnvironment::RestoreSnapshot(Snapshot& snapshot) {
+  simulation_time_->RestoreSnapshot(snapshot);
+  celestial_information_->UpdateAllObjectsInformation(simulation_time_->GetCurrentTime_jd());
+  gnss_satellites_->Update(simulation_time_);
+}
@@ -53,6 +53,18 @@ class GlobalEnvironment {
    */
   void Reset(void);
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the state of the global environment into the snapshot
+   * @note The celestial bodies and the GNSS satellites are not stored, since they are calculated from the time.
+   */
+  void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the state of the global environment from the snapshot, and recalculate the information at the restored time
+   */
+  void RestoreSnapshot(Snapshot& snapshot);
+
   // Getter
   /**
    * @fn GetSimulationTime
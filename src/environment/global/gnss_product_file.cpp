@@ -0,0 +1,419 @@
+/**
+ * @file gnss_product_file.cpp
+ * @brief Parser of the GNSS precise orbit (SP3) and clock (CLK) product files
+ */
+
+#include "gnss_product_file.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <thread>
+
+#include "gnss_satellites.hpp"
+#include "library/external/sgp4/sgp4ext.h"   // for jday()
+#include "library/external/sgp4/sgp4unit.h"  // for gstime()
+#include "library/utilities/memory_mapped_file.hpp"
+
+static const char kCacheMagic[8] = {'S', '2', 'E', 'G', 'N', 'S', 'S', '1'};  //!< Magic of the cache file
+static const uint32_t kCacheByteOrderMark = 0x01020304;                       //!< Byte order mark of the cache file
+
+/**
+ * @struct CacheHeader
+ * @brief Header of the binary cache file. The epochs and the records follow the header.
+ */
+struct CacheHeader {
+  char magic[8];                  //!< Magic "S2EGNSS1"
+  uint32_t byte_order_mark;       //!< Byte order mark
+  uint32_t format;                //!< Format of the product file
+  uint64_t file_size_byte;        //!< Size of the product file [byte]
+  uint64_t file_hash;             //!< FNV-1a hash of the product file
+  double time_interval_s;         //!< Epoch interval in the SP3 header [s]
+  int32_t number_of_epochs;       //!< Number of epochs in the SP3 header
+  int32_t number_of_satellites;   //!< Number of satellites in the SP3 header
+  uint64_t number_of_epoch_data;  //!< Number of the parsed epochs
+  uint64_t number_of_records;     //!< Number of the parsed records
+};
+
+/**
+ * @class LineTokenizer
+ * @brief Tokenizer of a line separated with spaces without copying the line
+ */
+class LineTokenizer {
+ public:
+  LineTokenizer(const char* begin, const char* end) : position_(begin), end_(end) {}
+
+  /**
+   * @fn Next
+   * @brief Move to the next token
+   * @return False when no token remains
+   */
+  bool Next() {
+    while (position_ < end_ && (*position_ == ' ' || *position_ == '\t')) ++position_;
+    token_ = position_;
+    while (position_ < end_ && *position_ != ' ' && *position_ != '\t') ++position_;
+    token_length_ = (size_t)(position_ - token_);
+    return token_length_ > 0;
+  }
+  /**
+   * @fn Skip
+   * @brief Skip the tokens
+   * @return False when the tokens do not remain
+   */
+  bool Skip(const size_t number_of_tokens) {
+    for (size_t i = 0; i < number_of_tokens; ++i) {
+      if (!Next()) return false;
+    }
+    return true;
+  }
+  /**
+   * @fn GetDouble
+   * @brief Return the current token as a floating point value
+   */
+  double GetDouble() const {
+    char buffer[64];
+    return strtod(CopyToken(buffer, sizeof(buffer)), nullptr);
+  }
+  /**
+   * @fn GetInt
+   * @brief Return the current token as an integer value
+   */
+  int GetInt() const {
+    char buffer[64];
+    return (int)strtol(CopyToken(buffer, sizeof(buffer)), nullptr, 10);
+  }
+  /**
+   * @fn GetString
+   * @brief Return the current token as a string
+   */
+  std::string GetString() const { return std::string(token_, token_length_); }
+  inline const char* GetToken() const { return token_; }
+  inline size_t GetTokenLength() const { return token_length_; }
+
+ private:
+  const char* position_;     //!< Current position in the line
+  const char* end_;          //!< End of the line
+  const char* token_ = "";   //!< Head of the current token
+  size_t token_length_ = 0;  //!< Length of the current token
+
+  const char* CopyToken(char* buffer, const size_t buffer_size) const {
+    const size_t length = std::min(token_length_, buffer_size - 1);
+    memcpy(buffer, token_, length);
+    buffer[length] = '\0';
+    return buffer;
+  }
+};
+
+/**
+ * @class TimeStampConverter
+ * @brief Convert the calendar time stamp in the product file to unix time, and reuse the result for the same time stamp
+ * @note The unix time is calculated with mktime and the seconds below 1 are truncated as GnssSatellites::SetUp does.
+ */
+class TimeStampConverter {
+ public:
+  /**
+   * @fn Convert
+   * @brief Convert the six tokens of year, month, day, hour, minute, and second
+   * @param [in] tokenizer: Tokenizer whose next token is the year
+   * @param [out] unix_time: Unix time
+   * @param [out] greenwich_sidereal_time_rad: Greenwich sidereal time [rad] (calculated only when is_sidereal_time_required is true)
+   * @param [in] is_sidereal_time_required: Calculate the Greenwich sidereal time
+   * @return False when the tokens are not enough
+   */
+  bool Convert(LineTokenizer& tokenizer, double& unix_time, double& greenwich_sidereal_time_rad, const bool is_sidereal_time_required) {
+    // The six tokens are compared with the last time stamp as a string before parsing them
+    if (!tokenizer.Next()) return false;
+    LineTokenizer field_tokenizer = tokenizer;
+    const char* time_stamp = tokenizer.GetToken();
+    if (!tokenizer.Skip(5)) return false;
+    const size_t time_stamp_length = (size_t)(tokenizer.GetToken() + tokenizer.GetTokenLength() - time_stamp);
+
+    is_new_time_stamp_ = (time_stamp_length != last_time_stamp_.size() || memcmp(time_stamp, last_time_stamp_.data(), time_stamp_length) != 0);
+    if (is_new_time_stamp_) {
+      int fields[5];
+      for (size_t i = 0; i < 5; ++i) {
+        fields[i] = field_tokenizer.GetInt();
+        field_tokenizer.Next();
+      }
+      const double second = field_tokenizer.GetDouble();
+
+      tm time_tm = {};
+      time_tm.tm_year = fields[0] - 1900;
+      time_tm.tm_mon = fields[1] - 1;  // 0 - 11, in time struct, 1 - 12 month is expressed by 1 - 12
+      time_tm.tm_mday = fields[2];
+      time_tm.tm_hour = fields[3];
+      time_tm.tm_min = fields[4];
+      time_tm.tm_sec = (int)(second + 1e-4);  // for the numerical error, plus 1e-4 (tm_sec is to be int)
+      last_unix_time_ = (double)mktime(&time_tm);
+      last_greenwich_sidereal_time_rad_ = 0.0;
+      if (is_sidereal_time_required) {
+        double julian_day;
+        jday(fields[0], fields[1], fields[2], fields[3], fields[4], second, julian_day);
+        last_greenwich_sidereal_time_rad_ = gstime(julian_day);
+      }
+      last_time_stamp_.assign(time_stamp, time_stamp_length);
+    }
+    unix_time = last_unix_time_;
+    greenwich_sidereal_time_rad = last_greenwich_sidereal_time_rad_;
+    return true;
+  }
+  /**
+   * @fn IsNewTimeStamp
+   * @brief Return true when the last converted time stamp differs from the previous one
+   */
+  inline bool IsNewTimeStamp() const { return is_new_time_stamp_; }
+
+ private:
+  std::string last_time_stamp_;                    //!< Last time stamp
+  double last_unix_time_ = 0.0;                    //!< Unix time of the last time stamp
+  double last_greenwich_sidereal_time_rad_ = 0.0;  //!< Greenwich sidereal time of the last time stamp [rad]
+  bool is_new_time_stamp_ = false;                 //!< Whether the last time stamp differs from the previous one
+};
+
+/**
+ * @fn CalcFileHash
+ * @brief Calculate FNV-1a hash of the data
+ */
+static uint64_t CalcFileHash(const unsigned char* data, const size_t size_byte) {
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (size_t i = 0; i < size_byte; ++i) {
+    hash ^= data[i];
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+/**
+ * @fn ParseSp3
+ * @brief Parse the contents of the SP3 file
+ */
+static void ParseSp3(const char* data, const char* data_end, GnssProductFile& product_file) {
+  const GnssSat_coordinate coordinate;
+  TimeStampConverter time_stamp_converter;
+  bool is_data_started = false;
+  size_t line_number = 0;
+  for (const char* line = data; line < data_end; ++line_number) {
+    const char* line_end = (const char*)memchr(line, '\n', (size_t)(data_end - line));
+    if (line_end == nullptr) line_end = data_end;
+    const char* next_line = line_end + (line_end < data_end ? 1 : 0);
+    if (line_end > line && line_end[-1] == '\r') --line_end;
+    LineTokenizer tokenizer(line, line_end);
+
+    if (line_number == 0) {
+      // in seventh token, there is time stamps
+      // http://epncb.oma.be/ftp/data/format/sp3c.txt
+      if (tokenizer.Skip(7)) product_file.number_of_epochs = tokenizer.GetInt();
+    } else if (line_number == 1) {
+      if (tokenizer.Skip(4)) product_file.time_interval_s = tokenizer.GetDouble();
+    } else if (line_number == 2) {
+      if (tokenizer.Skip(2)) product_file.number_of_satellites = tokenizer.GetInt();
+    } else if (line < line_end && *line == '*') {
+      is_data_started = true;
+      GnssProductEpoch epoch;
+      tokenizer.Next();
+      if (!time_stamp_converter.Convert(tokenizer, epoch.unix_time, epoch.greenwich_sidereal_time_rad, true)) break;
+      epoch.record_begin = epoch.record_end = product_file.records.size();
+      product_file.epochs.push_back(epoch);
+    } else if (is_data_started && line_end - line >= 3 && memcmp(line, "EOF", 3) == 0) {
+      break;
+    } else if (is_data_started && line < line_end && *line == 'P') {
+      GnssProductRecord record;
+      if (!tokenizer.Next()) continue;
+      record.gnss_satellite_id = coordinate.GetIndexFromID(tokenizer.GetString());
+      record.reserved = 0;
+      if (record.gnss_satellite_id < 0 || record.gnss_satellite_id >= coordinate.GetNumOfSatellites()) continue;
+      bool is_complete = true;
+      for (size_t i = 0; i < 3 && is_complete; ++i) {
+        is_complete = tokenizer.Next();
+        record.position_km[i] = tokenizer.GetDouble();
+      }
+      is_complete = is_complete && tokenizer.Next();
+      if (!is_complete) continue;
+      record.clock = tokenizer.GetDouble();
+      product_file.records.push_back(record);
+      product_file.epochs.back().record_end = product_file.records.size();
+    }
+    line = next_line;
+  }
+}
+
+/**
+ * @fn ParseClock
+ * @brief Parse the satellite clock records ("AS" lines) of the CLK file
+ */
+static void ParseClock(const char* data, const char* data_end, GnssProductFile& product_file) {
+  const GnssSat_coordinate coordinate;
+  TimeStampConverter time_stamp_converter;
+  for (const char* line = data; line < data_end;) {
+    const char* line_end = (const char*)memchr(line, '\n', (size_t)(data_end - line));
+    if (line_end == nullptr) line_end = data_end;
+    const char* next_line = line_end + (line_end < data_end ? 1 : 0);
+    if (line_end > line && line_end[-1] == '\r') --line_end;
+
+    if (line_end - line >= 3 && memcmp(line, "AS ", 3) == 0) {
+      LineTokenizer tokenizer(line, line_end);
+      GnssProductRecord record;
+      tokenizer.Skip(2);
+      record.gnss_satellite_id = coordinate.GetIndexFromID(tokenizer.GetString());
+      record.reserved = 0;
+      record.position_km[0] = record.position_km[1] = record.position_km[2] = 0.0;
+      double unix_time, greenwich_sidereal_time_rad;
+      if (record.gnss_satellite_id >= 0 && record.gnss_satellite_id < coordinate.GetNumOfSatellites() &&
+          time_stamp_converter.Convert(tokenizer, unix_time, greenwich_sidereal_time_rad, false) && tokenizer.Skip(2)) {
+        record.clock = tokenizer.GetDouble();
+        if (time_stamp_converter.IsNewTimeStamp() || product_file.epochs.empty()) {
+          GnssProductEpoch epoch;
+          epoch.unix_time = unix_time;
+          epoch.greenwich_sidereal_time_rad = 0.0;
+          epoch.record_begin = epoch.record_end = product_file.records.size();
+          product_file.epochs.push_back(epoch);
+        }
+        product_file.records.push_back(record);
+        product_file.epochs.back().record_end = product_file.records.size();
+      }
+    }
+    line = next_line;
+  }
+}
+
+/**
+ * @fn GetCacheFilePath
+ * @brief Return path to the cache file of the product file
+ */
+static std::string GetCacheFilePath(const std::string file_path, const std::string cache_directory) {
+  const size_t separator = file_path.find_last_of("/\\");
+  const std::string file_name = (separator == std::string::npos) ? file_path : file_path.substr(separator + 1);
+  return cache_directory + file_name + ".cache";
+}
+
+/**
+ * @fn ReadCache
+ * @brief Read the cache file when it is made from the same product file
+ */
+static bool ReadCache(const std::string cache_file_path, const GnssProductFileFormat format, const uint64_t file_size_byte, const uint64_t file_hash,
+                      GnssProductFile& product_file) {
+  std::ifstream file(cache_file_path, std::ios::in | std::ios::binary);
+  if (!file.is_open()) return false;
+  CacheHeader header;
+  file.read((char*)&header, sizeof(header));
+  if (!file.good() || memcmp(header.magic, kCacheMagic, sizeof(kCacheMagic)) != 0 || header.byte_order_mark != kCacheByteOrderMark ||
+      header.format != (uint32_t)format || header.file_size_byte != file_size_byte || header.file_hash != file_hash ||
+      header.number_of_records > file_size_byte || header.number_of_epoch_data > header.number_of_records + 1) {
+    return false;
+  }
+
+  product_file.format = format;
+  product_file.time_interval_s = header.time_interval_s;
+  product_file.number_of_epochs = header.number_of_epochs;
+  product_file.number_of_satellites = header.number_of_satellites;
+  product_file.epochs.resize(header.number_of_epoch_data);
+  product_file.records.resize(header.number_of_records);
+  file.read((char*)product_file.epochs.data(), sizeof(GnssProductEpoch) * product_file.epochs.size());
+  file.read((char*)product_file.records.data(), sizeof(GnssProductRecord) * product_file.records.size());
+  if (!file.good()) return false;
+  for (const GnssProductEpoch& epoch : product_file.epochs) {
+    if (epoch.record_begin > epoch.record_end || epoch.record_end > product_file.records.size()) return false;
+  }
+  return true;
+}
+
+/**
+ * @fn WriteCache
+ * @brief Write the cache file. The file is written into a temporary file and renamed, so a reader never sees a partial file.
+ */
+static void WriteCache(const std::string cache_file_path, const uint64_t file_size_byte, const uint64_t file_hash,
+                       const GnssProductFile& product_file) {
+  CacheHeader header;
+  memcpy(header.magic, kCacheMagic, sizeof(kCacheMagic));
+  header.byte_order_mark = kCacheByteOrderMark;
+  header.format = (uint32_t)product_file.format;
+  header.file_size_byte = file_size_byte;
+  header.file_hash = file_hash;
+  header.time_interval_s = product_file.time_interval_s;
+  header.number_of_epochs = product_file.number_of_epochs;
+  header.number_of_satellites = product_file.number_of_satellites;
+  header.number_of_epoch_data = product_file.epochs.size();
+  header.number_of_records = product_file.records.size();
+
+  const std::string temporary_file_path = cache_file_path + ".tmp";
+  {
+    std::ofstream file(temporary_file_path, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+      std::cerr << "Warning: Cannot write the GNSS product cache file: " << cache_file_path << std::endl;
+      return;
+    }
+    file.write((const char*)&header, sizeof(header));
+    file.write((const char*)product_file.epochs.data(), sizeof(GnssProductEpoch) * product_file.epochs.size());
+    file.write((const char*)product_file.records.data(), sizeof(GnssProductRecord) * product_file.records.size());
+    if (!file.good()) {
+      std::cerr << "Warning: Cannot write the GNSS product cache file: " << cache_file_path << std::endl;
+      return;
+    }
+  }
+  std::remove(cache_file_path.c_str());
+  if (std::rename(temporary_file_path.c_str(), cache_file_path.c_str()) != 0) std::remove(temporary_file_path.c_str());
+}
+
+bool ReadGnssProductFile(const std::string file_path, const GnssProductFileFormat format, const std::string cache_directory,
+                         GnssProductFile& product_file) {
+  product_file = GnssProductFile();
+  product_file.format = format;
+
+  const MemoryMappedFile mapped_file(file_path);
+  if (!mapped_file.IsMapped()) return false;
+
+  uint64_t file_hash = 0;
+  std::string cache_file_path;
+  if (!cache_directory.empty()) {
+    file_hash = CalcFileHash(mapped_file.GetData(), mapped_file.GetSize_byte());
+    cache_file_path = GetCacheFilePath(file_path, cache_directory);
+    if (ReadCache(cache_file_path, format, mapped_file.GetSize_byte(), file_hash, product_file)) return true;
+    product_file = GnssProductFile();
+    product_file.format = format;
+  }
+
+  const char* data = (const char*)mapped_file.GetData();
+  const char* data_end = data + mapped_file.GetSize_byte();
+  if (format == GnssProductFileFormat::kSp3) {
+    ParseSp3(data, data_end, product_file);
+  } else {
+    ParseClock(data, data_end, product_file);
+  }
+
+  if (!cache_directory.empty()) WriteCache(cache_file_path, mapped_file.GetSize_byte(), file_hash, product_file);
+  return true;
+}
+
+size_t ReadGnssProductFiles(const std::vector<std::string>& file_paths, const GnssProductFileFormat format, const std::string cache_directory,
+                            std::vector<GnssProductFile>& product_files) {
+  const size_t number_of_files = file_paths.size();
+  product_files.assign(number_of_files, GnssProductFile());
+  std::vector<char> is_read(number_of_files, 0);
+
+  // Each day is parsed on a thread
+  std::atomic<size_t> next_index(0);
+  auto worker = [&]() {
+    for (size_t index = next_index++; index < number_of_files; index = next_index++) {
+      is_read[index] = ReadGnssProductFile(file_paths[index], format, cache_directory, product_files[index]) ? 1 : 0;
+    }
+  };
+  size_t number_of_threads = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), number_of_files);
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < number_of_threads; ++i) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (size_t index = 0; index < number_of_files; ++index) {
+    if (!is_read[index]) return index;
+  }
+  return number_of_files;
+}
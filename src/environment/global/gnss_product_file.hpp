@@ -0,0 +1,84 @@
+/**
+ * @file gnss_product_file.hpp
+ * @brief Parser of the GNSS precise orbit (SP3) and clock (CLK) product files
+ */
+
+#ifndef S2E_ENVIRONMENT_GLOBAL_GNSS_PRODUCT_FILE_HPP_
+#define S2E_ENVIRONMENT_GLOBAL_GNSS_PRODUCT_FILE_HPP_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @enum GnssProductFileFormat
+ * @brief Format of the GNSS product file
+ */
+enum class GnssProductFileFormat {
+  kSp3,    //!< SP3 precise orbit file
+  kClock,  //!< RINEX clock file (.clk, .clk_30s)
+};
+
+/**
+ * @struct GnssProductEpoch
+ * @brief Epoch of the GNSS product file
+ */
+struct GnssProductEpoch {
+  double unix_time;                    //!< Unix time of the epoch (seconds below 1 are truncated)
+  double greenwich_sidereal_time_rad;  //!< Greenwich sidereal time of the epoch [rad]
+  uint64_t record_begin;               //!< Index of the first record of the epoch
+  uint64_t record_end;                 //!< Index of the record after the last record of the epoch
+};
+
+/**
+ * @struct GnssProductRecord
+ * @brief Record of a GNSS satellite in an epoch
+ */
+struct GnssProductRecord {
+  int32_t gnss_satellite_id;  //!< Index of GNSS satellite defined in GnssSat_coordinate
+  int32_t reserved;           //!< Padding
+  double position_km[3];      //!< Position in the ECEF frame (SP3 only) [km]
+  double clock;               //!< Clock bias (SP3: [us], CLK: [s])
+};
+
+/**
+ * @struct GnssProductFile
+ * @brief Typed contents of a GNSS product file
+ * @note The records of a CLK file are grouped into an epoch while the consecutive records have the same time stamp.
+ */
+struct GnssProductFile {
+  GnssProductFileFormat format = GnssProductFileFormat::kSp3;  //!< Format of the file
+  double time_interval_s = 0.0;                                //!< Epoch interval in the SP3 header [s]
+  int number_of_epochs = 0;                                    //!< Number of epochs in the SP3 header
+  int number_of_satellites = 0;                                //!< Number of satellites in the SP3 header
+  std::vector<GnssProductEpoch> epochs;                        //!< Epochs in the file order
+  std::vector<GnssProductRecord> records;                      //!< Records in the file order
+};
+
+/**
+ * @fn ReadGnssProductFile
+ * @brief Parse a GNSS product file
+ * @details The file is mapped into the memory, and the lines are tokenized in place without copying the file contents.
+ *          When the cache directory is given, the parsed result is stored into a binary cache file with the hash of the file contents, and
+ *          the cache is read instead of parsing the file when the hash matches.
+ * @param [in] file_path: Path to the product file
+ * @param [in] format: Format of the product file
+ * @param [in] cache_directory: Directory of the binary cache files (empty: cache is not used)
+ * @param [out] product_file: Parsed result
+ * @return False when the file cannot be read
+ */
+bool ReadGnssProductFile(const std::string file_path, const GnssProductFileFormat format, const std::string cache_directory,
+                         GnssProductFile& product_file);
+/**
+ * @fn ReadGnssProductFiles
+ * @brief Parse GNSS product files in parallel
+ * @param [in] file_paths: Paths to the product files
+ * @param [in] format: Format of the product files
+ * @param [in] cache_directory: Directory of the binary cache files (empty: cache is not used)
+ * @param [out] product_files: Parsed results in the order of the paths
+ * @return Index of the first file which cannot be read, or the number of the files when all files are read
+ */
+size_t ReadGnssProductFiles(const std::vector<std::string>& file_paths, const GnssProductFileFormat format, const std::string cache_directory,
+                            std::vector<GnssProductFile>& product_files);
+
+#endif  // S2E_ENVIRONMENT_GLOBAL_GNSS_PRODUCT_FILE_HPP_
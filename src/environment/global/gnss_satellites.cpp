@@ -7,7 +7,6 @@
 
 #include <algorithm>
 #include <iostream>
-#include <sstream>
 #include <vector>
 
 #include "environment/global/physical_constants.hpp"
@@ -33,6 +32,10 @@ const int qzss_index_bias_ = beidou_index_bias_ + beidou_sat_num_;       //!< Bi
 
 const int all_sat_num_ = gps_sat_num_ + glonass_sat_num_ + galileo_sat_num_ + beidou_sat_num_ + qzss_sat_num_;  //<! Total number of GNSS satellites
 
+const size_t kMaxNumberOfComponents = 6;  //!< Maximum number of the components of an interpolated value (ECEF and ECI positions)
+//! Number of the Chebyshev coefficients added to the interpolation number to fit the trigonometric interpolation
+const size_t kNumberOfAdditionalCoefficients = 4;
+
 using namespace std;
 
 /**
@@ -62,31 +65,31 @@ tm* initilized_tm() {
 }
 
 /**
- * @fn get_unixtime_from_timestamp_line
- * @brief Calculate unix time from calendar expression
- * @param [in] s: Time as calendar expression
- * @return Unix time
+ * @fn GetEpochRange
+ * @brief Calculate range of the epochs used in the SP3 file
+ * @param [in] file: Parsed SP3 file
+ * @param [in] ur_flag: Ultra Rapid flag
+ * @param [out] start_epoch: Index of the first epoch
+ * @param [out] end_epoch: Index of the epoch after the last epoch
  */
-double get_unixtime_from_timestamp_line(std::vector<string>& s) {
-  tm* time_tm = initilized_tm();
-  time_tm->tm_year = stoi(s.at(1)) - 1900;
-  time_tm->tm_mon = stoi(s.at(2)) - 1;  // 0 - 11, in time struct, 1 - 12 month is expressed by 1 - 12
-  time_tm->tm_mday = stoi(s.at(3));
-  time_tm->tm_hour = stoi(s.at(4));
-  time_tm->tm_min = stoi(s.at(5));
-  time_tm->tm_sec = (int)(stod(s.at(6)) + 1e-4);  // for the numerical error, plus 1e-4 (tm_sec is to be int)
-  double unix_time = (double)mktime(time_tm);
-  std::free(time_tm);
-
-  return unix_time;
+static void GetEpochRange(const GnssProductFile& file, const UltraRapidMode ur_flag, size_t& start_epoch, size_t& end_epoch) {
+  const size_t num_of_time_stamps = (size_t)std::max(file.number_of_epochs, 0);
+  if (ur_flag == kNotUse) {
+    start_epoch = 0;
+    end_epoch = num_of_time_stamps;
+  } else {
+    size_t offset = (size_t)((int)ur_flag - (int)kObserve1);
+    start_epoch = num_of_time_stamps / 8 * offset;
+    end_epoch = num_of_time_stamps / 8 * (offset + 1);
+  }
+  end_epoch = std::min(end_epoch, file.epochs.size());
+  start_epoch = std::min(start_epoch, end_epoch);
 }
 
-template <size_t N>
-libra::Vector<N> GnssSat_coordinate::TrigonometricInterpolation(const vector<double>& time_vector, const vector<libra::Vector<N>>& values,
-                                                                double time) const {
+double GnssSat_coordinate::TrigonometricInterpolation(const vector<double>& time_vector, const vector<double>& values, double time) const {
   size_t n = time_vector.size();
   double w = libra::tau / (24.0 * 60.0 * 60.0) * 1.03;  // coefficient of a day long
-  libra::Vector<N> res(0.0);
+  double res = 0.0;
 
   for (size_t i = 0; i < n; ++i) {
     double t_k = 1.0;
@@ -94,64 +97,148 @@ libra::Vector<N> GnssSat_coordinate::TrigonometricInterpolation(const vector<dou
       if (i == j) continue;
       t_k *= sin(w * (time - time_vector.at(j)) / 2.0) / sin(w * (time_vector.at(i) - time_vector.at(j)) / 2.0);
     }
-    for (size_t j = 0; j < (int)N; ++j) {
-      res(j) += t_k * values.at(i)(j);
-    }
+    res += t_k * values.at(i);
   }
 
   return res;
 }
 
-double GnssSat_coordinate::TrigonometricInterpolation(const vector<double>& time_vector, const vector<double>& values, double time) const {
+double GnssSat_coordinate::LagrangeInterpolation(const vector<double>& time_vector, const vector<double>& values, double time) const {
   size_t n = time_vector.size();
-  double w = libra::tau / (24.0 * 60.0 * 60.0) * 1.03;  // coefficient of a day long
   double res = 0.0;
-
   for (size_t i = 0; i < n; ++i) {
-    double t_k = 1.0;
+    double l_i = 1.0;
     for (size_t j = 0; j < n; ++j) {
       if (i == j) continue;
-      t_k *= sin(w * (time - time_vector.at(j)) / 2.0) / sin(w * (time_vector.at(i) - time_vector.at(j)) / 2.0);
+      l_i *= (time - time_vector.at(j)) / (time_vector.at(i) - time_vector.at(j));
     }
-    res += t_k * values.at(i);
+    res += values.at(i) * l_i;
   }
 
   return res;
 }
 
-template <size_t N>
-libra::Vector<N> GnssSat_coordinate::LagrangeInterpolation(const vector<double>& time_vector, const vector<libra::Vector<N>>& values,
-                                                           double time) const {
-  int n = time_vector.size();
-  libra::Vector<N> res(0.0);
+void GnssSat_coordinate::MakeSegments(Tables& tables, const size_t number_of_components, const size_t number_of_coefficients,
+                                      const double max_window_length_s, const bool is_trigonometric) {
+  tables.number_of_components = number_of_components;
+  tables.number_of_coefficients = number_of_coefficients;
+  tables.segments.assign(all_sat_num_, vector<InterpolationSegment>());
+  tables.coefficients.assign(all_sat_num_, vector<double>());
+  interpolated_values_.assign(all_sat_num_ * number_of_components, 0.0);
+  validate_.assign(all_sat_num_, false);
+  nearest_index_.assign(all_sat_num_, 0);
 
-  for (int i = 0; i < n; ++i) {
-    double l_i = 1.0;
-    for (int j = 0; j < n; ++j) {
-      if (i == j) continue;
-      l_i *= (time - time_vector.at(j)) / (time_vector.at(i) - time_vector.at(j));
-    }
-    for (int j = 0; j < N; ++j) {
-      res(j) += l_i * values.at(i)(j);
+  const size_t n = number_of_coefficients;
+  vector<double> window_time(interpolation_number_);
+  vector<vector<double>> window_values(number_of_components, vector<double>(interpolation_number_));
+  vector<double> node_values(number_of_components * n);
+  for (int gnss_satellite_id = 0; gnss_satellite_id < all_sat_num_; ++gnss_satellite_id) {
+    const vector<double>& unix_times = tables.unix_times.at(gnss_satellite_id);
+    const vector<double>& values = tables.values.at(gnss_satellite_id);
+    const int number_of_data = (int)unix_times.size();
+    vector<InterpolationSegment>& segments = tables.segments.at(gnss_satellite_id);
+    vector<double>& coefficients = tables.coefficients.at(gnss_satellite_id);
+    segments.resize(number_of_data);
+    coefficients.assign(number_of_data * n * number_of_components, 0.0);
+
+    for (int index = 0; index < number_of_data; ++index) {
+      // The data point is the nearest one in the segment, and it is available within the time interval
+      InterpolationSegment& segment = segments.at(index);
+      segment.start_unix_time = unix_times.at(index) - time_interval_;
+      if (index > 0) segment.start_unix_time = std::max(segment.start_unix_time, (unix_times.at(index - 1) + unix_times.at(index)) / 2.0);
+      segment.end_unix_time = unix_times.at(index) + time_interval_;
+      if (index + 1 < number_of_data) {
+        segment.end_unix_time = std::min(segment.end_unix_time, (unix_times.at(index) + unix_times.at(index + 1)) / 2.0);
+      }
+      segment.is_valid = false;
+
+      // for both even and odd: 2n+1 -> [-n, n] 2n -> [-n, n)
+      const int first_index = index - interpolation_number_ / 2;
+      const int last_index = index + (interpolation_number_ + 1) / 2 - 1;
+      if (first_index < 0 || last_index >= number_of_data || last_index < first_index) continue;
+      if (unix_times.at(last_index) - unix_times.at(first_index) > max_window_length_s) continue;
+      if (segment.end_unix_time <= segment.start_unix_time) continue;
+      segment.is_valid = true;
+
+      for (int j = 0; j < interpolation_number_; ++j) {
+        window_time.at(j) = unix_times.at(first_index + j);
+        for (size_t component = 0; component < number_of_components; ++component) {
+          window_values.at(component).at(j) = values.at((first_index + j) * number_of_components + component);
+        }
+      }
+
+      // Fit with the interpolated values at the Chebyshev nodes
+      const double center_unix_time = (segment.start_unix_time + segment.end_unix_time) / 2.0;
+      const double half_length_s = (segment.end_unix_time - segment.start_unix_time) / 2.0;
+      for (size_t j = 0; j < n; ++j) {
+        const double unix_time = center_unix_time + half_length_s * cos(libra::pi * ((double)j + 0.5) / (double)n);
+        for (size_t component = 0; component < number_of_components; ++component) {
+          node_values.at(component * n + j) = is_trigonometric ? TrigonometricInterpolation(window_time, window_values.at(component), unix_time)
+                                                               : LagrangeInterpolation(window_time, window_values.at(component), unix_time);
+        }
+      }
+      double* segment_coefficients = &coefficients.at(index * n * number_of_components);
+      for (size_t k = 0; k < n; ++k) {
+        for (size_t component = 0; component < number_of_components; ++component) {
+          double sum = 0.0;
+          for (size_t j = 0; j < n; ++j) {
+            sum += node_values.at(component * n + j) * cos(libra::pi * (double)k * ((double)j + 0.5) / (double)n);
+          }
+          segment_coefficients[k * number_of_components + component] = (k == 0 ? 1.0 : 2.0) * sum / (double)n;
+        }
+      }
     }
   }
-
-  return res;
 }
 
-double GnssSat_coordinate::LagrangeInterpolation(const vector<double>& time_vector, const vector<double>& values, double time) const {
-  size_t n = time_vector.size();
-  double res = 0.0;
-  for (size_t i = 0; i < n; ++i) {
-    double l_i = 1.0;
-    for (size_t j = 0; j < n; ++j) {
-      if (i == j) continue;
-      l_i *= (time - time_vector.at(j)) / (time_vector.at(i) - time_vector.at(j));
+void GnssSat_coordinate::EvaluateSegments(const double unix_time) {
+  const Tables& tables = *tables_;
+  const size_t number_of_components = tables.number_of_components;
+  const size_t n = tables.number_of_coefficients;
+  for (int gnss_satellite_id = 0; gnss_satellite_id < all_sat_num_; ++gnss_satellite_id) {
+    const int index = FindSegment(gnss_satellite_id, unix_time);
+    if (index < 0) {
+      validate_[gnss_satellite_id] = false;
+      continue;
+    }
+    nearest_index_[gnss_satellite_id] = index;
+    const InterpolationSegment& segment = tables.segments[gnss_satellite_id][index];
+    validate_[gnss_satellite_id] = segment.is_valid;
+    if (!segment.is_valid) continue;
+
+    // Clenshaw recurrence for all components at once
+    const double x = (2.0 * unix_time - segment.start_unix_time - segment.end_unix_time) / (segment.end_unix_time - segment.start_unix_time);
+    const double* coefficients = &tables.coefficients[gnss_satellite_id][index * n * number_of_components];
+    double* values = &interpolated_values_[gnss_satellite_id * number_of_components];
+    double b1[kMaxNumberOfComponents] = {0.0};
+    double b2[kMaxNumberOfComponents] = {0.0};
+    for (size_t k = n - 1; k >= 1; --k) {
+      const double* coefficients_k = &coefficients[k * number_of_components];
+      for (size_t component = 0; component < number_of_components; ++component) {
+        const double b0 = 2.0 * x * b1[component] - b2[component] + coefficients_k[component];
+        b2[component] = b1[component];
+        b1[component] = b0;
+      }
+    }
+    for (size_t component = 0; component < number_of_components; ++component) {
+      values[component] = coefficients[component] + x * b1[component] - b2[component];
     }
-    res += values.at(i) * l_i;
   }
+}
 
-  return res;
+int GnssSat_coordinate::FindSegment(const int gnss_satellite_id, const double unix_time) const {
+  const vector<InterpolationSegment>& segments = tables_->segments[gnss_satellite_id];
+  const size_t number_of_segments = segments.size();
+  // The segment of the previous update or the next one is used in most updates
+  const size_t last_index = (size_t)nearest_index_[gnss_satellite_id];
+  for (size_t index = last_index; index < last_index + 2 && index < number_of_segments; ++index) {
+    if (segments[index].start_unix_time <= unix_time && unix_time <= segments[index].end_unix_time) return (int)index;
+  }
+
+  auto itr = lower_bound(segments.begin(), segments.end(), unix_time,
+                         [](const InterpolationSegment& segment, const double time) { return segment.end_unix_time < time; });
+  if (itr == segments.end() || unix_time < itr->start_unix_time) return -1;
+  return (int)(itr - segments.begin());
 }
 
 int GnssSat_coordinate::GetIndexFromID(string sat_num) const {
@@ -224,106 +311,48 @@ bool GnssSat_coordinate::GetWhetherValid(int gnss_satellite_id) const {
   return validate_.at(gnss_satellite_id);
 }
 
-pair<double, double> GnssSat_position::Init(vector<vector<string>>& file, int interpolation_method, int interpolation_number,
+pair<double, double> GnssSat_position::Init(const vector<GnssProductFile>& files, int interpolation_method, int interpolation_number,
                                             UltraRapidMode ur_flag) {
   UNUSED(interpolation_method);
 
   interpolation_number_ = interpolation_number;
 
   // Expansion
-  gnss_sat_table_ecef_.resize(all_sat_num_);  // first vector size is the sat num
-  gnss_sat_table_eci_.resize(all_sat_num_);
-  unixtime_vector_.resize(all_sat_num_);
+  // ECEF and ECI positions are interpolated together
+  std::shared_ptr<Tables> tables = std::make_shared<Tables>();
+  tables->unix_times.resize(all_sat_num_);  // first vector size is the sat num
+  tables->values.resize(all_sat_num_);
 
   // for using min and max, set the sup & inf before
   double start_unix_time = 1e16;
   double end_unix_time = 0;
 
-  // Get Header Info
-  for (int page = 0; page < (int)file.size(); ++page) {
-    int num_of_time_stamps = 0;
-    int num_of_sat = 0;
-    int line;
-    for (line = 0; line < 3; ++line) {
-      istringstream iss{file.at(page).at(line)};
-
-      if (line == 0) {
-        // in seventh line, there is time stamps
-        // http://epncb.oma.be/ftp/data/format/sp3c.txt
-        for (int i = 0; i < 7; ++i) {
-          // how many time stamps are written?
-          string each;
-          iss >> each;
-          if (i == 6) num_of_time_stamps = stoi(each);
-        }
-      } else if (line == 1) {
-        for (int i = 0; i < 4; ++i) {
-          string each;
-          iss >> each;
-          if (i == 3) time_interval_ = stod(each);
-        }
-      } else if (line == 2) {
-        for (int i = 0; i < 2; ++i) {
-          string each;
-          iss >> each;
-          if (i == 1) num_of_sat = stoi(each);
-        }
-      }
-    }
+  for (const GnssProductFile& file : files) {
+    time_interval_ = file.time_interval_s;
 
-    line = 3;
-    while (file.at(page).at(line).front() != '*') ++line;
+    size_t start_epoch, end_epoch;
+    GetEpochRange(file, ur_flag, start_epoch, end_epoch);
+    for (size_t epoch_index = start_epoch; epoch_index < end_epoch; ++epoch_index) {
+      const GnssProductEpoch& epoch = file.epochs[epoch_index];
+      const double unix_time = epoch.unix_time;
+      const double cos_ = cos(epoch.greenwich_sidereal_time_rad);
+      const double sin_ = sin(epoch.greenwich_sidereal_time_rad);
 
-    int start_line, end_line;
-    if (ur_flag == kNotUse) {
-      start_line = line;
-      end_line = line + (num_of_sat + 1) * num_of_time_stamps;
-    } else {
-      int offset = (int)ur_flag - (int)kObserve1;
-      start_line = line + (num_of_sat + 1) * num_of_time_stamps / 8 * offset;
-      end_line = line + (num_of_sat + 1) * num_of_time_stamps / 8 * (offset + 1);
-    }
+      start_unix_time = std::min(start_unix_time, unix_time);
+      end_unix_time = std::max(end_unix_time, unix_time);
 
-    double unix_time = 0;
-    double cos_ = 0.0;
-    double sin_ = 0.0;
-    for (int i = 0; i < end_line - start_line; ++i) {
-      line = i + start_line;
-
-      istringstream iss{file.at(page).at(line)};
-      vector<string> s;
-      if (i % (num_of_sat + 1) == 0) {
-        for (int j = 0; j < 7; ++j) {
-          string tmp;
-          iss >> tmp;
-          s.push_back(tmp);
-        }
-
-        unix_time = get_unixtime_from_timestamp_line(s);
-        double jd;
-        jday(stoi(s.at(1)), stoi(s.at(2)), stoi(s.at(3)), stoi(s.at(4)), stoi(s.at(5)), stod(s.at(6)), jd);
-        double gs_time_ = gstime(jd);
-        cos_ = cos(gs_time_);
-        sin_ = sin(gs_time_);
-
-        start_unix_time = std::min(start_unix_time, unix_time);
-        end_unix_time = std::max(end_unix_time, unix_time);
-      } else {
-        for (int j = 0; j < 5; ++j) {
-          string tmp;
-          iss >> tmp;
-          s.push_back(tmp);
-        }
-        int gnss_satellite_id = GetIndexFromID(s.front());
+      for (size_t record_index = epoch.record_begin; record_index < epoch.record_end; ++record_index) {
+        const GnssProductRecord& record = file.records[record_index];
+        const int gnss_satellite_id = record.gnss_satellite_id;
 
         bool available_flag = true;
         libra::Vector<3> ecef_position_m(0.0);
         for (int j = 0; j < 3; ++j) {
-          if (std::abs(stod(s.at(j + 1)) - nan99) < 1.0) {
+          if (std::abs(record.position_km[j] - nan99) < 1.0) {
             available_flag = false;
             break;
           } else {
-            ecef_position_m(j) = stod(s.at(j + 1));
+            ecef_position_m(j) = record.position_km[j];
           }
         }
         if (!available_flag) continue;
@@ -341,19 +370,24 @@ pair<double, double> GnssSat_position::Init(vector<vector<string>>& file, int in
         eci_position(1) = sin_ * x + cos_ * y;
         eci_position(2) = z;
 
-        if (!unixtime_vector_.at(gnss_satellite_id).empty() && std::abs(unix_time - unixtime_vector_.at(gnss_satellite_id).back()) < 1.0) {
-          unixtime_vector_.at(gnss_satellite_id).back() = unix_time;
-          gnss_sat_table_ecef_.at(gnss_satellite_id).back() = ecef_position_m;
-          gnss_sat_table_eci_.at(gnss_satellite_id).back() = eci_position;
+        vector<double>& unix_times = tables->unix_times.at(gnss_satellite_id);
+        vector<double>& values = tables->values.at(gnss_satellite_id);
+        if (!unix_times.empty() && std::abs(unix_time - unix_times.back()) < 1.0) {
+          unix_times.back() = unix_time;
+          values.resize(values.size() - 6);
         } else {
-          unixtime_vector_.at(gnss_satellite_id).emplace_back(unix_time);
-          gnss_sat_table_ecef_.at(gnss_satellite_id).emplace_back(ecef_position_m);
-          gnss_sat_table_eci_.at(gnss_satellite_id).emplace_back(eci_position);
+          unix_times.emplace_back(unix_time);
         }
+        for (int i = 0; i < 3; ++i) values.push_back(ecef_position_m(i));
+        for (int i = 0; i < 3; ++i) values.push_back(eci_position(i));
       }
     }
   }
 
+  MakeSegments(*tables, 6, interpolation_number_ + kNumberOfAdditionalCoefficients, time_interval_ * (interpolation_number_ - 1 + 3) + 1e-4,
+               true);  // allow for 3 missing
+  tables_ = tables;
+
   return make_pair(start_unix_time, end_unix_time);
 }
 
@@ -363,135 +397,25 @@ void GnssSat_position::SetUp(const double start_unix_time, const double step_sec
   gnss_sat_ecef_.assign(all_sat_num_, libra::Vector<3>(0.0));
   gnss_sat_eci_.assign(all_sat_num_, libra::Vector<3>(0.0));
   validate_.assign(all_sat_num_, false);
+  nearest_index_.assign(all_sat_num_, 0);
 
-  nearest_index_.resize(all_sat_num_);
-  time_period_.resize(all_sat_num_);
-
-  ecef_.resize(all_sat_num_);
-  eci_.resize(all_sat_num_);
-
-  for (int gnss_satellite_id = 0; gnss_satellite_id < all_sat_num_; ++gnss_satellite_id) {
-    if (unixtime_vector_.at(gnss_satellite_id).empty()) {
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    }
-
-    int index = lower_bound(unixtime_vector_.at(gnss_satellite_id).begin(), unixtime_vector_.at(gnss_satellite_id).end(), start_unix_time) -
-                unixtime_vector_.at(gnss_satellite_id).begin();
-    if (index == (int)unixtime_vector_.at(gnss_satellite_id).size()) {
-      nearest_index_.at(gnss_satellite_id) = index;
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    }
-
-    double nearest_unixtime = unixtime_vector_.at(gnss_satellite_id).at(index);
-    if (interpolation_number_ % 2 && index != 0) {
-      double pre_time = unixtime_vector_.at(gnss_satellite_id).at(index - 1);
-      if (std::abs(start_unix_time - pre_time) < std::abs(start_unix_time - nearest_unixtime)) --index;
-    }
-    nearest_index_.at(gnss_satellite_id) = index;
-    nearest_unixtime = unixtime_vector_.at(gnss_satellite_id).at(index);
-    if (std::abs(start_unix_time - nearest_unixtime) > time_interval_) {
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    }
-
-    // for both even and odd: 2n+1 -> [-n, n] 2n -> [-n, n)
-    for (int j = -interpolation_number_ / 2; j < (interpolation_number_ + 1) / 2; ++j) {
-      int now_index = index + j;
-      if (now_index < 0 || now_index >= (int)unixtime_vector_.at(gnss_satellite_id).size()) continue;
-
-      time_period_.at(gnss_satellite_id).push_back(unixtime_vector_.at(gnss_satellite_id).at(now_index));
-      ecef_.at(gnss_satellite_id).push_back(gnss_sat_table_ecef_.at(gnss_satellite_id).at(now_index));
-      eci_.at(gnss_satellite_id).push_back(gnss_sat_table_eci_.at(gnss_satellite_id).at(now_index));
-    }
-    if ((int)time_period_.at(gnss_satellite_id).size() != interpolation_number_) {
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    }
-
-    double time_period_length = time_period_.at(gnss_satellite_id).back() - time_period_.at(gnss_satellite_id).front();
-    if (time_period_length > time_interval_ * (interpolation_number_ - 1 + 3) + 1e-4) {  // allow for 3 missing
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    } else {
-      validate_.at(gnss_satellite_id) = true;
-    }
-
-    if (std::abs(start_unix_time - nearest_unixtime) < 1e-4) {  // for the numerical error, plus 1e-4
-      gnss_sat_ecef_.at(gnss_satellite_id) = gnss_sat_table_ecef_.at(gnss_satellite_id).at(index);
-      gnss_sat_eci_.at(gnss_satellite_id) = gnss_sat_table_eci_.at(gnss_satellite_id).at(index);
-    } else {
-      gnss_sat_ecef_.at(gnss_satellite_id) =
-          TrigonometricInterpolation(time_period_.at(gnss_satellite_id), ecef_.at(gnss_satellite_id), start_unix_time);
-      gnss_sat_eci_.at(gnss_satellite_id) =
-          TrigonometricInterpolation(time_period_.at(gnss_satellite_id), eci_.at(gnss_satellite_id), start_unix_time);
-    }
-  }
+  Update(start_unix_time);
 }
 
 void GnssSat_position::Update(const double now_unix_time) {
-  for (int gnss_satellite_id = 0; gnss_satellite_id < all_sat_num_; ++gnss_satellite_id) {
-    if (unixtime_vector_.at(gnss_satellite_id).empty()) {
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    }
+  EvaluateSegments(now_unix_time);
 
-    int index = nearest_index_.at(gnss_satellite_id);
-    if (index == (int)unixtime_vector_.at(gnss_satellite_id).size()) {
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    }
-
-    if (index + 1 < (int)unixtime_vector_.at(gnss_satellite_id).size()) {
-      double pre_unix = unixtime_vector_.at(gnss_satellite_id).at(index);
-      double post_unix = unixtime_vector_.at(gnss_satellite_id).at(index + 1);
-
-      if (std::abs(now_unix_time - post_unix) < std::abs(now_unix_time - pre_unix)) {
-        ++index;
-        nearest_index_.at(gnss_satellite_id) = index;
-
-        time_period_.at(gnss_satellite_id).clear();
-        ecef_.at(gnss_satellite_id).clear();
-        eci_.at(gnss_satellite_id).clear();
-
-        // for both even and odd: 2n+1 -> [-n, n] 2n -> [-n, n)
-        for (int j = -interpolation_number_ / 2; j < (interpolation_number_ + 1) / 2; ++j) {
-          int now_index = index + j;
-          if (now_index < 0 || now_index >= (int)unixtime_vector_.at(gnss_satellite_id).size()) continue;
-
-          time_period_.at(gnss_satellite_id).push_back(unixtime_vector_.at(gnss_satellite_id).at(now_index));
-          ecef_.at(gnss_satellite_id).push_back(gnss_sat_table_ecef_.at(gnss_satellite_id).at(now_index));
-          eci_.at(gnss_satellite_id).push_back(gnss_sat_table_eci_.at(gnss_satellite_id).at(now_index));
-        }
-      }
-    }
-    double nearest_unix_time = unixtime_vector_.at(gnss_satellite_id).at(index);
-    if (std::abs(now_unix_time - nearest_unix_time) > time_interval_) {
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    }
+  for (int gnss_satellite_id = 0; gnss_satellite_id < all_sat_num_; ++gnss_satellite_id) {
+    if (!validate_[gnss_satellite_id]) continue;
 
-    if ((int)time_period_.at(gnss_satellite_id).size() != interpolation_number_) {
-      validate_.at(gnss_satellite_id) = false;
-      continue;
+    const int index = nearest_index_[gnss_satellite_id];
+    const double* values = &interpolated_values_[gnss_satellite_id * 6];
+    if (std::abs(now_unix_time - tables_->unix_times[gnss_satellite_id][index]) < 1e-4) {  // for the numerical error, plus 1e-4
+      values = &tables_->values[gnss_satellite_id][index * 6];
     }
-
-    double time_period_length = time_period_.at(gnss_satellite_id).back() - time_period_.at(gnss_satellite_id).front();
-    if (time_period_length > time_interval_ * (interpolation_number_ - 1 + 3) + 1e-4) {  // allow for 3 missing
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    } else {
-      validate_.at(gnss_satellite_id) = true;
-    }
-
-    if (std::abs(now_unix_time - nearest_unix_time) < 1e-4) {  // for the numerical error, plus 1e-4
-      gnss_sat_ecef_.at(gnss_satellite_id) = gnss_sat_table_ecef_.at(gnss_satellite_id).at(index);
-      gnss_sat_eci_.at(gnss_satellite_id) = gnss_sat_table_eci_.at(gnss_satellite_id).at(index);
-    } else {
-      gnss_sat_ecef_.at(gnss_satellite_id) =
-          TrigonometricInterpolation(time_period_.at(gnss_satellite_id), ecef_.at(gnss_satellite_id), now_unix_time);
-      gnss_sat_eci_.at(gnss_satellite_id) = TrigonometricInterpolation(time_period_.at(gnss_satellite_id), eci_.at(gnss_satellite_id), now_unix_time);
+    for (int i = 0; i < 3; ++i) {
+      gnss_sat_ecef_[gnss_satellite_id][i] = values[i];
+      gnss_sat_eci_[gnss_satellite_id][i] = values[3 + i];
     }
   }
 }
@@ -506,90 +430,39 @@ libra::Vector<3> GnssSat_position::GetSatEci(int gnss_satellite_id) const {
   return gnss_sat_eci_.at(gnss_satellite_id);
 }
 
-void GnssSat_clock::Init(vector<vector<string>>& file, string file_extension, int interpolation_number, UltraRapidMode ur_flag,
+void GnssSat_clock::Init(const vector<GnssProductFile>& files, string file_extension, int interpolation_number, UltraRapidMode ur_flag,
                          pair<double, double> unix_time_period) {
   interpolation_number_ = interpolation_number;
-  gnss_sat_clock_table_.resize(all_sat_num_);  // first vector size is the sat num
-  unixtime_vector_.resize(all_sat_num_);
+  std::shared_ptr<Tables> tables = std::make_shared<Tables>();
+  tables->unix_times.resize(all_sat_num_);  // first vector size is the sat num
+  tables->values.resize(all_sat_num_);
 
   if (file_extension == ".sp3") {
-    // Get Header Info
-    for (int page = 0; page < (int)file.size(); ++page) {
-      int num_of_time_stamps = 0;
-      int num_of_sat = 0;
-      int line;
-      for (line = 0; line < 3; ++line) {
-        istringstream iss{file.at(page).at(line)};
-
-        if (line == 0) {
-          // in seventh line, there is time stamps
-          // http://epncb.oma.be/ftp/data/format/sp3c.txt
-          for (int i = 0; i < 7; ++i) {
-            // how many time stamps are written?
-            string each;
-            iss >> each;
-            if (i == 6) num_of_time_stamps = stoi(each);
-          }
-        } else if (line == 1) {
-          for (int i = 0; i < 4; ++i) {
-            string each;
-            iss >> each;
-            if (i == 3) time_interval_ = stod(each);
-          }
-        } else if (line == 2) {
-          for (int i = 0; i < 2; ++i) {
-            string each;
-            iss >> each;
-            if (i == 1) num_of_sat = stoi(each);
-          }
-        }
-      }
-
-      line = 3;
-      while (file.at(page).at(line).front() != '*') ++line;
-
-      int start_line, end_line;
-      if (ur_flag == kNotUse) {
-        start_line = line;
-        end_line = line + (num_of_sat + 1) * num_of_time_stamps;
-      } else {
-        int offset = (int)ur_flag - (int)kObserve1;
-        start_line = line + (num_of_sat + 1) * num_of_time_stamps / 8 * offset;
-        end_line = line + (num_of_sat + 1) * num_of_time_stamps / 8 * (offset + 1);
-      }
-
-      double unix_time = 0;
-      for (int i = 0; i < end_line - start_line; ++i) {
-        line = i + start_line;
-
-        istringstream iss{file.at(page).at(line)};
-        vector<string> s;
-        if (i % (num_of_sat + 1) == 0) {
-          for (int j = 0; j < 7; ++j) {
-            string tmp;
-            iss >> tmp;
-            s.push_back(tmp);
-          }
-          unix_time = get_unixtime_from_timestamp_line(s);
-        } else {
-          for (int j = 0; j < 5; ++j) {
-            string tmp;
-            iss >> tmp;
-            s.push_back(tmp);
-          }
-          int gnss_satellite_id = GetIndexFromID(s.front());
-
-          double clock = stod(s.at(4));
+    for (const GnssProductFile& file : files) {
+      time_interval_ = file.time_interval_s;
+
+      size_t start_epoch, end_epoch;
+      GetEpochRange(file, ur_flag, start_epoch, end_epoch);
+      for (size_t epoch_index = start_epoch; epoch_index < end_epoch; ++epoch_index) {
+        const GnssProductEpoch& epoch = file.epochs[epoch_index];
+        const double unix_time = epoch.unix_time;
+        for (size_t record_index = epoch.record_begin; record_index < epoch.record_end; ++record_index) {
+          const GnssProductRecord& record = file.records[record_index];
+          const int gnss_satellite_id = record.gnss_satellite_id;
+
+          double clock = record.clock;
           if (std::abs(clock - nan99) < 1.0) continue;
 
           // in the file, clock bias is expressed in [micro second], so by multiplying by the speed_of_light & 1e-6, they are converted to [m]
           clock *= (environment::speed_of_light_m_s * 1e-6);
-          if (!unixtime_vector_.at(gnss_satellite_id).empty() && std::abs(unix_time - unixtime_vector_.at(gnss_satellite_id).back()) < 1.0) {
-            unixtime_vector_.at(gnss_satellite_id).back() = unix_time;
-            gnss_sat_clock_table_.at(gnss_satellite_id).back() = clock;
+          vector<double>& unix_times = tables->unix_times.at(gnss_satellite_id);
+          vector<double>& clock_table = tables->values.at(gnss_satellite_id);
+          if (!unix_times.empty() && std::abs(unix_time - unix_times.back()) < 1.0) {
+            unix_times.back() = unix_time;
+            clock_table.back() = clock;
           } else {
-            unixtime_vector_.at(gnss_satellite_id).push_back(unix_time);
-            gnss_sat_clock_table_.at(gnss_satellite_id).emplace_back(clock);
+            unix_times.push_back(unix_time);
+            clock_table.emplace_back(clock);
           }
         }
       }
@@ -601,7 +474,7 @@ void GnssSat_clock::Init(vector<vector<string>>& file, string file_extension, in
     }
     time_interval_ = 1e9;
 
-    for (int page = 0; page < (int)file.size(); ++page) {
+    for (const GnssProductFile& file : files) {
       double start_unix_time, end_unix_time;
       if (ur_flag == kNotUse) {
         start_unix_time = unix_time_period.first;
@@ -610,178 +483,61 @@ void GnssSat_clock::Init(vector<vector<string>>& file, string file_extension, in
         start_unix_time = -1;
         end_unix_time = 0;
       }
-      for (int line = 0; line < (int)file.at(page).size(); ++line) {
-        if (file.at(page).at(line).substr(0, 3) != "AS ") continue;
-
-        istringstream iss{file.at(page).at(line)};
-        vector<string> s;
-        for (int i = 0; i < 11; ++i) {
-          string tmp;
-          iss >> tmp;
-          s.push_back(tmp);
-        }
-
-        tm* time_tm = initilized_tm();
-        time_tm->tm_year = stoi(s.at(2)) - 1900;
-        time_tm->tm_mon = stoi(s.at(3)) - 1;  // 0 - 11, in time struct, 1 - 12 month is expressed by 1 - 12
-        time_tm->tm_mday = stoi(s.at(4));
-        time_tm->tm_hour = stoi(s.at(5));
-        time_tm->tm_min = stoi(s.at(6));
-        time_tm->tm_sec = (int)(stod(s.at(7)) + 1e-4);  // for the numerical error, plus 1e-4. tm_sec is to be int
-        double unix_time = (double)mktime(time_tm);
+      for (size_t epoch_index = 0; epoch_index < file.epochs.size(); ++epoch_index) {
+        const GnssProductEpoch& epoch = file.epochs[epoch_index];
+        const double unix_time = epoch.unix_time;
         const double interval = 6 * 60 * 60;
         if (start_unix_time < 0) {
           start_unix_time = unix_time + (ur_flag - kObserve1) * interval;  // Fix here to use enum class
           end_unix_time = start_unix_time + interval;
         }
-
-        std::free(time_tm);
-
-        int gnss_satellite_id = GetIndexFromID(s.at(1));
-        double clock_bias = stod(s.at(9)) * environment::speed_of_light_m_s;  // [s] -> [m]
-        if (start_unix_time - unix_time > 1e-4) continue;                     // for the numerical error
+        if (start_unix_time - unix_time > 1e-4) continue;  // for the numerical error
         if (end_unix_time - unix_time < 1e-4) break;
-        if (!unixtime_vector_.at(gnss_satellite_id).empty() &&
-            std::abs(unix_time - unixtime_vector_.at(gnss_satellite_id).back()) < 1e-4) {  // for the numerical error
-          unixtime_vector_.at(gnss_satellite_id).back() = unix_time;
-          gnss_sat_clock_table_.at(gnss_satellite_id).back() = clock_bias;
-        } else {
-          if (!unixtime_vector_.at(gnss_satellite_id).empty())
-            time_interval_ = min(time_interval_, unix_time - unixtime_vector_.at(gnss_satellite_id).back());
-          unixtime_vector_.at(gnss_satellite_id).emplace_back(unix_time);
-          gnss_sat_clock_table_.at(gnss_satellite_id).emplace_back(clock_bias);
+
+        for (size_t record_index = epoch.record_begin; record_index < epoch.record_end; ++record_index) {
+          const GnssProductRecord& record = file.records[record_index];
+          const int gnss_satellite_id = record.gnss_satellite_id;
+          double clock_bias = record.clock * environment::speed_of_light_m_s;  // [s] -> [m]
+          vector<double>& unix_times = tables->unix_times.at(gnss_satellite_id);
+          vector<double>& clock_table = tables->values.at(gnss_satellite_id);
+          if (!unix_times.empty() && std::abs(unix_time - unix_times.back()) < 1e-4) {  // for the numerical error
+            unix_times.back() = unix_time;
+            clock_table.back() = clock_bias;
+          } else {
+            if (!unix_times.empty()) time_interval_ = min(time_interval_, unix_time - unix_times.back());
+            unix_times.emplace_back(unix_time);
+            clock_table.emplace_back(clock_bias);
+          }
         }
       }
     }
   }
+
+  MakeSegments(*tables, 1, interpolation_number_, time_interval_ * (interpolation_number_ - 1) + 1e-4, false);  // more strict for clock_bias
+  tables_ = tables;
 }
 
 void GnssSat_clock::SetUp(const double start_unix_time, const double step_sec) {
   step_sec_ = step_sec;
 
-  gnss_sat_clock_.resize(all_sat_num_);
+  gnss_sat_clock_.assign(all_sat_num_, 0.0);
   validate_.assign(all_sat_num_, false);
+  nearest_index_.assign(all_sat_num_, 0);
 
-  nearest_index_.resize(all_sat_num_);
-  time_period_.resize(all_sat_num_);
-
-  clock_bias_.resize(all_sat_num_);
-
-  for (int gnss_satellite_id = 0; gnss_satellite_id < all_sat_num_; ++gnss_satellite_id) {
-    if (unixtime_vector_.at(gnss_satellite_id).empty()) {
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    }
-
-    int index = lower_bound(unixtime_vector_.at(gnss_satellite_id).begin(), unixtime_vector_.at(gnss_satellite_id).end(), start_unix_time) -
-                unixtime_vector_.at(gnss_satellite_id).begin();
-    if (index == (int)unixtime_vector_.at(gnss_satellite_id).size()) {
-      validate_.at(gnss_satellite_id) = false;
-      nearest_index_.at(gnss_satellite_id) = index;
-      continue;
-    }
-
-    double nearest_unixtime = unixtime_vector_.at(gnss_satellite_id).at(index);
-    if (interpolation_number_ % 2 && index != 0) {
-      double pre_time = unixtime_vector_.at(gnss_satellite_id).at(index - 1);
-      if (std::abs(start_unix_time - pre_time) < std::abs(start_unix_time - nearest_unixtime)) --index;
-    }
-    nearest_index_.at(gnss_satellite_id) = index;
-    nearest_unixtime = unixtime_vector_.at(gnss_satellite_id).at(index);
-    if (std::abs(start_unix_time - nearest_unixtime) > time_interval_) {
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    }
-
-    // for both even and odd: 2n+1 -> [-n, n] 2n -> [-n, n)
-    for (int j = -interpolation_number_ / 2; j < (interpolation_number_ + 1) / 2; ++j) {
-      int now_index = index + j;
-      if (now_index < 0 || now_index >= (int)unixtime_vector_.at(gnss_satellite_id).size()) continue;
-
-      time_period_.at(gnss_satellite_id).push_back(unixtime_vector_.at(gnss_satellite_id).at(now_index));
-      clock_bias_.at(gnss_satellite_id).push_back(gnss_sat_clock_table_.at(gnss_satellite_id).at(now_index));
-    }
-
-    if ((int)time_period_.at(gnss_satellite_id).size() != interpolation_number_) {
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    }
-    double time_period_length = time_period_.at(gnss_satellite_id).back() - time_period_.at(gnss_satellite_id).front();
-    if (time_period_length > time_interval_ * (interpolation_number_ - 1) + 1e-4) {  // more strict for clock_bias
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    } else {
-      validate_.at(gnss_satellite_id) = true;
-    }
-
-    if (std::abs(start_unix_time - nearest_unixtime) < 1e-4) {  // for the numerical error
-      gnss_sat_clock_.at(gnss_satellite_id) = gnss_sat_clock_table_.at(gnss_satellite_id).at(index);
-    } else {
-      gnss_sat_clock_.at(gnss_satellite_id) =
-          LagrangeInterpolation(time_period_.at(gnss_satellite_id), clock_bias_.at(gnss_satellite_id), start_unix_time);
-    }
-  }
+  Update(start_unix_time);
 }
 
 void GnssSat_clock::Update(const double now_unix_time) {
-  for (int gnss_satellite_id = 0; gnss_satellite_id < all_sat_num_; ++gnss_satellite_id) {
-    if (unixtime_vector_.at(gnss_satellite_id).empty()) {
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    }
-
-    int index = nearest_index_.at(gnss_satellite_id);
-    if (index == (int)unixtime_vector_.at(gnss_satellite_id).size()) {
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    }
+  EvaluateSegments(now_unix_time);
 
-    if (index + 1 < (int)unixtime_vector_.at(gnss_satellite_id).size()) {
-      double pre_unix = unixtime_vector_.at(gnss_satellite_id).at(index);
-      double post_unix = unixtime_vector_.at(gnss_satellite_id).at(index + 1);
-
-      if (std::abs(now_unix_time - post_unix) < std::abs(now_unix_time - pre_unix)) {
-        ++index;
-        nearest_index_.at(gnss_satellite_id) = index;
-
-        time_period_.at(gnss_satellite_id).clear();
-        clock_bias_.at(gnss_satellite_id).clear();
-
-        // for both even and odd: 2n+1 -> [-n, n] 2n -> [-n, n)
-        for (int j = -interpolation_number_ / 2; j < (interpolation_number_ + 1) / 2; ++j) {
-          int now_index = index + j;
-          if (now_index < 0 || now_index >= (int)unixtime_vector_.at(gnss_satellite_id).size()) continue;
-
-          time_period_.at(gnss_satellite_id).push_back(unixtime_vector_.at(gnss_satellite_id).at(now_index));
-          clock_bias_.at(gnss_satellite_id).push_back(gnss_sat_clock_table_.at(gnss_satellite_id).at(now_index));
-        }
-      }
-    }
-    if ((int)time_period_.at(gnss_satellite_id).size() != interpolation_number_) {
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    }
-
-    double nearest_unix_time = unixtime_vector_.at(gnss_satellite_id).at(index);
-    if (std::abs(now_unix_time - nearest_unix_time) > time_interval_) {
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    }
-
-    // in clock_bias, more strict.
-    double time_period_length = time_period_.at(gnss_satellite_id).back() - time_period_.at(gnss_satellite_id).front();
-    if (time_period_length > time_interval_ * (interpolation_number_ - 1) + 1e-4) {  // more strict for clock_bias
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    } else {
-      validate_.at(gnss_satellite_id) = true;
-    }
+  for (int gnss_satellite_id = 0; gnss_satellite_id < all_sat_num_; ++gnss_satellite_id) {
+    if (!validate_[gnss_satellite_id]) continue;
 
-    if (std::abs(now_unix_time - nearest_unix_time) < 1e-4) {
-      gnss_sat_clock_.at(gnss_satellite_id) = gnss_sat_clock_table_.at(gnss_satellite_id).at(index);
+    const int index = nearest_index_[gnss_satellite_id];
+    if (std::abs(now_unix_time - tables_->unix_times[gnss_satellite_id][index]) < 1e-4) {  // for the numerical error
+      gnss_sat_clock_[gnss_satellite_id] = tables_->values[gnss_satellite_id][index];
     } else {
-      gnss_sat_clock_.at(gnss_satellite_id) =
-          LagrangeInterpolation(time_period_.at(gnss_satellite_id), clock_bias_.at(gnss_satellite_id), now_unix_time);
+      gnss_sat_clock_[gnss_satellite_id] = interpolated_values_[gnss_satellite_id];
     }
   }
 }
@@ -792,8 +548,8 @@ double GnssSat_clock::GetSatClock(int gnss_satellite_id) const {
 }
 
 GnssSat_Info::GnssSat_Info() {}
-void GnssSat_Info::Init(vector<vector<string>>& position_file, int position_interpolation_method, int position_interpolation_number,
-                        UltraRapidMode position_ur_flag, vector<vector<string>>& clock_file, string clock_file_extension,
+void GnssSat_Info::Init(const vector<GnssProductFile>& position_file, int position_interpolation_method, int position_interpolation_number,
+                        UltraRapidMode position_ur_flag, const vector<GnssProductFile>& clock_file, string clock_file_extension,
                         int clock_interpolation_number, UltraRapidMode clock_ur_flag) {
   auto unix_time_period = position_.Init(position_file, position_interpolation_method, position_interpolation_number, position_ur_flag);
   clock_.Init(clock_file, clock_file_extension, clock_interpolation_number, clock_ur_flag, unix_time_period);
@@ -845,17 +601,17 @@ GnssSatellites::GnssSatellites(bool is_calc_enabled)
 
 bool GnssSatellites::IsCalcEnabled() const { return is_calc_enabled_; }
 
-void GnssSatellites::Init(vector<vector<string>>& true_position_file, int true_position_interpolation_method, int true_position_interpolation_number,
-                          UltraRapidMode true_position_ur_flag,
+void GnssSatellites::Init(const vector<GnssProductFile>& true_position_file, int true_position_interpolation_method,
+                          int true_position_interpolation_number, UltraRapidMode true_position_ur_flag,
 
-                          vector<vector<string>>& true_clock_file, string true_clock_file_extension, int true_clock_interpolation_number,
+                          const vector<GnssProductFile>& true_clock_file, string true_clock_file_extension, int true_clock_interpolation_number,
                           UltraRapidMode true_clock_ur_flag,
 
-                          vector<vector<string>>& estimate_position_file, int estimate_position_interpolation_method,
+                          const vector<GnssProductFile>& estimate_position_file, int estimate_position_interpolation_method,
                           int estimate_position_interpolation_number, UltraRapidMode estimate_position_ur_flag,
 
-                          vector<vector<string>>& estimate_clock_file, string estimate_clock_file_extension, int estimate_clock_interpolation_number,
-                          UltraRapidMode estimate_clock_ur_flag) {
+                          const vector<GnssProductFile>& estimate_clock_file, string estimate_clock_file_extension,
+                          int estimate_clock_interpolation_number, UltraRapidMode estimate_clock_ur_flag) {
   true_info_.Init(true_position_file, true_position_interpolation_method, true_position_interpolation_number, true_position_ur_flag,
 
                   true_clock_file, true_clock_file_extension, true_clock_interpolation_number, true_clock_ur_flag);
@@ -1082,7 +838,7 @@ double GnssSatellites::AddIonosphericDelay(const int gnss_satellite_id, const li
   const double default_delay = 20.0;                                             //[m] default delay
   double delay = default_delay * (1000.0 - altitude) / 1000.0 / cos(angle_rad);  // set the maximum height as 1000.0. Divide by
                                                                                  // cos because the slope makes it longer.
-  const double default_frequency = 1500.0;                                       //[MHz]
+  const double default_frequency = 1500.0;  //[MHz]
   // Ionospheric delay is inversely proportional to the square of the frequency
   delay *= pow(default_frequency / frequency, 2.0);
 
@@ -11,8 +11,10 @@
 #include <fstream>
 #include <iomanip>
 #include <map>
+#include <memory>
 #include <vector>
 
+#include "gnss_product_file.hpp"
 #include "library/logger/loggable.hpp"
 #include "library/math/vector.hpp"
 #include "simulation_time.hpp"
@@ -51,6 +53,10 @@ enum UltraRapidMode {
 /**
  * @class GnssSat_coordinate
  * @brief GNSS satellite coordinate?
+ * @details The data points are converted into the piecewise Chebyshev expansions of the interpolation at the initialization.
+ *          Each data point has a segment where it is the nearest data point, and the expansion of the interpolation with the window around
+ *          the data point is evaluated in the segment. So the cost of the update does not depend on the number of the interpolation points.
+ *          The data points and the expansions are not changed after the initialization, and they are shared by the copies of the object.
  */
 class GnssSat_coordinate {
  public:
@@ -79,6 +85,31 @@ class GnssSat_coordinate {
   bool GetWhetherValid(int gnss_satellite_id) const;
 
  protected:
+  /**
+   * @struct InterpolationSegment
+   * @brief Time range where a data point is the nearest data point
+   */
+  struct InterpolationSegment {
+    double start_unix_time;  //!< Start unix time of the segment
+    double end_unix_time;    //!< End unix time of the segment
+    bool is_valid;           //!< Whether the interpolation window around the data point is available
+  };
+  /**
+   * @struct Tables
+   * @brief Data points and Chebyshev expansions made at the initialization
+   */
+  struct Tables {
+    std::vector<std::vector<double>> unix_times;  //!< List of unixtime for all sat
+    //! Values at the data points of all satellites (values[gnss_satellite_id][data_point_index * number_of_components + component])
+    std::vector<std::vector<double>> values;
+    std::vector<std::vector<InterpolationSegment>> segments;  //!< Segments of all satellites (one segment for each data point)
+    //! Chebyshev coefficients of all satellites
+    //! (coefficients[gnss_satellite_id][(segment * number_of_coefficients + k) * number_of_components + component])
+    std::vector<std::vector<double>> coefficients;
+    size_t number_of_components = 0;    //!< Number of the components of a value
+    size_t number_of_coefficients = 0;  //!< Number of the Chebyshev coefficients per component and segment
+  };
+
   /**
    * @fn TrigonometricInterpolation
    * @brief Interpolate with Trigonometric method
@@ -89,8 +120,6 @@ class GnssSat_coordinate {
    * @param [in] time: Time to calculate the interpolated value
    * @return Interpolated value
    */
-  template <size_t N>
-  libra::Vector<N> TrigonometricInterpolation(const std::vector<double>& time_vector, const std::vector<libra::Vector<N>>& values, double time) const;
   double TrigonometricInterpolation(const std::vector<double>& time_vector, const std::vector<double>& values, double time) const;
 
   /**
@@ -101,14 +130,39 @@ class GnssSat_coordinate {
    * @param [in] time: Time to calculate the interpolated value
    * @return Interpolated value
    */
-  template <size_t N>
-  libra::Vector<N> LagrangeInterpolation(const std::vector<double>& time_vector, const std::vector<libra::Vector<N>>& values, double time) const;
   double LagrangeInterpolation(const std::vector<double>& time_vector, const std::vector<double>& values, double time) const;
 
-  std::vector<std::vector<double>> unixtime_vector_;  //!< List of unixtime for all sat
-  std::vector<std::vector<double>> time_period_;      //!< List of time period for interpolation
-  std::vector<bool> validate_;                        //!< List of whether the satellite is available at the time
-  std::vector<int> nearest_index_;                    //!< Index list for update(in position, time_and_index_list_. in clock_bias, time_table_)
+  /**
+   * @fn MakeSegments
+   * @brief Make the segments and the Chebyshev expansions of the interpolation from the data points of all satellites
+   * @param [in,out] tables: Tables which have the data points
+   * @param [in] number_of_components: Number of the components of a value
+   * @param [in] number_of_coefficients: Number of the Chebyshev coefficients per component and segment
+   * @param [in] max_window_length_s: Maximum time length of the available interpolation window [s]
+   * @param [in] is_trigonometric: Use trigonometric interpolation when true, and Lagrange interpolation when false
+   */
+  void MakeSegments(Tables& tables, const size_t number_of_components, const size_t number_of_coefficients,
+                    const double max_window_length_s, const bool is_trigonometric);
+  /**
+   * @fn EvaluateSegments
+   * @brief Evaluate the interpolation of all satellites, and update interpolated_values_, validate_, and nearest_index_
+   * @param [in] unix_time: Unix time to evaluate
+   */
+  void EvaluateSegments(const double unix_time);
+  /**
+   * @fn FindSegment
+   * @brief Find the segment including the time. The segment of the previous update is checked first.
+   * @param [in] gnss_satellite_id: Index of GNSS satellite
+   * @param [in] unix_time: Unix time
+   * @return Index of the segment, or -1 when no segment includes the time
+   */
+  int FindSegment(const int gnss_satellite_id, const double unix_time) const;
+
+  std::shared_ptr<const Tables> tables_ = std::make_shared<Tables>();  //!< Tables made at the initialization
+  std::vector<bool> validate_;                                         //!< List of whether the satellite is available at the time
+  std::vector<int> nearest_index_;                                     //!< Index list of the nearest data point at the last update
+
+  std::vector<double> interpolated_values_;  //!< Interpolated values of all satellites (gnss_satellite_id * number_of_components + component)
 
   double step_sec_ = 0.0;         //!< Step width [sec]
   double time_interval_ = 0.0;    //!< Time interval
@@ -129,13 +183,13 @@ class GnssSat_position : public GnssSat_coordinate {
   /**
    * @fn Init
    * @brief Initialize GNSS satellite position
-   * @param[in] file: File path for position calculation
+   * @param[in] files: Parsed SP3 files for position calculation
    * @param[in] interpolation_method: Interpolation method for position calculation
    * @param[in] interpolation_number: Interpolation number for position calculation
    * @param[in] ur_flag: Ultra Rapid flag for position calculation
    * @return Start unix time and end unix time
    */
-  std::pair<double, double> Init(std::vector<std::vector<std::string>>& file, int interpolation_method, int interpolation_number,
+  std::pair<double, double> Init(const std::vector<GnssProductFile>& files, int interpolation_method, int interpolation_number,
                                  UltraRapidMode ur_flag);
 
   /**
@@ -168,12 +222,6 @@ class GnssSat_position : public GnssSat_coordinate {
  private:
   std::vector<libra::Vector<3>> gnss_sat_ecef_;  //!< List of GNSS satellite position at specific time in the ECEF frame [m]
   std::vector<libra::Vector<3>> gnss_sat_eci_;   //!< List of GNSS satellite position at specific time in the ECI frame [m]
-
-  std::vector<std::vector<libra::Vector<3>>> gnss_sat_table_ecef_;  //!< Time series of position of all GNSS satellites in the ECEF frame [m]
-  std::vector<std::vector<libra::Vector<3>>> gnss_sat_table_eci_;   //!< Time series of position of all GNSS satellites in the ECEF frame [m]
-
-  std::vector<std::vector<libra::Vector<3>>> ecef_;  //!< Time series of position of all GNSS satellites in the ECEF frame before interpolation [m]
-  std::vector<std::vector<libra::Vector<3>>> eci_;   //!< Time series of position of all GNSS satellites in the ECEF frame before interpolation [m]
 };
 
 /**
@@ -190,12 +238,12 @@ class GnssSat_clock : public GnssSat_coordinate {
   /**
    * @fn Init
    * @brief Initialize GNSS satellite clock
-   * @param[in] ile: File path for clock calculation
+   * @param[in] files: Parsed SP3 or CLK files for clock calculation
    * @param[in] file_extension: Extension of the clock file (ex. .sp3, .clk30s)
    * @param[in] interpolation_number: Interpolation number for clock calculation
    * @param[in] ur_flag: Ultra Rapid flag for clock calculation
    */
-  void Init(std::vector<std::vector<std::string>>& file, std::string file_extension, int interpolation_number, UltraRapidMode ur_flag,
+  void Init(const std::vector<GnssProductFile>& files, std::string file_extension, int interpolation_number, UltraRapidMode ur_flag,
             std::pair<double, double> unix_time_period);
   /**
    * @fn SetUp
@@ -218,9 +266,7 @@ class GnssSat_clock : public GnssSat_coordinate {
   double GetSatClock(int gnss_satellite_id) const;
 
  private:
-  std::vector<double> gnss_sat_clock_;                     //!< List of clock bias of all GNSS satellites at specific time expressed in distance [m]
-  std::vector<std::vector<double>> gnss_sat_clock_table_;  //!< Time series of clock bias of all GNSS satellites expressed in distance [m]
-  std::vector<std::vector<double>> clock_bias_;  //!< Time series of clock bias of all GNSS satellites expressed in distance before interpolation [m]
+  std::vector<double> gnss_sat_clock_;  //!< List of clock bias of all GNSS satellites at specific time expressed in distance [m]
 };
 
 /**
@@ -237,17 +283,17 @@ class GnssSat_Info {
   /**
    * @fn Init
    * @brief Initialize position and clock
-   * @param[in] position_file: File path for position calculation
+   * @param[in] position_file: Parsed files for position calculation
    * @param[in] position_interpolation_method: Interpolation method for position calculation
    * @param[in] position_interpolation_number: Interpolation number for position calculation
    * @param[in] position_ur_flag: Ultra Rapid flag for position calculation
-   * @param[in] clock_file: File path for clock calculation
+   * @param[in] clock_file: Parsed files for clock calculation
    * @param[in] clock_file_extension: Extension of the clock file (ex. .sp3, .clk30s)
    * @param[in] clock_interpolation_number: Interpolation number for clock calculation
    * @param[in] clock_ur_flag: Ultra Rapid flag for clock calculation
    */
-  void Init(std::vector<std::vector<std::string>>& position_file, int position_interpolation_method, int position_interpolation_number,
-            UltraRapidMode position_ur_flag, std::vector<std::vector<std::string>>& clock_file, std::string clock_file_extension,
+  void Init(const std::vector<GnssProductFile>& position_file, int position_interpolation_method, int position_interpolation_number,
+            UltraRapidMode position_ur_flag, const std::vector<GnssProductFile>& clock_file, std::string clock_file_extension,
             int clock_interpolation_number, UltraRapidMode clock_ur_flag);
   /**
    * @fn SetUp
@@ -332,11 +378,11 @@ class GnssSatellites : public ILoggable {
    * @brief Initialize function
    * @note Parameters are defined in GNSSSat_Info for true and estimated information
    */
-  void Init(std::vector<std::vector<std::string>>& true_position_file, int true_position_interpolation_method, int true_position_interpolation_number,
-            UltraRapidMode true_position_ur_flag, std::vector<std::vector<std::string>>& true_clock_file, std::string true_clock_file_extension,
-            int true_clock_interpolation_number, UltraRapidMode true_clock_ur_flag, std::vector<std::vector<std::string>>& estimate_position_file,
+  void Init(const std::vector<GnssProductFile>& true_position_file, int true_position_interpolation_method, int true_position_interpolation_number,
+            UltraRapidMode true_position_ur_flag, const std::vector<GnssProductFile>& true_clock_file, std::string true_clock_file_extension,
+            int true_clock_interpolation_number, UltraRapidMode true_clock_ur_flag, const std::vector<GnssProductFile>& estimate_position_file,
             int estimate_position_interpolation_method, int estimate_position_interpolation_number, UltraRapidMode estimate_position_ur_flag,
-            std::vector<std::vector<std::string>>& estimate_clock_file, std::string estimate_clock_file_extension,
+            const std::vector<GnssProductFile>& estimate_clock_file, std::string estimate_clock_file_extension,
             int estimate_clock_interpolation_number, UltraRapidMode estimate_clock_ur_flag);
   /**
    * @fn IsCalcEnabled
@@ -5,6 +5,8 @@
 #include "hipparcos_catalogue.hpp"
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <sstream>
@@ -13,6 +15,36 @@
 
 #include "library/initialize/initialize_file_access.hpp"
 #include "library/math/constants.hpp"
+#include "library/utilities/memory_mapped_file.hpp"
+#include "library/utilities/shared_data_store.hpp"
+
+static const char kBinaryMagic[8] = {'S', '2', 'E', 'H', 'I', 'P', '0', '1'};  //!< Magic of the binary catalogue file
+static const uint32_t kBinaryByteOrderMark = 0x01020304;                       //!< Byte order mark of the binary catalogue file
+
+/**
+ * @struct HipparcosBinaryHeader
+ * @brief Header of the binary catalogue file
+ * @details The records, the unit vectors (x, y, z per star), the cell offsets, and the cell items of the sky index follow the header.
+ */
+struct HipparcosBinaryHeader {
+  char magic[8];             //!< Magic "S2EHIP01"
+  uint32_t byte_order_mark;  //!< Byte order mark
+  uint32_t grid_size;        //!< Number of the cells along an edge of a cube face of the sky index
+  uint64_t number_of_stars;  //!< Number of the stars
+  uint64_t number_of_cells;  //!< Number of the cells of the sky index
+};
+
+/**
+ * @struct HipparcosBinaryRecord
+ * @brief Record of a star in the binary catalogue file
+ */
+struct HipparcosBinaryRecord {
+  int32_t hipparcos_id;        //!< Hipparcos number
+  int32_t reserved;            //!< Reserved for the alignment
+  double visible_magnitude;    //!< Visible magnitude
+  double right_ascension_deg;  //!< Right ascension [deg]
+  double declination_deg;      //!< Declination [deg]
+};
 
 HipparcosCatalogue::HipparcosCatalogue(double max_magnitude, std::string catalogue_path)
     : max_magnitude_(max_magnitude), catalogue_path_(catalogue_path) {}
@@ -22,46 +54,166 @@ HipparcosCatalogue::~HipparcosCatalogue() {}
 bool HipparcosCatalogue::ReadContents(const std::string& file_name, const char delimiter = ',') {
   if (!IsCalcEnabled) return false;
 
+  // The catalogue is read once in a process and shared by the instances with the same file and maximum magnitude
+  const std::string key = file_name + delimiter + std::to_string(max_magnitude_);
+  const double max_magnitude = max_magnitude_;
+  std::shared_ptr<const CatalogueData> catalogue =
+      SharedDataStore<CatalogueData>::GetOrLoad(key, [&file_name, delimiter, max_magnitude]() -> std::shared_ptr<const CatalogueData> {
+        // Detect the binary catalogue by its magic
+        char magic[sizeof(kBinaryMagic)] = {};
+        {
+          std::ifstream ifs(file_name, std::ios::in | std::ios::binary);
+          ifs.read(magic, sizeof(magic));
+        }
+        if (memcmp(magic, kBinaryMagic, sizeof(kBinaryMagic)) == 0) return ReadBinaryCatalogue(file_name, max_magnitude);
+        return ReadCsvCatalogue(file_name, delimiter, max_magnitude);
+      });
+  if (catalogue == nullptr) return false;
+
+  hipparcos_catalogue_ = catalogue;
+  return true;
+}
+
+std::shared_ptr<const HipparcosCatalogue::CatalogueData> HipparcosCatalogue::ReadCsvCatalogue(const std::string& file_name, const char delimiter,
+                                                                                               const double max_magnitude) {
   std::ifstream ifs(file_name);
   if (!ifs.is_open()) {
     std::cerr << "file open error(hip_main.csv)";
-    return false;
+    return nullptr;
   }
 
+  std::shared_ptr<CatalogueData> contents = std::make_shared<CatalogueData>();
   std::string title;
   ifs >> title;  // Skip title
-  while (!ifs.eof()) {
+  std::string line;
+  while (ifs >> line) {
     HipparcosData hipparcos_data;
 
-    std::string line;
-    ifs >> line;
     std::replace(line.begin(), line.end(), delimiter, ' ');  // Convert delimiter as space for stringstream
     std::istringstream streamline(line);
 
-    streamline >> hipparcos_data.hipparcos_id >> hipparcos_data.visible_magnitude >> hipparcos_data.right_ascension_deg >>
-        hipparcos_data.declination_deg;
+    if (!(streamline >> hipparcos_data.hipparcos_id >> hipparcos_data.visible_magnitude >> hipparcos_data.right_ascension_deg >>
+          hipparcos_data.declination_deg)) {
+      std::cerr << "Warning: Invalid line in the Hipparcos catalogue file is skipped: " << line << std::endl;
+      continue;
+    }
+    if (hipparcos_data.visible_magnitude > max_magnitude) continue;  // Don't read stars darker than max_magnitude
+    contents->stars.push_back(hipparcos_data);
+  }
+  // The ranks are in ascending order of the magnitude even when the file is not sorted
+  std::stable_sort(contents->stars.begin(), contents->stars.end(),
+                   [](const HipparcosData& lhs, const HipparcosData& rhs) { return lhs.visible_magnitude < rhs.visible_magnitude; });
+
+  // Sky index with the precomputed unit vectors
+  std::vector<libra::Vector<3>> directions_i(contents->stars.size());
+  for (size_t rank = 0; rank < contents->stars.size(); rank++) {
+    const double ra_rad = contents->stars[rank].right_ascension_deg * libra::deg_to_rad;
+    const double de_rad = contents->stars[rank].declination_deg * libra::deg_to_rad;
+    directions_i[rank][0] = cos(ra_rad) * cos(de_rad);
+    directions_i[rank][1] = sin(ra_rad) * cos(de_rad);
+    directions_i[rank][2] = sin(de_rad);
+  }
+  contents->sky_index = libra::CubeFaceGridIndex(directions_i);
+  return contents;
+}
 
-    if (hipparcos_data.visible_magnitude > max_magnitude_) {
-      return true;
-    }  // Don't read stars darker than max_magnitude
-    hipparcos_catalogue_.push_back(hipparcos_data);
+std::shared_ptr<const HipparcosCatalogue::CatalogueData> HipparcosCatalogue::ReadBinaryCatalogue(const std::string& file_name,
+                                                                                                  const double max_magnitude) {
+  MemoryMappedFile mapped_file(file_name);
+  if (!mapped_file.IsMapped()) {
+    std::cerr << "Error: Cannot map the Hipparcos catalogue file: " << file_name << std::endl;
+    return nullptr;
   }
+  const unsigned char* data = mapped_file.GetData();
+  const size_t size_byte = mapped_file.GetSize_byte();
 
-  return true;
+  // Check the contents
+  const HipparcosBinaryHeader* header = (const HipparcosBinaryHeader*)data;
+  bool is_valid = size_byte >= sizeof(HipparcosBinaryHeader) && header->byte_order_mark == kBinaryByteOrderMark && header->grid_size >= 1 &&
+                  header->number_of_cells == 6 * (uint64_t)header->grid_size * header->grid_size;
+  const size_t number_of_stars = is_valid ? header->number_of_stars : 0;
+  const size_t number_of_cells = is_valid ? header->number_of_cells : 0;
+  const size_t directions_offset_byte = sizeof(HipparcosBinaryHeader) + sizeof(HipparcosBinaryRecord) * number_of_stars;
+  const size_t cell_offsets_offset_byte = directions_offset_byte + sizeof(double) * 3 * number_of_stars;
+  const size_t cell_items_offset_byte = cell_offsets_offset_byte + sizeof(uint64_t) * (number_of_cells + 1);
+  is_valid = is_valid && cell_items_offset_byte + sizeof(uint64_t) * number_of_stars <= size_byte;
+
+  const HipparcosBinaryRecord* records = (const HipparcosBinaryRecord*)(data + sizeof(HipparcosBinaryHeader));
+  const double* directions = (const double*)(data + directions_offset_byte);
+  const uint64_t* cell_offsets = (const uint64_t*)(data + cell_offsets_offset_byte);
+  const uint64_t* cell_items = (const uint64_t*)(data + cell_items_offset_byte);
+  if (is_valid) is_valid = cell_offsets[0] == 0 && cell_offsets[number_of_cells] == number_of_stars;
+  for (size_t cell = 0; is_valid && cell < number_of_cells; cell++) is_valid = cell_offsets[cell] <= cell_offsets[cell + 1];
+  for (size_t k = 0; is_valid && k < number_of_stars; k++) is_valid = cell_items[k] < number_of_stars;
+  // The stars brighter than the maximum magnitude are read as a prefix of the records
+  for (size_t rank = 1; is_valid && rank < number_of_stars; rank++) {
+    is_valid = records[rank - 1].visible_magnitude <= records[rank].visible_magnitude;
+  }
+  if (!is_valid) {
+    std::cerr << "Error: Invalid Hipparcos catalogue file: " << file_name << std::endl;
+    return nullptr;
+  }
+
+  std::shared_ptr<CatalogueData> contents = std::make_shared<CatalogueData>();
+  for (size_t rank = 0; rank < number_of_stars; rank++) {
+    if (records[rank].visible_magnitude > max_magnitude) break;  // Don't read stars darker than max_magnitude
+    contents->stars.push_back(HipparcosData{records[rank].hipparcos_id, records[rank].visible_magnitude, records[rank].right_ascension_deg,
+                                            records[rank].declination_deg});
+  }
+  std::vector<libra::Vector<3>> directions_i(number_of_stars);
+  for (size_t rank = 0; rank < number_of_stars; rank++) {
+    for (size_t i = 0; i < 3; i++) directions_i[rank][i] = directions[3 * rank + i];
+  }
+  contents->sky_index = libra::CubeFaceGridIndex(std::move(directions_i), header->grid_size,
+                                                 std::vector<size_t>(cell_offsets, cell_offsets + number_of_cells + 1),
+                                                 std::vector<size_t>(cell_items, cell_items + number_of_stars));
+  return contents;
 }
 
-libra::Vector<3> HipparcosCatalogue::GetStarDirection_i(size_t rank) const {
-  libra::Vector<3> direction_i;
-  double ra_rad = GetRightAscension_deg(rank) * libra::deg_to_rad;
-  double de_rad = GetDeclination_deg(rank) * libra::deg_to_rad;
+bool HipparcosCatalogue::WriteBinaryCatalogue(const std::string& file_name) const {
+  const std::vector<HipparcosData>& stars = hipparcos_catalogue_->stars;
+  const libra::CubeFaceGridIndex& sky_index = hipparcos_catalogue_->sky_index;
 
-  direction_i[0] = cos(ra_rad) * cos(de_rad);
-  direction_i[1] = sin(ra_rad) * cos(de_rad);
-  direction_i[2] = sin(de_rad);
+  HipparcosBinaryHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, kBinaryMagic, sizeof(kBinaryMagic));
+  header.byte_order_mark = kBinaryByteOrderMark;
+  header.grid_size = (uint32_t)sky_index.GetGridSize();
+  header.number_of_stars = stars.size();
+  header.number_of_cells = sky_index.GetCellOffsets().size() - 1;
+
+  std::vector<HipparcosBinaryRecord> records(stars.size());
+  std::vector<double> directions(3 * stars.size());
+  for (size_t rank = 0; rank < stars.size(); rank++) {
+    memset(&records[rank], 0, sizeof(HipparcosBinaryRecord));
+    records[rank].hipparcos_id = stars[rank].hipparcos_id;
+    records[rank].visible_magnitude = stars[rank].visible_magnitude;
+    records[rank].right_ascension_deg = stars[rank].right_ascension_deg;
+    records[rank].declination_deg = stars[rank].declination_deg;
+    for (size_t i = 0; i < 3; i++) directions[3 * rank + i] = sky_index.GetDirection(rank)[i];
+  }
+  const std::vector<uint64_t> cell_offsets(sky_index.GetCellOffsets().begin(), sky_index.GetCellOffsets().end());
+  const std::vector<uint64_t> cell_items(sky_index.GetCellItems().begin(), sky_index.GetCellItems().end());
 
-  return direction_i;
+  std::ofstream file(file_name, std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!file.is_open()) {
+    std::cerr << "Error: Cannot open the Hipparcos catalogue file: " << file_name << std::endl;
+    return false;
+  }
+  file.write((const char*)&header, sizeof(header));
+  file.write((const char*)records.data(), sizeof(HipparcosBinaryRecord) * records.size());
+  file.write((const char*)directions.data(), sizeof(double) * directions.size());
+  file.write((const char*)cell_offsets.data(), sizeof(uint64_t) * cell_offsets.size());
+  file.write((const char*)cell_items.data(), sizeof(uint64_t) * cell_items.size());
+  if (!file.good()) {
+    std::cerr << "Error: Cannot write the Hipparcos catalogue file: " << file_name << std::endl;
+    return false;
+  }
+  return true;
 }
 
+libra::Vector<3> HipparcosCatalogue::GetStarDirection_i(size_t rank) const { return hipparcos_catalogue_->sky_index.GetDirection(rank); }
+
 libra::Vector<3> HipparcosCatalogue::GetStarDirection_b(size_t rank, libra::Quaternion quaternion_i2b) const {
   libra::Vector<3> direction_i;
   libra::Vector<3> direction_b;
@@ -72,6 +224,13 @@ libra::Vector<3> HipparcosCatalogue::GetStarDirection_b(size_t rank, libra::Quat
   return direction_b;
 }
 
+std::vector<size_t> HipparcosCatalogue::FindStarsInCone(const libra::Vector<3>& axis_i, const double half_angle_rad) const {
+  std::vector<size_t> ranks = hipparcos_catalogue_->sky_index.FindInCone(axis_i, half_angle_rad);
+  // The sky index of the binary catalogue file can include the stars darker than the maximum magnitude
+  ranks.erase(std::lower_bound(ranks.begin(), ranks.end(), GetCatalogueSize()), ranks.end());
+  return ranks;
+}
+
 std::string HipparcosCatalogue::GetLogHeader() const {
   std::string str_tmp = "";
 
@@ -6,9 +6,11 @@
 #ifndef S2E_ENVIRONMENT_GLOBAL_HIPPARCOS_CATALOGUE_HPP_
 #define S2E_ENVIRONMENT_GLOBAL_HIPPARCOS_CATALOGUE_HPP_
 
+#include <memory>
 #include <vector>
 
 #include "library/logger/loggable.hpp"
+#include "library/math/cube_face_grid_index.hpp"
 #include "library/math/quaternion.hpp"
 #include "library/math/vector.hpp"
 
@@ -43,40 +45,49 @@ class HipparcosCatalogue : public ILoggable {
   /**
    *@fn ReadContents
    *@brief Read Hipparcos catalogue file
-   *@param [in] file_name: Path to Hipparcos catalogue file
-   *@param [in] delimiter: Delimiter for the catalogue file
+   *@note The binary catalogue file written by WriteBinaryCatalogue is detected by its magic and mapped without parsing
+   *@param [in] file_name: Path to Hipparcos catalogue file (CSV or binary)
+   *@param [in] delimiter: Delimiter for the CSV catalogue file
    */
   bool ReadContents(const std::string& file_name, const char delimiter);
+  /**
+   *@fn WriteBinaryCatalogue
+   *@brief Write the read catalogue into the binary catalogue file
+   *@details The file has the records in ascending order of the magnitude, the unit vectors in the inertial frame, and the sky index.
+   *         All values are stored in the byte order of the writing machine, which is checked with the byte order mark.
+   *@param [in] file_name: Path to the binary catalogue file
+   */
+  bool WriteBinaryCatalogue(const std::string& file_name) const;
 
   /**
    *@fn GetCatalogueSize
    *@brief Return read catalogue size
    */
-  size_t GetCatalogueSize() const { return hipparcos_catalogue_.size(); }
+  size_t GetCatalogueSize() const { return hipparcos_catalogue_->stars.size(); }
   /**
    *@fn GetHipparcosId
    *@brief Return Hipparcos ID of a star
    *@param [in] rank: Rank of star magnitude in read catalogue
    */
-  int GetHipparcosId(size_t rank) const { return hipparcos_catalogue_[rank].hipparcos_id; }
+  int GetHipparcosId(size_t rank) const { return hipparcos_catalogue_->stars[rank].hipparcos_id; }
   /**
    *@fn GetVisibleMagnitude
    *@brief Return magnitude in visible wave length of a star
    *@param [in] rank: Rank of star magnitude in read catalogue
    */
-  double GetVisibleMagnitude(size_t rank) const { return hipparcos_catalogue_[rank].visible_magnitude; }
+  double GetVisibleMagnitude(size_t rank) const { return hipparcos_catalogue_->stars[rank].visible_magnitude; }
   /**
    *@fn GetRightAscension_deg
    *@brief Return right ascension of a star
    *@param [in] rank: Rank of star magnitude in read catalogue
    */
-  double GetRightAscension_deg(size_t rank) const { return hipparcos_catalogue_[rank].right_ascension_deg; }
+  double GetRightAscension_deg(size_t rank) const { return hipparcos_catalogue_->stars[rank].right_ascension_deg; }
   /**
    *@fn GetDeclination_deg
    *@brief Return declination of a star
    *@param [in] rank: Rank of star magnitude in read catalogue
    */
-  double GetDeclination_deg(size_t rank) const { return hipparcos_catalogue_[rank].declination_deg; }
+  double GetDeclination_deg(size_t rank) const { return hipparcos_catalogue_->stars[rank].declination_deg; }
   /**
    *@fn GetStarDir_i
    *@brief Return direction vector of a star in the inertial frame
@@ -90,6 +101,14 @@ class HipparcosCatalogue : public ILoggable {
    *@param [in] quaternion_i2b: Quaternion from the inertial frame to the body-fixed frame
    */
   libra::Vector<3> GetStarDirection_b(size_t rank, libra::Quaternion quaternion_i2b) const;
+  /**
+   *@fn FindStarsInCone
+   *@brief Return ranks of the stars inside the cone in ascending order (brighter stars first)
+   *@note The stars are searched with the sky index built at the reading, so only the stars near the cone are tested
+   *@param [in] axis_i: Unit vector of the cone axis in the inertial frame
+   *@param [in] half_angle_rad: Half angle of the cone [rad]
+   */
+  std::vector<size_t> FindStarsInCone(const libra::Vector<3>& axis_i, const double half_angle_rad) const;
 
   // Override ILoggable
   /**
@@ -106,9 +125,39 @@ class HipparcosCatalogue : public ILoggable {
   bool IsCalcEnabled = true;  //!< Calculation enable flag
 
  private:
-  std::vector<HipparcosData> hipparcos_catalogue_;  //!< Data base of the read Hipparcos catalogue
-  double max_magnitude_;                            //!< Maximum magnitude in the data base
-  std::string catalogue_path_;                      //!< Path to Hipparcos catalog file
+  /**
+   *@struct CatalogueData
+   *@brief Read Hipparcos catalogue and its sky index
+   */
+  struct CatalogueData {
+    std::vector<HipparcosData> stars;    //!< Stars in ascending order of the magnitude
+    libra::CubeFaceGridIndex sky_index;  //!< Sky index of the star directions in the inertial frame
+  };
+  //! Data base of the read Hipparcos catalogue (shared by the instances which read the same file)
+  std::shared_ptr<const CatalogueData> hipparcos_catalogue_ = std::make_shared<CatalogueData>();
+  double max_magnitude_;        //!< Maximum magnitude in the data base
+  std::string catalogue_path_;  //!< Path to Hipparcos catalog file
+
+  /**
+   *@fn ReadCsvCatalogue
+   *@brief Read the CSV catalogue file and build the sky index
+   *@note The stars are sorted in ascending order of the magnitude, so the file does not need to be sorted
+   *@param [in] file_name: Path to the CSV catalogue file
+   *@param [in] delimiter: Delimiter for the catalogue file
+   *@param [in] max_magnitude: Maximum star magnitude to read
+   *@return Read catalogue or nullptr
+   */
+  static std::shared_ptr<const CatalogueData> ReadCsvCatalogue(const std::string& file_name, const char delimiter, const double max_magnitude);
+  /**
+   *@fn ReadBinaryCatalogue
+   *@brief Read the binary catalogue file
+   *@note The stars brighter than the maximum magnitude are used, and the sky index of all stars in the file is used as it is.
+   *      The file whose records are not in ascending order of the magnitude is rejected.
+   *@param [in] file_name: Path to the binary catalogue file
+   *@param [in] max_magnitude: Maximum star magnitude to read
+   *@return Read catalogue or nullptr
+   */
+  static std::shared_ptr<const CatalogueData> ReadBinaryCatalogue(const std::string& file_name, const double max_magnitude);
 };
 
 /**
@@ -7,6 +7,8 @@
 
 #include <iostream>
 #include <library/initialize/initialize_file_access.hpp>
+#include <library/utilities/shared_data_store.hpp>
+#include <memory>
 #include <string>
 
 std::string return_dirctory_path(std::string sort) {
@@ -46,28 +48,27 @@ std::string return_dirctory_path(std::string sort) {
   return main_directory + sub_directory;
 }
 
-void get_raw_contents(std::string directory_path, std::string file_name, std::vector<std::string>& storage) {
-  std::string all_file_path = directory_path + file_name;
-  std::ifstream ifs(all_file_path);
+void read_product_files(std::string directory_path, const std::vector<std::string>& file_names, const GnssProductFileFormat format,
+                        const std::string cache_directory, std::vector<GnssProductFile>& file_contents) {
+  std::vector<std::string> file_paths;
+  for (const std::string& file_name : file_names) {
+    file_paths.push_back(directory_path + file_name);
+  }
 
-  if (!ifs.is_open()) {
-    std::cout << "in " << directory_path << "gnss file: " << file_name << " not found" << std::endl;
+  const size_t failed_index = ReadGnssProductFiles(file_paths, format, cache_directory, file_contents);
+  if (failed_index < file_names.size()) {
+    std::cout << "in " << directory_path << "gnss file: " << file_names[failed_index] << " not found" << std::endl;
     exit(1);
   }
-  std::string str;
-  while (std::getline(ifs, str)) {
-    storage.push_back(str);
-  }
-  ifs.close();
-  if (storage.back() == "EOF") storage.pop_back();
 
   return;
 }
 
 void get_sp3_file_contents(std::string directory_path, std::string file_sort, std::string first, std::string last,
-                           std::vector<std::vector<std::string>>& file_contents, UltraRapidMode& ur_flag) {
+                           const std::string cache_directory, std::vector<GnssProductFile>& file_contents, UltraRapidMode& ur_flag) {
   std::string all_directory_path = directory_path + return_dirctory_path(file_sort);
   ur_flag = kNotUse;
+  std::vector<std::string> file_names;
 
   if (first.substr(0, 3) == "COD") {
     std::string file_header = "COD0MGXFIN_";
@@ -76,8 +77,6 @@ void get_sp3_file_contents(std::string directory_path, std::string file_sort, st
     int year_last_day = 365 + (year % 4 == 0) - (year % 100 == 0) + (year % 400 == 0);
     int day = stoi(first.substr(file_header.size() + 4, 3));
 
-    file_contents.clear();
-
     while (true) {
       if (day > year_last_day) {
         ++year;
@@ -92,9 +91,7 @@ void get_sp3_file_contents(std::string directory_path, std::string file_sort, st
       else
         s_day = "00" + std::to_string(day);
       std::string file_name = file_header + std::to_string(year) + s_day + file_footer;
-      file_contents.push_back(std::vector<std::string>());
-
-      get_raw_contents(all_directory_path, file_name, file_contents.back());
+      file_names.push_back(file_name);
 
       if (file_name == last) break;
       ++day;
@@ -117,8 +114,6 @@ void get_sp3_file_contents(std::string directory_path, std::string file_sort, st
       }
     }
 
-    file_contents.clear();
-
     while (true) {
       if (hour == 24) {
         hour = 0;
@@ -133,9 +128,7 @@ void get_sp3_file_contents(std::string directory_path, std::string file_sort, st
         file_name += "0";
       }
       file_name += std::to_string(hour) + file_footer;
-      file_contents.push_back(std::vector<std::string>());
-
-      get_raw_contents(all_directory_path, file_name, file_contents.back());
+      file_names.push_back(file_name);
 
       if (file_name == last) break;
       hour += 6;
@@ -155,29 +148,28 @@ void get_sp3_file_contents(std::string directory_path, std::string file_sort, st
       }
     }
 
-    file_contents.clear();
-
     while (true) {
       if (day == 7) {
         ++gps_week;
         day = 0;
       }
       std::string file_name = file_header + std::to_string(gps_week) + std::to_string(day) + file_footer;
-      file_contents.push_back(std::vector<std::string>());
-
-      get_raw_contents(all_directory_path, file_name, file_contents.back());
+      file_names.push_back(file_name);
 
       if (file_name == last) break;
       ++day;
     }
   }
 
+  read_product_files(all_directory_path, file_names, GnssProductFileFormat::kSp3, cache_directory, file_contents);
+
   return;
 }
 
 void get_clk_file_contents(std::string directory_path, std::string extension, std::string file_sort, std::string first, std::string last,
-                           std::vector<std::vector<std::string>>& file_contents) {
+                           const std::string cache_directory, std::vector<GnssProductFile>& file_contents) {
   std::string all_directory_path = directory_path + return_dirctory_path(file_sort) + extension.substr(1) + '/';
+  std::vector<std::string> file_names;
 
   if (file_sort.find("Ultra") != std::string::npos) {
     std::string file_header, file_footer;
@@ -196,8 +188,6 @@ void get_clk_file_contents(std::string directory_path, std::string extension, st
       }
     }
 
-    file_contents.clear();
-
     while (true) {
       if (hour == 24) {
         hour = 0;
@@ -212,9 +202,7 @@ void get_clk_file_contents(std::string directory_path, std::string extension, st
         file_name += "0";
       }
       file_name += std::to_string(hour) + file_footer;
-      file_contents.push_back(std::vector<std::string>());
-
-      get_raw_contents(all_directory_path, file_name, file_contents.back());
+      file_names.push_back(file_name);
 
       if (file_name == last) break;
       hour += 6;
@@ -234,60 +222,60 @@ void get_clk_file_contents(std::string directory_path, std::string extension, st
       }
     }
 
-    file_contents.clear();
-
     while (true) {
       if (day == 7) {
         ++gps_week;
         day = 0;
       }
       std::string file_name = file_header + std::to_string(gps_week) + std::to_string(day) + file_footer;
-      file_contents.push_back(std::vector<std::string>());
-
-      get_raw_contents(all_directory_path, file_name, file_contents.back());
+      file_names.push_back(file_name);
 
       if (file_name == last) break;
       ++day;
     }
   }
 
+  read_product_files(all_directory_path, file_names, GnssProductFileFormat::kClock, cache_directory, file_contents);
+
   return;
 }
 
-GnssSatellites* InitGnssSatellites(std::string file_name) {
-  IniAccess ini_file(file_name);
-  char section[] = "GNSS_SATELLIES";
-  GnssSatellites* gnss_satellites = new GnssSatellites(ini_file.ReadEnable(section, "calculation"));
-  if (!gnss_satellites->IsCalcEnabled()) {
-    return gnss_satellites;
-  }
-
+/**
+ * @fn MakeGnssSatellites
+ * @brief Read the product files and make the initialized GnssSatellites
+ * @param [in] ini_file: Initialize file
+ * @param [in] section: Section name
+ */
+static std::shared_ptr<const GnssSatellites> MakeGnssSatellites(IniAccess& ini_file, const char* section) {
   std::string directory_path = ini_file.ReadString(section, "directory_path");
+  std::string cache_directory = ini_file.ReadString(section, "parsed_file_cache_directory");
+  if (cache_directory == "NULL") cache_directory = "";  // the cache is disabled when the key is not defined
 
-  std::vector<std::vector<std::string>> true_position_file;
+  std::vector<GnssProductFile> true_position_file;
   UltraRapidMode true_position_ur_flag = kNotUse;
   get_sp3_file_contents(directory_path, ini_file.ReadString(section, "true_position_file_sort"), ini_file.ReadString(section, "true_position_first"),
-                        ini_file.ReadString(section, "true_position_last"), true_position_file, true_position_ur_flag);
+                        ini_file.ReadString(section, "true_position_last"), cache_directory, true_position_file, true_position_ur_flag);
   int true_position_interpolation_method = ini_file.ReadInt(section, "true_position_interpolation_method");
   int true_position_interpolation_number = ini_file.ReadInt(section, "true_position_interpolation_number");
 
-  std::vector<std::vector<std::string>> true_clock_file;
+  std::vector<GnssProductFile> true_clock_file;
   UltraRapidMode true_clock_ur_flag = kNotUse;
   std::string true_clock_file_extension = ini_file.ReadString(section, "true_clock_file_extension");
   if (true_clock_file_extension == ".sp3") {
     get_sp3_file_contents(directory_path, ini_file.ReadString(section, "true_clock_file_sort"), ini_file.ReadString(section, "true_clock_first"),
-                          ini_file.ReadString(section, "true_clock_last"), true_clock_file, true_clock_ur_flag);
+                          ini_file.ReadString(section, "true_clock_last"), cache_directory, true_clock_file, true_clock_ur_flag);
   } else {
     get_clk_file_contents(directory_path, true_clock_file_extension, ini_file.ReadString(section, "true_clock_file_sort"),
-                          ini_file.ReadString(section, "true_clock_first"), ini_file.ReadString(section, "true_clock_last"), true_clock_file);
+                          ini_file.ReadString(section, "true_clock_first"), ini_file.ReadString(section, "true_clock_last"), cache_directory,
+                          true_clock_file);
   }
   int true_clock_interpolation_number = ini_file.ReadInt(section, "true_clock_interpolation_number");
 
-  std::vector<std::vector<std::string>> estimate_position_file;
+  std::vector<GnssProductFile> estimate_position_file;
   UltraRapidMode estimate_position_ur_flag = kNotUse;
   get_sp3_file_contents(directory_path, ini_file.ReadString(section, "estimate_position_file_sort"),
                         ini_file.ReadString(section, "estimate_position_first"), ini_file.ReadString(section, "estimate_position_last"),
-                        estimate_position_file, estimate_position_ur_flag);
+                        cache_directory, estimate_position_file, estimate_position_ur_flag);
   int estimate_position_interpolation_method = ini_file.ReadInt(section, "estimate_position_interpolation_method");
   int estimate_position_interpolation_number = ini_file.ReadInt(section, "estimate_position_interpolation_number");
   if (estimate_position_ur_flag != kNotUse) {
@@ -299,20 +287,21 @@ GnssSatellites* InitGnssSatellites(std::string file_name) {
     }
   }
 
-  std::vector<std::vector<std::string>> estimate_clock_file;
+  std::vector<GnssProductFile> estimate_clock_file;
   UltraRapidMode estimate_clock_ur_flag = estimate_position_ur_flag;
   std::string estimate_clock_file_extension = ini_file.ReadString(section, "estimate_clock_file_extension");
   if (estimate_clock_file_extension == ".sp3") {
     get_sp3_file_contents(directory_path, ini_file.ReadString(section, "estimate_clock_file_sort"),
                           ini_file.ReadString(section, "estimate_clock_first"), ini_file.ReadString(section, "estimate_clock_last"),
-                          estimate_clock_file, estimate_clock_ur_flag);
+                          cache_directory, estimate_clock_file, estimate_clock_ur_flag);
   } else {
     get_clk_file_contents(directory_path, estimate_clock_file_extension, ini_file.ReadString(section, "estimate_clock_file_sort"),
                           ini_file.ReadString(section, "estimate_clock_first"), ini_file.ReadString(section, "estimate_clock_last"),
-                          estimate_clock_file);
+                          cache_directory, estimate_clock_file);
   }
   int estimate_clock_interpolation_number = ini_file.ReadInt(section, "estimate_clock_interpolation_number");
 
+  std::shared_ptr<GnssSatellites> gnss_satellites = std::make_shared<GnssSatellites>(true);
   gnss_satellites->Init(true_position_file, true_position_interpolation_method, true_position_interpolation_number, true_position_ur_flag,
 
                         true_clock_file, true_clock_file_extension, true_clock_interpolation_number, true_clock_ur_flag,
@@ -324,3 +313,43 @@ GnssSatellites* InitGnssSatellites(std::string file_name) {
 
   return gnss_satellites;
 }
+
+GnssSatellites* InitGnssSatellites(std::string file_name) {
+  IniAccess ini_file(file_name);
+  const char* section = "GNSS_SATELLIES";
+  const bool is_calc_enabled = ini_file.ReadEnable(section, "calculation");
+  if (!is_calc_enabled) {
+    return new GnssSatellites(is_calc_enabled);
+  }
+
+  // The tables are made once in a process for the same setting, and the copies of the prototype share them
+  const char* const setting_keys[] = {"directory_path",
+                                      "parsed_file_cache_directory",
+                                      "true_position_file_sort",
+                                      "true_position_first",
+                                      "true_position_last",
+                                      "true_position_interpolation_method",
+                                      "true_position_interpolation_number",
+                                      "true_clock_file_extension",
+                                      "true_clock_file_sort",
+                                      "true_clock_first",
+                                      "true_clock_last",
+                                      "true_clock_interpolation_number",
+                                      "estimate_position_file_sort",
+                                      "estimate_position_first",
+                                      "estimate_position_last",
+                                      "estimate_position_interpolation_method",
+                                      "estimate_position_interpolation_number",
+                                      "estimate_ur_observe_or_predict",
+                                      "estimate_clock_file_extension",
+                                      "estimate_clock_file_sort",
+                                      "estimate_clock_first",
+                                      "estimate_clock_last",
+                                      "estimate_clock_interpolation_number"};
+  std::string key;
+  for (const char* setting_key : setting_keys) key += ini_file.ReadString(section, setting_key) + "#";
+
+  std::shared_ptr<const GnssSatellites> prototype =
+      SharedDataStore<GnssSatellites>::GetOrLoad(key, [&ini_file, section]() { return MakeGnssSatellites(ini_file, section); });
+  return new GnssSatellites(*prototype);
+}
@@ -192,6 +192,44 @@ void SimulationTime::PrintStartDateTime(void) const {
   cout << " " << start_year_ << "/" << start_month_ << "/" << start_day_ << " " << h.str() << ":" << m.str() << ":" << s.str() << "\n";
 }
 
+void SimulationTime::SaveSnapshot(Snapshot& snapshot) const {
+  snapshot.Write(elapsed_time_sec_);
+  snapshot.Write(current_jd_);
+  snapshot.Write(current_sidereal_);
+  snapshot.Write(current_decyear_);
+  snapshot.Write(current_utc_);
+  snapshot.Write(attitude_update_counter_);
+  snapshot.Write(attitude_update_flag_);
+  snapshot.Write(orbit_update_counter_);
+  snapshot.Write(orbit_update_flag_);
+  snapshot.Write(thermal_update_counter_);
+  snapshot.Write(thermal_update_flag_);
+  snapshot.Write(component_update_counter_);
+  snapshot.Write(component_update_flag_);
+  snapshot.Write(log_counter_);
+  snapshot.Write(display_counter_);
+  snapshot.Write(state_);
+}
+
+void SimulationTime::RestoreSnapshot(Snapshot& snapshot) {
+  snapshot.Read(elapsed_time_sec_);
+  snapshot.Read(current_jd_);
+  snapshot.Read(current_sidereal_);
+  snapshot.Read(current_decyear_);
+  snapshot.Read(current_utc_);
+  snapshot.Read(attitude_update_counter_);
+  snapshot.Read(attitude_update_flag_);
+  snapshot.Read(orbit_update_counter_);
+  snapshot.Read(orbit_update_flag_);
+  snapshot.Read(thermal_update_counter_);
+  snapshot.Read(thermal_update_flag_);
+  snapshot.Read(component_update_counter_);
+  snapshot.Read(component_update_flag_);
+  snapshot.Read(log_counter_);
+  snapshot.Read(display_counter_);
+  snapshot.Read(state_);
+}
+
 string SimulationTime::GetLogHeader() const {
   string str_tmp = "";
 
@@ -201,18 +239,16 @@ string SimulationTime::GetLogHeader() const {
   return str_tmp;
 }
 
-string SimulationTime::GetLogValue() const {
-  string str_tmp = "";
+string SimulationTime::GetLogValue() const { return FormatLogValue(); }
 
-  str_tmp += WriteScalar(elapsed_time_sec_);
+void SimulationTime::AppendLogValue(LogRecord& record) const {
+  record.AddScalar(elapsed_time_sec_);
 
   const char kSize = 100;
   char ymdhms[kSize];
   snprintf(ymdhms, kSize, "%4d/%02d/%02d %02d:%02d:%.3lf,", current_utc_.year, current_utc_.month, current_utc_.day, current_utc_.hour,
            current_utc_.minute, current_utc_.second);
-  str_tmp += ymdhms;
-
-  return str_tmp;
+  record.AddText(ymdhms);
 }
 
 void SimulationTime::InitializeState() {
@@ -18,6 +18,7 @@
 #include "library/external/sgp4/sgp4io.h"
 #include "library/external/sgp4/sgp4unit.h"
 #include "library/logger/loggable.hpp"
+#include "library/utilities/snapshot.hpp"
 
 /**
  *@struct TimeState
@@ -245,6 +246,11 @@ class SimulationTime : public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(LogRecord& record) const;
 
   /**
    * @fn PrintStartDateTime
@@ -252,6 +258,17 @@ class SimulationTime : public ILoggable {
    */
   void PrintStartDateTime(void) const;
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the current time and the update counters into the snapshot
+   */
+  void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the current time and the update counters from the snapshot
+   */
+  void RestoreSnapshot(Snapshot& snapshot);
+
  private:
   // Variables
   double elapsed_time_sec_;  //!< Elapsed time from start of simulation [sec]
@@ -0,0 +1,302 @@
+/**
+ * @file test_gnss_product_file.cpp
+ * @brief Test codes for the GNSS product file parser and its binary cache with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <library/math/constants.hpp>
+#include <string>
+#include <vector>
+
+#include "gnss_product_file.hpp"
+#include "gnss_satellites.hpp"
+
+/**
+ * @brief SP3 file with two epochs of two GPS satellites and a Galileo satellite
+ */
+static const char kSp3Contents[] =
+    "#cP2023  1  1  0  0  0.00000000       2 ORBIT IGS20 HLM  IGS\n"
+    "## 2243      0.00000000   900.00000000 59945 0.0000000000000\n"
+    "+    3   G01G02E05  0  0  0  0  0  0  0  0  0  0  0  0  0  0\n"
+    "/* test fixture\n"
+    "*  2023  1  1  0  0  0.00000000\n"
+    "PG01  -1000.000001  20000.000002  15000.000003    100.000004\n"
+    "PG02  12000.500000 -14000.250000  18000.125000   -200.500000\n"
+    "PE05  25000.000000   1000.000000  -9000.000000     10.000000\n"
+    "*  2023  1  1  0 15  0.00000000\n"
+    "PG01  -1100.000001  20100.000002  14900.000003    100.100004\n"
+    "PG02  12100.500000 -14100.250000  17900.125000   -200.600000\n"
+    "EOF\n"
+    "*  2023  1  1  0 30  0.00000000\n"
+    "PG01  -1200.000001  20200.000002  14800.000003    100.200004\n";
+
+/**
+ * @brief CLK file with three epochs. The station records ("AR") and unknown satellites are skipped.
+ */
+static const char kClockContents[] =
+    "     3.00           C                                       RINEX VERSION / TYPE\n"
+    "                                                            END OF HEADER\n"
+    "AS G01  2023 01 01 00 00  0.000000  1    1.000000000000E-04\n"
+    "AS E05  2023 01 01 00 00  0.000000  1   -2.500000000000E-05\n"
+    "AR ABMF 2023 01 01 00 00  0.000000  1    3.000000000000E-06\n"
+    "AS X99  2023 01 01 00 00  0.000000  1    9.000000000000E-04\n"
+    "AS G01  2023 01 01 00 00 30.000000  2    1.000000100000E-04  1.0E-12\n"
+    "AS G01  2023 01 01 00 01  0.000000  1    1.000000200000E-04\n";
+
+/**
+ * @brief Write the contents into the file
+ */
+static void WriteFile(const std::string& file_path, const std::string& contents) {
+  std::ofstream file(file_path, std::ios::out | std::ios::binary | std::ios::trunc);
+  file.write(contents.data(), contents.size());
+}
+
+/**
+ * @brief Read all bytes of the file
+ */
+static std::string ReadFile(const std::string& file_path) {
+  std::ifstream file(file_path, std::ios::in | std::ios::binary);
+  return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+/**
+ * @brief Compare all fields of the parsed results
+ */
+static void ExpectSameProductFile(const GnssProductFile& expected, const GnssProductFile& actual) {
+  EXPECT_EQ(expected.format, actual.format);
+  EXPECT_EQ(expected.time_interval_s, actual.time_interval_s);
+  EXPECT_EQ(expected.number_of_epochs, actual.number_of_epochs);
+  EXPECT_EQ(expected.number_of_satellites, actual.number_of_satellites);
+  ASSERT_EQ(expected.epochs.size(), actual.epochs.size());
+  for (size_t i = 0; i < expected.epochs.size(); i++) {
+    EXPECT_EQ(expected.epochs[i].unix_time, actual.epochs[i].unix_time);
+    EXPECT_EQ(expected.epochs[i].greenwich_sidereal_time_rad, actual.epochs[i].greenwich_sidereal_time_rad);
+    EXPECT_EQ(expected.epochs[i].record_begin, actual.epochs[i].record_begin);
+    EXPECT_EQ(expected.epochs[i].record_end, actual.epochs[i].record_end);
+  }
+  ASSERT_EQ(expected.records.size(), actual.records.size());
+  for (size_t i = 0; i < expected.records.size(); i++) {
+    EXPECT_EQ(expected.records[i].gnss_satellite_id, actual.records[i].gnss_satellite_id);
+    for (size_t j = 0; j < 3; j++) EXPECT_EQ(expected.records[i].position_km[j], actual.records[i].position_km[j]);
+    EXPECT_EQ(expected.records[i].clock, actual.records[i].clock);
+  }
+}
+
+/**
+ * @brief Test for parsing the SP3 file
+ */
+TEST(GnssProductFile, ParseSp3) {
+  const std::string file_path = "test_gnss_product_file.sp3";
+  WriteFile(file_path, kSp3Contents);
+
+  GnssProductFile product_file;
+  ASSERT_TRUE(ReadGnssProductFile(file_path, GnssProductFileFormat::kSp3, "", product_file));
+  std::remove(file_path.c_str());
+
+  EXPECT_EQ(GnssProductFileFormat::kSp3, product_file.format);
+  EXPECT_EQ(2, product_file.number_of_epochs);
+  EXPECT_DOUBLE_EQ(900.0, product_file.time_interval_s);
+  EXPECT_EQ(3, product_file.number_of_satellites);
+
+  // The records after EOF are not read
+  ASSERT_EQ(2u, product_file.epochs.size());
+  ASSERT_EQ(5u, product_file.records.size());
+  EXPECT_EQ(0u, product_file.epochs[0].record_begin);
+  EXPECT_EQ(3u, product_file.epochs[0].record_end);
+  EXPECT_EQ(3u, product_file.epochs[1].record_begin);
+  EXPECT_EQ(5u, product_file.epochs[1].record_end);
+  EXPECT_DOUBLE_EQ(900.0, product_file.epochs[1].unix_time - product_file.epochs[0].unix_time);
+  // Greenwich sidereal time at 2023/01/01 00:00 UT is about 100.4 deg, and it advances about 3.76 deg in 15 min
+  EXPECT_NEAR(100.4 * libra::deg_to_rad, product_file.epochs[0].greenwich_sidereal_time_rad, 0.1 * libra::deg_to_rad);
+  EXPECT_NEAR(3.76 * libra::deg_to_rad, product_file.epochs[1].greenwich_sidereal_time_rad - product_file.epochs[0].greenwich_sidereal_time_rad,
+              0.01 * libra::deg_to_rad);
+
+  const GnssSat_coordinate coordinate;
+  EXPECT_EQ(coordinate.GetIndexFromID("G01"), product_file.records[0].gnss_satellite_id);
+  EXPECT_EQ(coordinate.GetIndexFromID("G02"), product_file.records[1].gnss_satellite_id);
+  EXPECT_EQ(coordinate.GetIndexFromID("E05"), product_file.records[2].gnss_satellite_id);
+  EXPECT_EQ(coordinate.GetIndexFromID("G01"), product_file.records[3].gnss_satellite_id);
+  EXPECT_DOUBLE_EQ(-1000.000001, product_file.records[0].position_km[0]);
+  EXPECT_DOUBLE_EQ(20000.000002, product_file.records[0].position_km[1]);
+  EXPECT_DOUBLE_EQ(15000.000003, product_file.records[0].position_km[2]);
+  EXPECT_DOUBLE_EQ(100.000004, product_file.records[0].clock);
+  EXPECT_DOUBLE_EQ(-14100.25, product_file.records[4].position_km[1]);
+  EXPECT_DOUBLE_EQ(-200.6, product_file.records[4].clock);
+}
+
+/**
+ * @brief Test for parsing the CLK file
+ */
+TEST(GnssProductFile, ParseClock) {
+  const std::string file_path = "test_gnss_product_file.clk";
+  WriteFile(file_path, kClockContents);
+
+  GnssProductFile product_file;
+  ASSERT_TRUE(ReadGnssProductFile(file_path, GnssProductFileFormat::kClock, "", product_file));
+  std::remove(file_path.c_str());
+
+  EXPECT_EQ(GnssProductFileFormat::kClock, product_file.format);
+  ASSERT_EQ(3u, product_file.epochs.size());
+  ASSERT_EQ(4u, product_file.records.size());
+  EXPECT_EQ(0u, product_file.epochs[0].record_begin);
+  EXPECT_EQ(2u, product_file.epochs[0].record_end);
+  EXPECT_EQ(2u, product_file.epochs[1].record_begin);
+  EXPECT_EQ(3u, product_file.epochs[1].record_end);
+  EXPECT_EQ(3u, product_file.epochs[2].record_begin);
+  EXPECT_EQ(4u, product_file.epochs[2].record_end);
+  EXPECT_DOUBLE_EQ(30.0, product_file.epochs[1].unix_time - product_file.epochs[0].unix_time);
+  EXPECT_DOUBLE_EQ(60.0, product_file.epochs[2].unix_time - product_file.epochs[0].unix_time);
+
+  const GnssSat_coordinate coordinate;
+  EXPECT_EQ(coordinate.GetIndexFromID("G01"), product_file.records[0].gnss_satellite_id);
+  EXPECT_EQ(coordinate.GetIndexFromID("E05"), product_file.records[1].gnss_satellite_id);
+  EXPECT_DOUBLE_EQ(1.0e-4, product_file.records[0].clock);
+  EXPECT_DOUBLE_EQ(-2.5e-5, product_file.records[1].clock);
+  EXPECT_DOUBLE_EQ(1.0000001e-4, product_file.records[2].clock);
+  EXPECT_DOUBLE_EQ(1.0000002e-4, product_file.records[3].clock);
+  EXPECT_DOUBLE_EQ(0.0, product_file.records[3].position_km[0]);
+}
+
+/**
+ * @brief Test for the missing file
+ */
+TEST(GnssProductFile, MissingFile) {
+  GnssProductFile product_file;
+  EXPECT_FALSE(ReadGnssProductFile("test_gnss_product_file_missing.sp3", GnssProductFileFormat::kSp3, "./", product_file));
+  std::vector<GnssProductFile> product_files;
+  EXPECT_EQ(0u, ReadGnssProductFiles({"test_gnss_product_file_missing.sp3"}, GnssProductFileFormat::kSp3, "", product_files));
+}
+
+/**
+ * @brief Test for the cache round trip, and the cache used instead of parsing the file
+ */
+TEST(GnssProductFile, CacheRoundTrip) {
+  const std::string file_path = "test_gnss_product_file_round_trip.sp3";
+  const std::string cache_file_path = file_path + ".cache";
+  WriteFile(file_path, kSp3Contents);
+  std::remove(cache_file_path.c_str());
+
+  GnssProductFile parsed;
+  ASSERT_TRUE(ReadGnssProductFile(file_path, GnssProductFileFormat::kSp3, "", parsed));
+  GnssProductFile written;
+  ASSERT_TRUE(ReadGnssProductFile(file_path, GnssProductFileFormat::kSp3, "./", written));
+  ExpectSameProductFile(parsed, written);
+  const std::string cache = ReadFile(cache_file_path);
+  ASSERT_FALSE(cache.empty());
+
+  GnssProductFile cached;
+  ASSERT_TRUE(ReadGnssProductFile(file_path, GnssProductFileFormat::kSp3, "./", cached));
+  ExpectSameProductFile(parsed, cached);
+
+  // The cache of the other format is not used
+  GnssProductFile clock;
+  ASSERT_TRUE(ReadGnssProductFile(file_path, GnssProductFileFormat::kClock, "./", clock));
+  EXPECT_TRUE(clock.records.empty());
+  ASSERT_TRUE(ReadGnssProductFile(file_path, GnssProductFileFormat::kSp3, "./", cached));
+  ExpectSameProductFile(parsed, cached);
+
+  // The clock of the last record is stored at the end of the cache. The modified value is read, so the file is not parsed again.
+  std::string modified_cache = ReadFile(cache_file_path);
+  const double modified_clock = 123.0;
+  modified_cache.replace(modified_cache.size() - sizeof(double), sizeof(double), (const char*)&modified_clock, sizeof(double));
+  WriteFile(cache_file_path, modified_cache);
+  ASSERT_TRUE(ReadGnssProductFile(file_path, GnssProductFileFormat::kSp3, "./", cached));
+  EXPECT_DOUBLE_EQ(modified_clock, cached.records.back().clock);
+
+  std::remove(file_path.c_str());
+  std::remove(cache_file_path.c_str());
+}
+
+/**
+ * @brief Test for the cache invalidated by the change of the product file
+ */
+TEST(GnssProductFile, CacheInvalidation) {
+  const std::string file_path = "test_gnss_product_file_invalidation.clk";
+  const std::string cache_file_path = file_path + ".cache";
+  WriteFile(file_path, kClockContents);
+  std::remove(cache_file_path.c_str());
+
+  GnssProductFile product_file;
+  ASSERT_TRUE(ReadGnssProductFile(file_path, GnssProductFileFormat::kClock, "./", product_file));
+  EXPECT_DOUBLE_EQ(1.0e-4, product_file.records[0].clock);
+
+  // The same size of the file with a different value
+  std::string modified_contents = kClockContents;
+  const size_t position = modified_contents.find("1.000000000000E-04");
+  ASSERT_NE(std::string::npos, position);
+  modified_contents.replace(position, 1, "7");
+  WriteFile(file_path, modified_contents);
+  ASSERT_TRUE(ReadGnssProductFile(file_path, GnssProductFileFormat::kClock, "./", product_file));
+  EXPECT_DOUBLE_EQ(7.0e-4, product_file.records[0].clock);
+
+  // An appended record
+  modified_contents += "AS E05  2023 01 01 00 01  0.000000  1    4.000000000000E-05\n";
+  WriteFile(file_path, modified_contents);
+  ASSERT_TRUE(ReadGnssProductFile(file_path, GnssProductFileFormat::kClock, "./", product_file));
+  ASSERT_EQ(5u, product_file.records.size());
+  EXPECT_DOUBLE_EQ(4.0e-5, product_file.records[4].clock);
+  EXPECT_EQ(5u, product_file.epochs.back().record_end);
+
+  // The cache is updated for the modified file
+  GnssProductFile parsed;
+  ASSERT_TRUE(ReadGnssProductFile(file_path, GnssProductFileFormat::kClock, "", parsed));
+  ASSERT_TRUE(ReadGnssProductFile(file_path, GnssProductFileFormat::kClock, "./", product_file));
+  ExpectSameProductFile(parsed, product_file);
+
+  std::remove(file_path.c_str());
+  std::remove(cache_file_path.c_str());
+}
+
+/**
+ * @brief Test for the rejection of the truncated and corrupted cache files
+ */
+TEST(GnssProductFile, CorruptedCache) {
+  const std::string file_path = "test_gnss_product_file_corrupted.sp3";
+  const std::string cache_file_path = file_path + ".cache";
+  WriteFile(file_path, kSp3Contents);
+  std::remove(cache_file_path.c_str());
+
+  GnssProductFile parsed;
+  ASSERT_TRUE(ReadGnssProductFile(file_path, GnssProductFileFormat::kSp3, "./", parsed));
+  const std::string valid_cache = ReadFile(cache_file_path);
+  ASSERT_FALSE(valid_cache.empty());
+
+  std::vector<std::string> corrupted_caches;
+  // Truncated in the header, the epochs, and the records
+  corrupted_caches.push_back(valid_cache.substr(0, 20));
+  corrupted_caches.push_back(valid_cache.substr(0, valid_cache.size() - sizeof(GnssProductRecord) * parsed.records.size() - 8));
+  corrupted_caches.push_back(valid_cache.substr(0, valid_cache.size() - 1));
+  corrupted_caches.push_back("");
+  // Broken magic
+  std::string broken_magic = valid_cache;
+  broken_magic[0] = 'X';
+  corrupted_caches.push_back(broken_magic);
+  // Broken record range of the first epoch (record_end is stored after the unix time, the sidereal time, and record_begin)
+  const size_t records_size_byte = sizeof(GnssProductRecord) * parsed.records.size();
+  const size_t epoch_offset = valid_cache.size() - records_size_byte - sizeof(GnssProductEpoch) * parsed.epochs.size();
+  std::string broken_epoch = valid_cache;
+  const uint64_t broken_record_end = 1000;
+  broken_epoch.replace(epoch_offset + 3 * 8, 8, (const char*)&broken_record_end, 8);
+  corrupted_caches.push_back(broken_epoch);
+  // Broken number of records
+  std::string broken_count = valid_cache;
+  const uint64_t broken_number_of_records = 0xFFFFFFFFFFFFULL;
+  broken_count.replace(epoch_offset - 8, 8, (const char*)&broken_number_of_records, 8);
+  corrupted_caches.push_back(broken_count);
+
+  for (size_t i = 0; i < corrupted_caches.size(); i++) {
+    SCOPED_TRACE("Corrupted cache " + std::to_string(i));
+    WriteFile(cache_file_path, corrupted_caches[i]);
+    GnssProductFile product_file;
+    ASSERT_TRUE(ReadGnssProductFile(file_path, GnssProductFileFormat::kSp3, "./", product_file));
+    ExpectSameProductFile(parsed, product_file);
+    // The corrupted cache is replaced
+    EXPECT_EQ(valid_cache, ReadFile(cache_file_path));
+  }
+
+  std::remove(file_path.c_str());
+  std::remove(cache_file_path.c_str());
+}
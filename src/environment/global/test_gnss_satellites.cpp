@@ -0,0 +1,258 @@
+/**
+ * @file test_gnss_satellites.cpp
+ * @brief Test codes for GnssSat_position and GnssSat_clock classes with GoogleTest
+ * @note The Chebyshev segments are compared with the former interpolation, which used the window around the nearest data point at each update.
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <library/math/constants.hpp>
+#include <vector>
+
+#include "gnss_satellites.hpp"
+#include "physical_constants.hpp"
+
+static const double kStartUnixTime = 1672531200.0;  //!< 2023/01/01 00:00:00 UTC
+static const double kEarthRotation_rad_s = 7.2921159e-5;
+
+/**
+ * @brief Position of the test satellite in the ECEF frame [km]
+ */
+static void CalcTestPosition_km(const int gnss_satellite_id, const double unix_time, double position_km[3]) {
+  // Circular orbit with the period of a half sidereal day, seen from the rotating Earth
+  const double elapsed_time_s = unix_time - kStartUnixTime;
+  const double argument_rad = libra::tau * elapsed_time_s / 43082.0 + gnss_satellite_id;
+  const double inclination_rad = 55.0 * libra::deg_to_rad;
+  const double radius_km = 26560.0;
+  const double x_km = radius_km * cos(argument_rad);
+  const double y_km = radius_km * sin(argument_rad) * cos(inclination_rad);
+  const double z_km = radius_km * sin(argument_rad) * sin(inclination_rad);
+  const double earth_rotation_rad = kEarthRotation_rad_s * elapsed_time_s;
+  position_km[0] = cos(earth_rotation_rad) * x_km + sin(earth_rotation_rad) * y_km;
+  position_km[1] = -sin(earth_rotation_rad) * x_km + cos(earth_rotation_rad) * y_km;
+  position_km[2] = z_km;
+}
+
+/**
+ * @brief Clock bias of the test satellite [us]
+ */
+static double CalcTestClock_us(const int gnss_satellite_id, const double unix_time) {
+  const double elapsed_time_s = unix_time - kStartUnixTime;
+  return 100.0 * (gnss_satellite_id + 1) + 1.0e-4 * elapsed_time_s + 0.01 * sin(elapsed_time_s / 5000.0);
+}
+
+/**
+ * @brief Make a product file with the test satellites
+ * @param [in] format: Format of the file
+ * @param [in] time_interval_s: Epoch interval [s]
+ * @param [in] number_of_epochs: Number of epochs
+ * @param [in] number_of_satellites: Number of GPS satellites from G01
+ */
+static GnssProductFile MakeTestFile(const GnssProductFileFormat format, const double time_interval_s, const int number_of_epochs,
+                                    const int number_of_satellites) {
+  GnssProductFile file;
+  file.format = format;
+  file.time_interval_s = time_interval_s;
+  file.number_of_epochs = number_of_epochs;
+  file.number_of_satellites = number_of_satellites;
+  for (int epoch_index = 0; epoch_index < number_of_epochs; epoch_index++) {
+    GnssProductEpoch epoch;
+    epoch.unix_time = kStartUnixTime + epoch_index * time_interval_s;
+    epoch.greenwich_sidereal_time_rad = 1.0 + kEarthRotation_rad_s * epoch_index * time_interval_s;
+    epoch.record_begin = file.records.size();
+    for (int gnss_satellite_id = 0; gnss_satellite_id < number_of_satellites; gnss_satellite_id++) {
+      GnssProductRecord record;
+      record.gnss_satellite_id = gnss_satellite_id;
+      record.reserved = 0;
+      CalcTestPosition_km(gnss_satellite_id, epoch.unix_time, record.position_km);
+      // The clock of CLK files is written in [s]
+      record.clock = CalcTestClock_us(gnss_satellite_id, epoch.unix_time);
+      if (format == GnssProductFileFormat::kClock) record.clock *= 1.0e-6;
+      file.records.push_back(record);
+    }
+    epoch.record_end = file.records.size();
+    file.epochs.push_back(epoch);
+  }
+  return file;
+}
+
+/**
+ * @brief Former interpolation with the window around the nearest data point
+ * @param [in] data_times: Time of the data points
+ * @param [in] data_values: Values at the data points
+ * @param [in] interpolation_number: Number of the data points in the window
+ * @param [in] unix_time: Time to interpolate
+ * @param [in] is_trigonometric: Use trigonometric interpolation when true, and Lagrange interpolation when false
+ * @param [in] nearest_index: Index of the nearest data point
+ */
+static double CalcReferenceInterpolation(const std::vector<double>& data_times, const std::vector<double>& data_values,
+                                         const int interpolation_number, const double unix_time, const bool is_trigonometric,
+                                         const int nearest_index) {
+  const int first_index = nearest_index - interpolation_number / 2;
+  const double w = libra::tau / (24.0 * 60.0 * 60.0) * 1.03;
+  double result = 0.0;
+  for (int i = first_index; i < first_index + interpolation_number; i++) {
+    double basis = 1.0;
+    for (int j = first_index; j < first_index + interpolation_number; j++) {
+      if (i == j) continue;
+      if (is_trigonometric) {
+        basis *= sin(w * (unix_time - data_times[j]) / 2.0) / sin(w * (data_times[i] - data_times[j]) / 2.0);
+      } else {
+        basis *= (unix_time - data_times[j]) / (data_times[i] - data_times[j]);
+      }
+    }
+    result += basis * data_values[i];
+  }
+  return result;
+}
+
+/**
+ * @brief Test times of a data point: the data point, inside of the segment, and the boundaries of the segment
+ */
+static std::vector<double> MakeTestTimes(const double data_time, const double time_interval_s) {
+  return {data_time, data_time + 0.13 * time_interval_s, data_time - 0.37 * time_interval_s, data_time + 0.5 * time_interval_s,
+          data_time - 0.5 * time_interval_s};
+}
+
+/**
+ * @brief Test for the positions compared with the former trigonometric interpolation
+ */
+TEST(GnssSatellites, Position) {
+  const double time_interval_s = 900.0;
+  const int number_of_epochs = 24;
+  const int interpolation_number = 9;
+  const std::vector<GnssProductFile> files = {MakeTestFile(GnssProductFileFormat::kSp3, time_interval_s, number_of_epochs, 2)};
+  GnssSat_position position;
+  position.Init(files, 0, interpolation_number, kNotUse);
+  position.SetUp(kStartUnixTime, 1.0);
+
+  for (int gnss_satellite_id = 0; gnss_satellite_id < 2; gnss_satellite_id++) {
+    std::vector<double> data_times;
+    std::vector<std::vector<double>> data_values(6);
+    for (const GnssProductEpoch& epoch : files[0].epochs) {
+      const GnssProductRecord& record = files[0].records[epoch.record_begin + gnss_satellite_id];
+      const double c = cos(epoch.greenwich_sidereal_time_rad), s = sin(epoch.greenwich_sidereal_time_rad);
+      const double x_m = record.position_km[0] * 1000.0, y_m = record.position_km[1] * 1000.0, z_m = record.position_km[2] * 1000.0;
+      const double values[6] = {x_m, y_m, z_m, c * x_m - s * y_m, s * x_m + c * y_m, z_m};
+      data_times.push_back(epoch.unix_time);
+      for (size_t component = 0; component < 6; component++) data_values[component].push_back(values[component]);
+    }
+
+    auto is_window_valid = [&](const int index) {
+      return index >= interpolation_number / 2 && index + (interpolation_number + 1) / 2 - 1 < number_of_epochs;
+    };
+    for (int index = 0; index < number_of_epochs; index++) {
+      for (const double unix_time : MakeTestTimes(data_times[index], time_interval_s)) {
+        position.Update(unix_time);
+        // The boundary of the segments belongs to either of the neighboring data points
+        std::vector<int> nearest_indices = {index};
+        const double boundary_direction = (unix_time - data_times[index]) / (0.5 * time_interval_s);
+        if (fabs(fabs(boundary_direction) - 1.0) < 1.0e-9) {
+          const int neighbor_index = index + (boundary_direction > 0.0 ? 1 : -1);
+          if (is_window_valid(neighbor_index)) nearest_indices.push_back(neighbor_index);
+        } else {
+          EXPECT_EQ(is_window_valid(index), position.GetWhetherValid(gnss_satellite_id)) << index;
+        }
+        if (!position.GetWhetherValid(gnss_satellite_id)) continue;
+
+        const libra::Vector<3> ecef_m = position.GetSatEcef(gnss_satellite_id);
+        const libra::Vector<3> eci_m = position.GetSatEci(gnss_satellite_id);
+        for (size_t i = 0; i < 3; i++) {
+          double ecef_error_m = INFINITY, eci_error_m = INFINITY;
+          for (const int nearest_index : nearest_indices) {
+            if (!is_window_valid(nearest_index)) continue;
+            const double reference_ecef_m =
+                CalcReferenceInterpolation(data_times, data_values[i], interpolation_number, unix_time, true, nearest_index);
+            const double reference_eci_m =
+                CalcReferenceInterpolation(data_times, data_values[3 + i], interpolation_number, unix_time, true, nearest_index);
+            ecef_error_m = std::min(ecef_error_m, fabs(reference_ecef_m - ecef_m[i]));
+            eci_error_m = std::min(eci_error_m, fabs(reference_eci_m - eci_m[i]));
+          }
+          EXPECT_LT(ecef_error_m, 1.0e-3);
+          EXPECT_LT(eci_error_m, 1.0e-3);
+          // The data point itself is returned at the data point
+          if (unix_time == data_times[index]) {
+            EXPECT_DOUBLE_EQ(data_values[i][index], ecef_m[i]);
+          }
+        }
+      }
+    }
+  }
+  // Satellite without data
+  position.Update(kStartUnixTime + 12 * time_interval_s);
+  EXPECT_FALSE(position.GetWhetherValid(5));
+}
+
+/**
+ * @brief Compare the clocks with the former Lagrange interpolation
+ * @param [in] files: Clock files
+ * @param [in] file_extension: Extension of the clock file
+ * @param [in] interpolation_number: Interpolation number
+ */
+static void CompareClocks(const std::vector<GnssProductFile>& files, const std::string file_extension, const int interpolation_number) {
+  const GnssProductFile& file = files[0];
+  const int number_of_epochs = (int)file.epochs.size();
+  const double time_interval_s = file.epochs[1].unix_time - file.epochs[0].unix_time;
+  GnssSat_clock clock;
+  clock.Init(files, file_extension, interpolation_number, kNotUse, std::make_pair(file.epochs.front().unix_time, file.epochs.back().unix_time));
+  clock.SetUp(kStartUnixTime, 1.0);
+
+  // Unit of the clock: SP3 [us], CLK [s]
+  const double clock_to_m = environment::speed_of_light_m_s * (file.format == GnssProductFileFormat::kSp3 ? 1.0e-6 : 1.0);
+  auto is_window_valid = [&](const int index) {
+    return index >= interpolation_number / 2 && index + (interpolation_number + 1) / 2 - 1 < number_of_epochs;
+  };
+  for (int gnss_satellite_id = 0; gnss_satellite_id < file.number_of_satellites; gnss_satellite_id++) {
+    std::vector<double> data_times, data_clocks_m;
+    for (const GnssProductEpoch& epoch : file.epochs) {
+      data_times.push_back(epoch.unix_time);
+      data_clocks_m.push_back(file.records[epoch.record_begin + gnss_satellite_id].clock * clock_to_m);
+    }
+
+    for (int index = 0; index < number_of_epochs; index++) {
+      for (const double unix_time : MakeTestTimes(data_times[index], time_interval_s)) {
+        if (unix_time > data_times.back() + 0.5 * time_interval_s) continue;
+        clock.Update(unix_time);
+        std::vector<int> nearest_indices = {index};
+        const double boundary_direction = (unix_time - data_times[index]) / (0.5 * time_interval_s);
+        if (fabs(fabs(boundary_direction) - 1.0) < 1.0e-9) {
+          const int neighbor_index = index + (boundary_direction > 0.0 ? 1 : -1);
+          if (is_window_valid(neighbor_index)) nearest_indices.push_back(neighbor_index);
+        } else {
+          EXPECT_EQ(is_window_valid(index), clock.GetWhetherValid(gnss_satellite_id)) << index;
+        }
+        if (!clock.GetWhetherValid(gnss_satellite_id)) continue;
+
+        double error_m = INFINITY;
+        for (const int nearest_index : nearest_indices) {
+          if (!is_window_valid(nearest_index)) continue;
+          const double reference_m = CalcReferenceInterpolation(data_times, data_clocks_m, interpolation_number, unix_time, false, nearest_index);
+          error_m = std::min(error_m, fabs(reference_m - clock.GetSatClock(gnss_satellite_id)));
+        }
+        // The Chebyshev expansion reproduces the Lagrange interpolation
+        EXPECT_LT(error_m, 1.0e-6);
+        if (unix_time == data_times[index]) {
+          EXPECT_DOUBLE_EQ(data_clocks_m[index], clock.GetSatClock(gnss_satellite_id));
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Test for the clocks in the SP3 file compared with the former Lagrange interpolation
+ */
+TEST(GnssSatellites, Sp3Clock) {
+  const std::vector<GnssProductFile> files = {MakeTestFile(GnssProductFileFormat::kSp3, 900.0, 24, 2)};
+  CompareClocks(files, ".sp3", 3);
+  CompareClocks(files, ".sp3", 4);
+}
+
+/**
+ * @brief Test for the clocks in the CLK file compared with the former Lagrange interpolation
+ */
+TEST(GnssSatellites, Clk30sClock) {
+  const std::vector<GnssProductFile> files = {MakeTestFile(GnssProductFileFormat::kClock, 30.0, 40, 3)};
+  CompareClocks(files, ".clk30s", 5);
+}
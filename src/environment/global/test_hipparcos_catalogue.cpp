@@ -0,0 +1,115 @@
+/**
+ * @file test_hipparcos_catalogue.cpp
+ * @brief Test codes for the order of the stars in HipparcosCatalogue class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "hipparcos_catalogue.hpp"
+
+/**
+ * @brief CSV catalogue which is not sorted by the magnitude
+ */
+static const char kCsvContents[] =
+    "hip_num,vmag,ra,de\n"
+    "11,5.0,10.0,20.0\n"
+    "12,1.0,30.0,-40.0\n"
+    "13,7.5,50.0,60.0\n"
+    "14,3.0,70.0,-80.0\n"
+    "15,2.0,90.0,10.0\n"
+    "16,3.0,110.0,-30.0\n";
+
+/**
+ * @brief Write a file
+ */
+static void WriteFile(const std::string& file_path, const std::string& contents) {
+  std::ofstream file(file_path, std::ios::out | std::ios::binary | std::ios::trunc);
+  file << contents;
+}
+
+/**
+ * @brief Read a file
+ */
+static std::string ReadFile(const std::string& file_path) {
+  std::ifstream file(file_path, std::ios::in | std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+/**
+ * @brief Test for the CSV catalogue which is not sorted
+ */
+TEST(HipparcosCatalogue, UnsortedCsv) {
+  const std::string csv_file_path = "test_hipparcos_catalogue_unsorted.csv";
+  WriteFile(csv_file_path, kCsvContents);
+
+  HipparcosCatalogue catalogue(6.0, csv_file_path);
+  ASSERT_TRUE(catalogue.ReadContents(csv_file_path, ','));
+  // The darker star in the middle of the file is skipped, and the stars with the same magnitude keep the order of the file
+  const std::vector<int> expected_ids = {12, 15, 14, 16, 11};
+  ASSERT_EQ(expected_ids.size(), catalogue.GetCatalogueSize());
+  for (size_t rank = 0; rank < expected_ids.size(); rank++) {
+    EXPECT_EQ(expected_ids[rank], catalogue.GetHipparcosId(rank));
+    if (rank > 0) {
+      EXPECT_LE(catalogue.GetVisibleMagnitude(rank - 1), catalogue.GetVisibleMagnitude(rank));
+    }
+  }
+  EXPECT_DOUBLE_EQ(90.0, catalogue.GetRightAscension_deg(1));
+  EXPECT_DOUBLE_EQ(10.0, catalogue.GetDeclination_deg(1));
+
+  // The sky index refers to the sorted ranks
+  libra::Vector<3> axis_i(0.0);
+  axis_i[1] = 1.0;
+  const std::vector<size_t> ranks = catalogue.FindStarsInCone(axis_i, 0.2);
+  ASSERT_EQ(1u, ranks.size());
+  EXPECT_EQ(1u, ranks[0]);
+
+  std::remove(csv_file_path.c_str());
+}
+
+/**
+ * @brief Test for the binary catalogue converted from the CSV catalogue which is not sorted
+ */
+TEST(HipparcosCatalogue, BinaryCatalogue) {
+  const std::string csv_file_path = "test_hipparcos_catalogue_source.csv";
+  const std::string binary_file_path = "test_hipparcos_catalogue.bin";
+  WriteFile(csv_file_path, kCsvContents);
+  HipparcosCatalogue csv_catalogue(100.0, csv_file_path);
+  ASSERT_TRUE(csv_catalogue.ReadContents(csv_file_path, ','));
+  ASSERT_TRUE(csv_catalogue.WriteBinaryCatalogue(binary_file_path));
+
+  // The stars brighter than the maximum magnitude are the prefix of the file
+  HipparcosCatalogue binary_catalogue(3.0, binary_file_path);
+  ASSERT_TRUE(binary_catalogue.ReadContents(binary_file_path, ','));
+  const std::vector<int> expected_ids = {12, 15, 14, 16};
+  ASSERT_EQ(expected_ids.size(), binary_catalogue.GetCatalogueSize());
+  for (size_t rank = 0; rank < expected_ids.size(); rank++) {
+    EXPECT_EQ(expected_ids[rank], binary_catalogue.GetHipparcosId(rank));
+    const libra::Vector<3> expected_direction_i = csv_catalogue.GetStarDirection_i(rank);
+    for (size_t i = 0; i < 3; i++) EXPECT_DOUBLE_EQ(expected_direction_i[i], binary_catalogue.GetStarDirection_i(rank)[i]);
+  }
+
+  // The binary file whose records are not sorted is rejected
+  const std::string unsorted_binary_file_path = "test_hipparcos_catalogue_unsorted.bin";
+  std::string contents = ReadFile(binary_file_path);
+  // The magnitude of the first record follows the header of 32 bytes and the ID with the reserved field
+  const size_t header_size_byte = 32;
+  const size_t magnitude_offset_byte = 8;
+  double magnitude = 0.0;
+  memcpy(&magnitude, &contents[header_size_byte + magnitude_offset_byte], sizeof(double));
+  ASSERT_DOUBLE_EQ(1.0, magnitude);
+  magnitude = 4.0;
+  memcpy(&contents[header_size_byte + magnitude_offset_byte], &magnitude, sizeof(double));
+  WriteFile(unsorted_binary_file_path, contents);
+  HipparcosCatalogue unsorted_catalogue(100.0, unsorted_binary_file_path);
+  EXPECT_FALSE(unsorted_catalogue.ReadContents(unsorted_binary_file_path, ','));
+
+  std::remove(csv_file_path.c_str());
+  std::remove(binary_file_path.c_str());
+  std::remove(unsorted_binary_file_path.c_str());
+}
@@ -5,6 +5,10 @@
 
 #include "atmosphere.hpp"
 
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
 #include "library/atmosphere/harris_priester_model.hpp"
 #include "library/atmosphere/simple_air_density_model.hpp"
 #include "library/initialize/initialize_file_access.hpp"
@@ -13,6 +17,7 @@
 #include "library/randomization/global_randomization.hpp"
 #include "library/randomization/normal_randomization.hpp"
 #include "library/randomization/random_walk.hpp"
+#include "library/utilities/shared_data_store.hpp"
 
 Atmosphere::Atmosphere(const std::string model, const std::string space_weather_file_name, const double gauss_standard_deviation_rate,
                        const bool is_manual_param, const double manual_f107, const double manual_f107a, const double manual_ap,
@@ -25,6 +30,7 @@ Atmosphere::Atmosphere(const std::string model, const std::string space_weather_
       manual_ap_(manual_ap),
       gauss_standard_deviation_rate_(gauss_standard_deviation_rate),
       local_celestial_information_(local_celestial_information) {
+  sun_handle_ = local_celestial_information_->GetBodyHandle("SUN");
   if (model_ == "STANDARD") {
     // Standard
     std::cerr << "Air density model : STANDARD" << std::endl;
@@ -34,8 +40,17 @@ Atmosphere::Atmosphere(const std::string model, const std::string space_weather_
     if (!is_manual_param_used_) {
       double decimal_year = simulation_time->GetCurrentDecimalYear();
       double end_time_s = simulation_time->GetEndTime_s();
-      if (GetSpaceWeatherTable_(decimal_year, end_time_s, space_weather_file_name, space_weather_table_)) {
-      } else {
+      // The table is read once in a process and shared by the instances with the same file and simulation period
+      std::ostringstream key;
+      key << std::setprecision(17) << space_weather_file_name << "#" << decimal_year << "#" << end_time_s;
+      space_weather_table_ = SharedDataStore<std::vector<nrlmsise_table>>::GetOrLoad(
+          key.str(), [decimal_year, end_time_s, &space_weather_file_name]() -> std::shared_ptr<const std::vector<nrlmsise_table>> {
+            std::shared_ptr<std::vector<nrlmsise_table>> table = std::make_shared<std::vector<nrlmsise_table>>();
+            if (!GetSpaceWeatherTable_(decimal_year, end_time_s, space_weather_file_name, *table)) return nullptr;
+            return table;
+          });
+      if (space_weather_table_ == nullptr) {
+        space_weather_table_ = std::make_shared<std::vector<nrlmsise_table>>();
         std::cerr << "Space Weather file read error!" << std::endl;
         std::cerr << "Air density is switched to STANDARD model" << std::endl;
         model_ = "STANDARD";
@@ -62,11 +77,16 @@ double Atmosphere::CalcAirDensity_kg_m3(const double decimal_year, const Orbit&
     double lat_rad = orbit.GetGeodeticPosition().GetLatitude_rad();
     double lon_rad = orbit.GetGeodeticPosition().GetLongitude_rad();
     double alt_m = orbit.GetGeodeticPosition().GetAltitude_m();
-    air_density_kg_m3_ = CalcNRLMSISE00(decimal_year, lat_rad, lon_rad, alt_m, space_weather_table_, is_manual_param_used_, manual_daily_f107_,
-                                        manual_average_f107_, manual_ap_);
+    if (is_density_grid_enabled_) {
+      air_density_kg_m3_ = CalcNrlmsise00WithGrid_kg_m3(decimal_year, lat_rad, lon_rad, alt_m);
+    } else {
+      air_density_kg_m3_ = CalcNRLMSISE00(decimal_year, lat_rad, lon_rad, alt_m, *space_weather_table_, is_manual_param_used_, manual_daily_f107_,
+                                          manual_average_f107_, manual_ap_);
+    }
   } else if (model_ == "HARRIS_PRIESTER") {
     // Harris-Priester
-    libra::Vector<3> sun_direction_eci = local_celestial_information_->GetGlobalInformation().GetPositionFromCenter_i_m("SUN").CalcNormalizedVector();
+    libra::Vector<3> sun_direction_eci =
+        local_celestial_information_->GetGlobalInformation().GetPositionFromCenter_i_m(sun_handle_).CalcNormalizedVector();
     air_density_kg_m3_ = libra::atmosphere::CalcAirDensityWithHarrisPriester_kg_m3(orbit.GetGeodeticPosition(), sun_direction_eci);
   } else {
     // No suitable model
@@ -76,6 +96,58 @@ double Atmosphere::CalcAirDensity_kg_m3(const double decimal_year, const Orbit&
   return AddNoise(air_density_kg_m3_);
 }
 
+void Atmosphere::EnableDensityGrid(const double tolerance, const double refresh_period_s) {
+  is_density_grid_enabled_ = true;
+  density_grid_refresh_period_s_ = refresh_period_s;
+  if (density_grid_refresh_period_s_ <= 0.0) {
+    std::cerr << "Refresh period of the density grid must be positive. It is set as 10800 s." << std::endl;
+    density_grid_refresh_period_s_ = 10800.0;
+  }
+  density_grid_epoch_decimal_year_ = -1.0;
+  density_grid_ = libra::atmosphere::AirDensityGrid(tolerance);
+}
+
+double Atmosphere::CalcNrlmsise00WithGrid_kg_m3(const double decimal_year, const double latitude_rad, const double longitude_rad,
+                                                const double altitude_m) {
+  // The decimal year is divided into the refresh periods in the same way as CalcNRLMSISE00 converts it to the date
+  const int year = (int)decimal_year;
+  const double days_per_year = ((year % 4 == 0) && (year % 100 != 0)) || (year % 400 == 0) ? 366.0 : 365.0;
+  const double period_year = density_grid_refresh_period_s_ / 86400.0 / days_per_year;
+  const double epoch_decimal_year = year + (floor((decimal_year - year) / period_year) + 0.5) * period_year;
+
+  // Clear the grid lazily at the first calculation in the new period
+  if (epoch_decimal_year != density_grid_epoch_decimal_year_) ResetDensityGrid(epoch_decimal_year);
+
+  // Local solar time in the same way as CalcNRLMSISE00
+  int date[6];
+  ConvertDecyearToDate(decimal_year, date);
+  const double ut_h = date[3] + date[4] / 60.0 + date[5] / 3600.0;
+  const double local_solar_time_h = ut_h + longitude_rad * libra::rad_to_deg / 15.0;
+  // The cells are validated with the model at the query time, so the error by the fixed epoch of the grid is also checked
+  const auto reference_function = [&](const double query_altitude_m, const double query_latitude_rad, const double query_local_solar_time_h) {
+    const double query_longitude_rad = (query_local_solar_time_h - ut_h) * 15.0 * libra::deg_to_rad;
+    return CalcNRLMSISE00(decimal_year, query_latitude_rad, query_longitude_rad, query_altitude_m, *space_weather_table_, is_manual_param_used_,
+                          manual_daily_f107_, manual_average_f107_, manual_ap_);
+  };
+  return density_grid_.CalcAirDensity_kg_m3(altitude_m, latitude_rad, local_solar_time_h, reference_function);
+}
+
+void Atmosphere::ResetDensityGrid(const double epoch_decimal_year) {
+  density_grid_epoch_decimal_year_ = epoch_decimal_year;
+  int date[6];
+  ConvertDecyearToDate(epoch_decimal_year, date);
+  const double epoch_ut_h = date[3] + date[4] / 60.0 + date[5] / 3600.0;
+  // The captured values are copied so that the copied object does not refer to this object
+  std::shared_ptr<const std::vector<nrlmsise_table>> table = space_weather_table_;
+  const bool is_manual_param_used = is_manual_param_used_;
+  const double manual_daily_f107 = manual_daily_f107_, manual_average_f107 = manual_average_f107_, manual_ap = manual_ap_;
+  density_grid_.Reset([=](const double grid_altitude_m, const double grid_latitude_rad, const double grid_local_solar_time_h) {
+    const double grid_longitude_rad = (grid_local_solar_time_h - epoch_ut_h) * 15.0 * libra::deg_to_rad;
+    return CalcNRLMSISE00(epoch_decimal_year, grid_latitude_rad, grid_longitude_rad, grid_altitude_m, *table, is_manual_param_used,
+                          manual_daily_f107, manual_average_f107, manual_ap);
+  });
+}
+
 double Atmosphere::AddNoise(const double rho_kg_m3) {
   // RandomWalk rw(rho_kg_m3*rw_stepwidth_,rho_kg_m3*rw_stddev_,rho_kg_m3*rw_limit_);
   libra::NormalRand nr(0.0, rho_kg_m3 * gauss_standard_deviation_rate_, global_randomization.MakeSeed());
@@ -84,13 +156,25 @@ double Atmosphere::AddNoise(const double rho_kg_m3) {
   return rho_kg_m3 + nrd;
 }
 
-std::string Atmosphere::GetLogValue() const {
-  std::string str_tmp = "";
-  str_tmp += WriteScalar(air_density_kg_m3_);
+void Atmosphere::SaveSnapshot(Snapshot& snapshot) const {
+  snapshot.Write(air_density_kg_m3_);
+  snapshot.Write(density_grid_epoch_decimal_year_);
+  density_grid_.SaveSnapshot(snapshot);
+}
 
-  return str_tmp;
+void Atmosphere::RestoreSnapshot(Snapshot& snapshot) {
+  snapshot.Read(air_density_kg_m3_);
+  double epoch_decimal_year = density_grid_epoch_decimal_year_;
+  snapshot.Read(epoch_decimal_year);
+  // The validation states depend on the queries, so the grid is reset to the saved epoch and the states are restored
+  if (epoch_decimal_year >= 0.0 && epoch_decimal_year != density_grid_epoch_decimal_year_) ResetDensityGrid(epoch_decimal_year);
+  density_grid_.RestoreSnapshot(snapshot);
 }
 
+std::string Atmosphere::GetLogValue() const { return FormatLogValue(); }
+
+void Atmosphere::AppendLogValue(LogRecord& record) const { record.AddScalar(air_density_kg_m3_); }
+
 std::string Atmosphere::GetLogHeader() const {
   std::string str_tmp = "";
 
@@ -128,6 +212,11 @@ Atmosphere InitAtmosphere(const std::string initialize_file_path, const LocalCel
 
   Atmosphere atmosphere(model, table_path, rho_stddev, is_manual_param_used, manual_daily_f107, manual_average_f107, manual_ap,
                         local_celestial_information, simulation_time);
+  if (conf.ReadEnable(section, "nrlmsise00_density_grid")) {
+    double tolerance = conf.ReadDouble(section, "nrlmsise00_density_grid_tolerance");
+    double refresh_period_s = conf.ReadDouble(section, "nrlmsise00_density_grid_refresh_period_s");
+    atmosphere.EnableDensityGrid(tolerance, refresh_period_s);
+  }
   atmosphere.SetCalcFlag(conf.ReadEnable(section, INI_CALC_LABEL));
   atmosphere.is_log_enabled_ = conf.ReadEnable(section, INI_LOG_LABEL);
 
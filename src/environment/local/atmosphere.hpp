@@ -5,15 +5,18 @@
 #ifndef S2E_ENVIRONMENT_LOCAL_ATMOSPHERE_HPP_
 #define S2E_ENVIRONMENT_LOCAL_ATMOSPHERE_HPP_
 
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "dynamics/orbit/orbit.hpp"
 #include "environment/global/simulation_time.hpp"
 #include "environment/local/local_celestial_information.hpp"
+#include "library/atmosphere/air_density_grid.hpp"
 #include "library/external/nrlmsise00/wrapper_nrlmsise00.hpp"
 #include "library/logger/loggable.hpp"
 #include "library/math/vector.hpp"
+#include "library/utilities/snapshot.hpp"
 
 /**
  * @class Atmosphere
@@ -60,6 +63,26 @@ class Atmosphere : public ILoggable {
    * @brief Set calculation flag (true: Enable, false: Disable)
    */
   inline void SetCalcFlag(const bool is_calc_enabled) { is_calc_enabled_ = is_calc_enabled; }
+  /**
+   * @fn EnableDensityGrid
+   * @brief Interpolate the NRLMSISE00 density on a grid of altitude, latitude, and local solar time
+   * @note The grid is evaluated at the center of each refresh period, and it is cleared at the first calculation in the next period.
+   *       Each cell is validated at its first query in the period against the model at the query time, so the time error is also checked.
+   * @param [in] tolerance: Tolerance of the relative interpolation error
+   * @param [in] refresh_period_s: Refresh period of the grid [s]
+   */
+  void EnableDensityGrid(const double tolerance, const double refresh_period_s);
+
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the atmospheric density and the validation states of the density grid into the snapshot
+   */
+  void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the atmospheric density and the validation states of the density grid from the snapshot
+   */
+  void RestoreSnapshot(Snapshot& snapshot);
 
   // Override ILoggable
   /**
@@ -72,6 +95,11 @@ class Atmosphere : public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(LogRecord& record) const;
 
  private:
   // General information
@@ -80,13 +108,20 @@ class Atmosphere : public ILoggable {
   double air_density_kg_m3_;     //!< Atmospheric density [kg/m^3]
 
   // NRLMSISE-00 model information
-  std::vector<nrlmsise_table> space_weather_table_;  //!< Space weather table
-  bool is_manual_param_used_;                        //!< Flag to use manual parameters
+  //! Space weather table (shared by the instances which read the same file for the same period)
+  std::shared_ptr<const std::vector<nrlmsise_table>> space_weather_table_ = std::make_shared<std::vector<nrlmsise_table>>();
+  bool is_manual_param_used_;  //!< Flag to use manual parameters
   // Reference of the following setting parameters https://www.swpc.noaa.gov/phenomena/f107-cm-radio-emissions
   double manual_daily_f107_;    //!< Manual daily f10.7 value
   double manual_average_f107_;  //!< Manual 3-month averaged f10.7 value
   double manual_ap_;            //!< Manual ap value Ref: http://wdc.kugi.kyoto-u.ac.jp/kp/kpexp-j.html
 
+  // NRLMSISE-00 density grid
+  bool is_density_grid_enabled_ = false;            //!< Flag to use the density grid
+  double density_grid_refresh_period_s_ = 10800.0;  //!< Refresh period of the density grid [s]
+  double density_grid_epoch_decimal_year_ = -1.0;   //!< Decimal year where the density grid is evaluated
+  libra::atmosphere::AirDensityGrid density_grid_;  //!< Density grid
+
   // Noise Information
   double gauss_standard_deviation_rate_;  //!< Standard deviation of density noise (defined as percentage)
   // TODO: Add random walk noise
@@ -96,6 +131,7 @@ class Atmosphere : public ILoggable {
 
   // References
   const LocalCelestialInformation* local_celestial_information_;  //!< Local celestial information
+  CelestialBodyHandle sun_handle_;                                //!< Handle of the sun
 
   // Functions
   /**
@@ -105,6 +141,22 @@ class Atmosphere : public ILoggable {
    * @return Atmospheric density with noise [kg/m^3]
    */
   double AddNoise(const double rho_kg_m3);
+  /**
+   * @fn CalcNrlmsise00WithGrid_kg_m3
+   * @brief Calculate NRLMSISE00 density with the density grid
+   * @param [in] decimal_year: Decimal year [year]
+   * @param [in] latitude_rad: Latitude [rad]
+   * @param [in] longitude_rad: Longitude [rad]
+   * @param [in] altitude_m: Altitude [m]
+   * @return Atmospheric density [kg/m^3]
+   */
+  double CalcNrlmsise00WithGrid_kg_m3(const double decimal_year, const double latitude_rad, const double longitude_rad, const double altitude_m);
+  /**
+   * @fn ResetDensityGrid
+   * @brief Reset the density grid with NRLMSISE00 at the epoch
+   * @param [in] epoch_decimal_year: Decimal year where the density grid is evaluated [year]
+   */
+  void ResetDensityGrid(const double epoch_decimal_year);
 };
 
 /**
@@ -5,11 +5,9 @@
 
 #include "geomagnetic_field.hpp"
 
-#include "library/external/igrf/igrf.h"
 #include "library/initialize/initialize_file_access.hpp"
 #include "library/randomization/global_randomization.hpp"
-#include "library/randomization/normal_randomization.hpp"
-#include "library/randomization/random_walk.hpp"
+#include "library/utilities/shared_data_store.hpp"
 
 GeomagneticField::GeomagneticField(const std::string igrf_file_name, const double random_walk_srandard_deviation_nT,
                                    const double random_walk_limit_nT, const double white_noise_standard_deviation_nT)
@@ -18,9 +16,11 @@ GeomagneticField::GeomagneticField(const std::string igrf_file_name, const doubl
       random_walk_standard_deviation_nT_(random_walk_srandard_deviation_nT),
       random_walk_limit_nT_(random_walk_limit_nT),
       white_noise_standard_deviation_nT_(white_noise_standard_deviation_nT),
-      igrf_file_name_(igrf_file_name) {
-  set_file_path(igrf_file_name_.c_str());
-}
+      igrf_file_name_(igrf_file_name),
+      igrf_model_(SharedDataStore<IgrfCoefficients>::GetOrLoad(igrf_file_name,
+                                                               [&igrf_file_name]() { return IgrfModel::ReadCoefficients(igrf_file_name); })),
+      random_walk_(0.1, libra::Vector<3>(random_walk_srandard_deviation_nT), libra::Vector<3>(random_walk_limit_nT)),
+      white_noise_(0.0, white_noise_standard_deviation_nT, global_randomization.MakeSeed()) {}
 
 void GeomagneticField::CalcMagneticField(const double decimal_year, const double sidereal_day, const GeodeticPosition position,
                                          const libra::Quaternion quaternion_i2b) {
@@ -30,8 +30,11 @@ void GeomagneticField::CalcMagneticField(const double decimal_year, const double
   const double lon_rad = position.GetLongitude_rad();
   const double alt_m = position.GetAltitude_m();
 
+  const libra::Vector<3> igrf_field_i_nT = igrf_model_.CalcMagneticField_i_nT(decimal_year, lat_rad, lon_rad, alt_m, sidereal_day);
   double magnetic_field_array_i_nT[3];
-  IgrfCalc(decimal_year, lat_rad, lon_rad, alt_m, sidereal_day, magnetic_field_array_i_nT);
+  for (int i = 0; i < 3; ++i) {
+    magnetic_field_array_i_nT[i] = igrf_field_i_nT[i];
+  }
   AddNoise(magnetic_field_array_i_nT);
   for (int i = 0; i < 3; ++i) {
     magnetic_field_i_nT_[i] = magnetic_field_array_i_nT[i];
@@ -39,17 +42,29 @@ void GeomagneticField::CalcMagneticField(const double decimal_year, const double
   magnetic_field_b_nT_ = quaternion_i2b.FrameConversion(magnetic_field_i_nT_);
 }
 
-void GeomagneticField::AddNoise(double* magnetic_field_array_i_nT) {
-  static libra::Vector<3> standard_deviation(random_walk_standard_deviation_nT_);
-  static libra::Vector<3> limit(random_walk_limit_nT_);
-  static RandomWalk<3> random_walk(0.1, standard_deviation, limit);
-
-  static libra::NormalRand white_noise(0.0, white_noise_standard_deviation_nT_, global_randomization.MakeSeed());
+void GeomagneticField::CalcMagneticFieldBatch(const double decimal_year, const double sidereal_day, IgrfModelBatch& batch) {
+  igrf_model_.CalcMagneticFieldBatch(batch, decimal_year, sidereal_day);
+}
 
+void GeomagneticField::AddNoise(double* magnetic_field_array_i_nT) {
   for (int i = 0; i < 3; ++i) {
-    magnetic_field_array_i_nT[i] += random_walk[i] + white_noise;
+    magnetic_field_array_i_nT[i] += random_walk_[i] + white_noise_;
   }
-  ++random_walk;  // Update random walk
+  ++random_walk_;  // Update random walk
+}
+
+void GeomagneticField::SaveSnapshot(Snapshot& snapshot) const {
+  snapshot.Write(magnetic_field_i_nT_);
+  snapshot.Write(magnetic_field_b_nT_);
+  random_walk_.SaveSnapshot(snapshot);
+  snapshot.Write(white_noise_);
+}
+
+void GeomagneticField::RestoreSnapshot(Snapshot& snapshot) {
+  snapshot.Read(magnetic_field_i_nT_);
+  snapshot.Read(magnetic_field_b_nT_);
+  random_walk_.RestoreSnapshot(snapshot);
+  snapshot.Read(white_noise_);
 }
 
 std::string GeomagneticField::GetLogHeader() const {
@@ -61,13 +76,11 @@ std::string GeomagneticField::GetLogHeader() const {
   return str_tmp;
 }
 
-std::string GeomagneticField::GetLogValue() const {
-  std::string str_tmp = "";
-
-  str_tmp += WriteVector(magnetic_field_i_nT_);
-  str_tmp += WriteVector(magnetic_field_b_nT_);
+std::string GeomagneticField::GetLogValue() const { return FormatLogValue(); }
 
-  return str_tmp;
+void GeomagneticField::AppendLogValue(LogRecord& record) const {
+  record.AddVector(magnetic_field_i_nT_);
+  record.AddVector(magnetic_field_b_nT_);
 }
 
 GeomagneticField InitGeomagneticField(std::string initialize_file_path) {
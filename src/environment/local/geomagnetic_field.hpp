@@ -7,13 +7,19 @@
 #define S2E_ENVIRONMENT_LOCAL_GEOMAGNETIC_FIELD_HPP_
 
 #include "library/geodesy/geodetic_position.hpp"
+#include "library/geomagnetism/igrf_model.hpp"
 #include "library/logger/loggable.hpp"
 #include "library/math/quaternion.hpp"
 #include "library/math/vector.hpp"
+#include "library/randomization/normal_randomization.hpp"
+#include "library/randomization/random_walk.hpp"
+#include "library/utilities/snapshot.hpp"
 
 /**
  * @class GeomagneticField
  * @brief Class to calculate magnetic field of the earth
+ * @details The IGRF coefficients are shared by all instances in the process, and each instance has its own IgrfModel. So the instances can
+ *          be used in parallel threads.
  */
 class GeomagneticField : public ILoggable {
  public:
@@ -45,6 +51,15 @@ class GeomagneticField : public ILoggable {
    */
   void CalcMagneticField(const double decimal_year, const double sidereal_day, const GeodeticPosition position,
                          const libra::Quaternion quaternion_i2b);
+  /**
+   * @fn CalcMagneticFieldBatch
+   * @brief Calculate magnetic field vectors without noise for all positions in the batch (e.g. the spacecraft of a constellation)
+   * @note The results are not stored in this object. Reuse the batch object to avoid memory allocation.
+   * @param [in] decimal_year: Decimal year [year]
+   * @param [in] sidereal_day: Sidereal day [day]
+   * @param [in,out] batch: Positions and the calculated magnetic fields
+   */
+  void CalcMagneticFieldBatch(const double decimal_year, const double sidereal_day, IgrfModelBatch& batch);
 
   /**
    * @fn GetGeomagneticField_i_nT
@@ -57,6 +72,17 @@ class GeomagneticField : public ILoggable {
    */
   inline libra::Vector<3> GetGeomagneticField_b_nT() const { return magnetic_field_b_nT_; }
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the magnetic field and the noise states into the snapshot
+   */
+  void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the magnetic field and the noise states from the snapshot
+   */
+  void RestoreSnapshot(Snapshot& snapshot);
+
   // Override ILoggable
   /**
    * @fn GetLogHeader
@@ -68,6 +94,11 @@ class GeomagneticField : public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(LogRecord& record) const;
 
  private:
   libra::Vector<3> magnetic_field_i_nT_;      //!< Magnetic field vector at the inertial frame [nT]
@@ -76,6 +107,9 @@ class GeomagneticField : public ILoggable {
   double random_walk_limit_nT_;               //!< Limit of Random Walk [nT]
   double white_noise_standard_deviation_nT_;  //!< Standard deviation of white noise [nT]
   std::string igrf_file_name_;                //!< Path to the initialize file
+  IgrfModel igrf_model_;                      //!< IGRF model
+  RandomWalk<3> random_walk_;                 //!< Random walk noise [nT]
+  libra::NormalRand white_noise_;             //!< White noise [nT]
 
   /**
    * @fn AddNoise
@@ -5,8 +5,6 @@
 
 #include "local_celestial_information.hpp"
 
-#include <SpiceUsr.h>
-
 #include <algorithm>
 #include <iostream>
 #include <locale>
@@ -132,9 +130,12 @@ void LocalCelestialInformation::ConvertVelocityInertialToBody(const double* posi
 }
 
 libra::Vector<3> LocalCelestialInformation::GetPositionFromSpacecraft_i_m(const char* body_name) const {
+  return GetPositionFromSpacecraft_i_m(GetBodyHandle(body_name));
+}
+
+libra::Vector<3> LocalCelestialInformation::GetPositionFromSpacecraft_i_m(const CelestialBodyHandle handle) const {
   libra::Vector<3> position;
-  int index = 0;
-  index = global_celestial_information_->CalcBodyIdFromName(body_name);
+  const unsigned int index = handle.GetIndex();
   for (int i = 0; i < 3; i++) {
     position[i] = celestial_body_position_from_spacecraft_i_m_[index * 3 + i];
   }
@@ -142,15 +143,16 @@ libra::Vector<3> LocalCelestialInformation::GetPositionFromSpacecraft_i_m(const
 }
 
 libra::Vector<3> LocalCelestialInformation::GetCenterBodyPositionFromSpacecraft_i_m() const {
-  std::string body_name = global_celestial_information_->GetCenterBodyName();
-  libra::Vector<3> position = GetPositionFromSpacecraft_i_m(body_name.c_str());
-  return position;
+  return GetPositionFromSpacecraft_i_m(global_celestial_information_->GetCenterBodyHandle());
 }
 
 libra::Vector<3> LocalCelestialInformation::GetPositionFromSpacecraft_b_m(const char* body_name) const {
+  return GetPositionFromSpacecraft_b_m(GetBodyHandle(body_name));
+}
+
+libra::Vector<3> LocalCelestialInformation::GetPositionFromSpacecraft_b_m(const CelestialBodyHandle handle) const {
   libra::Vector<3> position;
-  int index = 0;
-  index = global_celestial_information_->CalcBodyIdFromName(body_name);
+  const unsigned int index = handle.GetIndex();
   for (int i = 0; i < 3; i++) {
     position[i] = celestial_body_position_from_spacecraft_b_m_[index * 3 + i];
   }
@@ -158,21 +160,33 @@ libra::Vector<3> LocalCelestialInformation::GetPositionFromSpacecraft_b_m(const
 }
 
 libra::Vector<3> LocalCelestialInformation::GetCenterBodyPositionFromSpacecraft_b_m(void) const {
-  std::string body_name = global_celestial_information_->GetCenterBodyName();
-  libra::Vector<3> position = GetPositionFromSpacecraft_b_m(body_name.c_str());
-  return position;
+  return GetPositionFromSpacecraft_b_m(global_celestial_information_->GetCenterBodyHandle());
+}
+
+void LocalCelestialInformation::SaveSnapshot(Snapshot& snapshot) const {
+  const size_t num_of_state = global_celestial_information_->GetNumberOfSelectedBodies() * 3;
+  snapshot.WriteArray(celestial_body_position_from_center_b_m_, num_of_state);
+  snapshot.WriteArray(celestial_body_velocity_from_center_b_m_s_, num_of_state);
+  snapshot.WriteArray(celestial_body_position_from_spacecraft_i_m_, num_of_state);
+  snapshot.WriteArray(celestial_body_velocity_from_spacecraft_i_m_s_, num_of_state);
+  snapshot.WriteArray(celestial_body_position_from_spacecraft_b_m_, num_of_state);
+  snapshot.WriteArray(celestial_body_velocity_from_spacecraft_b_m_s_, num_of_state);
+}
+
+void LocalCelestialInformation::RestoreSnapshot(Snapshot& snapshot) {
+  const size_t num_of_state = global_celestial_information_->GetNumberOfSelectedBodies() * 3;
+  snapshot.ReadArray(celestial_body_position_from_center_b_m_, num_of_state);
+  snapshot.ReadArray(celestial_body_velocity_from_center_b_m_s_, num_of_state);
+  snapshot.ReadArray(celestial_body_position_from_spacecraft_i_m_, num_of_state);
+  snapshot.ReadArray(celestial_body_velocity_from_spacecraft_i_m_s_, num_of_state);
+  snapshot.ReadArray(celestial_body_position_from_spacecraft_b_m_, num_of_state);
+  snapshot.ReadArray(celestial_body_velocity_from_spacecraft_b_m_s_, num_of_state);
 }
 
 std::string LocalCelestialInformation::GetLogHeader() const {
-  SpiceBoolean found;
-  const int maxlen = 100;
-  char namebuf[maxlen];
   std::string str_tmp = "";
   for (int i = 0; i < global_celestial_information_->GetNumberOfSelectedBodies(); i++) {
-    SpiceInt planet_id = global_celestial_information_->GetSelectedBodyIds()[i];
-    // Acquisition of body name from id
-    bodc2n_c(planet_id, maxlen, namebuf, (SpiceBoolean*)&found);
-    std::string name = namebuf;
+    std::string name = global_celestial_information_->GetSelectedBodyName(i);
 
     std::locale loc = std::locale::classic();
     std::transform(name.begin(), name.end(), name.begin(), [loc](char c) { return std::tolower(c, loc); });
@@ -185,15 +199,15 @@ std::string LocalCelestialInformation::GetLogHeader() const {
   return str_tmp;
 }
 
-std::string LocalCelestialInformation::GetLogValue() const {
-  std::string str_tmp = "";
+std::string LocalCelestialInformation::GetLogValue() const { return FormatLogValue(); }
+
+void LocalCelestialInformation::AppendLogValue(LogRecord& record) const {
   for (int i = 0; i < global_celestial_information_->GetNumberOfSelectedBodies(); i++) {
     for (int j = 0; j < 3; j++) {
-      str_tmp += WriteScalar(celestial_body_position_from_spacecraft_b_m_[i * 3 + j]);
+      record.AddScalar(celestial_body_position_from_spacecraft_b_m_[i * 3 + j]);
     }
     for (int j = 0; j < 3; j++) {
-      str_tmp += WriteScalar(celestial_body_velocity_from_spacecraft_b_m_s_[i * 3 + j]);
+      record.AddScalar(celestial_body_velocity_from_spacecraft_b_m_s_[i * 3 + j]);
     }
   }
-  return str_tmp;
 }
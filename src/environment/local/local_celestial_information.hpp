@@ -6,6 +6,7 @@
 #ifndef S2E_ENVIRONMENT_LOCAL_LOCAL_CELESTIAL_INFORMATION_HPP_
 #define S2E_ENVIRONMENT_LOCAL_LOCAL_CELESTIAL_INFORMATION_HPP_
 
+#include "../../library/utilities/snapshot.hpp"
 #include "../global/celestial_information.hpp"
 
 /**
@@ -44,6 +45,12 @@ class LocalCelestialInformation : public ILoggable {
    * @param [in] body_name Celestial body name
    */
   libra::Vector<3> GetPositionFromSpacecraft_i_m(const char* body_name) const;
+  /**
+   * @fn GetPositionFromSpacecraft_i_m
+   * @brief Return position of a selected body (Origin: Spacecraft, Frame: Inertial frame)
+   * @param [in] handle: Handle of the body
+   */
+  libra::Vector<3> GetPositionFromSpacecraft_i_m(const CelestialBodyHandle handle) const;
   /**
    * @fn GetCenterBodyPositionFromSpacecraft_i_m
    * @brief Return position of the center body (Origin: Spacecraft, Frame: Inertial frame)
@@ -56,6 +63,12 @@ class LocalCelestialInformation : public ILoggable {
    * @param [in] body_name Celestial body name
    */
   libra::Vector<3> GetPositionFromSpacecraft_b_m(const char* body_name) const;
+  /**
+   * @fn GetPositionFromSpacecraft_b_m
+   * @brief Return position of a selected body (Origin: Spacecraft, Frame: Body fixed frame)
+   * @param [in] handle: Handle of the body
+   */
+  libra::Vector<3> GetPositionFromSpacecraft_b_m(const CelestialBodyHandle handle) const;
   /**
    * @fn GetCenterBodyPositionFromSpacecraft_b_m
    * @brief Return position of the center body (Origin: Spacecraft, Frame: Body fixed frame)
@@ -67,6 +80,24 @@ class LocalCelestialInformation : public ILoggable {
    * @brief Return global celestial information
    */
   inline const CelestialInformation& GetGlobalInformation() const { return *global_celestial_information_; }
+  /**
+   * @fn GetBodyHandle
+   * @brief Return handle of a selected body
+   * @note The name lookup is executed in this function, so call it at the initialization and keep the handle
+   * @param [in] body_name: Celestial body name
+   */
+  inline CelestialBodyHandle GetBodyHandle(const char* body_name) const { return global_celestial_information_->GetBodyHandle(body_name); }
+
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the positions and velocities of the celestial bodies seen from the spacecraft into the snapshot
+   */
+  void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the positions and velocities of the celestial bodies seen from the spacecraft from the snapshot
+   */
+  void RestoreSnapshot(Snapshot& snapshot);
 
   // Override ILoggable
   /**
@@ -79,6 +110,11 @@ class LocalCelestialInformation : public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(LogRecord& record) const;
 
  private:
   const CelestialInformation* global_celestial_information_;  //!< Global celestial information
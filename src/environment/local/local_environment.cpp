@@ -61,11 +61,25 @@ void LocalEnvironment::Update(const Dynamics* dynamics, const SimulationTime* si
 
   // Update local environments that depend only on the position
   if (simulation_time->GetOrbitPropagateFlag()) {
-    solar_radiation_pressure_environment_->UpdateAllStates();
+    solar_radiation_pressure_environment_->UpdateAllStates(simulation_time->GetElapsedTime_s(), orbit);
     atmosphere_->CalcAirDensity_kg_m3(simulation_time->GetCurrentDecimalYear(), orbit);
   }
 }
 
+void LocalEnvironment::SaveSnapshot(Snapshot& snapshot) const {
+  atmosphere_->SaveSnapshot(snapshot);
+  geomagnetic_field_->SaveSnapshot(snapshot);
+  solar_radiation_pressure_environment_->SaveSnapshot(snapshot);
+  celestial_information_->SaveSnapshot(snapshot);
+}
+
+void LocalEnvironment::RestoreSnapshot(Snapshot& snapshot) {
+  atmosphere_->RestoreSnapshot(snapshot);
+  geomagnetic_field_->RestoreSnapshot(snapshot);
+  solar_radiation_pressure_environment_->RestoreSnapshot(snapshot);
+  celestial_information_->RestoreSnapshot(snapshot);
+}
+
 void LocalEnvironment::LogSetup(Logger& logger) {
   logger.AddLogList(geomagnetic_field_);
   logger.AddLogList(solar_radiation_pressure_environment_);
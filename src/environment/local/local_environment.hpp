@@ -50,6 +50,17 @@ class LocalEnvironment {
    */
   void LogSetup(Logger& logger);
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the states of the local environments into the snapshot
+   */
+  void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the states of the local environments from the snapshot
+   */
+  void RestoreSnapshot(Snapshot& snapshot);
+
   /**
    * @fn GetAtmosphere
    * @brief Return Atmosphere class
@@ -5,7 +5,6 @@
 #include "solar_radiation_pressure_environment.hpp"
 
 #include <algorithm>
-#include <cassert>
 #include <fstream>
 
 #include "library/initialize/initialize_file_access.hpp"
@@ -14,26 +13,79 @@
 #include "library/math/vector.hpp"
 
 SolarRadiationPressureEnvironment::SolarRadiationPressureEnvironment(LocalCelestialInformation* local_celestial_information)
-    : local_celestial_information_(local_celestial_information) {
+    : local_celestial_information_(local_celestial_information), eclipse_predictor_(0.0, 0.0, 0.0, 0.0) {
   solar_radiation_pressure_N_m2_ = solar_constant_W_m2_ / environment::speed_of_light_m_s;
   shadow_source_name_ = local_celestial_information_->GetGlobalInformation().GetCenterBodyName();
-  sun_radius_m_ = local_celestial_information_->GetGlobalInformation().GetMeanRadiusFromName_m("SUN");
+  sun_handle_ = local_celestial_information_->GetBodyHandle("SUN");
+  shadow_source_handle_ = local_celestial_information_->GetBodyHandle(shadow_source_name_.c_str());
+  sun_radius_m_ = local_celestial_information_->GetGlobalInformation().GetMeanRadius_m(sun_handle_);
 }
 
-void SolarRadiationPressureEnvironment::UpdateAllStates() {
+void SolarRadiationPressureEnvironment::UpdateAllStates(const double elapsed_time_s, const Orbit& orbit) {
   if (!IsCalcEnabled) return;
 
   UpdatePressure();
-  CalcShadowCoefficient(shadow_source_name_);
+  if (is_eclipse_prediction_enabled_ && UpdateShadowCoefficientByPrediction(elapsed_time_s, orbit)) return;
+  CalcShadowCoefficient(shadow_source_handle_);
+}
+
+void SolarRadiationPressureEnvironment::SetEclipsePrediction(const bool is_enabled, const double horizon_s, const double margin_s) {
+  // The shadow source is the center body, so the orbit is the relative orbit to the shadow source
+  is_eclipse_prediction_enabled_ = is_enabled && shadow_source_handle_.GetIndex() != sun_handle_.GetIndex();
+  eclipse_prediction_margin_s_ = margin_s;
+
+  const CelestialInformation& global_information = local_celestial_information_->GetGlobalInformation();
+  eclipse_predictor_ = EclipsePredictor(global_information.GetGravityConstant_m3_s2(shadow_source_handle_), sun_radius_m_,
+                                        global_information.GetMeanRadius_m(shadow_source_handle_), horizon_s);
+}
+
+bool SolarRadiationPressureEnvironment::UpdateShadowCoefficientByPrediction(const double elapsed_time_s, const Orbit& orbit) {
+  // Predict again at the end of the prediction and after an event to reset the error of the two-body propagation
+  if (!eclipse_predictor_.GetIsPredicted() || elapsed_time_s < eclipse_predictor_.GetStartTime_s() ||
+      elapsed_time_s >= eclipse_predictor_.GetEndTime_s() ||
+      eclipse_predictor_.GetPreviousEventTime_s(elapsed_time_s - eclipse_prediction_margin_s_) > eclipse_predictor_.GetStartTime_s()) {
+    const CelestialInformation& global_information = local_celestial_information_->GetGlobalInformation();
+    const libra::Vector<3> r_sc2sun_eci = local_celestial_information_->GetPositionFromSpacecraft_i_m(sun_handle_);
+    const libra::Vector<3> r_sc2source_eci = local_celestial_information_->GetPositionFromSpacecraft_i_m(shadow_source_handle_);
+    const libra::Vector<3> source_velocity_i_m_s = global_information.GetVelocityFromCenter_i_m_s(shadow_source_handle_);
+    eclipse_predictor_.Predict(elapsed_time_s, -1.0 * r_sc2source_eci, orbit.GetVelocity_i_m_s() - source_velocity_i_m_s,
+                               r_sc2sun_eci - r_sc2source_eci, global_information.GetVelocityFromCenter_i_m_s(sun_handle_) - source_velocity_i_m_s);
+  }
+
+  // The predicted state is not reliable around the events
+  if (eclipse_predictor_.GetNextEventTime_s(elapsed_time_s - eclipse_prediction_margin_s_) <= elapsed_time_s + eclipse_prediction_margin_s_) {
+    return false;
+  }
+  switch (eclipse_predictor_.GetPredictedState(elapsed_time_s)) {
+    case EclipseState::kSunlit:
+      shadow_coefficient_ = 1.0;
+      return true;
+    case EclipseState::kUmbra:
+      shadow_coefficient_ = 0.0;
+      return true;
+    default:
+      return false;
+  }
 }
 
 void SolarRadiationPressureEnvironment::UpdatePressure() {
-  const libra::Vector<3> r_sc2sun_eci = local_celestial_information_->GetPositionFromSpacecraft_i_m("SUN");
+  const libra::Vector<3> r_sc2sun_eci = local_celestial_information_->GetPositionFromSpacecraft_i_m(sun_handle_);
   const double distance_sat_to_sun = r_sc2sun_eci.CalcNorm();
   solar_radiation_pressure_N_m2_ =
       solar_constant_W_m2_ / environment::speed_of_light_m_s / pow(distance_sat_to_sun / environment::astronomical_unit_m, 2.0);
 }
 
+void SolarRadiationPressureEnvironment::SaveSnapshot(Snapshot& snapshot) const {
+  snapshot.Write(solar_radiation_pressure_N_m2_);
+  snapshot.Write(shadow_coefficient_);
+}
+
+void SolarRadiationPressureEnvironment::RestoreSnapshot(Snapshot& snapshot) {
+  snapshot.Read(solar_radiation_pressure_N_m2_);
+  snapshot.Read(shadow_coefficient_);
+  eclipse_predictor_.Reset();
+}
+
 std::string SolarRadiationPressureEnvironment::GetLogHeader() const {
   std::string str_tmp = "";
 
@@ -43,56 +95,24 @@ std::string SolarRadiationPressureEnvironment::GetLogHeader() const {
   return str_tmp;
 }
 
-std::string SolarRadiationPressureEnvironment::GetLogValue() const {
-  std::string str_tmp = "";
+std::string SolarRadiationPressureEnvironment::GetLogValue() const { return FormatLogValue(); }
 
-  str_tmp += WriteScalar(solar_radiation_pressure_N_m2_ * shadow_coefficient_);
-  str_tmp += WriteScalar(shadow_coefficient_);
-
-  return str_tmp;
+void SolarRadiationPressureEnvironment::AppendLogValue(LogRecord& record) const {
+  record.AddScalar(solar_radiation_pressure_N_m2_ * shadow_coefficient_);
+  record.AddScalar(shadow_coefficient_);
 }
 
-void SolarRadiationPressureEnvironment::CalcShadowCoefficient(std::string shadow_source_name) {
-  if (shadow_source_name == "SUN") {
+void SolarRadiationPressureEnvironment::CalcShadowCoefficient(const CelestialBodyHandle shadow_source_handle) {
+  if (shadow_source_handle.GetIndex() == sun_handle_.GetIndex()) {
     shadow_coefficient_ = 1.0;
     return;
   }
 
-  const libra::Vector<3> r_sc2sun_eci = local_celestial_information_->GetPositionFromSpacecraft_i_m("SUN");
-  const libra::Vector<3> r_sc2source_eci = local_celestial_information_->GetPositionFromSpacecraft_i_m(shadow_source_name.c_str());
+  const libra::Vector<3> r_sc2sun_eci = local_celestial_information_->GetPositionFromSpacecraft_i_m(sun_handle_);
+  const libra::Vector<3> r_sc2source_eci = local_celestial_information_->GetPositionFromSpacecraft_i_m(shadow_source_handle);
 
-  const double shadow_source_radius_m = local_celestial_information_->GetGlobalInformation().GetMeanRadiusFromName_m(shadow_source_name.c_str());
-
-  const double distance_sat_to_sun = r_sc2sun_eci.CalcNorm();
-  const double sd_sun = asin(sun_radius_m_ / distance_sat_to_sun);                     // Apparent radius of the sun
-  const double sd_source = asin(shadow_source_radius_m / r_sc2source_eci.CalcNorm());  // Apparent radius of the shadow source
-
-  // Angle of deviation from shadow source center to sun center
-  libra::Vector<3> r_source2sun_eci = r_sc2sun_eci - r_sc2source_eci;
-  const double delta = acos(InnerProduct(r_sc2source_eci, r_sc2sun_eci - r_sc2source_eci) / r_sc2source_eci.CalcNorm() / r_source2sun_eci.CalcNorm());
-  // The angle between the center of the sun and the common chord
-  const double x = (delta * delta + sd_sun * sd_sun - sd_source * sd_source) / (2.0 * delta);
-  // The length of the common chord of the apparent solar disk and apparent telestial disk
-  const double y = sqrt(std::max(sd_sun * sd_sun - x * x, 0.0));
-
-  const double a = sd_sun;
-  const double b = sd_source;
-  const double c = delta;
-
-  if (c < fabs(a - b) && a <= b)  // The occultation is total (spacecraft is in umbra)
-  {
-    shadow_coefficient_ = 0.0;
-  } else if (c < fabs(a - b) && a > b)  // The occultation is partial but maximum
-  {
-    shadow_coefficient_ = 1.0 - (b * b) / (a * a);
-  } else if (fabs(a - b) <= c && c <= (a + b))  // spacecraft is in penumbra
-  {
-    double A = a * a * acos(x / a) + b * b * acos((c - x) / b) - c * y;  // The area of the occulted segment of the apparent solar disk
-    shadow_coefficient_ = 1.0 - A / (libra::pi * a * a);
-  } else {  // no occultation takes place
-    assert(c > (a + b));
-    shadow_coefficient_ = 1.0;
-  }
+  const double shadow_source_radius_m = local_celestial_information_->GetGlobalInformation().GetMeanRadius_m(shadow_source_handle);
+  shadow_coefficient_ = ::CalcShadowCoefficient(r_sc2sun_eci, r_sc2source_eci, sun_radius_m_, shadow_source_radius_m);
 }
 
 SolarRadiationPressureEnvironment InitSolarRadiationPressureEnvironment(std::string initialize_file_path,
@@ -104,5 +124,13 @@ SolarRadiationPressureEnvironment InitSolarRadiationPressureEnvironment(std::str
   srp_env.IsCalcEnabled = conf.ReadEnable(section, INI_CALC_LABEL);
   srp_env.is_log_enabled_ = conf.ReadEnable(section, INI_LOG_LABEL);
 
+  // Eclipse prediction (optional)
+  const bool is_eclipse_prediction_enabled = conf.ReadEnable(section, "eclipse_prediction_calculation");
+  double horizon_s = conf.ReadDouble(section, "eclipse_prediction_horizon_s");
+  if (horizon_s <= 0.0) horizon_s = 6000.0;
+  double margin_s = conf.ReadDouble(section, "eclipse_prediction_margin_s");
+  if (margin_s <= 0.0) margin_s = 60.0;
+  srp_env.SetEclipsePrediction(is_eclipse_prediction_enabled, horizon_s, margin_s);
+
   return srp_env;
 }
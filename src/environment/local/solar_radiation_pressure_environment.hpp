@@ -6,8 +6,11 @@
 #ifndef S2E_ENVIRONMENT_LOCAL_SOLAR_RADIATION_PRESSURE_ENVIRONMENT_HPP_
 #define S2E_ENVIRONMENT_LOCAL_SOLAR_RADIATION_PRESSURE_ENVIRONMENT_HPP_
 
+#include "dynamics/orbit/orbit.hpp"
 #include "environment/global/physical_constants.hpp"
 #include "environment/local/local_celestial_information.hpp"
+#include "library/orbit/eclipse_prediction.hpp"
+#include "library/utilities/snapshot.hpp"
 
 /**
  * @class SolarRadiationPressureEnvironment
@@ -32,8 +35,19 @@ class SolarRadiationPressureEnvironment : public ILoggable {
   /**
    * @fn UpdateAllStates
    * @brief Update pressure and shadow coefficients
+   * @note When the eclipse prediction is enabled, the shadow coefficient is not calculated far from the predicted eclipse events
+   * @param [in] elapsed_time_s: Elapsed time [sec]
+   * @param [in] orbit: Orbit information
    */
-  void UpdateAllStates();
+  void UpdateAllStates(const double elapsed_time_s, const Orbit& orbit);
+  /**
+   * @fn SetEclipsePrediction
+   * @brief Set the eclipse prediction
+   * @param [in] is_enabled: Enable flag
+   * @param [in] horizon_s: Time span of a prediction [sec]
+   * @param [in] margin_s: The shadow coefficient is calculated when a predicted event is within the margin [sec]
+   */
+  void SetEclipsePrediction(const bool is_enabled, const double horizon_s, const double margin_s);
 
   // Getter
   /**
@@ -66,6 +80,27 @@ class SolarRadiationPressureEnvironment : public ILoggable {
    * @brief Returns true if the shadow function is less than 1
    */
   inline bool GetIsEclipsed() const { return (shadow_coefficient_ >= 1.0 ? false : true); }
+  /**
+   * @fn GetIsEclipsePredictionEnabled
+   * @brief Return true when the eclipse prediction is enabled
+   */
+  inline bool GetIsEclipsePredictionEnabled() const { return is_eclipse_prediction_enabled_; }
+  /**
+   * @fn GetEclipsePredictor
+   * @brief Return the eclipse predictor which has the predicted eclipse events
+   */
+  inline const EclipsePredictor& GetEclipsePredictor() const { return eclipse_predictor_; }
+
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the pressure and the shadow coefficient into the snapshot
+   */
+  void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the pressure and the shadow coefficient from the snapshot
+   */
+  void RestoreSnapshot(Snapshot& snapshot);
 
   // Override ILoggable
   /**
@@ -78,16 +113,27 @@ class SolarRadiationPressureEnvironment : public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(LogRecord& record) const;
 
  private:
-  double solar_radiation_pressure_N_m2_;  //!< Solar radiation pressure [N/m^2]
-  double solar_constant_W_m2_ = 1366.0;   //!< Solar constant [W/m^2] TODO: We need to change the value depends on sun activity.
-  double shadow_coefficient_ = 1.0;       //!< Shadow function
-  double sun_radius_m_;                   //!< Sun radius [m]
-  std::string shadow_source_name_;        //!< Shadow source name
+  double solar_radiation_pressure_N_m2_;      //!< Solar radiation pressure [N/m^2]
+  double solar_constant_W_m2_ = 1366.0;       //!< Solar constant [W/m^2] TODO: We need to change the value depends on sun activity.
+  double shadow_coefficient_ = 1.0;           //!< Shadow function
+  double sun_radius_m_;                       //!< Sun radius [m]
+  std::string shadow_source_name_;            //!< Shadow source name
+  CelestialBodyHandle sun_handle_;            //!< Handle of the sun
+  CelestialBodyHandle shadow_source_handle_;  //!< Handle of the shadow source
 
   LocalCelestialInformation* local_celestial_information_;  //!< Local celestial information
 
+  bool is_eclipse_prediction_enabled_ = false;  //!< Enable flag of the eclipse prediction
+  double eclipse_prediction_margin_s_ = 60.0;   //!< Margin around the predicted events where the shadow coefficient is calculated [sec]
+  EclipsePredictor eclipse_predictor_;          //!< Eclipse predictor
+
   /**
    * @fn UpdatePressure
    * @brief Update pressure with solar distance
@@ -97,9 +143,17 @@ class SolarRadiationPressureEnvironment : public ILoggable {
   /**
    * @fn CalcShadowCoefficient
    * @brief Calculate shadow coefficient
-   * @param [in] shadow_source_name_: Shadow source name
+   * @param [in] shadow_source_handle: Handle of the shadow source
+   */
+  void CalcShadowCoefficient(const CelestialBodyHandle shadow_source_handle);
+  /**
+   * @fn UpdateShadowCoefficientByPrediction
+   * @brief Set the shadow coefficient from the predicted eclipse state when no predicted event is within the margin
+   * @param [in] elapsed_time_s: Elapsed time [sec]
+   * @param [in] orbit: Orbit information
+   * @return True when the shadow coefficient is set
    */
-  void CalcShadowCoefficient(std::string shadow_source_name);
+  bool UpdateShadowCoefficientByPrediction(const double elapsed_time_s, const Orbit& orbit);
 };
 
 /**
@@ -0,0 +1,145 @@
+/**
+ * @file air_density_grid.cpp
+ * @brief Class to interpolate the atmospheric density on a grid of altitude, latitude, and local solar time
+ */
+#include "air_density_grid.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace libra::atmosphere {
+
+AirDensityGrid::AirDensityGrid(const double tolerance, const double min_altitude_m, const double max_altitude_m, const double altitude_step_m,
+                               const double latitude_step_rad, const double local_solar_time_step_h)
+    : tolerance_(tolerance), min_altitude_m_(min_altitude_m), altitude_step_m_(altitude_step_m) {
+  // At least 4 nodes are required in each axis for the cubic interpolation.
+  // The latitude and local solar time steps are adjusted to divide the range equally.
+  const size_t altitude_intervals = std::max((size_t)3, (size_t)ceil((max_altitude_m - min_altitude_m) / altitude_step_m));
+  const size_t latitude_intervals = std::max((size_t)3, (size_t)round(libra::pi / latitude_step_rad));
+  const size_t local_solar_time_intervals = std::max((size_t)4, (size_t)round(24.0 / local_solar_time_step_h));
+  latitude_step_rad_ = libra::pi / (double)latitude_intervals;
+  local_solar_time_step_h_ = 24.0 / (double)local_solar_time_intervals;
+  number_of_altitudes_ = altitude_intervals + 1;
+  number_of_latitudes_ = latitude_intervals + 1;
+  number_of_local_solar_times_ = local_solar_time_intervals;
+
+  log_densities_.assign(number_of_altitudes_ * number_of_latitudes_ * number_of_local_solar_times_, std::numeric_limits<double>::quiet_NaN());
+  cells_.assign(altitude_intervals * latitude_intervals * local_solar_time_intervals, CellState::kUnchecked);
+}
+
+void AirDensityGrid::Reset(const DensityFunction& density_function) {
+  density_function_ = density_function;
+  std::fill(log_densities_.begin(), log_densities_.end(), std::numeric_limits<double>::quiet_NaN());
+  std::fill(cells_.begin(), cells_.end(), CellState::kUnchecked);
+  number_of_direct_cells_ = 0;
+}
+
+double AirDensityGrid::CalcAirDensity_kg_m3(const double altitude_m, const double latitude_rad, const double local_solar_time_h,
+                                            const DensityFunction& reference_function) {
+  if (!density_function_) return 0.0;
+  const DensityFunction& reference = reference_function ? reference_function : density_function_;
+
+  // Normalized coordinates
+  const double altitude = (altitude_m - min_altitude_m_) / altitude_step_m_;
+  if (!(altitude >= 0.0 && altitude <= (double)(number_of_altitudes_ - 1))) {
+    return CallDensityFunction(reference, altitude_m, latitude_rad, local_solar_time_h);
+  }
+  const double latitude = std::clamp((latitude_rad + libra::pi_2) / latitude_step_rad_, 0.0, (double)(number_of_latitudes_ - 1));
+  double local_solar_time = fmod(local_solar_time_h, 24.0) / local_solar_time_step_h_;
+  if (local_solar_time < 0.0) local_solar_time += (double)number_of_local_solar_times_;
+
+  // Cell index
+  const size_t altitude_index = std::min((size_t)altitude, number_of_altitudes_ - 2);
+  const size_t latitude_index = std::min((size_t)latitude, number_of_latitudes_ - 2);
+  const size_t local_solar_time_index = std::min((size_t)local_solar_time, number_of_local_solar_times_ - 1);
+  const size_t cell_index = (altitude_index * (number_of_latitudes_ - 1) + latitude_index) * number_of_local_solar_times_ + local_solar_time_index;
+
+  if (cells_[cell_index] == CellState::kUnchecked) {
+    // Compare the interpolation with the reference function at the first query in the cell
+    const double interpolated_kg_m3 = Interpolate(altitude, latitude, local_solar_time, altitude_index, latitude_index, local_solar_time_index);
+    const double reference_kg_m3 = CallDensityFunction(reference, altitude_m, latitude_rad, local_solar_time_h);
+    const double relative_error = fabs(interpolated_kg_m3 - reference_kg_m3) / reference_kg_m3;
+    // NaN and non-positive densities are also served directly
+    if (relative_error <= tolerance_) {
+      cells_[cell_index] = CellState::kInterpolated;
+      return interpolated_kg_m3;
+    }
+    cells_[cell_index] = CellState::kDirect;
+    number_of_direct_cells_++;
+    return reference_kg_m3;
+  }
+
+  if (cells_[cell_index] == CellState::kDirect) {
+    return CallDensityFunction(reference, altitude_m, latitude_rad, local_solar_time_h);
+  }
+  return Interpolate(altitude, latitude, local_solar_time, altitude_index, latitude_index, local_solar_time_index);
+}
+
+void AirDensityGrid::SaveSnapshot(Snapshot& snapshot) const {
+  snapshot.Write(cells_);
+  snapshot.Write(number_of_direct_cells_);
+}
+
+void AirDensityGrid::RestoreSnapshot(Snapshot& snapshot) {
+  snapshot.Read(cells_);
+  snapshot.Read(number_of_direct_cells_);
+}
+
+double AirDensityGrid::CallDensityFunction(const DensityFunction& function, const double altitude_m, const double latitude_rad,
+                                           const double local_solar_time_h) {
+  number_of_evaluations_++;
+  return function(altitude_m, latitude_rad, local_solar_time_h);
+}
+
+double AirDensityGrid::GetLogDensity(const size_t altitude_index, const size_t latitude_index, const size_t local_solar_time_index) {
+  const size_t index = (altitude_index * number_of_latitudes_ + latitude_index) * number_of_local_solar_times_ + local_solar_time_index;
+  if (std::isnan(log_densities_[index])) {
+    const double altitude_m = min_altitude_m_ + altitude_index * altitude_step_m_;
+    const double latitude_rad = latitude_index * latitude_step_rad_ - libra::pi_2;
+    const double density_kg_m3 = CallDensityFunction(density_function_, altitude_m, latitude_rad, local_solar_time_index * local_solar_time_step_h_);
+    // Non-positive density is stored as -infinity so that the node is not evaluated again
+    log_densities_[index] = density_kg_m3 > 0.0 ? log(density_kg_m3) : -std::numeric_limits<double>::infinity();
+  }
+  return log_densities_[index];
+}
+
+double AirDensityGrid::Interpolate(const double altitude, const double latitude, const double local_solar_time, const size_t altitude_index,
+                                   const size_t latitude_index, const size_t local_solar_time_index) {
+  // The stencil is shifted inside the grid at the edges of altitude and latitude, and wrapped around in local solar time
+  const size_t altitude_start = std::min(altitude_index > 0 ? altitude_index - 1 : 0, number_of_altitudes_ - 4);
+  const size_t latitude_start = std::min(latitude_index > 0 ? latitude_index - 1 : 0, number_of_latitudes_ - 4);
+  const size_t local_solar_time_start = (local_solar_time_index + number_of_local_solar_times_ - 1) % number_of_local_solar_times_;
+
+  double altitude_weights[4], latitude_weights[4], local_solar_time_weights[4];
+  CalcLagrangeWeights(altitude - (double)altitude_start, altitude_weights);
+  CalcLagrangeWeights(latitude - (double)latitude_start, latitude_weights);
+  CalcLagrangeWeights(local_solar_time - (double)local_solar_time_index + 1.0, local_solar_time_weights);
+
+  size_t local_solar_time_indices[4];
+  for (size_t k = 0; k < 4; k++) local_solar_time_indices[k] = (local_solar_time_start + k) % number_of_local_solar_times_;
+
+  double log_density = 0.0;
+  for (size_t i = 0; i < 4; i++) {
+    double sum_latitude = 0.0;
+    for (size_t j = 0; j < 4; j++) {
+      double sum_local_solar_time = 0.0;
+      for (size_t k = 0; k < 4; k++) {
+        sum_local_solar_time += local_solar_time_weights[k] * GetLogDensity(altitude_start + i, latitude_start + j, local_solar_time_indices[k]);
+      }
+      sum_latitude += latitude_weights[j] * sum_local_solar_time;
+    }
+    log_density += altitude_weights[i] * sum_latitude;
+  }
+  return exp(log_density);
+}
+
+void AirDensityGrid::CalcLagrangeWeights(const double x, double weights[4]) {
+  const double x0 = x, x1 = x - 1.0, x2 = x - 2.0, x3 = x - 3.0;
+  weights[0] = -x1 * x2 * x3 / 6.0;
+  weights[1] = x0 * x2 * x3 / 2.0;
+  weights[2] = -x0 * x1 * x3 / 2.0;
+  weights[3] = x0 * x1 * x2 / 6.0;
+}
+
+}  // namespace libra::atmosphere
@@ -0,0 +1,166 @@
+/**
+ * @file air_density_grid.hpp
+ * @brief Class to interpolate the atmospheric density on a grid of altitude, latitude, and local solar time
+ */
+
+#ifndef S2E_LIBRARY_ATMOSPHERE_AIR_DENSITY_GRID_HPP_
+#define S2E_LIBRARY_ATMOSPHERE_AIR_DENSITY_GRID_HPP_
+
+#include <cstdint>
+#include <functional>
+#include <library/math/constants.hpp>
+#include <library/utilities/snapshot.hpp>
+#include <vector>
+
+namespace libra::atmosphere {
+
+/**
+ * @class AirDensityGrid
+ * @brief Class to interpolate the atmospheric density on a grid of altitude, latitude, and local solar time
+ * @details The logarithm of the density is interpolated with the tricubic Lagrange polynomial of the 4x4x4 neighboring nodes. The nodes are
+ *          evaluated with the density function at the first use, so only the region around the orbit is evaluated. At the first use of each
+ *          cell after the reset, the interpolated density at the query is compared with the reference function, which can be the model at the
+ *          query time while the nodes are evaluated at a fixed epoch. The cell is served by the reference function directly when the relative
+ *          error exceeds the tolerance. The altitude out of the grid is also served directly.
+ */
+class AirDensityGrid {
+ public:
+  /**
+   * @brief Function to calculate the atmospheric density
+   * @param [in] altitude_m: Altitude [m]
+   * @param [in] latitude_rad: Latitude [rad]
+   * @param [in] local_solar_time_h: Local solar time [hour]
+   * @return Atmospheric density [kg/m^3]
+   */
+  using DensityFunction = std::function<double(const double altitude_m, const double latitude_rad, const double local_solar_time_h)>;
+
+  /**
+   * @fn AirDensityGrid
+   * @brief Constructor
+   * @param [in] tolerance: Tolerance of the relative interpolation error
+   * @param [in] min_altitude_m: Minimum altitude of the grid [m]
+   * @param [in] max_altitude_m: Maximum altitude of the grid [m]
+   * @param [in] altitude_step_m: Node spacing of altitude [m]
+   * @param [in] latitude_step_rad: Node spacing of latitude [rad]
+   * @param [in] local_solar_time_step_h: Node spacing of local solar time [hour]
+   */
+  AirDensityGrid(const double tolerance = 1.0e-3, const double min_altitude_m = 100.0e3, const double max_altitude_m = 1500.0e3,
+                 const double altitude_step_m = 10.0e3, const double latitude_step_rad = 5.0 * libra::deg_to_rad,
+                 const double local_solar_time_step_h = 0.5);
+
+  /**
+   * @fn Reset
+   * @brief Replace the density function and clear the evaluated nodes
+   * @note The nodes are evaluated again at the next use
+   * @param [in] density_function: Function to calculate the atmospheric density
+   */
+  void Reset(const DensityFunction& density_function);
+
+  /**
+   * @fn CalcAirDensity_kg_m3
+   * @brief Return the interpolated atmospheric density
+   * @param [in] altitude_m: Altitude [m]
+   * @param [in] latitude_rad: Latitude [rad]
+   * @param [in] local_solar_time_h: Local solar time [hour]
+   * @param [in] reference_function: Function to validate the cell and to serve the density directly (the density function when empty)
+   * @return Atmospheric density [kg/m^3]
+   */
+  double CalcAirDensity_kg_m3(const double altitude_m, const double latitude_rad, const double local_solar_time_h,
+                              const DensityFunction& reference_function = DensityFunction());
+
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the validation states of the cells into the snapshot
+   * @note The nodes are not stored, because they are evaluated again with the same density function
+   */
+  void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the validation states of the cells from the snapshot
+   * @note The density function needs to be reset as it was at the save before this function is called
+   */
+  void RestoreSnapshot(Snapshot& snapshot);
+
+  // Getter
+  /**
+   * @fn GetTolerance
+   * @brief Return tolerance of the relative interpolation error
+   */
+  inline double GetTolerance() const { return tolerance_; }
+  /**
+   * @fn GetNumberOfEvaluations
+   * @brief Return number of the density function and the reference function calls since the construction
+   */
+  inline size_t GetNumberOfEvaluations() const { return number_of_evaluations_; }
+  /**
+   * @fn GetNumberOfDirectCells
+   * @brief Return number of the cells served by the density function directly since the last reset
+   */
+  inline size_t GetNumberOfDirectCells() const { return number_of_direct_cells_; }
+
+ private:
+  /**
+   * @enum CellState
+   * @brief State of the cell
+   */
+  enum class CellState : uint8_t {
+    kUnchecked,     //!< Not used since the last reset
+    kInterpolated,  //!< The interpolation error is smaller than the tolerance
+    kDirect,        //!< The interpolation error exceeds the tolerance
+  };
+
+  DensityFunction density_function_;  //!< Function to calculate the atmospheric density
+  double tolerance_;                  //!< Tolerance of the relative interpolation error
+
+  // Grid definition
+  double min_altitude_m_;               //!< Minimum altitude of the grid [m]
+  double altitude_step_m_;              //!< Node spacing of altitude [m]
+  double latitude_step_rad_;            //!< Node spacing of latitude [rad]
+  double local_solar_time_step_h_;      //!< Node spacing of local solar time [hour]
+  size_t number_of_altitudes_;          //!< Number of nodes in altitude
+  size_t number_of_latitudes_;          //!< Number of nodes in latitude (from -90 deg to 90 deg)
+  size_t number_of_local_solar_times_;  //!< Number of nodes in local solar time (periodic in 24 hours)
+
+  std::vector<double> log_densities_;  //!< Logarithm of the density at the nodes (NaN for the nodes not evaluated)
+  std::vector<CellState> cells_;       //!< State of the cells
+  size_t number_of_evaluations_ = 0;   //!< Number of the density function calls
+  size_t number_of_direct_cells_ = 0;  //!< Number of the cells served directly
+
+  /**
+   * @fn CallDensityFunction
+   * @brief Call the density function or the reference function and count the call
+   */
+  double CallDensityFunction(const DensityFunction& function, const double altitude_m, const double latitude_rad, const double local_solar_time_h);
+  /**
+   * @fn GetLogDensity
+   * @brief Return the logarithm of the density at the node, and evaluate it at the first use
+   * @param [in] altitude_index: Node index of altitude
+   * @param [in] latitude_index: Node index of latitude
+   * @param [in] local_solar_time_index: Node index of local solar time
+   */
+  double GetLogDensity(const size_t altitude_index, const size_t latitude_index, const size_t local_solar_time_index);
+  /**
+   * @fn Interpolate
+   * @brief Interpolate the density with the 4x4x4 nodes around the cell
+   * @param [in] altitude: Altitude normalized by the node spacing from the minimum altitude
+   * @param [in] latitude: Latitude normalized by the node spacing from -90 deg
+   * @param [in] local_solar_time: Local solar time normalized by the node spacing (0 to the number of nodes)
+   * @param [in] altitude_index: Cell index of altitude
+   * @param [in] latitude_index: Cell index of latitude
+   * @param [in] local_solar_time_index: Cell index of local solar time
+   * @return Atmospheric density [kg/m^3]
+   */
+  double Interpolate(const double altitude, const double latitude, const double local_solar_time, const size_t altitude_index,
+                     const size_t latitude_index, const size_t local_solar_time_index);
+  /**
+   * @fn CalcLagrangeWeights
+   * @brief Calculate the weights of the cubic Lagrange interpolation with the nodes at 0, 1, 2, and 3
+   * @param [in] x: Position normalized by the node spacing from the first node
+   * @param [out] weights: Weights of the nodes
+   */
+  static void CalcLagrangeWeights(const double x, double weights[4]);
+};
+
+}  // namespace libra::atmosphere
+
+#endif  // S2E_LIBRARY_ATMOSPHERE_AIR_DENSITY_GRID_HPP_
@@ -0,0 +1,91 @@
+/**
+ * @file benchmark_air_density_grid.cpp
+ * @brief Micro-benchmark of AirDensityGrid class with NRLMSISE00 model
+ * @note The grid is compared with the direct calls of NRLMSISE00 along a circular orbit for one day with the manual space weather parameters.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <library/external/nrlmsise00/wrapper_nrlmsise00.hpp>
+#include <library/math/constants.hpp>
+#include <vector>
+
+#include "air_density_grid.hpp"
+
+/**
+ * @fn MeasureTime_us
+ * @brief Measure the average execution time of the function [us]
+ */
+template <typename Function>
+static double MeasureTime_us(const size_t number_of_calls, Function function) {
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < number_of_calls; i++) function(i);
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count() / (double)number_of_calls;
+}
+
+int main() {
+  const std::vector<nrlmsise_table> table;  // Not used with the manual parameters
+  const double f107 = 150.0, f107a = 150.0, ap = 3.0;
+  // The grid is evaluated at the noon of the day as Atmosphere does with the refresh period of one day
+  const double start_decimal_year = 2024.0 + 100.0 / 366.0;
+  const double epoch_decimal_year = start_decimal_year + 0.5 / 366.0;
+  int date[6];
+  ConvertDecyearToDate(epoch_decimal_year, date);
+  const double epoch_ut_h = date[3] + date[4] / 60.0 + date[5] / 3600.0;
+
+  printf("altitude_km, tolerance, direct_us, grid_us, speedup, max_relative_error, rms_relative_error, evaluations, direct_cells\n");
+  const double altitudes_km[] = {300.0, 500.0, 800.0};
+  const double tolerances[] = {1.0e-2, 1.0e-3, 1.0e-4};
+  for (const double altitude_km : altitudes_km) {
+    // Circular orbit with the inclination of 51.6 deg for one day with the step of 1 s
+    const size_t number_of_steps = 86400;
+    const double inclination_rad = 51.6 * libra::deg_to_rad;
+    const double orbit_period_s = libra::tau * sqrt(pow((6378.137 + altitude_km) * 1000.0, 3.0) / 3.986004418e14);
+    const double earth_rotation_rad_s = 7.2921159e-5;
+    std::vector<double> decimal_years(number_of_steps), latitudes_rad(number_of_steps), longitudes_rad(number_of_steps);
+    std::vector<double> altitudes_m(number_of_steps), local_solar_times_h(number_of_steps);
+    for (size_t i = 0; i < number_of_steps; i++) {
+      const double time_s = (double)i;
+      const double argument_rad = libra::tau * time_s / orbit_period_s;
+      decimal_years[i] = start_decimal_year + time_s / 86400.0 / 366.0;
+      latitudes_rad[i] = asin(sin(inclination_rad) * sin(argument_rad));
+      const double right_ascension_rad = atan2(cos(inclination_rad) * sin(argument_rad), cos(argument_rad));
+      longitudes_rad[i] = remainder(right_ascension_rad - earth_rotation_rad_s * time_s, libra::tau);
+      altitudes_m[i] = altitude_km * 1000.0;
+      // Local solar time in the same way as CalcNRLMSISE00
+      ConvertDecyearToDate(decimal_years[i], date);
+      local_solar_times_h[i] = date[3] + date[4] / 60.0 + date[5] / 3600.0 + longitudes_rad[i] * libra::rad_to_deg / 15.0;
+    }
+
+    std::vector<double> direct_kg_m3(number_of_steps);
+    const double direct_us = MeasureTime_us(number_of_steps, [&](size_t i) {
+      direct_kg_m3[i] = CalcNRLMSISE00(decimal_years[i], latitudes_rad[i], longitudes_rad[i], altitudes_m[i], table, true, f107, f107a, ap);
+    });
+
+    for (const double tolerance : tolerances) {
+      libra::atmosphere::AirDensityGrid grid(tolerance);
+      grid.Reset([&](const double altitude_m, const double latitude_rad, const double local_solar_time_h) {
+        const double longitude_rad = (local_solar_time_h - epoch_ut_h) * 15.0 * libra::deg_to_rad;
+        return CalcNRLMSISE00(epoch_decimal_year, latitude_rad, longitude_rad, altitude_m, table, true, f107, f107a, ap);
+      });
+      std::vector<double> grid_kg_m3(number_of_steps);
+      const double grid_us = MeasureTime_us(number_of_steps, [&](size_t i) {
+        grid_kg_m3[i] = grid.CalcAirDensity_kg_m3(altitudes_m[i], latitudes_rad[i], local_solar_times_h[i]);
+      });
+
+      double max_error = 0.0, sum_squared_error = 0.0;
+      for (size_t i = 0; i < number_of_steps; i++) {
+        const double error = fabs(grid_kg_m3[i] - direct_kg_m3[i]) / direct_kg_m3[i];
+        max_error = std::max(max_error, error);
+        sum_squared_error += error * error;
+      }
+      printf("%.0f, %.0e, %f, %f, %.1f, %e, %e, %zu, %zu\n", altitude_km, tolerance, direct_us, grid_us, direct_us / grid_us, max_error,
+             sqrt(sum_squared_error / number_of_steps), grid.GetNumberOfEvaluations(), grid.GetNumberOfDirectCells());
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,147 @@
+/**
+ * @file test_air_density_grid.cpp
+ * @brief Test codes for AirDensityGrid class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "air_density_grid.hpp"
+
+using libra::atmosphere::AirDensityGrid;
+
+/**
+ * @brief Density profile similar to the thermosphere with the diurnal bulge
+ */
+static double CalcTestDensity_kg_m3(const double altitude_m, const double latitude_rad, const double local_solar_time_h) {
+  // Scale height increasing linearly from 20 km at 100 km altitude
+  const double altitude_km = altitude_m / 1000.0;
+  const double profile = pow(1.0 + 0.12 * (altitude_km - 100.0) / 20.0, -1.0 / 0.12);
+  const double diurnal = 1.0 + 0.3 * cos(libra::tau * (local_solar_time_h - 14.0) / 24.0) * cos(latitude_rad);
+  const double semidiurnal = 1.0 + 0.05 * cos(2.0 * libra::tau * (local_solar_time_h - 3.0) / 24.0);
+  return 5.6e-7 * profile * diurnal * semidiurnal * (1.0 + 0.1 * sin(latitude_rad) * sin(latitude_rad));
+}
+
+/**
+ * @brief Test for the interpolation accuracy and the number of the density function calls along an orbit
+ */
+TEST(AirDensityGrid, Orbit) {
+  const double tolerance = 1.0e-3;
+  AirDensityGrid grid(tolerance);
+  grid.Reset(CalcTestDensity_kg_m3);
+
+  // Inclined circular orbit around 400 km with the ground track in the local solar time frame
+  const size_t number_of_steps = 86400;
+  const double inclination_rad = 51.6 * libra::deg_to_rad;
+  const double orbit_period_s = 5554.0;
+  double max_error = 0.0;
+  for (size_t i = 0; i < number_of_steps; i++) {
+    const double time_s = (double)i;
+    const double argument_rad = libra::tau * time_s / orbit_period_s;
+    const double latitude_rad = asin(sin(inclination_rad) * sin(argument_rad));
+    const double right_ascension_rad = atan2(cos(inclination_rad) * sin(argument_rad), cos(argument_rad));
+    const double local_solar_time_h = 12.0 + right_ascension_rad / libra::tau * 24.0 + time_s / 86400.0 * 24.0 / 365.25;
+    const double altitude_m = 400.0e3 + 5.0e3 * sin(argument_rad);
+
+    const double density_kg_m3 = grid.CalcAirDensity_kg_m3(altitude_m, latitude_rad, local_solar_time_h);
+    const double reference_kg_m3 = CalcTestDensity_kg_m3(altitude_m, latitude_rad, local_solar_time_h);
+    max_error = std::max(max_error, fabs(density_kg_m3 - reference_kg_m3) / reference_kg_m3);
+  }
+  EXPECT_LT(max_error, tolerance);
+  EXPECT_EQ(0u, grid.GetNumberOfDirectCells());
+  EXPECT_LT(grid.GetNumberOfEvaluations(), number_of_steps / 10);
+}
+
+/**
+ * @brief Test for the cells served by the density function directly
+ */
+TEST(AirDensityGrid, Direct) {
+  // The tolerance is too small for the interpolation
+  AirDensityGrid grid(1.0e-14);
+  grid.Reset(CalcTestDensity_kg_m3);
+  const double latitudes_rad[] = {-1.5, -0.2, 0.7, 1.5707963267948966};
+  for (const double latitude_rad : latitudes_rad) {
+    const double density_kg_m3 = grid.CalcAirDensity_kg_m3(456.0e3, latitude_rad, 23.9);
+    EXPECT_DOUBLE_EQ(CalcTestDensity_kg_m3(456.0e3, latitude_rad, 23.9), density_kg_m3);
+  }
+  EXPECT_EQ(4u, grid.GetNumberOfDirectCells());
+
+  // Out of the altitude range
+  AirDensityGrid coarse_grid(1.0e-3);
+  coarse_grid.Reset(CalcTestDensity_kg_m3);
+  EXPECT_DOUBLE_EQ(CalcTestDensity_kg_m3(1600.0e3, 0.1, 3.0), coarse_grid.CalcAirDensity_kg_m3(1600.0e3, 0.1, 3.0));
+  EXPECT_EQ(1u, coarse_grid.GetNumberOfEvaluations());
+
+  // Non-positive density
+  coarse_grid.Reset([](const double, const double, const double) { return 0.0; });
+  EXPECT_DOUBLE_EQ(0.0, coarse_grid.CalcAirDensity_kg_m3(400.0e3, 0.1, 3.0));
+  EXPECT_EQ(1u, coarse_grid.GetNumberOfDirectCells());
+}
+
+/**
+ * @brief Test for the reset of the density function
+ */
+TEST(AirDensityGrid, Reset) {
+  AirDensityGrid grid(1.0e-3);
+  EXPECT_DOUBLE_EQ(0.0, grid.CalcAirDensity_kg_m3(400.0e3, 0.1, 3.0));
+
+  grid.Reset(CalcTestDensity_kg_m3);
+  const double density_kg_m3 = grid.CalcAirDensity_kg_m3(400.0e3, 0.1, 3.0);
+  EXPECT_NEAR(1.0, density_kg_m3 / CalcTestDensity_kg_m3(400.0e3, 0.1, 3.0), 1.0e-3);
+
+  grid.Reset([](const double altitude_m, const double latitude_rad, const double local_solar_time_h) {
+    return 2.0 * CalcTestDensity_kg_m3(altitude_m, latitude_rad, local_solar_time_h);
+  });
+  EXPECT_NEAR(2.0, grid.CalcAirDensity_kg_m3(400.0e3, 0.1, 3.0) / density_kg_m3, 1.0e-12);
+}
+
+/**
+ * @brief Test for the validation with the reference function different from the density function of the nodes
+ */
+TEST(AirDensityGrid, Reference) {
+  // Reference function like the model at the query time, which differs from the model at the epoch of the nodes
+  const AirDensityGrid::DensityFunction reference_function = [](const double altitude_m, const double latitude_rad, const double local_solar_time_h) {
+    return 1.002 * CalcTestDensity_kg_m3(altitude_m, latitude_rad, local_solar_time_h);
+  };
+
+  // The difference exceeds the tolerance, so the cell is served by the reference function
+  AirDensityGrid grid(1.0e-3);
+  grid.Reset(CalcTestDensity_kg_m3);
+  EXPECT_DOUBLE_EQ(reference_function(400.0e3, 0.1, 3.0), grid.CalcAirDensity_kg_m3(400.0e3, 0.1, 3.0, reference_function));
+  EXPECT_DOUBLE_EQ(reference_function(401.0e3, 0.11, 3.1), grid.CalcAirDensity_kg_m3(401.0e3, 0.11, 3.1, reference_function));
+  EXPECT_EQ(1u, grid.GetNumberOfDirectCells());
+  // Out of the altitude range
+  EXPECT_DOUBLE_EQ(reference_function(1600.0e3, 0.1, 3.0), grid.CalcAirDensity_kg_m3(1600.0e3, 0.1, 3.0, reference_function));
+
+  // The difference is within the tolerance, so the cell is interpolated
+  AirDensityGrid loose_grid(1.0e-2);
+  loose_grid.Reset(CalcTestDensity_kg_m3);
+  const double density_kg_m3 = loose_grid.CalcAirDensity_kg_m3(400.0e3, 0.1, 3.0, reference_function);
+  EXPECT_NEAR(1.0, density_kg_m3 / CalcTestDensity_kg_m3(400.0e3, 0.1, 3.0), 1.0e-3);
+  EXPECT_EQ(0u, loose_grid.GetNumberOfDirectCells());
+}
+
+/**
+ * @brief Test for the snapshot of the validation states
+ */
+TEST(AirDensityGrid, Snapshot) {
+  const AirDensityGrid::DensityFunction reference_function = [](const double altitude_m, const double latitude_rad, const double local_solar_time_h) {
+    return 1.002 * CalcTestDensity_kg_m3(altitude_m, latitude_rad, local_solar_time_h);
+  };
+  AirDensityGrid grid(1.0e-3);
+  grid.Reset(CalcTestDensity_kg_m3);
+  grid.CalcAirDensity_kg_m3(400.0e3, 0.1, 3.0, reference_function);
+  grid.CalcAirDensity_kg_m3(600.0e3, -0.5, 20.0);
+  Snapshot snapshot;
+  grid.SaveSnapshot(snapshot);
+
+  AirDensityGrid restored_grid(1.0e-3);
+  restored_grid.Reset(CalcTestDensity_kg_m3);
+  snapshot.Rewind();
+  restored_grid.RestoreSnapshot(snapshot);
+  EXPECT_TRUE(snapshot.IsEnd());
+  EXPECT_EQ(1u, restored_grid.GetNumberOfDirectCells());
+  // The cell validated as direct is served directly without the validation
+  EXPECT_DOUBLE_EQ(CalcTestDensity_kg_m3(401.0e3, 0.11, 3.1), restored_grid.CalcAirDensity_kg_m3(401.0e3, 0.11, 3.1));
+  EXPECT_DOUBLE_EQ(grid.CalcAirDensity_kg_m3(601.0e3, -0.51, 20.1), restored_grid.CalcAirDensity_kg_m3(601.0e3, -0.51, 20.1));
+}
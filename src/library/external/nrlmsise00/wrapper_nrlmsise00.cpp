@@ -17,6 +17,7 @@ extern "C" {
 #include <cmath> /* maths functions */
 #include <environment/global/physical_constants.hpp>
 #include <library/math/constants.hpp>
+#include <mutex>
 #include <numeric>
 
 #include "wrapper_nrlmsise00.hpp" /* header for nrlmsise-00.h */
@@ -28,6 +29,9 @@ using namespace std;
 /* ------------------------------------------------------------------- */
 
 static double decyear_monthly;
+// The NRLMSISE-00 model in the external library and decyear_monthly are shared by all threads, and the model is not reentrant.
+// The calls are serialized for the simulation cases executed in parallel.
+static std::mutex nrlmsise00_mutex;
 
 int LeapYear(int year) { return ((year % 4 == 0) && (year % 100 != 0)) || (year % 400 == 0); }
 
@@ -183,6 +187,8 @@ double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt,
 
   ConvertDecyearToDate(decyear, date);
 
+  std::lock_guard<std::mutex> lock(nrlmsise00_mutex);
+
   input.doy = (int)((decyear - (int)decyear) * 365.25);
   input.year = 0; /* without effect */
   input.sec = date[3] * 60.0 * 60.0 + date[4] * 60.0 + date[5];
@@ -273,6 +279,7 @@ size_t GetSpaceWeatherTable_(double decyear, double endsec, const string& filena
 
         // After 1.5 month from the update date, the data is updated once per month. So calculate the decimal year of the date
         int days_month[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+        std::lock_guard<std::mutex> lock(nrlmsise00_mutex);
         decyear_monthly = decyear_updated + (days_month[month_updated] + 14) / 365.0;
       }
       continue;
@@ -43,10 +43,19 @@ struct nrlmsise_table {
  * @param [in] manual_f107a: Manual setting averaged F10.7
  * @param [in] manual_ap: Manual setting Ap-index
  * @return Atmospheric density [kg/m3]
+ * @note The NRLMSISE-00 model is not reentrant. The calls from parallel threads are serialized with a mutex.
  */
 double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt, const std::vector<nrlmsise_table>& table, bool is_manual_param,
                       double manual_f107, double manual_f107a, double manual_ap);
 
+/**
+ * @fn ConvertDecyearToDate
+ * @brief Convert the decimal year to the date used in CalcNRLMSISE00
+ * @param [in] decyear: Decimal year
+ * @param [out] date: Year, month, day, hour, minute, and second
+ */
+void ConvertDecyearToDate(double decyear, int* date);
+
 /**
  * @fn GetSpaceWeatherTable_
  * @brief Read the space weather table file
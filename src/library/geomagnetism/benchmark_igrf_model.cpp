@@ -0,0 +1,176 @@
+/**
+ * @file benchmark_igrf_model.cpp
+ * @brief Micro-benchmark of IgrfModel class
+ * @note The reference implementation is the former IgrfModel which calculates the factors of the Legendre recursion at every call.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "igrf_model.hpp"
+
+/**
+ * @class ReferenceIgrfModel
+ * @brief Former implementation of the scalar IgrfModel calculation in the local north-east-down frame
+ */
+class ReferenceIgrfModel {
+ public:
+  ReferenceIgrfModel(const IgrfCoefficients& coefficients, const double decimal_year) : degree_(coefficients.degree) {
+    // Extrapolation after the last epoch
+    const double elapsed_year = decimal_year - coefficients.epochs_year.back();
+    const size_t number_of_coefficients = IgrfModel::GetCoefficientIndex(degree_, degree_) + 1;
+    g_.resize(number_of_coefficients);
+    h_.resize(number_of_coefficients);
+    for (size_t i = 0; i < number_of_coefficients; i++) {
+      g_[i] = coefficients.g_nT.back()[i] + coefficients.secular_variation_g_nT[i] * elapsed_year;
+      h_[i] = coefficients.h_nT.back()[i] + coefficients.secular_variation_h_nT[i] * elapsed_year;
+    }
+    p_.resize(number_of_coefficients);
+    dp_.resize(number_of_coefficients);
+    cos_m_.resize(degree_ + 1);
+    sin_m_.resize(degree_ + 1);
+  }
+
+  libra::Vector<3> CalcMagneticField_ned_nT(const double latitude_rad, const double longitude_rad, const double altitude_m);
+
+ private:
+  size_t degree_;
+  std::vector<double> g_, h_, p_, dp_, cos_m_, sin_m_;
+};
+
+libra::Vector<3> ReferenceIgrfModel::CalcMagneticField_ned_nT(const double latitude_rad, const double longitude_rad, const double altitude_m) {
+  const double altitude_km = altitude_m / 1000.0;
+  const double re = 6378.137, rp = re * (1.0 - 1.0 / 298.25722);
+  const double re2 = re * re, rp2 = rp * rp;
+  const double slat = sin(latitude_rad), slat2 = slat * slat, clat2 = 1.0 - slat2;
+  const double rm2 = re2 * clat2 + rp2 * slat2, rm = sqrt(rm2);
+  const double r = sqrt((re2 * re2 * clat2 + rp2 * rp2 * slat2) / rm2 + 2.0 * altitude_km * rm + altitude_km * altitude_km);
+  const double cth = slat * (altitude_km + rp2 / rm) / r;
+  const double sth = std::max(sqrt(std::max(1.0 - cth * cth, 0.0)), 1.0e-10);
+
+  p_[0] = 1.0;
+  dp_[0] = 0.0;
+  for (size_t n = 1; n <= degree_; n++) {
+    const size_t d = IgrfModel::GetCoefficientIndex(n, n), pd = IgrfModel::GetCoefficientIndex(n - 1, n - 1);
+    if (n == 1) {
+      p_[d] = sth;
+      dp_[d] = cth;
+    } else {
+      const double factor = sqrt((2.0 * n - 1.0) / (2.0 * n));
+      p_[d] = factor * sth * p_[pd];
+      dp_[d] = factor * (cth * p_[pd] + sth * dp_[pd]);
+    }
+    for (size_t m = 0; m < n; m++) {
+      const size_t i = IgrfModel::GetCoefficientIndex(n, m), i1 = IgrfModel::GetCoefficientIndex(n - 1, m);
+      const double denominator = sqrt((double)(n * n - m * m));
+      double p = (2.0 * n - 1.0) * cth * p_[i1];
+      double dp = (2.0 * n - 1.0) * (cth * dp_[i1] - sth * p_[i1]);
+      if (n >= m + 2) {
+        const size_t i2 = IgrfModel::GetCoefficientIndex(n - 2, m);
+        const double factor_2 = sqrt((double)((n - 1) * (n - 1) - m * m));
+        p -= factor_2 * p_[i2];
+        dp -= factor_2 * dp_[i2];
+      }
+      p_[i] = p / denominator;
+      dp_[i] = dp / denominator;
+    }
+  }
+  const double cph = cos(longitude_rad), sph = sin(longitude_rad);
+  cos_m_[0] = 1.0;
+  sin_m_[0] = 0.0;
+  for (size_t m = 1; m <= degree_; m++) {
+    cos_m_[m] = cos_m_[m - 1] * cph - sin_m_[m - 1] * sph;
+    sin_m_[m] = sin_m_[m - 1] * cph + cos_m_[m - 1] * sph;
+  }
+
+  const double ratio = 6371.2 / r;
+  double ratio_power = ratio * ratio;
+  double north = 0.0, east = 0.0, down = 0.0;
+  for (size_t n = 1; n <= degree_; n++) {
+    ratio_power *= ratio;
+    double north_n = 0.0, east_n = 0.0, down_n = 0.0;
+    for (size_t m = 0; m <= n; m++) {
+      const size_t i = IgrfModel::GetCoefficientIndex(n, m);
+      const double cos_term = g_[i] * cos_m_[m] + h_[i] * sin_m_[m];
+      const double sin_term = g_[i] * sin_m_[m] - h_[i] * cos_m_[m];
+      north_n += cos_term * dp_[i];
+      east_n += (double)m * sin_term * p_[i];
+      down_n += cos_term * p_[i];
+    }
+    north += ratio_power * north_n;
+    east += ratio_power * east_n;
+    down -= ratio_power * (n + 1.0) * down_n;
+  }
+  libra::Vector<3> field_ned_nT;
+  field_ned_nT[0] = north;
+  field_ned_nT[1] = east / sth;
+  field_ned_nT[2] = down;
+  return field_ned_nT;
+}
+
+/**
+ * @fn MeasureTime_us
+ * @brief Measure the average execution time of the function [us]
+ */
+template <typename Function>
+static double MeasureTime_us(const size_t number_of_calls, Function function) {
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < number_of_calls; i++) function(i);
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count() / (double)number_of_calls;
+}
+
+int main(int argc, char* argv[]) {
+  // Usage: benchmark_igrf_model [coefficient file]
+  const std::string file_name = (argc > 1) ? argv[1] : "src/library/external/igrf/igrf13.coef";
+  std::shared_ptr<const IgrfCoefficients> coefficients = IgrfModel::ReadCoefficients(file_name);
+  if (coefficients == nullptr) return 1;
+  const double decimal_year = coefficients->epochs_year.back() + 2.5;
+  ReferenceIgrfModel reference(*coefficients, decimal_year);
+  IgrfModel target(coefficients);
+
+  printf("number_of_positions, reference_us, scalar_us, batch_us, max_relative_error\n");
+  const size_t sizes[] = {1, 4, 16, 64, 256, 1024};
+  for (const size_t size : sizes) {
+    // Positions around LEO
+    std::vector<double> latitudes_rad(size), longitudes_rad(size), altitudes_m(size);
+    IgrfModelBatch batch(size);
+    for (size_t i = 0; i < size; i++) {
+      latitudes_rad[i] = 1.5 * sin(0.37 * i);
+      longitudes_rad[i] = fmod(0.91 * i, 6.28) - 3.14;
+      altitudes_m[i] = 4.0e5 + 1.0e3 * (i % 300);
+      batch.SetPosition(i, latitudes_rad[i], longitudes_rad[i], altitudes_m[i]);
+    }
+
+    const size_t number_of_calls = 400000 / size + 10;
+    double sum = 0.0;  // Prevent optimizing out the calculation
+    const double reference_us = MeasureTime_us(number_of_calls * size, [&](size_t i) {
+      sum += reference.CalcMagneticField_ned_nT(latitudes_rad[i % size], longitudes_rad[i % size], altitudes_m[i % size])[0];
+    });
+    const double scalar_us = MeasureTime_us(number_of_calls * size, [&](size_t i) {
+      sum += target.CalcMagneticField_ned_nT(decimal_year, latitudes_rad[i % size], longitudes_rad[i % size], altitudes_m[i % size])[0];
+    });
+    const double batch_us = MeasureTime_us(number_of_calls, [&](size_t) {
+                              target.CalcMagneticFieldBatch(batch, decimal_year, 0.0);
+                              sum += batch.GetMagneticFields_ned_nT(0)[0];
+                            }) /
+                            (double)size;
+
+    double max_error = 0.0;
+    for (size_t i = 0; i < size; i++) {
+      const libra::Vector<3> reference_ned_nT = reference.CalcMagneticField_ned_nT(latitudes_rad[i], longitudes_rad[i], altitudes_m[i]);
+      const libra::Vector<3> scalar_ned_nT = target.CalcMagneticField_ned_nT(decimal_year, latitudes_rad[i], longitudes_rad[i], altitudes_m[i]);
+      const double norm = reference_ned_nT.CalcNorm();
+      max_error = fmax(max_error, (scalar_ned_nT - reference_ned_nT).CalcNorm() / norm);
+      max_error = fmax(max_error, (batch.GetMagneticField_ned_nT(i) - reference_ned_nT).CalcNorm() / norm);
+    }
+
+    printf("%zu, %f, %f, %f, %e\n", size, reference_us, scalar_us, batch_us, max_error);
+    if (sum == 0.0) printf("\n");
+  }
+
+  return 0;
+}
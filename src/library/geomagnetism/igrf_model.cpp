@@ -0,0 +1,408 @@
+/**
+ * @file igrf_model.cpp
+ * @brief Class to calculate the geomagnetic field with IGRF (International Geomagnetic Reference Field) model
+ */
+
+#include "igrf_model.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include "../math/simd.hpp"
+
+using libra::PackedDouble;
+
+// Constants of the coordinate conversion [km]
+static const double kEquatorialRadius_km = 6378.137;  //!< Equatorial radius of WGS84 ellipsoid [km]
+static const double kInverseFlattening = 298.25722;   //!< Inverse flattening of WGS84 ellipsoid
+static const double kReferenceRadius_km = 6371.2;     //!< Reference radius of IGRF model [km]
+static const double kMinimumSinColatitude = 1.0e-10;  //!< Minimum sine of the colatitude to avoid the division by zero at the poles
+
+/**
+ * @fn ConvertToGeocentric
+ * @brief Convert the geodetic latitude and altitude to the geocentric radius and colatitude
+ * @param [in] latitude_rad: Geodetic latitude [rad]
+ * @param [in] altitude_m: Altitude from the WGS84 ellipsoid [m]
+ * @param [out] radius_km: Geocentric radius [km]
+ * @param [out] cos_colatitude: Cosine of the geocentric colatitude
+ */
+static void ConvertToGeocentric(const double latitude_rad, const double altitude_m, double& radius_km, double& cos_colatitude) {
+  const double altitude_km = altitude_m / 1000.0;
+  const double polar_radius_km = kEquatorialRadius_km * (1.0 - 1.0 / kInverseFlattening);
+  const double equatorial_radius2 = kEquatorialRadius_km * kEquatorialRadius_km;
+  const double polar_radius2 = polar_radius_km * polar_radius_km;
+  const double sin_latitude = sin(latitude_rad);
+  const double sin_latitude2 = sin_latitude * sin_latitude;
+  const double cos_latitude2 = 1.0 - sin_latitude2;
+  const double radius_of_curvature2 = equatorial_radius2 * cos_latitude2 + polar_radius2 * sin_latitude2;
+  const double radius_of_curvature = sqrt(radius_of_curvature2);
+  const double surface_radius2 =
+      (equatorial_radius2 * equatorial_radius2 * cos_latitude2 + polar_radius2 * polar_radius2 * sin_latitude2) / radius_of_curvature2;
+  radius_km = sqrt(surface_radius2 + 2.0 * altitude_km * radius_of_curvature + altitude_km * altitude_km);
+  cos_colatitude = sin_latitude * (altitude_km + polar_radius2 / radius_of_curvature) / radius_km;
+}
+
+IgrfModel::IgrfModel(std::shared_ptr<const IgrfCoefficients> coefficients)
+    : coefficients_(coefficients != nullptr ? coefficients : std::make_shared<IgrfCoefficients>()), decimal_year_(std::nan("")) {
+  const size_t degree = coefficients_->degree;
+  const size_t number_of_coefficients = GetCoefficientIndex(degree, degree) + 1;
+  g_nT_.assign(number_of_coefficients, 0.0);
+  h_nT_.assign(number_of_coefficients, 0.0);
+  legendre_.assign(number_of_coefficients, 0.0);
+  legendre_derivative_.assign(number_of_coefficients, 0.0);
+  cos_m_longitude_.assign(degree + 1, 0.0);
+  sin_m_longitude_.assign(degree + 1, 0.0);
+
+  // Factors of the recursion of the Schmidt semi-normalized associated Legendre functions
+  legendre_diagonal_factor_.assign(degree + 1, 1.0);
+  legendre_factor_1_.assign(number_of_coefficients, 0.0);
+  legendre_factor_2_.assign(number_of_coefficients, 0.0);
+  for (size_t n = 2; n <= degree; n++) {
+    legendre_diagonal_factor_[n] = sqrt((2.0 * n - 1.0) / (2.0 * n));
+  }
+  for (size_t n = 1; n <= degree; n++) {
+    for (size_t m = 0; m < n; m++) {
+      const double denominator = sqrt((double)(n * n - m * m));
+      legendre_factor_1_[GetCoefficientIndex(n, m)] = (2.0 * n - 1.0) / denominator;
+      legendre_factor_2_[GetCoefficientIndex(n, m)] = sqrt((double)((n - 1) * (n - 1) - m * m)) / denominator;
+    }
+  }
+}
+
+std::shared_ptr<const IgrfCoefficients> IgrfModel::ReadCoefficients(const std::string& file_name) {
+  std::ifstream file(file_name);
+  if (!file.is_open()) {
+    std::cerr << "IGRF coefficient file not found: " << file_name << std::endl;
+    return nullptr;
+  }
+  std::shared_ptr<IgrfCoefficients> coefficients = std::make_shared<IgrfCoefficients>();
+
+  // Line 1: maximum degree, number of columns, and valid period
+  std::string line;
+  size_t number_of_columns = 0;
+  std::getline(file, line);
+  std::istringstream header(line);
+  if (!(header >> coefficients->degree >> number_of_columns >> coefficients->valid_start_year >> coefficients->valid_end_year) ||
+      coefficients->degree < 1 || number_of_columns < 2) {
+    std::cerr << "IGRF coefficient file has an invalid header: " << file_name << std::endl;
+    return nullptr;
+  }
+
+  // Line 2: epochs of the columns (the last column is the secular variation)
+  const size_t number_of_epochs = number_of_columns - 1;
+  std::getline(file, line);
+  std::istringstream epoch_line(line);
+  std::string label;
+  int n_label, m_label;
+  epoch_line >> label >> n_label >> m_label;
+  coefficients->epochs_year.resize(number_of_epochs);
+  for (size_t i = 0; i < number_of_epochs; i++) {
+    if (!(epoch_line >> coefficients->epochs_year[i]) || (i > 0 && coefficients->epochs_year[i] <= coefficients->epochs_year[i - 1])) {
+      std::cerr << "IGRF coefficient file has invalid epochs: " << file_name << std::endl;
+      return nullptr;
+    }
+  }
+
+  // Following lines: coefficients of each degree and order
+  const size_t number_of_coefficients = GetCoefficientIndex(coefficients->degree, coefficients->degree) + 1;
+  coefficients->g_nT.assign(number_of_epochs, std::vector<double>(number_of_coefficients, 0.0));
+  coefficients->h_nT.assign(number_of_epochs, std::vector<double>(number_of_coefficients, 0.0));
+  coefficients->secular_variation_g_nT.assign(number_of_coefficients, 0.0);
+  coefficients->secular_variation_h_nT.assign(number_of_coefficients, 0.0);
+  while (std::getline(file, line)) {
+    std::istringstream coefficient_line(line);
+    if (!(coefficient_line >> label >> n_label >> m_label)) continue;
+    if ((label != "g" && label != "h") || n_label < 1 || m_label < 0 || m_label > n_label || (size_t)n_label > coefficients->degree) {
+      std::cerr << "IGRF coefficient file has an invalid line: " << line << std::endl;
+      return nullptr;
+    }
+    const size_t index = GetCoefficientIndex(n_label, m_label);
+    std::vector<std::vector<double>>& values = (label == "g") ? coefficients->g_nT : coefficients->h_nT;
+    std::vector<double>& secular_variation = (label == "g") ? coefficients->secular_variation_g_nT : coefficients->secular_variation_h_nT;
+    for (size_t i = 0; i < number_of_epochs; i++) coefficient_line >> values[i][index];
+    coefficient_line >> secular_variation[index];
+    if (coefficient_line.fail()) {
+      std::cerr << "IGRF coefficient file has a short line: " << line << std::endl;
+      return nullptr;
+    }
+  }
+  return coefficients;
+}
+
+void IgrfModel::SetDecimalYear(const double decimal_year) {
+  if (decimal_year == decimal_year_) return;
+  decimal_year_ = decimal_year;
+
+  const IgrfCoefficients& coefficients = *coefficients_;
+  const size_t number_of_epochs = coefficients.epochs_year.size();
+  if (number_of_epochs == 0) return;
+  if (!is_out_of_range_warned_ && (decimal_year < coefficients.valid_start_year || decimal_year > coefficients.valid_end_year)) {
+    std::cerr << "IGRF model is not defined for the year " << decimal_year << std::endl;
+    is_out_of_range_warned_ = true;
+  }
+
+  if (number_of_epochs == 1 || decimal_year >= coefficients.epochs_year.back()) {
+    // Extrapolation with the secular variation after the last epoch
+    const double elapsed_year = decimal_year - coefficients.epochs_year.back();
+    for (size_t i = 0; i < g_nT_.size(); i++) {
+      g_nT_[i] = coefficients.g_nT.back()[i] + coefficients.secular_variation_g_nT[i] * elapsed_year;
+      h_nT_[i] = coefficients.h_nT.back()[i] + coefficients.secular_variation_h_nT[i] * elapsed_year;
+    }
+    return;
+  }
+
+  // Linear interpolation between the epochs (the first interval is extrapolated before the first epoch)
+  const std::vector<double>& epochs_year = coefficients.epochs_year;
+  const size_t upper = std::upper_bound(epochs_year.begin(), epochs_year.end(), decimal_year) - epochs_year.begin();
+  const size_t k = std::min(std::max(upper, (size_t)1), number_of_epochs - 1) - 1;
+  const double ratio = (decimal_year - epochs_year[k]) / (epochs_year[k + 1] - epochs_year[k]);
+  for (size_t i = 0; i < g_nT_.size(); i++) {
+    g_nT_[i] = coefficients.g_nT[k][i] + (coefficients.g_nT[k + 1][i] - coefficients.g_nT[k][i]) * ratio;
+    h_nT_[i] = coefficients.h_nT[k][i] + (coefficients.h_nT[k + 1][i] - coefficients.h_nT[k][i]) * ratio;
+  }
+}
+
+libra::Vector<3> IgrfModel::CalcMagneticField_ned_nT(const double decimal_year, const double latitude_rad, const double longitude_rad,
+                                                     const double altitude_m) {
+  SetDecimalYear(decimal_year);
+
+  double radius_km;
+  ConvertToGeocentric(latitude_rad, altitude_m, radius_km, cos_colatitude_);
+  const double sin_colatitude = std::max(sqrt(std::max(1.0 - cos_colatitude_ * cos_colatitude_, 0.0)), kMinimumSinColatitude);
+
+  CalcLegendreFunctions(cos_colatitude_, sin_colatitude);
+  const size_t degree = coefficients_->degree;
+  const double cos_longitude = cos(longitude_rad);
+  const double sin_longitude = sin(longitude_rad);
+  cos_m_longitude_[0] = 1.0;
+  sin_m_longitude_[0] = 0.0;
+  for (size_t m = 1; m <= degree; m++) {
+    cos_m_longitude_[m] = cos_m_longitude_[m - 1] * cos_longitude - sin_m_longitude_[m - 1] * sin_longitude;
+    sin_m_longitude_[m] = sin_m_longitude_[m - 1] * cos_longitude + cos_m_longitude_[m - 1] * sin_longitude;
+  }
+
+  // Sum of the spherical harmonics
+  const double radius_ratio = kReferenceRadius_km / radius_km;
+  double radius_ratio_power = radius_ratio * radius_ratio;  // (a/r)^(n+2)
+  double north_nT = 0.0, east_nT = 0.0, down_nT = 0.0;
+  for (size_t n = 1; n <= degree; n++) {
+    radius_ratio_power *= radius_ratio;
+    double north_n = 0.0, east_n = 0.0, down_n = 0.0;
+    for (size_t m = 0; m <= n; m++) {
+      const size_t index = GetCoefficientIndex(n, m);
+      const double cos_term = g_nT_[index] * cos_m_longitude_[m] + h_nT_[index] * sin_m_longitude_[m];
+      const double sin_term = g_nT_[index] * sin_m_longitude_[m] - h_nT_[index] * cos_m_longitude_[m];
+      north_n += cos_term * legendre_derivative_[index];
+      east_n += (double)m * sin_term * legendre_[index];
+      down_n += cos_term * legendre_[index];
+    }
+    north_nT += radius_ratio_power * north_n;
+    east_nT += radius_ratio_power * east_n;
+    down_nT -= radius_ratio_power * (double)(n + 1) * down_n;
+  }
+  east_nT /= sin_colatitude;
+
+  libra::Vector<3> magnetic_field_ned_nT;
+  magnetic_field_ned_nT[0] = north_nT;
+  magnetic_field_ned_nT[1] = east_nT;
+  magnetic_field_ned_nT[2] = down_nT;
+  return magnetic_field_ned_nT;
+}
+
+libra::Vector<3> IgrfModel::CalcMagneticField_i_nT(const double decimal_year, const double latitude_rad, const double longitude_rad,
+                                                   const double altitude_m, const double greenwich_sidereal_time_rad) {
+  const libra::Vector<3> magnetic_field_ned_nT = CalcMagneticField_ned_nT(decimal_year, latitude_rad, longitude_rad, altitude_m);
+
+  // Rotation around Y axis by (pi - colatitude) converts the NED frame to the frame fixed on the earth at the longitude
+  const double sin_colatitude = sqrt(std::max(1.0 - cos_colatitude_ * cos_colatitude_, 0.0));
+  const double cos_angle = -cos_colatitude_;  // cos(pi - colatitude)
+  const double sin_angle = sin_colatitude;    // sin(pi - colatitude)
+  const double x_nT = cos_angle * magnetic_field_ned_nT[0] - sin_angle * magnetic_field_ned_nT[2];
+  const double y_nT = magnetic_field_ned_nT[1];
+  const double z_nT = sin_angle * magnetic_field_ned_nT[0] + cos_angle * magnetic_field_ned_nT[2];
+
+  // Rotation around Z axis by the longitude and the sidereal time
+  const double angle_rad = longitude_rad + greenwich_sidereal_time_rad;
+  const double cos_z = cos(angle_rad);
+  const double sin_z = sin(angle_rad);
+  libra::Vector<3> magnetic_field_i_nT;
+  magnetic_field_i_nT[0] = cos_z * x_nT - sin_z * y_nT;
+  magnetic_field_i_nT[1] = sin_z * x_nT + cos_z * y_nT;
+  magnetic_field_i_nT[2] = z_nT;
+  return magnetic_field_i_nT;
+}
+
+void IgrfModel::CalcMagneticFieldBatch(IgrfModelBatch& batch, const double decimal_year, const double greenwich_sidereal_time_rad) {
+  const size_t size = batch.padded_size_;
+  for (size_t axis = 0; axis < 3; axis++) {
+    std::fill(batch.magnetic_field_ned_nT_[axis].begin(), batch.magnetic_field_ned_nT_[axis].end(), 0.0);
+    std::fill(batch.magnetic_field_i_nT_[axis].begin(), batch.magnetic_field_i_nT_[axis].end(), 0.0);
+  }
+  if (batch.number_of_positions_ == 0) return;
+  SetDecimalYear(decimal_year);
+
+  // The padding positions copy the first position to keep the calculation finite
+  for (size_t p = batch.number_of_positions_; p < size; p++) {
+    batch.latitude_rad_[p] = batch.latitude_rad_[0];
+    batch.longitude_rad_[p] = batch.longitude_rad_[0];
+    batch.altitude_m_[p] = batch.altitude_m_[0];
+  }
+
+  // Allocated only when the batch or the degree becomes larger than the previous call
+  const size_t degree = coefficients_->degree;
+  const size_t lanes = PackedDouble::kNumberOfLanes;
+  const size_t number_of_coefficients = g_nT_.size();
+  if (batch.cos_colatitude_.size() < size) {
+    batch.cos_colatitude_.resize(size);
+    batch.sin_colatitude_.resize(size);
+    batch.inverse_sin_colatitude_.resize(size);
+    batch.radius_ratio_.resize(size);
+    batch.cos_longitude_.resize(size);
+    batch.sin_longitude_.resize(size);
+  }
+  if (batch.legendre_.size() < number_of_coefficients * lanes) {
+    batch.legendre_.resize(number_of_coefficients * lanes);
+    batch.legendre_derivative_.resize(number_of_coefficients * lanes);
+    batch.cos_m_longitude_.resize((degree + 1) * lanes);
+    batch.sin_m_longitude_.resize((degree + 1) * lanes);
+  }
+
+  // Position dependent values (scalar because of the trigonometric functions)
+  for (size_t p = 0; p < size; p++) {
+    double radius_km, cos_colatitude;
+    ConvertToGeocentric(batch.latitude_rad_[p], batch.altitude_m_[p], radius_km, cos_colatitude);
+    const double sin_colatitude = std::max(sqrt(std::max(1.0 - cos_colatitude * cos_colatitude, 0.0)), kMinimumSinColatitude);
+    batch.cos_colatitude_[p] = cos_colatitude;
+    batch.sin_colatitude_[p] = sin_colatitude;
+    batch.inverse_sin_colatitude_[p] = 1.0 / sin_colatitude;
+    batch.radius_ratio_[p] = kReferenceRadius_km / radius_km;
+    batch.cos_longitude_[p] = cos(batch.longitude_rad_[p]);
+    batch.sin_longitude_[p] = sin(batch.longitude_rad_[p]);
+  }
+
+  // Same procedure with CalcMagneticField_ned_nT and CalcMagneticField_i_nT for the positions in a SIMD pack
+  const PackedDouble zero = PackedDouble::Broadcast(0.0), one = PackedDouble::Broadcast(1.0);
+  const PackedDouble cos_sidereal_time = PackedDouble::Broadcast(cos(greenwich_sidereal_time_rad));
+  const PackedDouble sin_sidereal_time = PackedDouble::Broadcast(sin(greenwich_sidereal_time_rad));
+  double* legendre = batch.legendre_.data();
+  double* legendre_derivative = batch.legendre_derivative_.data();
+  double* cos_m_longitude = batch.cos_m_longitude_.data();
+  double* sin_m_longitude = batch.sin_m_longitude_.data();
+  for (size_t p = 0; p < size; p += lanes) {
+    const PackedDouble cos_colatitude = PackedDouble::Load(&batch.cos_colatitude_[p]);
+    const PackedDouble sin_colatitude = PackedDouble::Load(&batch.sin_colatitude_[p]);
+
+    // Legendre functions
+    one.Store(legendre);
+    zero.Store(legendre_derivative);
+    for (size_t n = 1; n <= degree; n++) {
+      const size_t diagonal = GetCoefficientIndex(n, n) * lanes;
+      const size_t previous_diagonal = GetCoefficientIndex(n - 1, n - 1) * lanes;
+      const PackedDouble factor = PackedDouble::Broadcast(legendre_diagonal_factor_[n]);
+      const PackedDouble legendre_previous = PackedDouble::Load(legendre + previous_diagonal);
+      const PackedDouble legendre_derivative_previous = PackedDouble::Load(legendre_derivative + previous_diagonal);
+      (factor * sin_colatitude * legendre_previous).Store(legendre + diagonal);
+      (factor * (cos_colatitude * legendre_previous + sin_colatitude * legendre_derivative_previous)).Store(legendre_derivative + diagonal);
+
+      for (size_t m = 0; m < n; m++) {
+        const size_t index = GetCoefficientIndex(n, m);
+        const size_t index_1 = GetCoefficientIndex(n - 1, m) * lanes;
+        const PackedDouble factor_1 = PackedDouble::Broadcast(legendre_factor_1_[index]);
+        const PackedDouble legendre_1 = PackedDouble::Load(legendre + index_1);
+        const PackedDouble legendre_derivative_1 = PackedDouble::Load(legendre_derivative + index_1);
+        PackedDouble legendre_n = factor_1 * cos_colatitude * legendre_1;
+        PackedDouble legendre_derivative_n = factor_1 * (cos_colatitude * legendre_derivative_1 - sin_colatitude * legendre_1);
+        if (n >= m + 2) {
+          const size_t index_2 = GetCoefficientIndex(n - 2, m) * lanes;
+          const PackedDouble factor_2 = PackedDouble::Broadcast(legendre_factor_2_[index]);
+          legendre_n = legendre_n - factor_2 * PackedDouble::Load(legendre + index_2);
+          legendre_derivative_n = legendre_derivative_n - factor_2 * PackedDouble::Load(legendre_derivative + index_2);
+        }
+        legendre_n.Store(legendre + index * lanes);
+        legendre_derivative_n.Store(legendre_derivative + index * lanes);
+      }
+    }
+
+    // cos(m * longitude) and sin(m * longitude)
+    const PackedDouble cos_longitude = PackedDouble::Load(&batch.cos_longitude_[p]);
+    const PackedDouble sin_longitude = PackedDouble::Load(&batch.sin_longitude_[p]);
+    one.Store(cos_m_longitude);
+    zero.Store(sin_m_longitude);
+    for (size_t m = 1; m <= degree; m++) {
+      const PackedDouble cos_previous = PackedDouble::Load(cos_m_longitude + (m - 1) * lanes);
+      const PackedDouble sin_previous = PackedDouble::Load(sin_m_longitude + (m - 1) * lanes);
+      (cos_previous * cos_longitude - sin_previous * sin_longitude).Store(cos_m_longitude + m * lanes);
+      (sin_previous * cos_longitude + cos_previous * sin_longitude).Store(sin_m_longitude + m * lanes);
+    }
+
+    // Sum of the spherical harmonics
+    const PackedDouble radius_ratio = PackedDouble::Load(&batch.radius_ratio_[p]);
+    PackedDouble radius_ratio_power = radius_ratio * radius_ratio;  // (a/r)^(n+2)
+    PackedDouble north = zero, east = zero, down = zero;
+    for (size_t n = 1; n <= degree; n++) {
+      radius_ratio_power = radius_ratio_power * radius_ratio;
+      PackedDouble north_n = zero, east_n = zero, down_n = zero;
+      for (size_t m = 0; m <= n; m++) {
+        const size_t index = GetCoefficientIndex(n, m);
+        const PackedDouble g = PackedDouble::Broadcast(g_nT_[index]), h = PackedDouble::Broadcast(h_nT_[index]);
+        const PackedDouble cos_m = PackedDouble::Load(cos_m_longitude + m * lanes), sin_m = PackedDouble::Load(sin_m_longitude + m * lanes);
+        const PackedDouble cos_term = g * cos_m + h * sin_m;
+        const PackedDouble sin_term = g * sin_m - h * cos_m;
+        const PackedDouble legendre_nm = PackedDouble::Load(legendre + index * lanes);
+        north_n += cos_term * PackedDouble::Load(legendre_derivative + index * lanes);
+        east_n += PackedDouble::Broadcast((double)m) * sin_term * legendre_nm;
+        down_n += cos_term * legendre_nm;
+      }
+      north += radius_ratio_power * north_n;
+      east += radius_ratio_power * east_n;
+      down = down - radius_ratio_power * PackedDouble::Broadcast((double)(n + 1)) * down_n;
+    }
+    east = east * PackedDouble::Load(&batch.inverse_sin_colatitude_[p]);
+    north.Store(&batch.magnetic_field_ned_nT_[0][p]);
+    east.Store(&batch.magnetic_field_ned_nT_[1][p]);
+    down.Store(&batch.magnetic_field_ned_nT_[2][p]);
+
+    // Inertial frame
+    const PackedDouble x = zero - cos_colatitude * north - sin_colatitude * down;
+    const PackedDouble z = sin_colatitude * north - cos_colatitude * down;
+    const PackedDouble cos_z = cos_longitude * cos_sidereal_time - sin_longitude * sin_sidereal_time;
+    const PackedDouble sin_z = sin_longitude * cos_sidereal_time + cos_longitude * sin_sidereal_time;
+    (cos_z * x - sin_z * east).Store(&batch.magnetic_field_i_nT_[0][p]);
+    (sin_z * x + cos_z * east).Store(&batch.magnetic_field_i_nT_[1][p]);
+    z.Store(&batch.magnetic_field_i_nT_[2][p]);
+  }
+}
+
+void IgrfModel::CalcLegendreFunctions(const double cos_colatitude, const double sin_colatitude) {
+  const size_t degree = coefficients_->degree;
+  legendre_[0] = 1.0;
+  legendre_derivative_[0] = 0.0;
+  for (size_t n = 1; n <= degree; n++) {
+    // Sectorial term (n = m)
+    const size_t diagonal = GetCoefficientIndex(n, n);
+    const size_t previous_diagonal = GetCoefficientIndex(n - 1, n - 1);
+    const double factor = legendre_diagonal_factor_[n];
+    legendre_[diagonal] = factor * sin_colatitude * legendre_[previous_diagonal];
+    legendre_derivative_[diagonal] =
+        factor * (cos_colatitude * legendre_[previous_diagonal] + sin_colatitude * legendre_derivative_[previous_diagonal]);
+
+    // Other terms (n > m)
+    for (size_t m = 0; m < n; m++) {
+      const size_t index = GetCoefficientIndex(n, m);
+      const size_t index_1 = GetCoefficientIndex(n - 1, m);
+      const double factor_1 = legendre_factor_1_[index];
+      double legendre = factor_1 * cos_colatitude * legendre_[index_1];
+      double legendre_derivative = factor_1 * (cos_colatitude * legendre_derivative_[index_1] - sin_colatitude * legendre_[index_1]);
+      if (n >= m + 2) {
+        const size_t index_2 = GetCoefficientIndex(n - 2, m);
+        legendre -= legendre_factor_2_[index] * legendre_[index_2];
+        legendre_derivative -= legendre_factor_2_[index] * legendre_derivative_[index_2];
+      }
+      legendre_[index] = legendre;
+      legendre_derivative_[index] = legendre_derivative;
+    }
+  }
+}
@@ -0,0 +1,149 @@
+/**
+ * @file igrf_model.hpp
+ * @brief Class to calculate the geomagnetic field with IGRF (International Geomagnetic Reference Field) model
+ */
+
+#ifndef S2E_LIBRARY_GEOMAGNETISM_IGRF_MODEL_HPP_
+#define S2E_LIBRARY_GEOMAGNETISM_IGRF_MODEL_HPP_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../math/vector.hpp"
+#include "igrf_model_batch.hpp"
+
+/**
+ * @struct IgrfCoefficients
+ * @brief Schmidt semi-normalized coefficients of IGRF model read from the coefficient file
+ * @details The coefficients are packed degree by degree (see IgrfModel::GetCoefficientIndex). They are not changed after the reading, so
+ *          they can be shared by the models in all threads.
+ */
+struct IgrfCoefficients {
+  size_t degree = 0;                           //!< Maximum degree
+  double valid_start_year = 0.0;               //!< Start of the valid period [year]
+  double valid_end_year = 0.0;                 //!< End of the valid period [year]
+  std::vector<double> epochs_year;             //!< Epochs of the coefficients [year]
+  std::vector<std::vector<double>> g_nT;       //!< Cosine coefficients of each epoch [nT]
+  std::vector<std::vector<double>> h_nT;       //!< Sine coefficients of each epoch [nT]
+  std::vector<double> secular_variation_g_nT;  //!< Secular variation of the cosine coefficients after the last epoch [nT/year]
+  std::vector<double> secular_variation_h_nT;  //!< Secular variation of the sine coefficients after the last epoch [nT/year]
+};
+
+/**
+ * @class IgrfModel
+ * @brief Class to calculate the geomagnetic field with IGRF model
+ * @details The coefficients are shared by the copies of the object, and each object owns the coefficients interpolated for the decimal year of
+ *          the last calculation and the workspace of the calculation. So the objects can be used in different threads at the same time, and
+ *          the calculation does not allocate memory. The factors of the Legendre recursion are precomputed at the construction.
+ */
+class IgrfModel {
+ public:
+  /**
+   * @fn IgrfModel
+   * @brief Constructor
+   * @param [in] coefficients: Coefficients read by ReadCoefficients
+   */
+  explicit IgrfModel(std::shared_ptr<const IgrfCoefficients> coefficients);
+
+  /**
+   * @fn ReadCoefficients
+   * @brief Read the IGRF coefficient file (e.g. igrf13.coef)
+   * @param [in] file_name: Path to the coefficient file
+   * @return Coefficients or nullptr when the reading failed
+   */
+  static std::shared_ptr<const IgrfCoefficients> ReadCoefficients(const std::string& file_name);
+
+  /**
+   * @fn CalcMagneticField_ned_nT
+   * @brief Calculate the magnetic field in the local north-east-down frame of the geocentric spherical coordinate
+   * @param [in] decimal_year: Decimal year [year]
+   * @param [in] latitude_rad: Geodetic latitude [rad]
+   * @param [in] longitude_rad: Longitude [rad]
+   * @param [in] altitude_m: Altitude from the WGS84 ellipsoid [m]
+   * @return Magnetic field [nT]
+   */
+  libra::Vector<3> CalcMagneticField_ned_nT(const double decimal_year, const double latitude_rad, const double longitude_rad,
+                                            const double altitude_m);
+  /**
+   * @fn CalcMagneticField_i_nT
+   * @brief Calculate the magnetic field in the inertial frame
+   * @param [in] decimal_year: Decimal year [year]
+   * @param [in] latitude_rad: Geodetic latitude [rad]
+   * @param [in] longitude_rad: Longitude [rad]
+   * @param [in] altitude_m: Altitude from the WGS84 ellipsoid [m]
+   * @param [in] greenwich_sidereal_time_rad: Greenwich sidereal time [rad]
+   * @return Magnetic field [nT]
+   */
+  libra::Vector<3> CalcMagneticField_i_nT(const double decimal_year, const double latitude_rad, const double longitude_rad, const double altitude_m,
+                                          const double greenwich_sidereal_time_rad);
+
+  /**
+   * @fn CalcMagneticFieldBatch
+   * @brief Calculate the magnetic field for all positions in the batch
+   * @note The positions are processed by SIMD instructions, and each interpolated coefficient is read once for the positions in a SIMD pack.
+   * @param [in,out] batch: Positions and the calculated magnetic fields in the local north-east-down and the inertial frames
+   * @param [in] decimal_year: Decimal year [year]
+   * @param [in] greenwich_sidereal_time_rad: Greenwich sidereal time [rad]
+   */
+  void CalcMagneticFieldBatch(IgrfModelBatch& batch, const double decimal_year, const double greenwich_sidereal_time_rad);
+
+  /**
+   * @fn SetDecimalYear
+   * @brief Interpolate the coefficients for the decimal year
+   * @note The coefficients are interpolated only when the decimal year is changed from the last call
+   * @param [in] decimal_year: Decimal year [year]
+   */
+  void SetDecimalYear(const double decimal_year);
+
+  // Getter
+  /**
+   * @fn GetDegree
+   * @brief Return maximum degree
+   */
+  inline size_t GetDegree() const { return coefficients_->degree; }
+  /**
+   * @fn GetCoefficients
+   * @brief Return the shared coefficients
+   */
+  inline const std::shared_ptr<const IgrfCoefficients>& GetCoefficients() const { return coefficients_; }
+
+  /**
+   * @fn GetCoefficientIndex
+   * @brief Return index of the packed coefficient arrays
+   * @param [in] n: Degree
+   * @param [in] m: Order (m <= n)
+   */
+  static inline size_t GetCoefficientIndex(const size_t n, const size_t m) { return n * (n + 1) / 2 + m; }
+
+ private:
+  std::shared_ptr<const IgrfCoefficients> coefficients_;  //!< Coefficients shared by the copies
+  double decimal_year_;                                   //!< Decimal year of the interpolated coefficients [year]
+  bool is_out_of_range_warned_ = false;                   //!< Flag to warn the decimal year out of the valid period only once
+
+  // Coefficients interpolated for the decimal year (packed)
+  std::vector<double> g_nT_;  //!< Cosine coefficients [nT]
+  std::vector<double> h_nT_;  //!< Sine coefficients [nT]
+
+  // Factors of the Legendre recursion
+  std::vector<double> legendre_diagonal_factor_;  //!< Factor of P(n-1, n-1) for P(n, n) (indexed by n)
+  std::vector<double> legendre_factor_1_;         //!< Factor of P(n-1, m) for P(n, m) with n > m (packed)
+  std::vector<double> legendre_factor_2_;         //!< Factor of P(n-2, m) for P(n, m) with n > m + 1 (packed)
+
+  // Workspace
+  std::vector<double> legendre_;             //!< Schmidt semi-normalized associated Legendre functions (packed)
+  std::vector<double> legendre_derivative_;  //!< Derivative of the Legendre functions by the colatitude (packed)
+  std::vector<double> cos_m_longitude_;      //!< cos(m * longitude)
+  std::vector<double> sin_m_longitude_;      //!< sin(m * longitude)
+  double cos_colatitude_ = 1.0;              //!< Cosine of the geocentric colatitude of the last calculation
+
+  /**
+   * @fn CalcLegendreFunctions
+   * @brief Calculate the Legendre functions and the derivatives for the geocentric colatitude
+   * @param [in] cos_colatitude: Cosine of the geocentric colatitude
+   * @param [in] sin_colatitude: Sine of the geocentric colatitude
+   */
+  void CalcLegendreFunctions(const double cos_colatitude, const double sin_colatitude);
+};
+
+#endif  // S2E_LIBRARY_GEOMAGNETISM_IGRF_MODEL_HPP_
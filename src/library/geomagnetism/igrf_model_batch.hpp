@@ -0,0 +1,135 @@
+/**
+ * @file igrf_model_batch.hpp
+ * @brief Class to hold positions and results of the batched IGRF calculation
+ */
+
+#ifndef S2E_LIBRARY_GEOMAGNETISM_IGRF_MODEL_BATCH_HPP_
+#define S2E_LIBRARY_GEOMAGNETISM_IGRF_MODEL_BATCH_HPP_
+
+#include <vector>
+
+#include "../geodesy/geodetic_position.hpp"
+#include "../math/simd.hpp"
+#include "../math/vector.hpp"
+
+/**
+ * @class IgrfModelBatch
+ * @brief Positions and results of the batched IGRF calculation in the structure-of-arrays layout
+ * @note The batch also owns the workspace of the calculation, so reusing the same batch object avoids memory allocation.
+ *       The arrays are padded to a multiple of the SIMD width.
+ */
+class IgrfModelBatch {
+ public:
+  /**
+   * @fn IgrfModelBatch
+   * @brief Constructor
+   * @param [in] number_of_positions: Number of positions
+   */
+  IgrfModelBatch(const size_t number_of_positions = 0) { Resize(number_of_positions); }
+
+  /**
+   * @fn Resize
+   * @brief Change the number of positions
+   * @param [in] number_of_positions: Number of positions
+   */
+  inline void Resize(const size_t number_of_positions) {
+    const size_t lanes = libra::PackedDouble::kNumberOfLanes;
+    number_of_positions_ = number_of_positions;
+    padded_size_ = (number_of_positions + lanes - 1) / lanes * lanes;
+    latitude_rad_.resize(padded_size_, 0.0);
+    longitude_rad_.resize(padded_size_, 0.0);
+    altitude_m_.resize(padded_size_, 0.0);
+    for (size_t axis = 0; axis < 3; axis++) {
+      magnetic_field_ned_nT_[axis].resize(padded_size_, 0.0);
+      magnetic_field_i_nT_[axis].resize(padded_size_, 0.0);
+    }
+  }
+
+  /**
+   * @fn SetPosition
+   * @brief Set a position
+   * @param [in] index: Index of the position
+   * @param [in] latitude_rad: Geodetic latitude [rad]
+   * @param [in] longitude_rad: Longitude [rad]
+   * @param [in] altitude_m: Altitude from the WGS84 ellipsoid [m]
+   */
+  inline void SetPosition(const size_t index, const double latitude_rad, const double longitude_rad, const double altitude_m) {
+    latitude_rad_[index] = latitude_rad;
+    longitude_rad_[index] = longitude_rad;
+    altitude_m_[index] = altitude_m;
+  }
+  /**
+   * @fn SetPosition
+   * @brief Set a position
+   * @param [in] index: Index of the position
+   * @param [in] position: Geodetic position
+   */
+  inline void SetPosition(const size_t index, const GeodeticPosition& position) {
+    SetPosition(index, position.GetLatitude_rad(), position.GetLongitude_rad(), position.GetAltitude_m());
+  }
+
+  // Getter
+  /**
+   * @fn GetNumberOfPositions
+   * @brief Return number of positions
+   */
+  inline size_t GetNumberOfPositions() const { return number_of_positions_; }
+  /**
+   * @fn GetMagneticFields_ned_nT
+   * @brief Return head of the calculated magnetic field array of an axis in the local north-east-down frame
+   * @param [in] axis: Axis index (0: North, 1: East, 2: Down)
+   */
+  inline const double* GetMagneticFields_ned_nT(const size_t axis) const { return magnetic_field_ned_nT_[axis].data(); }
+  /**
+   * @fn GetMagneticField_ned_nT
+   * @brief Return calculated magnetic field in the local north-east-down frame of the geocentric spherical coordinate [nT]
+   * @param [in] index: Index of the position
+   */
+  inline libra::Vector<3> GetMagneticField_ned_nT(const size_t index) const {
+    libra::Vector<3> magnetic_field_ned_nT;
+    for (size_t axis = 0; axis < 3; axis++) magnetic_field_ned_nT[axis] = magnetic_field_ned_nT_[axis][index];
+    return magnetic_field_ned_nT;
+  }
+  /**
+   * @fn GetMagneticFields_i_nT
+   * @brief Return head of the calculated magnetic field array of an axis in the inertial frame
+   * @param [in] axis: Axis index (0: X, 1: Y, 2: Z)
+   */
+  inline const double* GetMagneticFields_i_nT(const size_t axis) const { return magnetic_field_i_nT_[axis].data(); }
+  /**
+   * @fn GetMagneticField_i_nT
+   * @brief Return calculated magnetic field in the inertial frame [nT]
+   * @param [in] index: Index of the position
+   */
+  inline libra::Vector<3> GetMagneticField_i_nT(const size_t index) const {
+    libra::Vector<3> magnetic_field_i_nT;
+    for (size_t axis = 0; axis < 3; axis++) magnetic_field_i_nT[axis] = magnetic_field_i_nT_[axis][index];
+    return magnetic_field_i_nT;
+  }
+
+ private:
+  friend class IgrfModel;
+
+  size_t number_of_positions_ = 0;                //!< Number of positions
+  size_t padded_size_ = 0;                        //!< Number of positions padded to a multiple of the SIMD width
+  std::vector<double> latitude_rad_;              //!< Geodetic latitudes [rad]
+  std::vector<double> longitude_rad_;             //!< Longitudes [rad]
+  std::vector<double> altitude_m_;                //!< Altitudes [m]
+  std::vector<double> magnetic_field_ned_nT_[3];  //!< Calculated magnetic fields in the local north-east-down frame [nT]
+  std::vector<double> magnetic_field_i_nT_[3];    //!< Calculated magnetic fields in the inertial frame [nT]
+
+  // Workspace of the position dependent values
+  std::vector<double> cos_colatitude_;          //!< Cosine of the geocentric colatitude
+  std::vector<double> sin_colatitude_;          //!< Sine of the geocentric colatitude
+  std::vector<double> inverse_sin_colatitude_;  //!< Inverse of the sine of the geocentric colatitude
+  std::vector<double> radius_ratio_;            //!< Reference radius divided by the geocentric radius
+  std::vector<double> cos_longitude_;           //!< Cosine of the longitude
+  std::vector<double> sin_longitude_;           //!< Sine of the longitude
+  // Workspace of the positions in a SIMD pack (indexed by the coefficient index or the order, multiplied by the number of lanes)
+  std::vector<double> legendre_;             //!< Legendre functions
+  std::vector<double> legendre_derivative_;  //!< Derivative of the Legendre functions by the colatitude
+  std::vector<double> cos_m_longitude_;      //!< cos(m * longitude)
+  std::vector<double> sin_m_longitude_;      //!< sin(m * longitude)
+};
+
+#endif  // S2E_LIBRARY_GEOMAGNETISM_IGRF_MODEL_BATCH_HPP_
@@ -0,0 +1,199 @@
+/**
+ * @file test_igrf_model.cpp
+ * @brief Test codes for IgrfModel class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+
+#include "igrf_model.hpp"
+
+static const double kReferenceRadius_km = 6371.2;
+static const double kEquatorialRadius_km = 6378.137;
+static const double kPolarRadius_km = 6378.137 * (1.0 - 1.0 / 298.25722);
+
+/**
+ * @brief Read the coefficients of degree 2 with two epochs (2000 and 2010) and the secular variation
+ * @note The coefficient file is written for the reading and removed after it
+ */
+static std::shared_ptr<const IgrfCoefficients> ReadTestCoefficients() {
+  const std::string file_path = "test_igrf_model.coef";
+  {
+    std::ofstream file(file_path);
+    file << "   2  3 2000 2015\n";
+    file << "y  0  0 2000.0 2010.0 2010-15\n";
+    file << "g  1  0 -30000 -29000 10.0\n";
+    file << "g  1  1  -2000  -1800  4.0\n";
+    file << "h  1  1   5000   4800 -6.0\n";
+    file << "g  2  0  -2000  -2400  2.0\n";
+    file << "g  2  1   3000   3100 -1.0\n";
+    file << "h  2  1  -2000  -2200  3.0\n";
+    file << "g  2  2   1600   1700  0.5\n";
+    file << "h  2  2   -400   -500 -0.5\n";
+  }
+  std::shared_ptr<const IgrfCoefficients> coefficients = IgrfModel::ReadCoefficients(file_path);
+  std::remove(file_path.c_str());
+  return coefficients;
+}
+
+/**
+ * @brief Magnetic potential of the test coefficients at 2005 [nT km]
+ * @param [in] radius_km: Geocentric radius [km]
+ * @param [in] colatitude_rad: Geocentric colatitude [rad]
+ * @param [in] longitude_rad: Longitude [rad]
+ */
+static double CalcTestPotential(const double radius_km, const double colatitude_rad, const double longitude_rad) {
+  const double c = cos(colatitude_rad), s = sin(colatitude_rad);
+  const double ratio = kReferenceRadius_km / radius_km;
+  const double degree_1 = -29500.0 * c + (-1900.0 * cos(longitude_rad) + 4900.0 * sin(longitude_rad)) * s;
+  const double degree_2 = -2200.0 * (1.5 * c * c - 0.5) + (3050.0 * cos(longitude_rad) - 2100.0 * sin(longitude_rad)) * sqrt(3.0) * c * s +
+                          (1650.0 * cos(2.0 * longitude_rad) - 450.0 * sin(2.0 * longitude_rad)) * 0.5 * sqrt(3.0) * s * s;
+  return kReferenceRadius_km * (ratio * ratio * degree_1 + ratio * ratio * ratio * degree_2);
+}
+
+/**
+ * @brief Test for reading the coefficient file
+ */
+TEST(IgrfModel, ReadCoefficients) {
+  std::shared_ptr<const IgrfCoefficients> coefficients = ReadTestCoefficients();
+  ASSERT_NE(nullptr, coefficients);
+  EXPECT_EQ(2u, coefficients->degree);
+  ASSERT_EQ(2u, coefficients->epochs_year.size());
+  EXPECT_DOUBLE_EQ(2010.0, coefficients->epochs_year[1]);
+  EXPECT_DOUBLE_EQ(-2200.0, coefficients->h_nT[1][IgrfModel::GetCoefficientIndex(2, 1)]);
+  EXPECT_DOUBLE_EQ(-0.5, coefficients->secular_variation_h_nT[IgrfModel::GetCoefficientIndex(2, 2)]);
+
+  EXPECT_EQ(nullptr, IgrfModel::ReadCoefficients("not_existing_igrf.coef"));
+}
+
+/**
+ * @brief Test for the field compared with the gradient of the potential
+ */
+TEST(IgrfModel, Gradient) {
+  IgrfModel model(ReadTestCoefficients());
+  const double latitudes_rad[] = {-1.5, -0.7, 0.0, 0.4, 1.2, 1.56};
+  const double longitude_rad = 2.0;
+  const double altitude_km = 600.0;
+  for (const double latitude_rad : latitudes_rad) {
+    const libra::Vector<3> field_ned_nT = model.CalcMagneticField_ned_nT(2005.0, latitude_rad, longitude_rad, altitude_km * 1000.0);
+
+    // Geocentric position
+    const double sin_latitude = sin(latitude_rad), cos_latitude = cos(latitude_rad);
+    const double normal_radius_km =
+        kEquatorialRadius_km * kEquatorialRadius_km / sqrt(pow(kEquatorialRadius_km * cos_latitude, 2.0) + pow(kPolarRadius_km * sin_latitude, 2.0));
+    const double xy_km = (normal_radius_km + altitude_km) * cos_latitude;
+    const double z_km = (normal_radius_km * pow(kPolarRadius_km / kEquatorialRadius_km, 2.0) + altitude_km) * sin_latitude;
+    const double radius_km = sqrt(xy_km * xy_km + z_km * z_km);
+    const double colatitude_rad = atan2(xy_km, z_km);
+
+    const double d = 1.0e-6;
+    const double d_km = 1.0e-3;
+    const double north_nT =
+        (CalcTestPotential(radius_km, colatitude_rad + d, longitude_rad) - CalcTestPotential(radius_km, colatitude_rad - d, longitude_rad)) /
+        (2.0 * d * radius_km);
+    const double east_nT =
+        -(CalcTestPotential(radius_km, colatitude_rad, longitude_rad + d) - CalcTestPotential(radius_km, colatitude_rad, longitude_rad - d)) /
+        (2.0 * d * radius_km * sin(colatitude_rad));
+    const double down_nT =
+        (CalcTestPotential(radius_km + d_km, colatitude_rad, longitude_rad) - CalcTestPotential(radius_km - d_km, colatitude_rad, longitude_rad)) /
+        (2.0 * d_km);
+    EXPECT_NEAR(north_nT, field_ned_nT[0], 1.0e-3);
+    EXPECT_NEAR(east_nT, field_ned_nT[1], 1.0e-3);
+    EXPECT_NEAR(down_nT, field_ned_nT[2], 1.0e-3);
+  }
+}
+
+/**
+ * @brief Test for the interpolation of the coefficients with the decimal year
+ */
+TEST(IgrfModel, DecimalYear) {
+  IgrfModel model(ReadTestCoefficients());
+  // The north component at the equator and the longitude 0 is -(a/r)^3 g10 - sqrt(3) (a/r)^4 g21
+  const double years[] = {1995.0, 2000.0, 2005.0, 2010.0, 2012.0};
+  const double expected_g10_nT[] = {-30500.0, -30000.0, -29500.0, -29000.0, -28980.0};
+  const double expected_g21_nT[] = {2950.0, 3000.0, 3050.0, 3100.0, 3098.0};
+  const double ratio = kReferenceRadius_km / kEquatorialRadius_km;
+  for (size_t i = 0; i < 5; i++) {
+    const libra::Vector<3> field_ned_nT = model.CalcMagneticField_ned_nT(years[i], 0.0, 0.0, 0.0);
+    EXPECT_NEAR(-pow(ratio, 3.0) * expected_g10_nT[i] - sqrt(3.0) * pow(ratio, 4.0) * expected_g21_nT[i], field_ned_nT[0], 1.0e-6);
+  }
+}
+
+/**
+ * @brief Test for the models used in parallel threads
+ */
+TEST(IgrfModel, Threads) {
+  std::shared_ptr<const IgrfCoefficients> coefficients = ReadTestCoefficients();
+  const size_t kNumberOfThreads = 4;
+  const size_t kNumberOfSteps = 1000;
+  auto calc = [&coefficients](const size_t thread_index, std::vector<libra::Vector<3>>& results) {
+    IgrfModel model(coefficients);
+    results.resize(kNumberOfSteps);
+    for (size_t i = 0; i < kNumberOfSteps; i++) {
+      const double t = (double)i / (double)kNumberOfSteps;
+      results[i] = model.CalcMagneticField_i_nT(2000.0 + 10.0 * t + thread_index, 1.5 * sin(10.0 * t), 6.0 * t, 5.0e5, 0.3 * thread_index);
+    }
+  };
+
+  std::vector<std::vector<libra::Vector<3>>> expected(kNumberOfThreads), results(kNumberOfThreads);
+  for (size_t k = 0; k < kNumberOfThreads; k++) calc(k, expected[k]);
+  std::vector<std::thread> threads;
+  for (size_t k = 0; k < kNumberOfThreads; k++) threads.emplace_back(calc, k, std::ref(results[k]));
+  for (auto& thread : threads) thread.join();
+
+  for (size_t k = 0; k < kNumberOfThreads; k++) {
+    for (size_t i = 0; i < kNumberOfSteps; i++) {
+      for (size_t j = 0; j < 3; j++) EXPECT_EQ(expected[k][i][j], results[k][i][j]);
+    }
+  }
+}
+
+/**
+ * @brief Test for the batched calculation compared with the calculation of each position
+ */
+TEST(IgrfModel, Batch) {
+  // Coefficients of degree 10 with a decay similar to the geomagnetic field
+  const std::string file_path = "test_igrf_model_batch.coef";
+  {
+    std::ofstream file(file_path);
+    file << "  10  3 2000 2015\n";
+    file << "y  0  0 2000.0 2010.0 2010-15\n";
+    for (size_t n = 1; n <= 10; n++) {
+      for (size_t m = 0; m <= n; m++) {
+        const double g_nT = 30000.0 / pow(n, 3.0) * cos(1.0 + n + 3.0 * m);
+        file << "g " << n << " " << m << " " << g_nT << " " << 0.9 * g_nT << " " << 0.01 * g_nT << "\n";
+        if (m == 0) continue;
+        const double h_nT = 30000.0 / pow(n, 3.0) * sin(2.0 + 3.0 * n + m);
+        file << "h " << n << " " << m << " " << h_nT << " " << 1.1 * h_nT << " " << -0.01 * h_nT << "\n";
+      }
+    }
+  }
+  IgrfModel model(IgrfModel::ReadCoefficients(file_path));
+  std::remove(file_path.c_str());
+  ASSERT_EQ(10u, model.GetDegree());
+
+  const double decimal_year = 2007.3;
+  const double greenwich_sidereal_time_rad = 1.2;
+  const size_t sizes[] = {1, 3, 13};
+  for (const size_t size : sizes) {
+    IgrfModelBatch batch(size);
+    for (size_t i = 0; i < size; i++) {
+      batch.SetPosition(i, 1.55 * cos(0.7 * i), -3.0 + 0.5 * i, 3.0e5 + 1.0e5 * i);
+    }
+    model.CalcMagneticFieldBatch(batch, decimal_year, greenwich_sidereal_time_rad);
+    EXPECT_EQ(size, batch.GetNumberOfPositions());
+    for (size_t i = 0; i < size; i++) {
+      const double latitude_rad = 1.55 * cos(0.7 * i), longitude_rad = -3.0 + 0.5 * i, altitude_m = 3.0e5 + 1.0e5 * i;
+      const libra::Vector<3> field_ned_nT = model.CalcMagneticField_ned_nT(decimal_year, latitude_rad, longitude_rad, altitude_m);
+      const libra::Vector<3> field_i_nT =
+          model.CalcMagneticField_i_nT(decimal_year, latitude_rad, longitude_rad, altitude_m, greenwich_sidereal_time_rad);
+      for (size_t axis = 0; axis < 3; axis++) {
+        EXPECT_NEAR(field_ned_nT[axis], batch.GetMagneticField_ned_nT(i)[axis], 1.0e-8);
+        EXPECT_NEAR(field_i_nT[axis], batch.GetMagneticField_i_nT(i)[axis], 1.0e-8);
+      }
+    }
+  }
+}
@@ -0,0 +1,413 @@
+/**
+ * @file benchmark_gravity_potential.cpp
+ * @brief Micro-benchmark of GravityPotential class
+ * @note The reference implementation is the former GravityPotential which allocates the V/W tables at every call.
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "gravity_potential.hpp"
+
+/**
+ * @class ReferenceGravityPotential
+ * @brief Former implementation of GravityPotential with vector-of-vectors coefficients and per-call V/W tables
+ */
+class ReferenceGravityPotential {
+ public:
+  ReferenceGravityPotential(const size_t degree, const std::vector<std::vector<double>> cosine_coefficients,
+                            const std::vector<std::vector<double>> sine_coefficients, const double gravity_constants_m3_s2,
+                            const double center_body_radius_m)
+      : degree_(degree),
+        c_(cosine_coefficients),
+        s_(sine_coefficients),
+        gravity_constants_m3_s2_(gravity_constants_m3_s2),
+        center_body_radius_m_(center_body_radius_m) {
+    if (degree_ <= 1) degree_ = 0;
+  }
+
+  libra::Vector<3> CalcAcceleration_xcxf_m_s2(const libra::Vector<3> &position_xcxf_m);
+  libra::Matrix<3, 3> CalcPartialDerivative_xcxf_s2(const libra::Vector<3> &position_xcxf_m);
+
+ private:
+  size_t degree_ = 0;
+  size_t n_ = 0, m_ = 0;
+  std::vector<std::vector<double>> c_;
+  std::vector<std::vector<double>> s_;
+  double gravity_constants_m3_s2_;
+  double center_body_radius_m_;
+  double radius_m_ = 0.0;
+  double xcxf_x_m_ = 0.0, xcxf_y_m_ = 0.0, xcxf_z_m_ = 0.0;
+
+  void v_w_nn_update(double *v_nn, double *w_nn, const double v_prev, const double w_prev);
+  void v_w_nm_update(double *v_nm, double *w_nm, const double v_prev, const double w_prev, const double v_prev2, const double w_prev2);
+};
+
+libra::Vector<3> ReferenceGravityPotential::CalcAcceleration_xcxf_m_s2(const libra::Vector<3> &position_xcxf_m) {
+  libra::Vector<3> acceleration_xcxf_m_s2(0.0);
+  if (degree_ <= 0) return acceleration_xcxf_m_s2;  // TODO: Consider this assertion is needed
+
+  xcxf_x_m_ = position_xcxf_m[0];
+  xcxf_y_m_ = position_xcxf_m[1];
+  xcxf_z_m_ = position_xcxf_m[2];
+  radius_m_ = position_xcxf_m.CalcNorm();
+
+  // Calc V and W
+  const size_t degree_vw = degree_ + 1;
+  std::vector<std::vector<double>> v(degree_vw + 1, std::vector<double>(degree_vw + 1, 0.0));
+  std::vector<std::vector<double>> w(degree_vw + 1, std::vector<double>(degree_vw + 1, 0.0));
+  // n = m = 0
+  v[0][0] = center_body_radius_m_ / radius_m_;
+  w[0][0] = 0.0;
+  m_ = 0;
+
+  while (m_ < degree_vw) {
+    for (n_ = m_ + 1; n_ <= degree_vw; n_++) {
+      if (n_ <= m_ + 1) {
+        v_w_nm_update(&v[n_][m_], &w[n_][m_], v[n_ - 1][m_], w[n_ - 1][m_], 0.0, 0.0);
+      } else {
+        v_w_nm_update(&v[n_][m_], &w[n_][m_], v[n_ - 1][m_], w[n_ - 1][m_], v[n_ - 2][m_], w[n_ - 2][m_]);
+      }
+    }
+    // next step
+    m_++;
+    n_ = m_;
+    v_w_nn_update(&v[n_][m_], &w[n_][m_], v[n_ - 1][m_ - 1], w[n_ - 1][m_ - 1]);
+  }
+
+  // Calc Acceleration
+  for (n_ = 0; n_ <= degree_; n_++)  // this loop can integrate with previous loop
+  {
+    m_ = 0;
+    const double n_d = (double)n_;
+    const double normalize = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d + 3.0));
+    const double normalize_xy = normalize * sqrt((n_d + 2.0) * (n_d + 1.0) / 2.0);
+    // m_==0
+    acceleration_xcxf_m_s2[0] += -c_[n_][0] * v[n_ + 1][1] * normalize_xy;
+    acceleration_xcxf_m_s2[1] += -c_[n_][0] * w[n_ + 1][1] * normalize_xy;
+    acceleration_xcxf_m_s2[2] += (n_ + 1.0) * (-c_[n_][0] * v[n_ + 1][0] - s_[n_][0] * w[n_ + 1][0]) * normalize;
+    for (m_ = 1; m_ <= n_; m_++) {
+      const double m_d = (double)m_;
+      const double factorial = (n_d - m_d + 1.0) * (n_d - m_d + 2.0);
+      const double normalize_xy1 = normalize * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0));
+      double normalize_xy2;
+      if (m_ == 1) {
+        normalize_xy2 = normalize * sqrt(factorial) * sqrt(2.0);
+      } else {
+        normalize_xy2 = normalize * sqrt(factorial);
+      }
+      const double normalize_z = normalize * sqrt((n_d + m_d + 1.0) / (n_d - m_d + 1.0));
+
+      acceleration_xcxf_m_s2[0] += 0.5 * (normalize_xy1 * (-c_[n_][m_] * v[n_ + 1][m_ + 1] - s_[n_][m_] * w[n_ + 1][m_ + 1]) +
+                                          normalize_xy2 * (c_[n_][m_] * v[n_ + 1][m_ - 1] + s_[n_][m_] * w[n_ + 1][m_ - 1]));
+      acceleration_xcxf_m_s2[1] += 0.5 * (normalize_xy1 * (-c_[n_][m_] * w[n_ + 1][m_ + 1] + s_[n_][m_] * v[n_ + 1][m_ + 1]) +
+                                          normalize_xy2 * (-c_[n_][m_] * w[n_ + 1][m_ - 1] + s_[n_][m_] * v[n_ + 1][m_ - 1]));
+      acceleration_xcxf_m_s2[2] += (n_d - m_d + 1.0) * (-c_[n_][m_] * v[n_ + 1][m_] - s_[n_][m_] * w[n_ + 1][m_]) * normalize_z;
+    }
+  }
+  acceleration_xcxf_m_s2 *= gravity_constants_m3_s2_ / pow(center_body_radius_m_, 2.0);
+
+  return acceleration_xcxf_m_s2;
+}
+
+libra::Matrix<3, 3> ReferenceGravityPotential::CalcPartialDerivative_xcxf_s2(const libra::Vector<3> &position_xcxf_m) {
+  libra::Matrix<3, 3> partial_derivative(0.0);
+  if (degree_ <= 0) return partial_derivative;
+
+  xcxf_x_m_ = position_xcxf_m[0];
+  xcxf_y_m_ = position_xcxf_m[1];
+  xcxf_z_m_ = position_xcxf_m[2];
+  radius_m_ = position_xcxf_m.CalcNorm();
+
+  // Calc V and W
+  const size_t degree_vw = degree_ + 2;
+  std::vector<std::vector<double>> v(degree_vw + 1, std::vector<double>(degree_vw + 1, 0.0));
+  std::vector<std::vector<double>> w(degree_vw + 1, std::vector<double>(degree_vw + 1, 0.0));
+  // n = m = 0
+  v[0][0] = center_body_radius_m_ / radius_m_;
+  w[0][0] = 0.0;
+  m_ = 0;
+  while (m_ < degree_vw) {
+    for (n_ = m_ + 1; n_ <= degree_vw; n_++) {
+      if (n_ <= m_ + 1) {
+        v_w_nm_update(&v[n_][m_], &w[n_][m_], v[n_ - 1][m_], w[n_ - 1][m_], 0.0, 0.0);
+      } else {
+        v_w_nm_update(&v[n_][m_], &w[n_][m_], v[n_ - 1][m_], w[n_ - 1][m_], v[n_ - 2][m_], w[n_ - 2][m_]);
+      }
+    }
+    // next step
+    m_++;
+    n_ = m_;
+    v_w_nn_update(&v[n_][m_], &w[n_][m_], v[n_ - 1][m_ - 1], w[n_ - 1][m_ - 1]);
+  }
+
+  // Calc partial derivatives
+  for (n_ = 0; n_ <= degree_; n_++)  // this loop can integrate with previous loop
+  {
+    const double n_d = (double)n_;
+
+    // C_n_0 * V_n+2_m
+    const double normalize_cn0_v20 = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d + 5.0));
+    const double normalize_cn0_v21 = normalize_cn0_v20 * sqrt((n_d + 2.0) * (n_d + 3.0) / 2.0);
+    const double normalize_cn0_v22 = normalize_cn0_v20 * sqrt((n_d + 1.0) * (n_d + 2.0) * (n_d + 3.0) * (n_d + 4.0) / 2.0);
+
+    for (m_ = 0; m_ <= n_; m_++) {
+      const double m_d = (double)m_;
+
+      // dx/dx, dx/dy, dy/dy
+      if (m_ == 0) {
+        partial_derivative[0][0] +=
+            0.5 * (c_[n_][0] * v[n_ + 2][2] * normalize_cn0_v22 - c_[n_][0] * v[n_ + 2][0] * (n_d + 1.0) * (n_d + 2.0) * normalize_cn0_v20);
+        partial_derivative[1][1] +=
+            0.5 * (-c_[n_][0] * v[n_ + 2][2] * normalize_cn0_v22 - c_[n_][0] * v[n_ + 2][0] * (n_d + 1.0) * (n_d + 2.0) * normalize_cn0_v20);
+
+        partial_derivative[0][1] += 0.5 * (c_[n_][0] * w[n_ + 2][2] * normalize_cn0_v22);
+      } else if (m_ == 1) {
+        const double normalize_cn1_v21 = normalize_cn0_v20 * sqrt((n_d + 2.0) * (n_d + 3.0) / (n_d * (n_d + 1.0)));
+        const double normalize_cn1_v21_with_coeff = n_d * (n_d + 1.0) * normalize_cn1_v21;
+        const double normalize_cn1_v23 = normalize_cn0_v20 * sqrt((n_d + 2.0) * (n_d + 3.0) * (n_d + 4.0) * (n_d + 5.0));
+
+        partial_derivative[0][0] += 0.25 * ((c_[n_][1] * v[n_ + 2][3] + s_[n_][1] * w[n_ + 2][3]) * normalize_cn1_v23 -
+                                            (3.0 * c_[n_][1] * v[n_ + 2][1] + s_[n_][1] * w[n_ + 2][1]) * normalize_cn1_v21_with_coeff);
+        partial_derivative[1][1] += 0.25 * ((-c_[n_][1] * v[n_ + 2][3] - s_[n_][1] * w[n_ + 2][3]) * normalize_cn1_v23 -
+                                            (c_[n_][1] * v[n_ + 2][1] + 3.0 * s_[n_][1] * w[n_ + 2][1]) * normalize_cn1_v21_with_coeff);
+
+        partial_derivative[0][1] += 0.25 * ((c_[n_][1] * w[n_ + 2][3] - s_[n_][1] * v[n_ + 2][3]) * normalize_cn1_v23 -
+                                            (c_[n_][1] * w[n_ + 2][1] + s_[n_][1] * v[n_ + 2][1]) * normalize_cn1_v21_with_coeff);
+      } else if (m_ == 2) {
+        double normalize_cnm_v2p2 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) * (n_d + m_d + 3.0) * (n_d + m_d + 4.0));
+        double normalize_cnm_v2m2 = normalize_cn0_v20 * sqrt(2.0 / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * (n_d - m_d + 4.0)));
+        double normalize_cnm_v2m2_with_coeff = (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * (n_d - m_d + 4.0) * normalize_cnm_v2m2;
+        double normalize_cnm_v20 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0)));
+        double normalize_cnm_v20_with_coeff = 2.0 * (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * normalize_cnm_v20;
+
+        partial_derivative[0][0] += 0.25 * ((c_[n_][m_] * v[n_ + 2][m_ + 2] + s_[n_][m_] * w[n_ + 2][m_ + 2]) * normalize_cnm_v2p2 -
+                                            (c_[n_][m_] * v[n_ + 2][m_] + s_[n_][m_] * w[n_ + 2][m_]) * normalize_cnm_v20_with_coeff +
+                                            (c_[n_][m_] * v[n_ + 2][m_ - 2] + s_[n_][m_] * w[n_ + 2][m_ - 2]) * normalize_cnm_v2m2_with_coeff);
+        partial_derivative[1][1] += 0.25 * ((-c_[n_][m_] * v[n_ + 2][m_ + 2] - s_[n_][m_] * w[n_ + 2][m_ + 2]) * normalize_cnm_v2p2 -
+                                            (c_[n_][m_] * v[n_ + 2][m_] + s_[n_][m_] * w[n_ + 2][m_]) * normalize_cnm_v20_with_coeff -
+                                            (c_[n_][m_] * v[n_ + 2][m_ - 2] + s_[n_][m_] * w[n_ + 2][m_ - 2]) * normalize_cnm_v2m2_with_coeff);
+        partial_derivative[0][1] += 0.25 * ((c_[n_][m_] * w[n_ + 2][m_ + 2] - s_[n_][m_] * v[n_ + 2][m_ + 2]) * normalize_cnm_v2p2 +
+                                            (-c_[n_][m_] * w[n_ + 2][m_ - 2] + s_[n_][m_] * v[n_ + 2][m_ - 2]) * normalize_cnm_v2m2_with_coeff);
+      } else {
+        double normalize_cnm_v2p2 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) * (n_d + m_d + 3.0) * (n_d + m_d + 4.0));
+        double normalize_cnm_v2m2 = normalize_cn0_v20 * sqrt(1.0 / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * (n_d - m_d + 4.0)));
+        double normalize_cnm_v2m2_with_coeff = (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * (n_d - m_d + 4.0) * normalize_cnm_v2m2;
+        double normalize_cnm_v20 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0)));
+        double normalize_cnm_v20_with_coeff = 2.0 * (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * normalize_cnm_v20;
+
+        partial_derivative[0][0] += 0.25 * ((c_[n_][m_] * v[n_ + 2][m_ + 2] + s_[n_][m_] * w[n_ + 2][m_ + 2]) * normalize_cnm_v2p2 -
+                                            (c_[n_][m_] * v[n_ + 2][m_] + s_[n_][m_] * w[n_ + 2][m_]) * normalize_cnm_v20_with_coeff +
+                                            (c_[n_][m_] * v[n_ + 2][m_ - 2] + s_[n_][m_] * w[n_ + 2][m_ - 2]) * normalize_cnm_v2m2_with_coeff);
+        partial_derivative[1][1] += 0.25 * ((-c_[n_][m_] * v[n_ + 2][m_ + 2] - s_[n_][m_] * w[n_ + 2][m_ + 2]) * normalize_cnm_v2p2 -
+                                            (c_[n_][m_] * v[n_ + 2][m_] + s_[n_][m_] * w[n_ + 2][m_]) * normalize_cnm_v20_with_coeff -
+                                            (c_[n_][m_] * v[n_ + 2][m_ - 2] + s_[n_][m_] * w[n_ + 2][m_ - 2]) * normalize_cnm_v2m2_with_coeff);
+        partial_derivative[0][1] += 0.25 * ((c_[n_][m_] * w[n_ + 2][m_ + 2] - s_[n_][m_] * v[n_ + 2][m_ + 2]) * normalize_cnm_v2p2 +
+                                            (-c_[n_][m_] * w[n_ + 2][m_ - 2] + s_[n_][m_] * v[n_ + 2][m_ - 2]) * normalize_cnm_v2m2_with_coeff);
+      }
+      // dx/dz, dy/dz
+      if (m_ == 0) {
+        partial_derivative[0][2] += (n_d + 1.0) * (c_[n_][0] * v[n_ + 2][1] * normalize_cn0_v21);
+        partial_derivative[1][2] += (n_d + 1.0) * (c_[n_][0] * w[n_ + 2][1] * normalize_cn0_v21);
+      } else if (m_ == 1) {
+        double normalize_cnm_v2p1 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) * (n_d + m_d + 3.0) / (n_d - m_d + 1.0));
+        double normalize_cnm_v2p1_with_coeff = (n_d - m_d + 1.0) * normalize_cnm_v2p1;
+        double normalize_cnm_v2m1 = normalize_cn0_v20 * sqrt(2.0 * (n_d + m_d + 1.0) / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0)));
+        double normalize_cnm_v2m1_with_coeff = (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * normalize_cnm_v2m1;
+
+        partial_derivative[0][2] += 0.5 * ((+c_[n_][m_] * v[n_ + 2][m_ + 1] + s_[n_][m_] * w[n_ + 2][m_ + 1]) * normalize_cnm_v2p1_with_coeff +
+                                           (-c_[n_][m_] * v[n_ + 2][m_ - 1] - s_[n_][m_] * w[n_ + 2][m_ - 1]) * normalize_cnm_v2m1_with_coeff);
+        partial_derivative[1][2] += 0.5 * ((+c_[n_][m_] * w[n_ + 2][m_ + 1] - s_[n_][m_] * v[n_ + 2][m_ + 1]) * normalize_cnm_v2p1_with_coeff +
+                                           (+c_[n_][m_] * w[n_ + 2][m_ - 1] - s_[n_][m_] * v[n_ + 2][m_ - 1]) * normalize_cnm_v2m1_with_coeff);
+      } else {
+        double normalize_cnm_v2p1 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) * (n_d + m_d + 3.0) / (n_d - m_d + 1.0));
+        double normalize_cnm_v2p1_with_coeff = (n_d - m_d + 1.0) * normalize_cnm_v2p1;
+        double normalize_cnm_v2m1 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0)));
+        double normalize_cnm_v2m1_with_coeff = (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * normalize_cnm_v2m1;
+
+        partial_derivative[0][2] += 0.5 * ((+c_[n_][m_] * v[n_ + 2][m_ + 1] + s_[n_][m_] * w[n_ + 2][m_ + 1]) * normalize_cnm_v2p1_with_coeff +
+                                           (-c_[n_][m_] * v[n_ + 2][m_ - 1] - s_[n_][m_] * w[n_ + 2][m_ - 1]) * normalize_cnm_v2m1_with_coeff);
+        partial_derivative[1][2] += 0.5 * ((+c_[n_][m_] * w[n_ + 2][m_ + 1] - s_[n_][m_] * v[n_ + 2][m_ + 1]) * normalize_cnm_v2p1_with_coeff +
+                                           (+c_[n_][m_] * w[n_ + 2][m_ - 1] - s_[n_][m_] * v[n_ + 2][m_ - 1]) * normalize_cnm_v2m1_with_coeff);
+      }
+      // dz/dz
+      double normalize_cnm_v20 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0)));
+      double normalize_cnm_v20_with_coeff = (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * normalize_cnm_v20;
+      partial_derivative[2][2] += (c_[n_][m_] * v[n_ + 2][m_] + s_[n_][m_] * w[n_ + 2][m_]) * normalize_cnm_v20_with_coeff;
+    }
+  }
+  // Symmetry property
+  partial_derivative[1][0] = partial_derivative[0][1];
+  partial_derivative[2][0] = partial_derivative[0][2];
+  partial_derivative[2][1] = partial_derivative[1][2];
+
+  // Multiply common coefficients
+  partial_derivative *= gravity_constants_m3_s2_ / pow(center_body_radius_m_, 3.0);
+
+  return partial_derivative;
+}
+
+void ReferenceGravityPotential::v_w_nn_update(double *v_nn, double *w_nn, const double v_prev, const double w_prev) {
+  if (n_ != m_) return;
+
+  const double n_d = (double)n_;
+
+  const double tmp = center_body_radius_m_ / pow(radius_m_, 2.0);
+  const double x_tmp = xcxf_x_m_ * tmp;
+  const double y_tmp = xcxf_y_m_ * tmp;
+  double c_normalize;
+  if (n_ == 1) {
+    c_normalize = (2.0 * n_d - 1.0) * sqrt(2.0 * n_d + 1.0);
+  } else {
+    c_normalize = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d));
+  }
+
+  *v_nn = c_normalize * (x_tmp * v_prev - y_tmp * w_prev);
+  *w_nn = c_normalize * (x_tmp * w_prev + y_tmp * v_prev);
+  return;
+}
+
+void ReferenceGravityPotential::v_w_nm_update(double *v_nm, double *w_nm, const double v_prev, const double w_prev, const double v_prev2,
+                                     const double w_prev2) {
+  if (n_ == m_) return;
+
+  const double m_d = (double)m_;
+  const double n_d = (double)n_;
+
+  const double tmp = center_body_radius_m_ / pow(radius_m_, 2.0);
+  const double z_tmp = xcxf_z_m_ * tmp;
+  const double re_tmp = center_body_radius_m_ * tmp;
+  const double c1 = (2.0 * n_d - 1.0) / (n_d - m_d);
+  const double c2 = (n_d + m_d - 1.0) / (n_d - m_d);
+  double c_normalize, c2_normalize;
+
+  c_normalize = sqrt(((2.0 * n_d + 1.0) * (n_d - m_d)) / ((2.0 * n_d - 1.0) * (n_d + m_d)));
+  if (n_ <= 1) {
+    c2_normalize = 1.0;
+  } else {
+    c2_normalize = sqrt(((2.0 * n_d - 1.0) * (n_d - m_d - 1.0)) / ((2.0 * n_d - 3.0) * (n_d + m_d - 1.0)));
+  }
+
+  *v_nm = c_normalize * (c1 * z_tmp * v_prev - c2 * c2_normalize * re_tmp * v_prev2);
+  *w_nm = c_normalize * (c1 * z_tmp * w_prev - c2 * c2_normalize * re_tmp * w_prev2);
+  return;
+}
+
+/**
+ * @fn CalcRelativeError
+ * @brief Calculate the relative error of a value
+ */
+static double CalcRelativeError(const double target, const double reference) {
+  const double scale = fabs(reference) > 1e-300 ? fabs(reference) : 1.0;
+  return fabs(target - reference) / scale;
+}
+
+/**
+ * @fn MeasureTime_us
+ * @brief Measure the average execution time of the function [us]
+ */
+template <typename Function>
+static double MeasureTime_us(const size_t number_of_calls, Function function) {
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < number_of_calls; i++) function(i);
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count() / (double)number_of_calls;
+}
+
+int main(int argc, char *argv[]) {
+  // Usage: benchmark_gravity_potential [max_degree]
+  const size_t max_degree = (argc > 1) ? (size_t)atoi(argv[1]) : 360;
+  const size_t degrees[] = {2, 4, 10, 20, 50, 100, 180, 260, 360};
+  const double gravity_constant_m3_s2 = 3.986004418e14;
+  const double radius_m = 6378137.0;
+
+  // Positions around LEO
+  std::vector<libra::Vector<3>> positions_m;
+  for (size_t i = 0; i < 16; i++) {
+    const double angle_rad = 0.4 * (double)i;
+    libra::Vector<3> position_m;
+    position_m[0] = 6.9e6 * cos(angle_rad) * cos(0.3 * angle_rad);
+    position_m[1] = 6.9e6 * sin(angle_rad) * cos(0.3 * angle_rad);
+    position_m[2] = 6.9e6 * sin(0.3 * angle_rad);
+    positions_m.push_back(position_m);
+  }
+
+  printf(
+      "degree, reference_acceleration_us, acceleration_us, batch_acceleration_us, reference_partial_us, partial_us, batch_partial_us, "
+      "max_relative_error\n");
+  for (size_t degree : degrees) {
+    if (degree > max_degree) break;
+
+    // Coefficients with a decay similar to the Earth gravity field
+    std::vector<std::vector<double>> c(degree + 1, std::vector<double>(degree + 1, 0.0));
+    std::vector<std::vector<double>> s(degree + 1, std::vector<double>(degree + 1, 0.0));
+    for (size_t n = 2; n <= degree; n++) {
+      for (size_t m = 0; m <= n; m++) {
+        c[n][m] = 1e-5 / (double)(n * n) * cos(1.0 + (double)(n + 3 * m));
+        s[n][m] = (m == 0) ? 0.0 : 1e-5 / (double)(n * n) * sin(2.0 + (double)(3 * n + m));
+      }
+    }
+    ReferenceGravityPotential reference(degree, c, s, gravity_constant_m3_s2, radius_m);
+    GravityPotential target(degree, c, s, gravity_constant_m3_s2, radius_m);
+
+    double max_error = 0.0;
+    for (const auto &position_m : positions_m) {
+      const libra::Vector<3> acceleration_m_s2 = target.CalcAcceleration_xcxf_m_s2(position_m);
+      const libra::Vector<3> reference_acceleration_m_s2 = reference.CalcAcceleration_xcxf_m_s2(position_m);
+      const libra::Matrix<3, 3> partial_s2 = target.CalcPartialDerivative_xcxf_s2(position_m);
+      const libra::Matrix<3, 3> reference_partial_s2 = reference.CalcPartialDerivative_xcxf_s2(position_m);
+      for (size_t i = 0; i < 3; i++) {
+        max_error = fmax(max_error, CalcRelativeError(acceleration_m_s2[i], reference_acceleration_m_s2[i]));
+        for (size_t j = 0; j < 3; j++) {
+          max_error = fmax(max_error, CalcRelativeError(partial_s2[i][j], reference_partial_s2[i][j]));
+        }
+      }
+    }
+
+    const size_t number_of_calls = 2000000 / ((degree + 1) * (degree + 1)) + 10;
+    double sum = 0.0;  // Prevent optimizing out the calculation
+    const double reference_acceleration_us =
+        MeasureTime_us(number_of_calls, [&](size_t i) { sum += reference.CalcAcceleration_xcxf_m_s2(positions_m[i % positions_m.size()])[0]; });
+    const double acceleration_us =
+        MeasureTime_us(number_of_calls, [&](size_t i) { sum += target.CalcAcceleration_xcxf_m_s2(positions_m[i % positions_m.size()])[0]; });
+    const double reference_partial_us =
+        MeasureTime_us(number_of_calls, [&](size_t i) { sum += reference.CalcPartialDerivative_xcxf_s2(positions_m[i % positions_m.size()])[0][0]; });
+    const double partial_us =
+        MeasureTime_us(number_of_calls, [&](size_t i) { sum += target.CalcPartialDerivative_xcxf_s2(positions_m[i % positions_m.size()])[0][0]; });
+
+
+    // Batched calculation of all positions (time per position)
+    GravityPotentialBatch batch(positions_m.size());
+    for (size_t i = 0; i < positions_m.size(); i++) batch.SetPosition_xcxf_m(i, positions_m[i]);
+    const size_t number_of_batch_calls = number_of_calls / positions_m.size() + 1;
+    const double batch_acceleration_us = MeasureTime_us(number_of_batch_calls, [&](size_t) {
+                                           target.CalcBatch_xcxf(batch, false);
+                                           sum += batch.GetAccelerations_xcxf_m_s2(0)[0];
+                                         }) /
+                                         (double)positions_m.size();
+    const double batch_partial_us = MeasureTime_us(number_of_batch_calls, [&](size_t) {
+                                      target.CalcBatch_xcxf(batch, true);
+                                      sum += batch.GetAccelerations_xcxf_m_s2(0)[0];
+                                    }) /
+                                    (double)positions_m.size();
+    for (size_t i = 0; i < positions_m.size(); i++) {
+      const libra::Vector<3> reference_acceleration_m_s2 = reference.CalcAcceleration_xcxf_m_s2(positions_m[i]);
+      const libra::Matrix<3, 3> reference_partial_s2 = reference.CalcPartialDerivative_xcxf_s2(positions_m[i]);
+      for (size_t j = 0; j < 3; j++) {
+        max_error = fmax(max_error, CalcRelativeError(batch.GetAcceleration_xcxf_m_s2(i)[j], reference_acceleration_m_s2[j]));
+        for (size_t k = 0; k < 3; k++) {
+          max_error = fmax(max_error, CalcRelativeError(batch.GetPartialDerivative_xcxf_s2(i)[j][k], reference_partial_s2[j][k]));
+        }
+      }
+    }
+
+    printf("%zu, %f, %f, %f, %f, %f, %f, %e\n", degree, reference_acceleration_us, acceleration_us, batch_acceleration_us, reference_partial_us,
+           partial_us, batch_partial_us, max_error);
+    if (sum == 0.0) printf("\n");
+  }
+
+  return 0;
+}
@@ -5,88 +5,171 @@
 
 #include "gravity_potential.hpp"
 
-#include <chrono>
+#include <algorithm>
 #include <cmath>
-#include <fstream>
-#include <iostream>
+
+#include "../math/simd.hpp"
+
+using libra::PackedDouble;
+
+/**
+ * @fn AccumulateAccelerationTerms
+ * @brief Accumulate the acceleration terms of an order m (m >= 1) for all degrees with SIMD instructions
+ * @note The arrays are indexed by n - m
+ * @param [in] number_of_terms: Number of degrees
+ * @param [in] c, s: Cosine and sine coefficients
+ * @param [in] xy1_factor, xy2_factor, z_factor: Normalization factors
+ * @param [in] v_p1, w_p1, v_0, w_0, v_m1, w_m1: V and W function of (n+1, m+1), (n+1, m), and (n+1, m-1)
+ * @param [out] acceleration: Acceleration to be accumulated
+ */
+static void AccumulateAccelerationTerms(const size_t number_of_terms, const double *c, const double *s, const double *xy1_factor,
+                                        const double *xy2_factor, const double *z_factor, const double *v_p1, const double *w_p1, const double *v_0,
+                                        const double *w_0, const double *v_m1, const double *w_m1, libra::Vector<3> &acceleration) {
+  const size_t lanes = PackedDouble::kNumberOfLanes;
+  PackedDouble sum_x = PackedDouble::Broadcast(0.0), sum_y = PackedDouble::Broadcast(0.0), sum_z = PackedDouble::Broadcast(0.0);
+  size_t k = 0;
+  for (; k + lanes <= number_of_terms; k += lanes) {
+    const PackedDouble c_k = PackedDouble::Load(c + k), s_k = PackedDouble::Load(s + k);
+    const PackedDouble v_p1_k = PackedDouble::Load(v_p1 + k), w_p1_k = PackedDouble::Load(w_p1 + k);
+    const PackedDouble v_m1_k = PackedDouble::Load(v_m1 + k), w_m1_k = PackedDouble::Load(w_m1 + k);
+    const PackedDouble xy1 = PackedDouble::Load(xy1_factor + k), xy2 = PackedDouble::Load(xy2_factor + k);
+
+    sum_x += xy2 * (c_k * v_m1_k + s_k * w_m1_k) - xy1 * (c_k * v_p1_k + s_k * w_p1_k);
+    sum_y += xy1 * (c_k * w_p1_k - s_k * v_p1_k) + xy2 * (c_k * w_m1_k - s_k * v_m1_k);
+    sum_z += PackedDouble::Load(z_factor + k) * (c_k * PackedDouble::Load(v_0 + k) + s_k * PackedDouble::Load(w_0 + k));
+  }
+  double x = sum_x.Sum(), y = sum_y.Sum(), z = sum_z.Sum();
+  for (; k < number_of_terms; k++) {
+    x += xy2_factor[k] * (c[k] * v_m1[k] + s[k] * w_m1[k]) - xy1_factor[k] * (c[k] * v_p1[k] + s[k] * w_p1[k]);
+    y += xy1_factor[k] * (c[k] * w_p1[k] - s[k] * v_p1[k]) + xy2_factor[k] * (c[k] * w_m1[k] - s[k] * v_m1[k]);
+    z += z_factor[k] * (c[k] * v_0[k] + s[k] * w_0[k]);
+  }
+  acceleration[0] += x;
+  acceleration[1] -= y;
+  acceleration[2] -= z;
+}
+
+/**
+ * @fn AccumulatePartialDerivativeTerms
+ * @brief Accumulate the partial derivative terms of an order m (m >= 2) for all degrees with SIMD instructions
+ * @note The arrays are indexed by n - m
+ * @param [in] number_of_terms: Number of degrees
+ * @param [in] c, s: Cosine and sine coefficients
+ * @param [in] factors: Normalization factors of V/W(n+2, m+2), V/W(n+2, m), V/W(n+2, m-2), V/W(n+2, m+1), V/W(n+2, m-1), and ZZ
+ * @param [in] v, w: V and W function of (n+2, m-2) to (n+2, m+2)
+ * @param [out] partial_derivative: Partial derivative to be accumulated
+ */
+static void AccumulatePartialDerivativeTerms(const size_t number_of_terms, const double *c, const double *s, const double *const factors[6],
+                                             const double *const v[5], const double *const w[5], libra::Matrix<3, 3> &partial_derivative) {
+  enum { kM2, kM1, k0, kP1, kP2 };  // Index of v and w
+  const size_t lanes = PackedDouble::kNumberOfLanes;
+  const PackedDouble zero = PackedDouble::Broadcast(0.0);
+  PackedDouble sum_xx_yy_p = zero, sum_xx_yy_0 = zero, sum_xy = zero, sum_xz = zero, sum_yz = zero, sum_zz = zero;
+  size_t k = 0;
+  for (; k + lanes <= number_of_terms; k += lanes) {
+    const PackedDouble c_k = PackedDouble::Load(c + k), s_k = PackedDouble::Load(s + k);
+    PackedDouble a[5] = {zero, zero, zero, zero, zero}, b[5] = {zero, zero, zero, zero, zero};
+    for (size_t j = 0; j < 5; j++) {
+      const PackedDouble v_k = PackedDouble::Load(v[j] + k), w_k = PackedDouble::Load(w[j] + k);
+      a[j] = c_k * v_k + s_k * w_k;
+      b[j] = c_k * w_k - s_k * v_k;
+    }
+    const PackedDouble p2 = PackedDouble::Load(factors[0] + k), m2 = PackedDouble::Load(factors[2] + k);
+    const PackedDouble p1 = PackedDouble::Load(factors[3] + k), m1 = PackedDouble::Load(factors[4] + k);
+
+    sum_xx_yy_p += p2 * a[kP2] + m2 * a[kM2];
+    sum_xx_yy_0 += PackedDouble::Load(factors[1] + k) * a[k0];
+    sum_xy += p2 * b[kP2] - m2 * b[kM2];
+    sum_xz += p1 * a[kP1] - m1 * a[kM1];
+    sum_yz += p1 * b[kP1] + m1 * b[kM1];
+    sum_zz += PackedDouble::Load(factors[5] + k) * a[k0];
+  }
+  double xx_yy_p = sum_xx_yy_p.Sum(), xx_yy_0 = sum_xx_yy_0.Sum(), xy = sum_xy.Sum(), xz = sum_xz.Sum(), yz = sum_yz.Sum(), zz = sum_zz.Sum();
+  for (; k < number_of_terms; k++) {
+    double a[5], b[5];
+    for (size_t j = 0; j < 5; j++) {
+      a[j] = c[k] * v[j][k] + s[k] * w[j][k];
+      b[j] = c[k] * w[j][k] - s[k] * v[j][k];
+    }
+    xx_yy_p += factors[0][k] * a[kP2] + factors[2][k] * a[kM2];
+    xx_yy_0 += factors[1][k] * a[k0];
+    xy += factors[0][k] * b[kP2] - factors[2][k] * b[kM2];
+    xz += factors[3][k] * a[kP1] - factors[4][k] * a[kM1];
+    yz += factors[3][k] * b[kP1] + factors[4][k] * b[kM1];
+    zz += factors[5][k] * a[k0];
+  }
+  partial_derivative[0][0] += xx_yy_p - xx_yy_0;
+  partial_derivative[1][1] += -xx_yy_p - xx_yy_0;
+  partial_derivative[0][1] += xy;
+  partial_derivative[0][2] += xz;
+  partial_derivative[1][2] += yz;
+  partial_derivative[2][2] += zz;
+}
 
 GravityPotential::GravityPotential(const size_t degree, const std::vector<std::vector<double>> cosine_coefficients,
                                    const std::vector<std::vector<double>> sine_coefficients, const double gravity_constants_m3_s2,
                                    const double center_body_radius_m)
-    : degree_(degree),
-      c_(cosine_coefficients),
-      s_(sine_coefficients),
-      gravity_constants_m3_s2_(gravity_constants_m3_s2),
-      center_body_radius_m_(center_body_radius_m) {
+    : degree_(degree), gravity_constants_m3_s2_(gravity_constants_m3_s2), center_body_radius_m_(center_body_radius_m) {
   // degree
   if (degree_ <= 1) {  // TODO: Consider this assertion is needed
     degree_ = 0;
+    return;
   }
   // coefficients
-  // TODO Check size
+  std::shared_ptr<Tables> tables = std::make_shared<Tables>();
+  const size_t number_of_coefficients = GetCoefficientIndex(degree_, degree_) + 1;
+  tables->c.assign(number_of_coefficients, 0.0);
+  tables->s.assign(number_of_coefficients, 0.0);
+  for (size_t n = 0; n <= degree_ && n < cosine_coefficients.size() && n < sine_coefficients.size(); n++) {
+    for (size_t m = 0; m <= n && m < cosine_coefficients[n].size() && m < sine_coefficients[n].size(); m++) {
+      tables->c[GetCoefficientIndex(n, m)] = cosine_coefficients[n][m];
+      tables->s[GetCoefficientIndex(n, m)] = sine_coefficients[n][m];
+    }
+  }
+  InitializeNormalizationFactors(*tables);
+  tables_ = tables;
+
+  // Workspace for V and W up to degree + 2, which is required by the partial derivative calculation
+  workspace_stride_ = degree_ + 3;
+  v_.assign(kNumberOfWorkspaceColumns * workspace_stride_, 0.0);
+  w_.assign(kNumberOfWorkspaceColumns * workspace_stride_, 0.0);
 }
 
 libra::Vector<3> GravityPotential::CalcAcceleration_xcxf_m_s2(const libra::Vector<3> &position_xcxf_m) {
   libra::Vector<3> acceleration_xcxf_m_s2(0.0);
   if (degree_ <= 0) return acceleration_xcxf_m_s2;  // TODO: Consider this assertion is needed
+  const Tables &tables = *tables_;
 
-  xcxf_x_m_ = position_xcxf_m[0];
-  xcxf_y_m_ = position_xcxf_m[1];
-  xcxf_z_m_ = position_xcxf_m[2];
-  radius_m_ = position_xcxf_m.CalcNorm();
-
-  // Calc V and W
+  // The terms of the order m use V and W of the order m - 1, m, and m + 1.
+  // The order columns are calculated one by one and accumulated as soon as the required columns are ready.
   const size_t degree_vw = degree_ + 1;
-  std::vector<std::vector<double>> v(degree_vw + 1, std::vector<double>(degree_vw + 1, 0.0));
-  std::vector<std::vector<double>> w(degree_vw + 1, std::vector<double>(degree_vw + 1, 0.0));
-  // n = m = 0
-  v[0][0] = center_body_radius_m_ / radius_m_;
-  w[0][0] = 0.0;
-  m_ = 0;
-
-  while (m_ < degree_vw) {
-    for (n_ = m_ + 1; n_ <= degree_vw; n_++) {
-      if (n_ <= m_ + 1) {
-        v_w_nm_update(&v[n_][m_], &w[n_][m_], v[n_ - 1][m_], w[n_ - 1][m_], 0.0, 0.0);
-      } else {
-        v_w_nm_update(&v[n_][m_], &w[n_][m_], v[n_ - 1][m_], w[n_ - 1][m_], v[n_ - 2][m_], w[n_ - 2][m_]);
+  InitializeVw(position_xcxf_m);
+  CalcVwColumn(0, degree_vw);
+
+  for (size_t m = 0; m <= degree_; m++) {
+    CalcVwColumn(m + 1, degree_vw);
+
+    if (m == 0) {
+      for (size_t n = 0; n <= degree_; n++) {
+        const size_t i_c = GetCoefficientIndex(n, 0);
+        const size_t i_0 = GetWorkspaceIndex(n + 1, 0);
+        const size_t i_p1 = GetWorkspaceIndex(n + 1, 1);
+        const double c = tables.c[i_c];
+        const double s = tables.s[i_c];
+        acceleration_xcxf_m_s2[0] -= tables.acceleration_xy1_factor[i_c] * c * v_[i_p1];
+        acceleration_xcxf_m_s2[1] -= tables.acceleration_xy1_factor[i_c] * c * w_[i_p1];
+        acceleration_xcxf_m_s2[2] -= tables.acceleration_z_factor[i_c] * (c * v_[i_0] + s * w_[i_0]);
       }
+      continue;
     }
-    // next step
-    m_++;
-    n_ = m_;
-    v_w_nn_update(&v[n_][m_], &w[n_][m_], v[n_ - 1][m_ - 1], w[n_ - 1][m_ - 1]);
-  }
-
-  // Calc Acceleration
-  for (n_ = 0; n_ <= degree_; n_++)  // this loop can integrate with previous loop
-  {
-    m_ = 0;
-    const double n_d = (double)n_;
-    const double normalize = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d + 3.0));
-    const double normalize_xy = normalize * sqrt((n_d + 2.0) * (n_d + 1.0) / 2.0);
-    // m_==0
-    acceleration_xcxf_m_s2[0] += -c_[n_][0] * v[n_ + 1][1] * normalize_xy;
-    acceleration_xcxf_m_s2[1] += -c_[n_][0] * w[n_ + 1][1] * normalize_xy;
-    acceleration_xcxf_m_s2[2] += (n_ + 1.0) * (-c_[n_][0] * v[n_ + 1][0] - s_[n_][0] * w[n_ + 1][0]) * normalize;
-    for (m_ = 1; m_ <= n_; m_++) {
-      const double m_d = (double)m_;
-      const double factorial = (n_d - m_d + 1.0) * (n_d - m_d + 2.0);
-      const double normalize_xy1 = normalize * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0));
-      double normalize_xy2;
-      if (m_ == 1) {
-        normalize_xy2 = normalize * sqrt(factorial) * sqrt(2.0);
-      } else {
-        normalize_xy2 = normalize * sqrt(factorial);
-      }
-      const double normalize_z = normalize * sqrt((n_d + m_d + 1.0) / (n_d - m_d + 1.0));
 
-      acceleration_xcxf_m_s2[0] += 0.5 * (normalize_xy1 * (-c_[n_][m_] * v[n_ + 1][m_ + 1] - s_[n_][m_] * w[n_ + 1][m_ + 1]) +
-                                          normalize_xy2 * (c_[n_][m_] * v[n_ + 1][m_ - 1] + s_[n_][m_] * w[n_ + 1][m_ - 1]));
-      acceleration_xcxf_m_s2[1] += 0.5 * (normalize_xy1 * (-c_[n_][m_] * w[n_ + 1][m_ + 1] + s_[n_][m_] * v[n_ + 1][m_ + 1]) +
-                                          normalize_xy2 * (-c_[n_][m_] * w[n_ + 1][m_ - 1] + s_[n_][m_] * v[n_ + 1][m_ - 1]));
-      acceleration_xcxf_m_s2[2] += (n_d - m_d + 1.0) * (-c_[n_][m_] * v[n_ + 1][m_] - s_[n_][m_] * w[n_ + 1][m_]) * normalize_z;
-    }
+    const size_t i_c = GetCoefficientIndex(m, m);
+    const size_t i_0 = GetWorkspaceIndex(m + 1, m);
+    const size_t i_p1 = GetWorkspaceIndex(m + 1, m + 1);
+    const size_t i_m1 = GetWorkspaceIndex(m + 1, m - 1);
+    AccumulateAccelerationTerms(degree_ - m + 1, &tables.c[i_c], &tables.s[i_c], &tables.acceleration_xy1_factor[i_c],
+                                &tables.acceleration_xy2_factor[i_c], &tables.acceleration_z_factor[i_c], &v_[i_p1], &w_[i_p1], &v_[i_0], &w_[i_0],
+                                &v_[i_m1], &w_[i_m1], acceleration_xcxf_m_s2);
   }
   acceleration_xcxf_m_s2 *= gravity_constants_m3_s2_ / pow(center_body_radius_m_, 2.0);
 
@@ -96,127 +179,64 @@ libra::Vector<3> GravityPotential::CalcAcceleration_xcxf_m_s2(const libra::Vecto
 libra::Matrix<3, 3> GravityPotential::CalcPartialDerivative_xcxf_s2(const libra::Vector<3> &position_xcxf_m) {
   libra::Matrix<3, 3> partial_derivative(0.0);
   if (degree_ <= 0) return partial_derivative;
+  const Tables &tables = *tables_;
 
-  xcxf_x_m_ = position_xcxf_m[0];
-  xcxf_y_m_ = position_xcxf_m[1];
-  xcxf_z_m_ = position_xcxf_m[2];
-  radius_m_ = position_xcxf_m.CalcNorm();
-
-  // Calc V and W
+  // The terms of the order m use V and W of the order m - 2 to m + 2.
+  // The order columns are calculated one by one and accumulated as soon as the required columns are ready.
   const size_t degree_vw = degree_ + 2;
-  std::vector<std::vector<double>> v(degree_vw + 1, std::vector<double>(degree_vw + 1, 0.0));
-  std::vector<std::vector<double>> w(degree_vw + 1, std::vector<double>(degree_vw + 1, 0.0));
-  // n = m = 0
-  v[0][0] = center_body_radius_m_ / radius_m_;
-  w[0][0] = 0.0;
-  m_ = 0;
-  while (m_ < degree_vw) {
-    for (n_ = m_ + 1; n_ <= degree_vw; n_++) {
-      if (n_ <= m_ + 1) {
-        v_w_nm_update(&v[n_][m_], &w[n_][m_], v[n_ - 1][m_], w[n_ - 1][m_], 0.0, 0.0);
-      } else {
-        v_w_nm_update(&v[n_][m_], &w[n_][m_], v[n_ - 1][m_], w[n_ - 1][m_], v[n_ - 2][m_], w[n_ - 2][m_]);
+  InitializeVw(position_xcxf_m);
+  CalcVwColumn(0, degree_vw);
+  CalcVwColumn(1, degree_vw);
+
+  for (size_t m = 0; m <= degree_; m++) {
+    CalcVwColumn(m + 2, degree_vw);
+
+    if (m >= 2) {
+      const size_t i_c = GetCoefficientIndex(m, m);
+      const double *const factors[6] = {&tables.partial_p2_factor[i_c], &tables.partial_0_factor[i_c],  &tables.partial_m2_factor[i_c],
+                                        &tables.partial_p1_factor[i_c], &tables.partial_m1_factor[i_c], &tables.partial_zz_factor[i_c]};
+      const double *v[5], *w[5];
+      for (size_t j = 0; j < 5; j++) {
+        v[j] = &v_[GetWorkspaceIndex(m + 2, m + j - 2)];
+        w[j] = &w_[GetWorkspaceIndex(m + 2, m + j - 2)];
       }
+      AccumulatePartialDerivativeTerms(degree_ - m + 1, &tables.c[i_c], &tables.s[i_c], factors, v, w, partial_derivative);
+      continue;
     }
-    // next step
-    m_++;
-    n_ = m_;
-    v_w_nn_update(&v[n_][m_], &w[n_][m_], v[n_ - 1][m_ - 1], w[n_ - 1][m_ - 1]);
-  }
 
-  // Calc partial derivatives
-  for (n_ = 0; n_ <= degree_; n_++)  // this loop can integrate with previous loop
-  {
-    const double n_d = (double)n_;
-
-    // C_n_0 * V_n+2_m
-    const double normalize_cn0_v20 = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d + 5.0));
-    const double normalize_cn0_v21 = normalize_cn0_v20 * sqrt((n_d + 2.0) * (n_d + 3.0) / 2.0);
-    const double normalize_cn0_v22 = normalize_cn0_v20 * sqrt((n_d + 1.0) * (n_d + 2.0) * (n_d + 3.0) * (n_d + 4.0) / 2.0);
-
-    for (m_ = 0; m_ <= n_; m_++) {
-      const double m_d = (double)m_;
-
-      // dx/dx, dx/dy, dy/dy
-      if (m_ == 0) {
-        partial_derivative[0][0] +=
-            0.5 * (c_[n_][0] * v[n_ + 2][2] * normalize_cn0_v22 - c_[n_][0] * v[n_ + 2][0] * (n_d + 1.0) * (n_d + 2.0) * normalize_cn0_v20);
-        partial_derivative[1][1] +=
-            0.5 * (-c_[n_][0] * v[n_ + 2][2] * normalize_cn0_v22 - c_[n_][0] * v[n_ + 2][0] * (n_d + 1.0) * (n_d + 2.0) * normalize_cn0_v20);
-
-        partial_derivative[0][1] += 0.5 * (c_[n_][0] * w[n_ + 2][2] * normalize_cn0_v22);
-      } else if (m_ == 1) {
-        const double normalize_cn1_v21 = normalize_cn0_v20 * sqrt((n_d + 2.0) * (n_d + 3.0) / (n_d * (n_d + 1.0)));
-        const double normalize_cn1_v21_with_coeff = n_d * (n_d + 1.0) * normalize_cn1_v21;
-        const double normalize_cn1_v23 = normalize_cn0_v20 * sqrt((n_d + 2.0) * (n_d + 3.0) * (n_d + 4.0) * (n_d + 5.0));
-
-        partial_derivative[0][0] += 0.25 * ((c_[n_][1] * v[n_ + 2][3] + s_[n_][1] * w[n_ + 2][3]) * normalize_cn1_v23 -
-                                            (3.0 * c_[n_][1] * v[n_ + 2][1] + s_[n_][1] * w[n_ + 2][1]) * normalize_cn1_v21_with_coeff);
-        partial_derivative[1][1] += 0.25 * ((-c_[n_][1] * v[n_ + 2][3] - s_[n_][1] * w[n_ + 2][3]) * normalize_cn1_v23 -
-                                            (c_[n_][1] * v[n_ + 2][1] + 3.0 * s_[n_][1] * w[n_ + 2][1]) * normalize_cn1_v21_with_coeff);
-
-        partial_derivative[0][1] += 0.25 * ((c_[n_][1] * w[n_ + 2][3] - s_[n_][1] * v[n_ + 2][3]) * normalize_cn1_v23 -
-                                            (c_[n_][1] * w[n_ + 2][1] + s_[n_][1] * v[n_ + 2][1]) * normalize_cn1_v21_with_coeff);
-      } else if (m_ == 2) {
-        double normalize_cnm_v2p2 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) * (n_d + m_d + 3.0) * (n_d + m_d + 4.0));
-        double normalize_cnm_v2m2 = normalize_cn0_v20 * sqrt(2.0 / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * (n_d - m_d + 4.0)));
-        double normalize_cnm_v2m2_with_coeff = (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * (n_d - m_d + 4.0) * normalize_cnm_v2m2;
-        double normalize_cnm_v20 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0)));
-        double normalize_cnm_v20_with_coeff = 2.0 * (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * normalize_cnm_v20;
-
-        partial_derivative[0][0] += 0.25 * ((c_[n_][m_] * v[n_ + 2][m_ + 2] + s_[n_][m_] * w[n_ + 2][m_ + 2]) * normalize_cnm_v2p2 -
-                                            (c_[n_][m_] * v[n_ + 2][m_] + s_[n_][m_] * w[n_ + 2][m_]) * normalize_cnm_v20_with_coeff +
-                                            (c_[n_][m_] * v[n_ + 2][m_ - 2] + s_[n_][m_] * w[n_ + 2][m_ - 2]) * normalize_cnm_v2m2_with_coeff);
-        partial_derivative[1][1] += 0.25 * ((-c_[n_][m_] * v[n_ + 2][m_ + 2] - s_[n_][m_] * w[n_ + 2][m_ + 2]) * normalize_cnm_v2p2 -
-                                            (c_[n_][m_] * v[n_ + 2][m_] + s_[n_][m_] * w[n_ + 2][m_]) * normalize_cnm_v20_with_coeff -
-                                            (c_[n_][m_] * v[n_ + 2][m_ - 2] + s_[n_][m_] * w[n_ + 2][m_ - 2]) * normalize_cnm_v2m2_with_coeff);
-        partial_derivative[0][1] += 0.25 * ((c_[n_][m_] * w[n_ + 2][m_ + 2] - s_[n_][m_] * v[n_ + 2][m_ + 2]) * normalize_cnm_v2p2 +
-                                            (-c_[n_][m_] * w[n_ + 2][m_ - 2] + s_[n_][m_] * v[n_ + 2][m_ - 2]) * normalize_cnm_v2m2_with_coeff);
-      } else {
-        double normalize_cnm_v2p2 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) * (n_d + m_d + 3.0) * (n_d + m_d + 4.0));
-        double normalize_cnm_v2m2 = normalize_cn0_v20 * sqrt(1.0 / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * (n_d - m_d + 4.0)));
-        double normalize_cnm_v2m2_with_coeff = (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * (n_d - m_d + 4.0) * normalize_cnm_v2m2;
-        double normalize_cnm_v20 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0)));
-        double normalize_cnm_v20_with_coeff = 2.0 * (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * normalize_cnm_v20;
-
-        partial_derivative[0][0] += 0.25 * ((c_[n_][m_] * v[n_ + 2][m_ + 2] + s_[n_][m_] * w[n_ + 2][m_ + 2]) * normalize_cnm_v2p2 -
-                                            (c_[n_][m_] * v[n_ + 2][m_] + s_[n_][m_] * w[n_ + 2][m_]) * normalize_cnm_v20_with_coeff +
-                                            (c_[n_][m_] * v[n_ + 2][m_ - 2] + s_[n_][m_] * w[n_ + 2][m_ - 2]) * normalize_cnm_v2m2_with_coeff);
-        partial_derivative[1][1] += 0.25 * ((-c_[n_][m_] * v[n_ + 2][m_ + 2] - s_[n_][m_] * w[n_ + 2][m_ + 2]) * normalize_cnm_v2p2 -
-                                            (c_[n_][m_] * v[n_ + 2][m_] + s_[n_][m_] * w[n_ + 2][m_]) * normalize_cnm_v20_with_coeff -
-                                            (c_[n_][m_] * v[n_ + 2][m_ - 2] + s_[n_][m_] * w[n_ + 2][m_ - 2]) * normalize_cnm_v2m2_with_coeff);
-        partial_derivative[0][1] += 0.25 * ((c_[n_][m_] * w[n_ + 2][m_ + 2] - s_[n_][m_] * v[n_ + 2][m_ + 2]) * normalize_cnm_v2p2 +
-                                            (-c_[n_][m_] * w[n_ + 2][m_ - 2] + s_[n_][m_] * v[n_ + 2][m_ - 2]) * normalize_cnm_v2m2_with_coeff);
-      }
-      // dx/dz, dy/dz
-      if (m_ == 0) {
-        partial_derivative[0][2] += (n_d + 1.0) * (c_[n_][0] * v[n_ + 2][1] * normalize_cn0_v21);
-        partial_derivative[1][2] += (n_d + 1.0) * (c_[n_][0] * w[n_ + 2][1] * normalize_cn0_v21);
-      } else if (m_ == 1) {
-        double normalize_cnm_v2p1 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) * (n_d + m_d + 3.0) / (n_d - m_d + 1.0));
-        double normalize_cnm_v2p1_with_coeff = (n_d - m_d + 1.0) * normalize_cnm_v2p1;
-        double normalize_cnm_v2m1 = normalize_cn0_v20 * sqrt(2.0 * (n_d + m_d + 1.0) / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0)));
-        double normalize_cnm_v2m1_with_coeff = (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * normalize_cnm_v2m1;
-
-        partial_derivative[0][2] += 0.5 * ((+c_[n_][m_] * v[n_ + 2][m_ + 1] + s_[n_][m_] * w[n_ + 2][m_ + 1]) * normalize_cnm_v2p1_with_coeff +
-                                           (-c_[n_][m_] * v[n_ + 2][m_ - 1] - s_[n_][m_] * w[n_ + 2][m_ - 1]) * normalize_cnm_v2m1_with_coeff);
-        partial_derivative[1][2] += 0.5 * ((+c_[n_][m_] * w[n_ + 2][m_ + 1] - s_[n_][m_] * v[n_ + 2][m_ + 1]) * normalize_cnm_v2p1_with_coeff +
-                                           (+c_[n_][m_] * w[n_ + 2][m_ - 1] - s_[n_][m_] * v[n_ + 2][m_ - 1]) * normalize_cnm_v2m1_with_coeff);
+    // The order 0 and 1 have the different forms due to the normalization
+    for (size_t n = m; n <= degree_; n++) {
+      const size_t i_c = GetCoefficientIndex(n, m);
+      const double c = tables.c[i_c];
+      const double s = tables.s[i_c];
+      const double p2 = tables.partial_p2_factor[i_c];
+      const double f0 = tables.partial_0_factor[i_c];
+      const double p1 = tables.partial_p1_factor[i_c];
+      const size_t i_0 = GetWorkspaceIndex(n + 2, m);
+      const size_t i_p1 = GetWorkspaceIndex(n + 2, m + 1);
+      const size_t i_p2 = GetWorkspaceIndex(n + 2, m + 2);
+
+      if (m == 0) {
+        // dx/dx, dx/dy, dy/dy
+        partial_derivative[0][0] += p2 * c * v_[i_p2] - f0 * c * v_[i_0];
+        partial_derivative[1][1] += -p2 * c * v_[i_p2] - f0 * c * v_[i_0];
+        partial_derivative[0][1] += p2 * c * w_[i_p2];
+        // dx/dz, dy/dz
+        partial_derivative[0][2] += p1 * c * v_[i_p1];
+        partial_derivative[1][2] += p1 * c * w_[i_p1];
       } else {
-        double normalize_cnm_v2p1 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) * (n_d + m_d + 3.0) / (n_d - m_d + 1.0));
-        double normalize_cnm_v2p1_with_coeff = (n_d - m_d + 1.0) * normalize_cnm_v2p1;
-        double normalize_cnm_v2m1 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0)));
-        double normalize_cnm_v2m1_with_coeff = (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * normalize_cnm_v2m1;
-
-        partial_derivative[0][2] += 0.5 * ((+c_[n_][m_] * v[n_ + 2][m_ + 1] + s_[n_][m_] * w[n_ + 2][m_ + 1]) * normalize_cnm_v2p1_with_coeff +
-                                           (-c_[n_][m_] * v[n_ + 2][m_ - 1] - s_[n_][m_] * w[n_ + 2][m_ - 1]) * normalize_cnm_v2m1_with_coeff);
-        partial_derivative[1][2] += 0.5 * ((+c_[n_][m_] * w[n_ + 2][m_ + 1] - s_[n_][m_] * v[n_ + 2][m_ + 1]) * normalize_cnm_v2p1_with_coeff +
-                                           (+c_[n_][m_] * w[n_ + 2][m_ - 1] - s_[n_][m_] * v[n_ + 2][m_ - 1]) * normalize_cnm_v2m1_with_coeff);
+        const size_t i_m1 = GetWorkspaceIndex(n + 2, m - 1);
+        const double m1 = tables.partial_m1_factor[i_c];
+        // dx/dx, dx/dy, dy/dy
+        partial_derivative[0][0] += p2 * (c * v_[i_p2] + s * w_[i_p2]) - f0 * (3.0 * c * v_[i_0] + s * w_[i_0]);
+        partial_derivative[1][1] += -p2 * (c * v_[i_p2] + s * w_[i_p2]) - f0 * (c * v_[i_0] + 3.0 * s * w_[i_0]);
+        partial_derivative[0][1] += p2 * (c * w_[i_p2] - s * v_[i_p2]) - f0 * (c * w_[i_0] + s * v_[i_0]);
+        // dx/dz, dy/dz
+        partial_derivative[0][2] += p1 * (c * v_[i_p1] + s * w_[i_p1]) - m1 * (c * v_[i_m1] + s * w_[i_m1]);
+        partial_derivative[1][2] += p1 * (c * w_[i_p1] - s * v_[i_p1]) + m1 * (c * w_[i_m1] - s * v_[i_m1]);
       }
       // dz/dz
-      double normalize_cnm_v20 = normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0)));
-      double normalize_cnm_v20_with_coeff = (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * normalize_cnm_v20;
-      partial_derivative[2][2] += (c_[n_][m_] * v[n_ + 2][m_] + s_[n_][m_] * w[n_ + 2][m_]) * normalize_cnm_v20_with_coeff;
+      partial_derivative[2][2] += tables.partial_zz_factor[i_c] * (c * v_[i_0] + s * w_[i_0]);
     }
   }
   // Symmetry property
@@ -230,48 +250,335 @@ libra::Matrix<3, 3> GravityPotential::CalcPartialDerivative_xcxf_s2(const libra:
   return partial_derivative;
 }
 
-void GravityPotential::v_w_nn_update(double *v_nn, double *w_nn, const double v_prev, const double w_prev) {
-  if (n_ != m_) return;
+void GravityPotential::CalcBatch_xcxf(GravityPotentialBatch &batch, const bool is_partial_derivative_enabled) const {
+  const size_t size = batch.padded_size_;
+  for (size_t axis = 0; axis < 3; axis++) {
+    std::fill(batch.acceleration_xcxf_m_s2_[axis].begin(), batch.acceleration_xcxf_m_s2_[axis].end(), 0.0);
+  }
+  for (size_t i = 0; i < 6; i++) {
+    std::fill(batch.partial_derivative_xcxf_s2_[i].begin(), batch.partial_derivative_xcxf_s2_[i].end(), 0.0);
+  }
+  if (degree_ <= 0 || batch.number_of_positions_ == 0) return;
+  const Tables &tables = *tables_;
+
+  // The padding positions copy the first position to keep the calculation finite
+  for (size_t axis = 0; axis < 3; axis++) {
+    for (size_t p = batch.number_of_positions_; p < size; p++) {
+      batch.position_xcxf_m_[axis][p] = batch.position_xcxf_m_[axis][0];
+    }
+  }
+
+  // Same order by order procedure with CalcAcceleration_xcxf_m_s2 and CalcPartialDerivative_xcxf_s2
+  const size_t column_offset = is_partial_derivative_enabled ? 2 : 1;
+  const size_t degree_vw = degree_ + column_offset;
+  InitializeBatchVw(batch);
+  for (size_t m = 0; m < column_offset; m++) {
+    CalcBatchVwColumn(batch, m, degree_vw);
+  }
+
+  const size_t lanes = PackedDouble::kNumberOfLanes;
+  const PackedDouble zero = PackedDouble::Broadcast(0.0);
+  const double *v = batch.v_.data();
+  const double *w = batch.w_.data();
+  for (size_t m = 0; m <= degree_; m++) {
+    CalcBatchVwColumn(batch, m + column_offset, degree_vw);
+
+    for (size_t p = 0; p < size; p += lanes) {
+      // Acceleration
+      PackedDouble sum_x = zero, sum_y = zero, sum_z = zero;
+      for (size_t n = m; n <= degree_; n++) {
+        const size_t i_c = GetCoefficientIndex(n, m);
+        const PackedDouble c = PackedDouble::Broadcast(tables.c[i_c]), s = PackedDouble::Broadcast(tables.s[i_c]);
+        const PackedDouble xy1 = PackedDouble::Broadcast(tables.acceleration_xy1_factor[i_c]);
+        const size_t i_0 = GetBatchWorkspaceIndex(n + 1, m, size) + p;
+        const size_t i_p1 = GetBatchWorkspaceIndex(n + 1, m + 1, size) + p;
+        const PackedDouble v_0 = PackedDouble::Load(v + i_0), w_0 = PackedDouble::Load(w + i_0);
+        const PackedDouble v_p1 = PackedDouble::Load(v + i_p1), w_p1 = PackedDouble::Load(w + i_p1);
+
+        sum_z += PackedDouble::Broadcast(tables.acceleration_z_factor[i_c]) * (c * v_0 + s * w_0);
+        if (m == 0) {
+          sum_x += xy1 * c * v_p1;
+          sum_y += xy1 * c * w_p1;
+        } else {
+          const PackedDouble xy2 = PackedDouble::Broadcast(tables.acceleration_xy2_factor[i_c]);
+          const size_t i_m1 = GetBatchWorkspaceIndex(n + 1, m - 1, size) + p;
+          const PackedDouble v_m1 = PackedDouble::Load(v + i_m1), w_m1 = PackedDouble::Load(w + i_m1);
+          sum_x += xy1 * (c * v_p1 + s * w_p1) - xy2 * (c * v_m1 + s * w_m1);
+          sum_y += xy1 * (c * w_p1 - s * v_p1) + xy2 * (c * w_m1 - s * v_m1);
+        }
+      }
+      const PackedDouble sums[3] = {sum_x, sum_y, sum_z};
+      for (size_t axis = 0; axis < 3; axis++) {
+        double *acceleration = &batch.acceleration_xcxf_m_s2_[axis][p];
+        (PackedDouble::Load(acceleration) - sums[axis]).Store(acceleration);
+      }
+      if (!is_partial_derivative_enabled) continue;
+
+      // Partial derivative
+      PackedDouble sum_p = zero, sum_0x = zero, sum_0y = zero, sum_xy = zero, sum_xz = zero, sum_yz = zero, sum_zz = zero;
+      for (size_t n = m; n <= degree_; n++) {
+        const size_t i_c = GetCoefficientIndex(n, m);
+        const PackedDouble c = PackedDouble::Broadcast(tables.c[i_c]), s = PackedDouble::Broadcast(tables.s[i_c]);
+        const PackedDouble p2 = PackedDouble::Broadcast(tables.partial_p2_factor[i_c]), p1 = PackedDouble::Broadcast(tables.partial_p1_factor[i_c]);
+        const PackedDouble f0 = PackedDouble::Broadcast(tables.partial_0_factor[i_c]);
+        const size_t i_0 = GetBatchWorkspaceIndex(n + 2, m, size) + p;
+        const size_t i_p1 = GetBatchWorkspaceIndex(n + 2, m + 1, size) + p;
+        const size_t i_p2 = GetBatchWorkspaceIndex(n + 2, m + 2, size) + p;
+        const PackedDouble v_0 = PackedDouble::Load(v + i_0), w_0 = PackedDouble::Load(w + i_0);
+        const PackedDouble v_p1 = PackedDouble::Load(v + i_p1), w_p1 = PackedDouble::Load(w + i_p1);
+        const PackedDouble v_p2 = PackedDouble::Load(v + i_p2), w_p2 = PackedDouble::Load(w + i_p2);
+
+        sum_zz += PackedDouble::Broadcast(tables.partial_zz_factor[i_c]) * (c * v_0 + s * w_0);
+        if (m == 0) {
+          sum_p += p2 * c * v_p2;
+          sum_0x += f0 * c * v_0;
+          sum_xy += p2 * c * w_p2;
+          sum_xz += p1 * c * v_p1;
+          sum_yz += p1 * c * w_p1;
+          continue;
+        }
+        const PackedDouble m1 = PackedDouble::Broadcast(tables.partial_m1_factor[i_c]);
+        const size_t i_m1 = GetBatchWorkspaceIndex(n + 2, m - 1, size) + p;
+        const PackedDouble v_m1 = PackedDouble::Load(v + i_m1), w_m1 = PackedDouble::Load(w + i_m1);
+        sum_xz += p1 * (c * v_p1 + s * w_p1) - m1 * (c * v_m1 + s * w_m1);
+        sum_yz += p1 * (c * w_p1 - s * v_p1) + m1 * (c * w_m1 - s * v_m1);
+        if (m == 1) {
+          const PackedDouble three = PackedDouble::Broadcast(3.0);
+          sum_p += p2 * (c * v_p2 + s * w_p2);
+          sum_0x += f0 * (three * c * v_0 + s * w_0);
+          sum_0y += f0 * (c * v_0 + three * s * w_0);
+          sum_xy += p2 * (c * w_p2 - s * v_p2) - f0 * (c * w_0 + s * v_0);
+        } else {
+          const PackedDouble m2 = PackedDouble::Broadcast(tables.partial_m2_factor[i_c]);
+          const size_t i_m2 = GetBatchWorkspaceIndex(n + 2, m - 2, size) + p;
+          const PackedDouble v_m2 = PackedDouble::Load(v + i_m2), w_m2 = PackedDouble::Load(w + i_m2);
+          sum_p += p2 * (c * v_p2 + s * w_p2) + m2 * (c * v_m2 + s * w_m2);
+          sum_0x += f0 * (c * v_0 + s * w_0);
+          sum_xy += p2 * (c * w_p2 - s * v_p2) - m2 * (c * w_m2 - s * v_m2);
+        }
+      }
+      if (m != 1) sum_0y = sum_0x;
+
+      std::vector<double> *partial = batch.partial_derivative_xcxf_s2_;
+      double *xx = &partial[GravityPotentialBatch::kXx][p];
+      double *yy = &partial[GravityPotentialBatch::kYy][p];
+      (PackedDouble::Load(xx) + sum_p - sum_0x).Store(xx);
+      (PackedDouble::Load(yy) - sum_p - sum_0y).Store(yy);
+      const size_t indexes[4] = {GravityPotentialBatch::kXy, GravityPotentialBatch::kXz, GravityPotentialBatch::kYz, GravityPotentialBatch::kZz};
+      const PackedDouble sums_others[4] = {sum_xy, sum_xz, sum_yz, sum_zz};
+      for (size_t i = 0; i < 4; i++) {
+        double *element = &partial[indexes[i]][p];
+        (PackedDouble::Load(element) + sums_others[i]).Store(element);
+      }
+    }
+  }
+
+  // Multiply common coefficients
+  const double acceleration_coefficient = gravity_constants_m3_s2_ / pow(center_body_radius_m_, 2.0);
+  const double partial_derivative_coefficient = gravity_constants_m3_s2_ / pow(center_body_radius_m_, 3.0);
+  for (size_t p = 0; p < size; p++) {
+    for (size_t axis = 0; axis < 3; axis++) batch.acceleration_xcxf_m_s2_[axis][p] *= acceleration_coefficient;
+    for (size_t i = 0; i < 6; i++) batch.partial_derivative_xcxf_s2_[i][p] *= partial_derivative_coefficient;
+  }
+}
+
+void GravityPotential::InitializeNormalizationFactors(Tables &tables) const {
+  const size_t number_of_coefficients = tables.c.size();
+  tables.acceleration_xy1_factor.assign(number_of_coefficients, 0.0);
+  tables.acceleration_xy2_factor.assign(number_of_coefficients, 0.0);
+  tables.acceleration_z_factor.assign(number_of_coefficients, 0.0);
+  tables.partial_p2_factor.assign(number_of_coefficients, 0.0);
+  tables.partial_0_factor.assign(number_of_coefficients, 0.0);
+  tables.partial_m2_factor.assign(number_of_coefficients, 0.0);
+  tables.partial_p1_factor.assign(number_of_coefficients, 0.0);
+  tables.partial_m1_factor.assign(number_of_coefficients, 0.0);
+  tables.partial_zz_factor.assign(number_of_coefficients, 0.0);
+
+  for (size_t m = 0; m <= degree_; m++) {
+    const double m_d = (double)m;
+    for (size_t n = m; n <= degree_; n++) {
+      const double n_d = (double)n;
+      const size_t i = GetCoefficientIndex(n, m);
+
+      // Acceleration
+      const double normalize = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d + 3.0));
+      if (m == 0) {
+        tables.acceleration_xy1_factor[i] = normalize * sqrt((n_d + 2.0) * (n_d + 1.0) / 2.0);
+      } else {
+        const double factorial = (n_d - m_d + 1.0) * (n_d - m_d + 2.0);
+        tables.acceleration_xy1_factor[i] = 0.5 * normalize * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0));
+        // The normalization factor of the order 0 includes an additional sqrt(2)
+        tables.acceleration_xy2_factor[i] = 0.5 * normalize * sqrt(factorial) * (m == 1 ? sqrt(2.0) : 1.0);
+      }
+      tables.acceleration_z_factor[i] = (n_d - m_d + 1.0) * normalize * sqrt((n_d + m_d + 1.0) / (n_d - m_d + 1.0));
+
+      // Partial derivative
+      const double normalize_cn0_v20 = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d + 5.0));
+      if (m == 0) {
+        tables.partial_p2_factor[i] = 0.5 * normalize_cn0_v20 * sqrt((n_d + 1.0) * (n_d + 2.0) * (n_d + 3.0) * (n_d + 4.0) / 2.0);
+        tables.partial_0_factor[i] = 0.5 * (n_d + 1.0) * (n_d + 2.0) * normalize_cn0_v20;
+        tables.partial_p1_factor[i] = (n_d + 1.0) * normalize_cn0_v20 * sqrt((n_d + 2.0) * (n_d + 3.0) / 2.0);
+      } else if (m == 1) {
+        tables.partial_p2_factor[i] = 0.25 * normalize_cn0_v20 * sqrt((n_d + 2.0) * (n_d + 3.0) * (n_d + 4.0) * (n_d + 5.0));
+        tables.partial_0_factor[i] = 0.25 * n_d * (n_d + 1.0) * normalize_cn0_v20 * sqrt((n_d + 2.0) * (n_d + 3.0) / (n_d * (n_d + 1.0)));
+      } else {
+        const double factorial = (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0) * (n_d - m_d + 4.0);
+        tables.partial_p2_factor[i] = 0.25 * normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) * (n_d + m_d + 3.0) * (n_d + m_d + 4.0));
+        tables.partial_0_factor[i] = 0.25 * 2.0 * (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * normalize_cn0_v20 *
+                               sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0)));
+        tables.partial_m2_factor[i] = 0.25 * factorial * normalize_cn0_v20 * sqrt((m == 2 ? 2.0 : 1.0) / factorial);
+      }
+      if (m >= 1) {
+        const double factorial = (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * (n_d - m_d + 3.0);
+        tables.partial_p1_factor[i] =
+            0.5 * (n_d - m_d + 1.0) * normalize_cn0_v20 * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) * (n_d + m_d + 3.0) / (n_d - m_d + 1.0));
+        tables.partial_m1_factor[i] = 0.5 * factorial * normalize_cn0_v20 * sqrt((m == 1 ? 2.0 : 1.0) * (n_d + m_d + 1.0) / factorial);
+      }
+      tables.partial_zz_factor[i] = (n_d - m_d + 1.0) * (n_d - m_d + 2.0) * normalize_cn0_v20 *
+                              sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0) / ((n_d - m_d + 1.0) * (n_d - m_d + 2.0)));
+    }
+  }
+
+  // Recursion of V and W function
+  const size_t degree_vw = degree_ + 2;
+  tables.vw_diagonal_factor.assign(degree_vw + 1, 0.0);
+  tables.vw_factor_1.assign(GetVwFactorIndex(degree_vw, degree_vw) + 1, 0.0);
+  tables.vw_factor_2.assign(GetVwFactorIndex(degree_vw, degree_vw) + 1, 0.0);
+  for (size_t m = 0; m <= degree_vw; m++) {
+    const double m_d = (double)m;
+    if (m == 1) {
+      tables.vw_diagonal_factor[m] = sqrt(3.0);
+    } else if (m > 1) {
+      tables.vw_diagonal_factor[m] = sqrt((2.0 * m_d + 1.0) / (2.0 * m_d));
+    }
+    for (size_t n = m + 1; n <= degree_vw; n++) {
+      const double n_d = (double)n;
+      const size_t i = GetVwFactorIndex(n, m);
+      const double c_normalize = sqrt(((2.0 * n_d + 1.0) * (n_d - m_d)) / ((2.0 * n_d - 1.0) * (n_d + m_d)));
+      tables.vw_factor_1[i] = c_normalize * (2.0 * n_d - 1.0) / (n_d - m_d);
+      if (n >= m + 2) {
+        const double c2_normalize = sqrt(((2.0 * n_d - 1.0) * (n_d - m_d - 1.0)) / ((2.0 * n_d - 3.0) * (n_d + m_d - 1.0)));
+        tables.vw_factor_2[i] = c_normalize * c2_normalize * (n_d + m_d - 1.0) / (n_d - m_d);
+      }
+    }
+  }
+}
+
+void GravityPotential::InitializeVw(const libra::Vector<3> &position_xcxf_m) {
+  const double radius_m = position_xcxf_m.CalcNorm();
+  const double tmp = center_body_radius_m_ / pow(radius_m, 2.0);
+  x_tmp_ = position_xcxf_m[0] * tmp;
+  y_tmp_ = position_xcxf_m[1] * tmp;
+  z_tmp_ = position_xcxf_m[2] * tmp;
+  re_tmp_ = center_body_radius_m_ * tmp;
 
-  const double n_d = (double)n_;
+  // n = m = 0
+  v_[GetWorkspaceIndex(0, 0)] = center_body_radius_m_ / radius_m;
+  w_[GetWorkspaceIndex(0, 0)] = 0.0;
+}
+
+void GravityPotential::CalcVwColumn(const size_t m, const size_t degree_vw) {
+  if (m > degree_vw) return;
+  const Tables &tables = *tables_;
 
-  const double tmp = center_body_radius_m_ / pow(radius_m_, 2.0);
-  const double x_tmp = xcxf_x_m_ * tmp;
-  const double y_tmp = xcxf_y_m_ * tmp;
-  double c_normalize;
-  if (n_ == 1) {
-    c_normalize = (2.0 * n_d - 1.0) * sqrt(2.0 * n_d + 1.0);
-  } else {
-    c_normalize = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d));
+  // n = m
+  if (m > 0) {
+    const double v_prev = v_[GetWorkspaceIndex(m - 1, m - 1)];
+    const double w_prev = w_[GetWorkspaceIndex(m - 1, m - 1)];
+    v_[GetWorkspaceIndex(m, m)] = tables.vw_diagonal_factor[m] * (x_tmp_ * v_prev - y_tmp_ * w_prev);
+    w_[GetWorkspaceIndex(m, m)] = tables.vw_diagonal_factor[m] * (x_tmp_ * w_prev + y_tmp_ * v_prev);
   }
+  if (m == degree_vw) return;
+
+  // n > m
+  double *v = &v_[GetWorkspaceIndex(0, m)];
+  double *w = &w_[GetWorkspaceIndex(0, m)];
+  const double *factor_1 = &tables.vw_factor_1[GetVwFactorIndex(m, m)];  // indexed by n - m
+  const double *factor_2 = &tables.vw_factor_2[GetVwFactorIndex(m, m)];  // indexed by n - m
+  v[m + 1] = factor_1[1] * z_tmp_ * v[m];
+  w[m + 1] = factor_1[1] * z_tmp_ * w[m];
+  for (size_t n = m + 2; n <= degree_vw; n++) {
+    v[n] = factor_1[n - m] * z_tmp_ * v[n - 1] - factor_2[n - m] * re_tmp_ * v[n - 2];
+    w[n] = factor_1[n - m] * z_tmp_ * w[n - 1] - factor_2[n - m] * re_tmp_ * w[n - 2];
+  }
+}
 
-  *v_nn = c_normalize * (x_tmp * v_prev - y_tmp * w_prev);
-  *w_nn = c_normalize * (x_tmp * w_prev + y_tmp * v_prev);
-  return;
+void GravityPotential::InitializeBatchVw(GravityPotentialBatch &batch) const {
+  const size_t size = batch.padded_size_;
+  const size_t workspace_size = kNumberOfWorkspaceColumns * workspace_stride_ * size;
+  // Allocated only when the batch or the degree becomes larger than the previous call
+  if (batch.v_.size() < workspace_size) {
+    batch.v_.resize(workspace_size);
+    batch.w_.resize(workspace_size);
+  }
+  batch.x_tmp_.resize(size);
+  batch.y_tmp_.resize(size);
+  batch.z_tmp_.resize(size);
+  batch.re_tmp_.resize(size);
+
+  for (size_t p = 0; p < size; p++) {
+    const double x_m = batch.position_xcxf_m_[0][p], y_m = batch.position_xcxf_m_[1][p], z_m = batch.position_xcxf_m_[2][p];
+    const double radius_m = sqrt(x_m * x_m + y_m * y_m + z_m * z_m);
+    const double tmp = center_body_radius_m_ / pow(radius_m, 2.0);
+    batch.x_tmp_[p] = x_m * tmp;
+    batch.y_tmp_[p] = y_m * tmp;
+    batch.z_tmp_[p] = z_m * tmp;
+    batch.re_tmp_[p] = center_body_radius_m_ * tmp;
+
+    // n = m = 0
+    batch.v_[GetBatchWorkspaceIndex(0, 0, size) + p] = center_body_radius_m_ / radius_m;
+    batch.w_[GetBatchWorkspaceIndex(0, 0, size) + p] = 0.0;
+  }
 }
 
-void GravityPotential::v_w_nm_update(double *v_nm, double *w_nm, const double v_prev, const double w_prev, const double v_prev2,
-                                     const double w_prev2) {
-  if (n_ == m_) return;
-
-  const double m_d = (double)m_;
-  const double n_d = (double)n_;
-
-  const double tmp = center_body_radius_m_ / pow(radius_m_, 2.0);
-  const double z_tmp = xcxf_z_m_ * tmp;
-  const double re_tmp = center_body_radius_m_ * tmp;
-  const double c1 = (2.0 * n_d - 1.0) / (n_d - m_d);
-  const double c2 = (n_d + m_d - 1.0) / (n_d - m_d);
-  double c_normalize, c2_normalize;
-
-  c_normalize = sqrt(((2.0 * n_d + 1.0) * (n_d - m_d)) / ((2.0 * n_d - 1.0) * (n_d + m_d)));
-  if (n_ <= 1) {
-    c2_normalize = 1.0;
-  } else {
-    c2_normalize = sqrt(((2.0 * n_d - 1.0) * (n_d - m_d - 1.0)) / ((2.0 * n_d - 3.0) * (n_d + m_d - 1.0)));
+void GravityPotential::CalcBatchVwColumn(GravityPotentialBatch &batch, const size_t m, const size_t degree_vw) const {
+  if (m > degree_vw) return;
+  const Tables &tables = *tables_;
+  const size_t size = batch.padded_size_;
+  const size_t lanes = PackedDouble::kNumberOfLanes;
+  double *v = batch.v_.data();
+  double *w = batch.w_.data();
+
+  // n = m
+  if (m > 0) {
+    const PackedDouble factor = PackedDouble::Broadcast(tables.vw_diagonal_factor[m]);
+    const size_t i_prev = GetBatchWorkspaceIndex(m - 1, m - 1, size);
+    const size_t i = GetBatchWorkspaceIndex(m, m, size);
+    for (size_t p = 0; p < size; p += lanes) {
+      const PackedDouble x_tmp = PackedDouble::Load(&batch.x_tmp_[p]), y_tmp = PackedDouble::Load(&batch.y_tmp_[p]);
+      const PackedDouble v_prev = PackedDouble::Load(v + i_prev + p), w_prev = PackedDouble::Load(w + i_prev + p);
+      (factor * (x_tmp * v_prev - y_tmp * w_prev)).Store(v + i + p);
+      (factor * (x_tmp * w_prev + y_tmp * v_prev)).Store(w + i + p);
+    }
+  }
+
+  if (m == degree_vw) return;
+
+  // n = m + 1
+  const double *factor_1 = &tables.vw_factor_1[GetVwFactorIndex(m, m)];  // indexed by n - m
+  const double *factor_2 = &tables.vw_factor_2[GetVwFactorIndex(m, m)];  // indexed by n - m
+  {
+    const PackedDouble f1 = PackedDouble::Broadcast(factor_1[1]);
+    const size_t i = GetBatchWorkspaceIndex(m + 1, m, size);
+    const size_t i_prev = GetBatchWorkspaceIndex(m, m, size);
+    for (size_t p = 0; p < size; p += lanes) {
+      const PackedDouble z_tmp = PackedDouble::Load(&batch.z_tmp_[p]);
+      (f1 * z_tmp * PackedDouble::Load(v + i_prev + p)).Store(v + i + p);
+      (f1 * z_tmp * PackedDouble::Load(w + i_prev + p)).Store(w + i + p);
+    }
   }
 
-  *v_nm = c_normalize * (c1 * z_tmp * v_prev - c2 * c2_normalize * re_tmp * v_prev2);
-  *w_nm = c_normalize * (c1 * z_tmp * w_prev - c2 * c2_normalize * re_tmp * w_prev2);
-  return;
+  // n >= m + 2
+  for (size_t n = m + 2; n <= degree_vw; n++) {
+    const PackedDouble f1 = PackedDouble::Broadcast(factor_1[n - m]);
+    const PackedDouble f2 = PackedDouble::Broadcast(factor_2[n - m]);
+    const size_t i = GetBatchWorkspaceIndex(n, m, size);
+    const size_t i_prev = GetBatchWorkspaceIndex(n - 1, m, size);
+    const size_t i_prev2 = GetBatchWorkspaceIndex(n - 2, m, size);
+    for (size_t p = 0; p < size; p += lanes) {
+      const PackedDouble z_tmp = PackedDouble::Load(&batch.z_tmp_[p]), re_tmp = PackedDouble::Load(&batch.re_tmp_[p]);
+      (f1 * z_tmp * PackedDouble::Load(v + i_prev + p) - f2 * re_tmp * PackedDouble::Load(v + i_prev2 + p)).Store(v + i + p);
+      (f1 * z_tmp * PackedDouble::Load(w + i_prev + p) - f2 * re_tmp * PackedDouble::Load(w + i_prev2 + p)).Store(w + i + p);
+    }
+  }
 }
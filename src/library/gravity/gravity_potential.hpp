@@ -7,14 +7,18 @@
 #define S2E_LIBRARY_GRAVITY_GRAVITY_POTENTIAL_HPP_
 
 #include <environment/global/physical_constants.hpp>
+#include <memory>
 #include <vector>
 
 #include "../math/matrix.hpp"
 #include "../math/vector.hpp"
+#include "gravity_potential_batch.hpp"
 
 /**
  * @class GravityPotential
  * @brief Class to calculate gravity potential
+ * @details The coefficients and the normalization factors are not changed after the construction, and they are shared by the copies of the
+ *          object. So a copy of a constructed object is lightweight, and it only owns the workspace of the calculation.
  */
 class GravityPotential {
  public:
@@ -56,31 +60,132 @@ class GravityPotential {
    */
   libra::Matrix<3, 3> CalcPartialDerivative_xcxf_s2(const libra::Vector<3> &position_xcxf_m);
 
+  /**
+   * @fn CalcBatch_xcxf
+   * @brief Calculate the acceleration, and optionally the partial derivative, for all positions in the batch
+   * @note Each coefficient is read once for all positions, and the positions are processed by SIMD instructions.
+   *       This function does not modify the object, so a GravityPotential can be shared by batches.
+   * @param [in,out] batch: Positions in the XCXF frame [m] and the calculated results
+   * @param [in] is_partial_derivative_enabled: Calculate the partial derivative of acceleration too
+   */
+  void CalcBatch_xcxf(GravityPotentialBatch &batch, const bool is_partial_derivative_enabled = false) const;
+
  private:
-  size_t degree_ = 0;                   //!< Maximum degree
-  size_t n_ = 0, m_ = 0;                //!< Degree and order (FIXME: follow naming rule)
-  std::vector<std::vector<double>> c_;  //!< Cosine coefficients
-  std::vector<std::vector<double>> s_;  //!< Sine coefficients
-  double gravity_constants_m3_s2_;      //!< Gravity constant of the center body [m3/s2]
-  double center_body_radius_m_;         //!< Radius of the center body [m]
+  /**
+   * @struct Tables
+   * @brief Coefficients and normalization factors precomputed at the construction
+   */
+  struct Tables {
+    std::vector<double> c;  //!< Cosine coefficients packed order by order (see GetCoefficientIndex)
+    std::vector<double> s;  //!< Sine coefficients packed order by order (see GetCoefficientIndex)
+
+    // Normalization factors (packed as the coefficients)
+    std::vector<double> acceleration_xy1_factor;  //!< Factor of V/W(n+1, m+1) for the X and Y acceleration
+    std::vector<double> acceleration_xy2_factor;  //!< Factor of V/W(n+1, m-1) for the X and Y acceleration
+    std::vector<double> acceleration_z_factor;    //!< Factor of V/W(n+1, m) for the Z acceleration
+    std::vector<double> partial_p2_factor;        //!< Factor of V/W(n+2, m+2) for the XX, XY, and YY partial derivatives
+    std::vector<double> partial_0_factor;         //!< Factor of V/W(n+2, m) for the XX, XY, and YY partial derivatives
+    std::vector<double> partial_m2_factor;        //!< Factor of V/W(n+2, m-2) for the XX, XY, and YY partial derivatives
+    std::vector<double> partial_p1_factor;        //!< Factor of V/W(n+2, m+1) for the XZ and YZ partial derivatives
+    std::vector<double> partial_m1_factor;        //!< Factor of V/W(n+2, m-1) for the XZ and YZ partial derivatives
+    std::vector<double> partial_zz_factor;        //!< Factor of V/W(n+2, m) for the ZZ partial derivative
+    // Recursion factors of V and W function (packed up to degree + 2)
+    std::vector<double> vw_diagonal_factor;  //!< Factor for n = m
+    std::vector<double> vw_factor_1;         //!< Factor of V/W(n-1, m) for n > m
+    std::vector<double> vw_factor_2;         //!< Factor of V/W(n-2, m) for n > m
+  };
+
+  size_t degree_ = 0;                                                   //!< Maximum degree
+  double gravity_constants_m3_s2_;                                      //!< Gravity constant of the center body [m3/s2]
+  double center_body_radius_m_;                                         //!< Radius of the center body [m]
+  std::shared_ptr<const Tables> tables_ = std::make_shared<Tables>();  //!< Precomputed tables shared by the copies
 
   // calculation
-  double radius_m_ = 0.0;                                    //!< Radius [m]
-  double xcxf_x_m_ = 0.0, xcxf_y_m_ = 0.0, xcxf_z_m_ = 0.0;  //!< Spacecraft position in XCXF frame [m]
+  double x_tmp_ = 0.0, y_tmp_ = 0.0, z_tmp_ = 0.0;  //!< Spacecraft position in XCXF frame multiplied by Re/r^2 [-/m]
+  double re_tmp_ = 0.0;                             //!< (Re/r)^2 [-]
+  size_t workspace_stride_ = 0;                     //!< Number of elements of one order column in the workspace
+  std::vector<double> v_;                           //!< Workspace of V function (rolling window of order columns)
+  std::vector<double> w_;                           //!< Workspace of W function (rolling window of order columns)
+
+  static const size_t kNumberOfWorkspaceColumns = 5;  //!< Order columns used at the same time in the partial derivative calculation
+
+  /**
+   * @fn GetPackedIndex
+   * @brief Return index of an array packed order by order, where the degrees of the same order are contiguous
+   * @param [in] n: Degree
+   * @param [in] m: Order (m <= n)
+   * @param [in] max_degree: Maximum degree of the array
+   */
+  static inline size_t GetPackedIndex(const size_t n, const size_t m, const size_t max_degree) {
+    return m * (max_degree + 1) - m * (m - 1) / 2 + (n - m);
+  }
+  /**
+   * @fn GetCoefficientIndex
+   * @brief Return index of the coefficient and normalization factor arrays
+   * @param [in] n: Degree
+   * @param [in] m: Order (m <= n)
+   */
+  inline size_t GetCoefficientIndex(const size_t n, const size_t m) const { return GetPackedIndex(n, m, degree_); }
+  /**
+   * @fn GetVwFactorIndex
+   * @brief Return index of the recursion factor arrays of V and W function
+   * @param [in] n: Degree
+   * @param [in] m: Order (m <= n)
+   */
+  inline size_t GetVwFactorIndex(const size_t n, const size_t m) const { return GetPackedIndex(n, m, degree_ + 2); }
+  /**
+   * @fn GetWorkspaceIndex
+   * @brief Return index of the V/W workspace
+   * @param [in] n: Degree
+   * @param [in] m: Order (m <= n)
+   */
+  inline size_t GetWorkspaceIndex(const size_t n, const size_t m) const { return (m % kNumberOfWorkspaceColumns) * workspace_stride_ + n; }
 
   /**
-   * @fn v_w_nn_update
-   * @brief Calculate V and W function for n = m
-   * @note FIXME: fix function name
+   * @fn InitializeNormalizationFactors
+   * @brief Precompute the normalization factors
+   * @param [in,out] tables: Tables which have the coefficients
+   */
+  void InitializeNormalizationFactors(Tables &tables) const;
+  /**
+   * @fn InitializeVw
+   * @brief Set the position dependent constants and calculate V and W function for n = m = 0
+   * @param [in] position_xcxf_m: Position of the spacecraft in the XCXF frame [m]
    */
-  void v_w_nn_update(double *v_nn, double *w_nn, const double v_prev, const double w_prev);
+  void InitializeVw(const libra::Vector<3> &position_xcxf_m);
+  /**
+   * @fn CalcVwColumn
+   * @brief Calculate V and W function of the order m for all degree
+   * @note The order column m - 1 must be calculated before when m > 0
+   * @param [in] m: Order
+   * @param [in] degree_vw: Maximum degree of V and W function
+   */
+  void CalcVwColumn(const size_t m, const size_t degree_vw);
 
   /**
-   * @fn v_w_nm_update
-   * @brief Calculate V and W function for n not equal m
-   * @note FIXME: fix function name
+   * @fn GetBatchWorkspaceIndex
+   * @brief Return index of the V/W workspace of the batch for the first position
+   * @param [in] n: Degree
+   * @param [in] m: Order (m <= n)
+   * @param [in] padded_size: Padded number of positions of the batch
+   */
+  inline size_t GetBatchWorkspaceIndex(const size_t n, const size_t m, const size_t padded_size) const {
+    return GetWorkspaceIndex(n, m) * padded_size;
+  }
+  /**
+   * @fn InitializeBatchVw
+   * @brief Batch version of InitializeVw
+   * @param [in,out] batch: Batch
+   */
+  void InitializeBatchVw(GravityPotentialBatch &batch) const;
+  /**
+   * @fn CalcBatchVwColumn
+   * @brief Batch version of CalcVwColumn
+   * @param [in,out] batch: Batch
+   * @param [in] m: Order
+   * @param [in] degree_vw: Maximum degree of V and W function
    */
-  void v_w_nm_update(double *v_nm, double *w_nm, const double v_prev, const double w_prev, const double v_prev2, const double w_prev2);
+  void CalcBatchVwColumn(GravityPotentialBatch &batch, const size_t m, const size_t degree_vw) const;
 };
 
 #endif  // S2E_LIBRARY_GRAVITY_GRAVITY_POTENTIAL_HPP_
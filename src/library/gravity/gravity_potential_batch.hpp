@@ -0,0 +1,121 @@
+/**
+ * @file gravity_potential_batch.hpp
+ * @brief Class to hold positions and results of the batched gravity potential calculation
+ */
+
+#ifndef S2E_LIBRARY_GRAVITY_GRAVITY_POTENTIAL_BATCH_HPP_
+#define S2E_LIBRARY_GRAVITY_GRAVITY_POTENTIAL_BATCH_HPP_
+
+#include <vector>
+
+#include "../math/matrix.hpp"
+#include "../math/simd.hpp"
+#include "../math/vector.hpp"
+
+/**
+ * @class GravityPotentialBatch
+ * @brief Positions and results of the batched gravity potential calculation in the structure-of-arrays layout
+ * @note The batch also owns the workspace of the calculation, so reusing the same batch object avoids memory allocation.
+ *       The arrays are padded to a multiple of the SIMD width.
+ */
+class GravityPotentialBatch {
+ public:
+  /**
+   * @fn GravityPotentialBatch
+   * @brief Constructor
+   * @param [in] number_of_positions: Number of positions
+   */
+  GravityPotentialBatch(const size_t number_of_positions = 0) { Resize(number_of_positions); }
+
+  /**
+   * @fn Resize
+   * @brief Change the number of positions
+   * @param [in] number_of_positions: Number of positions
+   */
+  inline void Resize(const size_t number_of_positions) {
+    const size_t lanes = libra::PackedDouble::kNumberOfLanes;
+    number_of_positions_ = number_of_positions;
+    padded_size_ = (number_of_positions + lanes - 1) / lanes * lanes;
+    for (size_t axis = 0; axis < 3; axis++) {
+      position_xcxf_m_[axis].resize(padded_size_, 0.0);
+      acceleration_xcxf_m_s2_[axis].resize(padded_size_, 0.0);
+    }
+    for (size_t i = 0; i < 6; i++) {
+      partial_derivative_xcxf_s2_[i].resize(padded_size_, 0.0);
+    }
+  }
+
+  /**
+   * @fn SetPosition_xcxf_m
+   * @brief Set a position
+   * @param [in] index: Index of the position
+   * @param [in] position_xcxf_m: Position in the XCXF frame [m]
+   */
+  inline void SetPosition_xcxf_m(const size_t index, const libra::Vector<3>& position_xcxf_m) {
+    for (size_t axis = 0; axis < 3; axis++) position_xcxf_m_[axis][index] = position_xcxf_m[axis];
+  }
+
+  // Getter
+  /**
+   * @fn GetNumberOfPositions
+   * @brief Return number of positions
+   */
+  inline size_t GetNumberOfPositions() const { return number_of_positions_; }
+  /**
+   * @fn GetPositions_xcxf_m
+   * @brief Return head of the position array of an axis to set positions in the structure-of-arrays layout
+   * @param [in] axis: Axis index (0: X, 1: Y, 2: Z)
+   */
+  inline double* GetPositions_xcxf_m(const size_t axis) { return position_xcxf_m_[axis].data(); }
+  /**
+   * @fn GetAccelerations_xcxf_m_s2
+   * @brief Return head of the calculated acceleration array of an axis
+   * @param [in] axis: Axis index (0: X, 1: Y, 2: Z)
+   */
+  inline const double* GetAccelerations_xcxf_m_s2(const size_t axis) const { return acceleration_xcxf_m_s2_[axis].data(); }
+  /**
+   * @fn GetAcceleration_xcxf_m_s2
+   * @brief Return calculated acceleration in the XCXF frame [m/s2]
+   * @param [in] index: Index of the position
+   */
+  inline libra::Vector<3> GetAcceleration_xcxf_m_s2(const size_t index) const {
+    libra::Vector<3> acceleration_xcxf_m_s2;
+    for (size_t axis = 0; axis < 3; axis++) acceleration_xcxf_m_s2[axis] = acceleration_xcxf_m_s2_[axis][index];
+    return acceleration_xcxf_m_s2;
+  }
+  /**
+   * @fn GetPartialDerivative_xcxf_s2
+   * @brief Return calculated partial derivative of acceleration in the XCXF frame [-/s2]
+   * @note Valid only when the partial derivative calculation is enabled
+   * @param [in] index: Index of the position
+   */
+  inline libra::Matrix<3, 3> GetPartialDerivative_xcxf_s2(const size_t index) const {
+    libra::Matrix<3, 3> partial_derivative_xcxf_s2;
+    partial_derivative_xcxf_s2[0][0] = partial_derivative_xcxf_s2_[kXx][index];
+    partial_derivative_xcxf_s2[0][1] = partial_derivative_xcxf_s2[1][0] = partial_derivative_xcxf_s2_[kXy][index];
+    partial_derivative_xcxf_s2[0][2] = partial_derivative_xcxf_s2[2][0] = partial_derivative_xcxf_s2_[kXz][index];
+    partial_derivative_xcxf_s2[1][1] = partial_derivative_xcxf_s2_[kYy][index];
+    partial_derivative_xcxf_s2[1][2] = partial_derivative_xcxf_s2[2][1] = partial_derivative_xcxf_s2_[kYz][index];
+    partial_derivative_xcxf_s2[2][2] = partial_derivative_xcxf_s2_[kZz][index];
+    return partial_derivative_xcxf_s2;
+  }
+
+ private:
+  friend class GravityPotential;
+
+  enum { kXx, kXy, kXz, kYy, kYz, kZz };  //!< Index of the symmetric partial derivative elements
+
+  size_t number_of_positions_ = 0;                     //!< Number of positions
+  size_t padded_size_ = 0;                             //!< Number of positions padded to a multiple of the SIMD width
+  std::vector<double> position_xcxf_m_[3];             //!< Positions in the XCXF frame [m]
+  std::vector<double> acceleration_xcxf_m_s2_[3];      //!< Calculated accelerations in the XCXF frame [m/s2]
+  std::vector<double> partial_derivative_xcxf_s2_[6];  //!< Calculated partial derivatives in the XCXF frame [-/s2]
+
+  // Workspace
+  std::vector<double> x_tmp_, y_tmp_, z_tmp_;  //!< Positions multiplied by Re/r^2 [-/m]
+  std::vector<double> re_tmp_;                 //!< (Re/r)^2 [-]
+  std::vector<double> v_;                      //!< Workspace of V function (rolling window of order columns)
+  std::vector<double> w_;                      //!< Workspace of W function (rolling window of order columns)
+};
+
+#endif  // S2E_LIBRARY_GRAVITY_GRAVITY_POTENTIAL_BATCH_HPP_
@@ -153,3 +153,94 @@ TEST(GravityPotential, PartialDerivative2) {
     }
   }
 }
+
+/**
+ * @brief Test for reuse of the internal workspace between calls
+ */
+TEST(GravityPotential, WorkspaceReuse) {
+  const size_t degree = 10;
+
+  std::vector<std::vector<double>> c_;  //!< Cosine coefficients
+  std::vector<std::vector<double>> s_;  //!< Sine coefficients
+
+  // Unit coefficients
+  c_.assign(degree + 1, std::vector<double>(degree + 1, 1.0));
+  s_.assign(degree + 1, std::vector<double>(degree + 1, 1.0));
+
+  // Initialize GravityPotential
+  GravityPotential gravity_potential_(degree, c_, s_, 1.0, 1.0);
+
+  libra::Vector<3> position_1_xcxf_m;
+  position_1_xcxf_m[0] = 1.0;
+  position_1_xcxf_m[1] = 0.0;
+  position_1_xcxf_m[2] = 0.0;
+  libra::Vector<3> position_2_xcxf_m;
+  position_2_xcxf_m[0] = 1.0;
+  position_2_xcxf_m[1] = 1.0;
+  position_2_xcxf_m[2] = 1.0;
+
+  // The results must not depend on the previous calls
+  const libra::Vector<3> acceleration_xcxf_m_s2 = gravity_potential_.CalcAcceleration_xcxf_m_s2(position_1_xcxf_m);
+  const libra::Matrix<3, 3> partial_derivative_xcxf_s2 = gravity_potential_.CalcPartialDerivative_xcxf_s2(position_1_xcxf_m);
+  gravity_potential_.CalcPartialDerivative_xcxf_s2(position_2_xcxf_m);
+  gravity_potential_.CalcAcceleration_xcxf_m_s2(position_2_xcxf_m);
+  const libra::Vector<3> acceleration_again_xcxf_m_s2 = gravity_potential_.CalcAcceleration_xcxf_m_s2(position_1_xcxf_m);
+  const libra::Matrix<3, 3> partial_derivative_again_xcxf_s2 = gravity_potential_.CalcPartialDerivative_xcxf_s2(position_1_xcxf_m);
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_DOUBLE_EQ(acceleration_xcxf_m_s2[i], acceleration_again_xcxf_m_s2[i]);
+    for (size_t j = 0; j < 3; j++) {
+      EXPECT_DOUBLE_EQ(partial_derivative_xcxf_s2[i][j], partial_derivative_again_xcxf_s2[i][j]);
+    }
+  }
+}
+
+/**
+ * @brief Test for batched calculation
+ */
+TEST(GravityPotential, Batch) {
+  const size_t degree = 10;
+
+  std::vector<std::vector<double>> c_;  //!< Cosine coefficients
+  std::vector<std::vector<double>> s_;  //!< Sine coefficients
+
+  // Unit coefficients
+  c_.assign(degree + 1, std::vector<double>(degree + 1, 1.0));
+  s_.assign(degree + 1, std::vector<double>(degree + 1, 1.0));
+
+  // Initialize GravityPotential
+  GravityPotential gravity_potential_(degree, c_, s_, 1.0, 1.0);
+
+  // The number of positions is not a multiple of the SIMD width
+  const size_t number_of_positions = 5;
+  GravityPotentialBatch batch(number_of_positions);
+  std::vector<libra::Vector<3>> positions_xcxf_m;
+  for (size_t i = 0; i < number_of_positions; i++) {
+    libra::Vector<3> position_xcxf_m;
+    position_xcxf_m[0] = 1.0 + 0.1 * i;
+    position_xcxf_m[1] = 0.5 - 0.2 * i;
+    position_xcxf_m[2] = 0.3 * i;
+    positions_xcxf_m.push_back(position_xcxf_m);
+    batch.SetPosition_xcxf_m(i, position_xcxf_m);
+  }
+
+  const double accuracy = 1.0e-10;
+  for (int is_partial_derivative_enabled = 0; is_partial_derivative_enabled <= 1; is_partial_derivative_enabled++) {
+    gravity_potential_.CalcBatch_xcxf(batch, is_partial_derivative_enabled == 1);
+    for (size_t i = 0; i < number_of_positions; i++) {
+      const libra::Vector<3> acceleration_xcxf_m_s2 = gravity_potential_.CalcAcceleration_xcxf_m_s2(positions_xcxf_m[i]);
+      const libra::Vector<3> batch_acceleration_xcxf_m_s2 = batch.GetAcceleration_xcxf_m_s2(i);
+      for (size_t j = 0; j < 3; j++) {
+        EXPECT_NEAR(acceleration_xcxf_m_s2[j], batch_acceleration_xcxf_m_s2[j], accuracy * fabs(acceleration_xcxf_m_s2[j]));
+      }
+      if (is_partial_derivative_enabled == 0) continue;
+
+      const libra::Matrix<3, 3> partial_derivative_xcxf_s2 = gravity_potential_.CalcPartialDerivative_xcxf_s2(positions_xcxf_m[i]);
+      const libra::Matrix<3, 3> batch_partial_derivative_xcxf_s2 = batch.GetPartialDerivative_xcxf_s2(i);
+      for (size_t j = 0; j < 3; j++) {
+        for (size_t k = 0; k < 3; k++) {
+          EXPECT_NEAR(partial_derivative_xcxf_s2[j][k], batch_partial_derivative_xcxf_s2[j][k], accuracy * fabs(partial_derivative_xcxf_s2[j][k]));
+        }
+      }
+    }
+  }
+}
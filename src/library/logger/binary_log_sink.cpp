@@ -0,0 +1,102 @@
+/**
+ * @file binary_log_sink.cpp
+ * @brief Log output destination for binary columnar file
+ */
+
+#include "binary_log_sink.hpp"
+
+#include <iostream>
+#include <library/utilities/macros.hpp>
+
+const char BinaryLogSink::kMagic[8] = {'S', '2', 'E', 'L', 'O', 'G', 'B', '\0'};
+const uint32_t BinaryLogSink::kVersion;
+
+BinaryLogSink::BinaryLogSink(const std::string& file_path, const LogWriterSetting& writer_setting) : writer_(file_path, writer_setting, true) {}
+
+BinaryLogSink::~BinaryLogSink() {
+  // The file writer writes all records into the file at its destruction
+  if (!is_header_written_) {
+    WriteFileHeader();
+    writer_.EndRecord();
+  }
+}
+
+void BinaryLogSink::WriteHeader(const ILoggable& loggable) { headers_.push_back(loggable.GetLogHeader()); }
+
+void BinaryLogSink::EndHeader(const bool add_newline) {
+  UNUSED(add_newline);
+  segment_index_ = 0;
+}
+
+void BinaryLogSink::WriteValue(const ILoggable& loggable) {
+  if (is_layout_broken_ || !writer_.IsOpened()) return;
+
+  record_.Clear();
+  loggable.AppendLogValue(record_);
+  const std::vector<LogColumn>& columns = record_.GetColumns();
+
+  // The column types are fixed by the first record
+  if (!is_header_written_) {
+    layout_.push_back(columns);
+  } else if (segment_index_ >= layout_.size() || columns.size() != layout_[segment_index_].size()) {
+    std::cerr << "Error: the number of log columns is changed. The binary log output is stopped." << std::endl;
+    is_layout_broken_ = true;
+    return;
+  }
+  segment_index_++;
+
+  size_t value_index = 0;
+  size_t text_index = 0;
+  for (const LogColumn& column : columns) {
+    if (column.type == LogColumnType::kDouble) {
+      const double value = record_.GetValues()[value_index++];
+      AppendToBuffer(&value, sizeof(value));
+    } else {
+      const std::string& text = record_.GetText(text_index++);
+      const uint32_t length = static_cast<uint32_t>(text.size());
+      AppendToBuffer(&length, sizeof(length));
+      AppendToBuffer(text.data(), text.size());
+    }
+  }
+}
+
+void BinaryLogSink::EndRecord(const bool add_newline) {
+  UNUSED(add_newline);
+  segment_index_ = 0;
+  if (is_layout_broken_ || !writer_.IsOpened()) {
+    record_buffer_.clear();
+    return;
+  }
+
+  if (!is_header_written_) WriteFileHeader();
+  writer_.Write(record_buffer_.data(), record_buffer_.size());
+  writer_.EndRecord();
+  record_buffer_.clear();
+}
+
+void BinaryLogSink::Flush() { writer_.Flush(); }
+
+void BinaryLogSink::WriteFileHeader() {
+  // Segments without values are written with no columns
+  layout_.resize(headers_.size());
+
+  const uint32_t version = kVersion;
+  const uint32_t number_of_segments = static_cast<uint32_t>(headers_.size());
+  writer_.Write(kMagic, sizeof(kMagic));
+  writer_.Write(&version, sizeof(version));
+  writer_.Write(&number_of_segments, sizeof(number_of_segments));
+  for (size_t i = 0; i < headers_.size(); i++) {
+    const uint32_t header_length = static_cast<uint32_t>(headers_[i].size());
+    writer_.Write(&header_length, sizeof(header_length));
+    writer_.Write(headers_[i]);
+
+    const uint32_t number_of_columns = static_cast<uint32_t>(layout_[i].size());
+    writer_.Write(&number_of_columns, sizeof(number_of_columns));
+    for (const LogColumn& column : layout_[i]) {
+      const uint8_t type = static_cast<uint8_t>(column.type);
+      writer_.Write(&type, sizeof(type));
+      writer_.Write(&column.precision, sizeof(column.precision));
+    }
+  }
+  is_header_written_ = true;
+}
@@ -0,0 +1,105 @@
+/**
+ * @file binary_log_sink.hpp
+ * @brief Log output destination for binary columnar file
+ */
+
+#ifndef S2E_LIBRARY_LOGGER_BINARY_LOG_SINK_HPP_
+#define S2E_LIBRARY_LOGGER_BINARY_LOG_SINK_HPP_
+
+#include <string>
+#include <vector>
+
+#include "log_file_writer.hpp"
+#include "log_record.hpp"
+#include "log_sink.hpp"
+
+/**
+ * @class BinaryLogSink
+ * @brief Log output destination for binary columnar file
+ * @details The file consists of a header written once and raw records appended every log step.
+ *          Numbers are stored in the native (little-endian) byte order.
+ *          Header: magic "S2ELOGB" + '\0' (8 bytes), version (uint32), number of segments (uint32), and for each segment (= loggable):
+ *          CSV header length (uint32), CSV header text, number of columns (uint32), and type (uint8) and precision (uint8) of each column.
+ *          Record: for each segment and column, a double (8 bytes) or a text length (uint32) followed by the text.
+ *          scripts/Log/convert_binary_log_to_csv.py converts the file into the CSV layout written by CsvLogSink.
+ */
+class BinaryLogSink : public ILogSink {
+ public:
+  /**
+   * @fn BinaryLogSink
+   * @brief Constructor
+   * @param [in] file_path: Path to the output binary file
+   * @param [in] writer_setting: Setting of the file writer
+   */
+  BinaryLogSink(const std::string& file_path, const LogWriterSetting& writer_setting = LogWriterSetting());
+  /**
+   * @fn ~BinaryLogSink
+   * @brief Destructor
+   */
+  virtual ~BinaryLogSink();
+
+  // Override ILogSink
+  /**
+   * @fn IsOpened
+   * @brief Override IsOpened function of ILogSink
+   */
+  virtual bool IsOpened() const { return writer_.IsOpened(); }
+  /**
+   * @fn WriteHeader
+   * @brief Override WriteHeader function of ILogSink
+   */
+  virtual void WriteHeader(const ILoggable& loggable);
+  /**
+   * @fn EndHeader
+   * @brief Override EndHeader function of ILogSink
+   * @note The header is written into the file with the column types at the end of the first record
+   */
+  virtual void EndHeader(const bool add_newline);
+  /**
+   * @fn WriteValue
+   * @brief Override WriteValue function of ILogSink
+   */
+  virtual void WriteValue(const ILoggable& loggable);
+  /**
+   * @fn EndRecord
+   * @brief Override EndRecord function of ILogSink
+   * @note A record always corresponds to a line of the CSV file, so add_newline is ignored
+   */
+  virtual void EndRecord(const bool add_newline);
+  /**
+   * @fn Flush
+   * @brief Override Flush function of ILogSink
+   */
+  virtual void Flush();
+
+  static const char kMagic[8];         //!< Magic number at the head of the file
+  static const uint32_t kVersion = 1;  //!< Version of the file format
+
+ private:
+  LogFileWriter writer_;                        //!< Binary file writer
+  std::vector<std::string> headers_;            //!< CSV header of each segment
+  std::vector<std::vector<LogColumn>> layout_;  //!< Column types of each segment
+  bool is_header_written_ = false;              //!< Is the header written into the file?
+  bool is_layout_broken_ = false;               //!< Does a loggable change its number of columns?
+  size_t segment_index_ = 0;                    //!< Index of the segment in the current record
+  LogRecord record_;                            //!< Reused record of a loggable
+  std::vector<char> record_buffer_;             //!< Reused buffer of the current record
+
+  /**
+   * @fn WriteFileHeader
+   * @brief Write the header block into the file writer
+   */
+  void WriteFileHeader();
+  /**
+   * @fn AppendToBuffer
+   * @brief Append raw bytes into the current record buffer
+   * @param [in] data: Pointer to the data
+   * @param [in] size: Size of the data [Byte]
+   */
+  inline void AppendToBuffer(const void* data, const size_t size) {
+    const char* bytes = static_cast<const char*>(data);
+    record_buffer_.insert(record_buffer_.end(), bytes, bytes + size);
+  }
+};
+
+#endif  // S2E_LIBRARY_LOGGER_BINARY_LOG_SINK_HPP_
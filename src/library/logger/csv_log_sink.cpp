@@ -0,0 +1,26 @@
+/**
+ * @file csv_log_sink.cpp
+ * @brief Log output destination for CSV file
+ */
+
+#include "csv_log_sink.hpp"
+
+CsvLogSink::CsvLogSink(const std::string& file_path, const LogWriterSetting& writer_setting) : writer_(file_path, writer_setting, false) {}
+
+CsvLogSink::~CsvLogSink() {}
+
+void CsvLogSink::WriteHeader(const ILoggable& loggable) { writer_.Write(loggable.GetLogHeader()); }
+
+void CsvLogSink::EndHeader(const bool add_newline) {
+  if (add_newline) writer_.Write("\n", 1);
+  writer_.EndRecord();
+}
+
+void CsvLogSink::WriteValue(const ILoggable& loggable) { writer_.Write(loggable.GetLogValue()); }
+
+void CsvLogSink::EndRecord(const bool add_newline) {
+  if (add_newline) writer_.Write("\n", 1);
+  writer_.EndRecord();
+}
+
+void CsvLogSink::Flush() { writer_.Flush(); }
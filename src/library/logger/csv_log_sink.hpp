@@ -0,0 +1,69 @@
+/**
+ * @file csv_log_sink.hpp
+ * @brief Log output destination for CSV file
+ */
+
+#ifndef S2E_LIBRARY_LOGGER_CSV_LOG_SINK_HPP_
+#define S2E_LIBRARY_LOGGER_CSV_LOG_SINK_HPP_
+
+#include <string>
+
+#include "log_file_writer.hpp"
+#include "log_sink.hpp"
+
+/**
+ * @class CsvLogSink
+ * @brief Log output destination for CSV file
+ */
+class CsvLogSink : public ILogSink {
+ public:
+  /**
+   * @fn CsvLogSink
+   * @brief Constructor
+   * @param [in] file_path: Path to the output CSV file
+   * @param [in] writer_setting: Setting of the file writer
+   */
+  CsvLogSink(const std::string& file_path, const LogWriterSetting& writer_setting = LogWriterSetting());
+  /**
+   * @fn ~CsvLogSink
+   * @brief Destructor
+   */
+  virtual ~CsvLogSink();
+
+  // Override ILogSink
+  /**
+   * @fn IsOpened
+   * @brief Override IsOpened function of ILogSink
+   */
+  virtual bool IsOpened() const { return writer_.IsOpened(); }
+  /**
+   * @fn WriteHeader
+   * @brief Override WriteHeader function of ILogSink
+   */
+  virtual void WriteHeader(const ILoggable& loggable);
+  /**
+   * @fn EndHeader
+   * @brief Override EndHeader function of ILogSink
+   */
+  virtual void EndHeader(const bool add_newline);
+  /**
+   * @fn WriteValue
+   * @brief Override WriteValue function of ILogSink
+   */
+  virtual void WriteValue(const ILoggable& loggable);
+  /**
+   * @fn EndRecord
+   * @brief Override EndRecord function of ILogSink
+   */
+  virtual void EndRecord(const bool add_newline);
+  /**
+   * @fn Flush
+   * @brief Override Flush function of ILogSink
+   */
+  virtual void Flush();
+
+ private:
+  LogFileWriter writer_;  //!< CSV file writer
+};
+
+#endif  // S2E_LIBRARY_LOGGER_CSV_LOG_SINK_HPP_
@@ -13,7 +13,8 @@ Logger* InitLog(std::string file_name) {
   std::string log_file_path = ini_file.ReadString("SIMULATION_SETTINGS", "log_file_save_directory");
   bool log_ini = ini_file.ReadEnable("SIMULATION_SETTINGS", "save_initialize_files");
 
-  Logger* log = new Logger("default.csv", log_file_path, file_name, log_ini, true);
+  Logger* log = new Logger("default.csv", log_file_path, file_name, log_ini, true, ReadLogFileFormat(file_name), ReadLogWriterSetting(file_name));
+  log->SetLogSummary(InitLogSummary(file_name));
 
   return log;
 }
@@ -28,3 +29,38 @@ Logger* InitMonteCarloLog(std::string file_name, bool enable) {
 
   return log;
 }
+
+LogFileFormat ReadLogFileFormat(std::string file_name) {
+  IniAccess ini_file(file_name);
+
+  std::string log_file_format = ini_file.ReadString("SIMULATION_SETTINGS", "log_file_format");
+  if (log_file_format == "BINARY") {
+    return LogFileFormat::kBinary;
+  }
+  return LogFileFormat::kCsv;
+}
+
+LogWriterSetting ReadLogWriterSetting(std::string file_name) {
+  IniAccess ini_file(file_name);
+
+  LogWriterSetting setting;
+  setting.is_asynchronous = ini_file.ReadEnable("SIMULATION_SETTINGS", "log_asynchronous_writing");
+  std::string buffer_full_policy = ini_file.ReadString("SIMULATION_SETTINGS", "log_buffer_full_policy");
+  if (buffer_full_policy == "DROP") {
+    setting.buffer_full_policy = LogBufferFullPolicy::kDrop;
+  }
+  return setting;
+}
+
+LogSummary* InitLogSummary(std::string file_name) {
+  IniAccess ini_file(file_name);
+
+  std::vector<std::string> reducer_settings = ini_file.ReadStrVector("SIMULATION_SETTINGS", "log_summary");
+  if (reducer_settings.empty()) return nullptr;
+
+  LogSummary* log_summary = new LogSummary();
+  for (const std::string& reducer_setting : reducer_settings) {
+    log_summary->AddReducer(reducer_setting);
+  }
+  return log_summary;
+}
@@ -23,4 +23,28 @@ Logger* InitLog(std::string file_name);
  */
 Logger* InitMonteCarloLog(std::string file_name, bool enable);
 
+/**
+ * @fn ReadLogFileFormat
+ * @brief Read the format of the log output file
+ * @param [in] file_name: File name of the initialize file
+ * @return Log file format (CSV when the setting is not found)
+ */
+LogFileFormat ReadLogFileFormat(std::string file_name);
+
+/**
+ * @fn ReadLogWriterSetting
+ * @brief Read the setting of the log file writer
+ * @param [in] file_name: File name of the initialize file
+ * @return Log writer setting (synchronous writing when the setting is not found)
+ */
+LogWriterSetting ReadLogWriterSetting(std::string file_name);
+
+/**
+ * @fn InitLogSummary
+ * @brief Initialize the summary of the log columns
+ * @param [in] file_name: File name of the initialize file
+ * @return Log summary (nullptr when no reducer is set)
+ */
+LogSummary* InitLogSummary(std::string file_name);
+
 #endif  // S2E_LIBRARY_LOGGER_INITIALIZE_LOG_HPP_
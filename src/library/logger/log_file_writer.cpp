@@ -0,0 +1,130 @@
+/**
+ * @file log_file_writer.cpp
+ * @brief Class to write log data into a file with buffers and an optional background writer thread
+ */
+
+#include "log_file_writer.hpp"
+
+#include <iostream>
+
+LogFileWriter::LogFileWriter(const std::string& file_path, const LogWriterSetting& setting, const bool is_binary_mode) : setting_(setting) {
+  std::ios::openmode open_mode = std::ios::out;
+  if (is_binary_mode) open_mode |= std::ios::binary;
+  file_.open(file_path, open_mode);
+  is_file_opened_ = file_.is_open();
+  if (!is_file_opened_) {
+    std::cerr << "Error opening log file: " << file_path << std::endl;
+    return;
+  }
+
+  // The caller thread fills a buffer while the writer thread writes another one
+  if (!setting_.is_asynchronous) {
+    setting_.number_of_buffers = 1;
+  } else if (setting_.number_of_buffers < 2) {
+    setting_.number_of_buffers = 2;
+  }
+  ring_.resize(setting_.number_of_buffers);
+  for (auto& buffer : ring_) {
+    buffer.reserve(setting_.buffer_size_byte);
+  }
+
+  if (setting_.is_asynchronous) {
+    writer_thread_ = std::thread(&LogFileWriter::WriterThread, this);
+  }
+}
+
+LogFileWriter::~LogFileWriter() {
+  if (!is_file_opened_) return;
+
+  Flush();
+  if (writer_thread_.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      is_stop_requested_ = true;
+    }
+    filled_cv_.notify_one();
+    writer_thread_.join();
+  }
+  if (number_of_dropped_records_ > 0) {
+    std::cerr << "Warning: " << number_of_dropped_records_ << " log records are dropped since the log buffers are full." << std::endl;
+  }
+  file_.close();
+}
+
+void LogFileWriter::Write(const void* data, const size_t size) {
+  if (!is_file_opened_) return;
+  const char* bytes = static_cast<const char*>(data);
+  std::vector<char>& buffer = ring_[write_index_];
+  buffer.insert(buffer.end(), bytes, bytes + size);
+}
+
+void LogFileWriter::EndRecord() {
+  if (!is_file_opened_) return;
+
+  if (ring_[write_index_].size() >= setting_.buffer_size_byte) {
+    const bool is_blocking = (setting_.buffer_full_policy == LogBufferFullPolicy::kBlock);
+    if (!SubmitCurrentBuffer(is_blocking)) {
+      // Drop the latest record so that the buffer does not grow
+      ring_[write_index_].resize(record_start_position_);
+      number_of_dropped_records_++;
+    }
+  }
+  record_start_position_ = ring_[write_index_].size();
+}
+
+void LogFileWriter::Flush() {
+  if (!is_file_opened_) return;
+
+  if (!ring_[write_index_].empty()) SubmitCurrentBuffer(true);
+  record_start_position_ = 0;
+  if (setting_.is_asynchronous) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    released_cv_.wait(lock, [this] { return number_of_filled_buffers_ == 0; });
+  }
+  // The writer thread does not access the file here since all buffers are written
+  file_.flush();
+}
+
+bool LogFileWriter::SubmitCurrentBuffer(const bool is_blocking) {
+  if (!setting_.is_asynchronous) {
+    std::vector<char>& buffer = ring_[write_index_];
+    file_.write(buffer.data(), buffer.size());
+    buffer.clear();
+    return true;
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    // The next buffer is free when it is neither waiting for nor under writing
+    if (number_of_filled_buffers_ + 1 >= ring_.size()) {
+      if (!is_blocking) return false;
+      released_cv_.wait(lock, [this] { return number_of_filled_buffers_ + 1 < ring_.size(); });
+    }
+    number_of_filled_buffers_++;
+    write_index_ = (write_index_ + 1) % ring_.size();
+  }
+  filled_cv_.notify_one();
+  return true;
+}
+
+void LogFileWriter::WriterThread() {
+  while (true) {
+    std::vector<char>* buffer;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      filled_cv_.wait(lock, [this] { return number_of_filled_buffers_ > 0 || is_stop_requested_; });
+      if (number_of_filled_buffers_ == 0) return;  // Stop after all buffers are written
+      buffer = &ring_[read_index_];
+    }
+
+    file_.write(buffer->data(), buffer->size());
+    buffer->clear();
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      read_index_ = (read_index_ + 1) % ring_.size();
+      number_of_filled_buffers_--;
+    }
+    released_cv_.notify_all();
+  }
+}
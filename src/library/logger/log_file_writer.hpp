@@ -0,0 +1,130 @@
+/**
+ * @file log_file_writer.hpp
+ * @brief Class to write log data into a file with buffers and an optional background writer thread
+ */
+
+#ifndef S2E_LIBRARY_LOGGER_LOG_FILE_WRITER_HPP_
+#define S2E_LIBRARY_LOGGER_LOG_FILE_WRITER_HPP_
+
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @enum LogBufferFullPolicy
+ * @brief Behavior when all record buffers are waiting for the writer thread
+ */
+enum class LogBufferFullPolicy {
+  kBlock,  //!< Wait for the writer thread (no data loss)
+  kDrop,   //!< Drop the record (the simulation never waits for the disk)
+};
+
+/**
+ * @struct LogWriterSetting
+ * @brief Setting of the log file writer
+ */
+struct LogWriterSetting {
+  bool is_asynchronous = false;                                          //!< Write the file in a background thread
+  LogBufferFullPolicy buffer_full_policy = LogBufferFullPolicy::kBlock;  //!< Policy when all buffers are full
+  size_t number_of_buffers = 4;                                          //!< Number of record buffers (>= 2 for asynchronous mode)
+  size_t buffer_size_byte = 1 << 20;                                     //!< Size of a record buffer [Byte]
+};
+
+/**
+ * @class LogFileWriter
+ * @brief Class to write log data into a file with buffers and an optional background writer thread
+ * @details Records are appended into a ring of preallocated buffers. A filled buffer is written into the file by the caller thread in the
+ *          synchronous mode, or handed to the background writer thread in the asynchronous mode. The memory is bounded by the number and
+ *          the size of the buffers. Flush and the destructor wait until all records are written into the file.
+ */
+class LogFileWriter {
+ public:
+  /**
+   * @fn LogFileWriter
+   * @brief Constructor
+   * @param [in] file_path: Path to the output file
+   * @param [in] setting: Writer setting
+   * @param [in] is_binary_mode: Open the file in binary mode
+   */
+  LogFileWriter(const std::string& file_path, const LogWriterSetting& setting, const bool is_binary_mode);
+  /**
+   * @fn ~LogFileWriter
+   * @brief Destructor: write all buffered records and stop the writer thread
+   */
+  ~LogFileWriter();
+
+  // Prohibit copy since the writer thread accesses the members
+  LogFileWriter(const LogFileWriter&) = delete;
+  LogFileWriter& operator=(const LogFileWriter&) = delete;
+
+  /**
+   * @fn Write
+   * @brief Append data to the current record
+   * @param [in] data: Pointer to the data
+   * @param [in] size: Size of the data [Byte]
+   */
+  void Write(const void* data, const size_t size);
+  /**
+   * @fn Write
+   * @brief Append string to the current record
+   * @param [in] data: String data
+   */
+  inline void Write(const std::string& data) { Write(data.data(), data.size()); }
+  /**
+   * @fn EndRecord
+   * @brief Finish the current record. The buffer is handed to the file when it is filled.
+   */
+  void EndRecord();
+  /**
+   * @fn Flush
+   * @brief Write all finished records into the file and wait for the completion
+   */
+  void Flush();
+
+  // Getter
+  /**
+   * @fn IsOpened
+   * @brief Return true when the output file is opened
+   */
+  inline bool IsOpened() const { return is_file_opened_; }
+  /**
+   * @fn GetNumberOfDroppedRecords
+   * @brief Return the number of records dropped with LogBufferFullPolicy::kDrop
+   */
+  inline size_t GetNumberOfDroppedRecords() const { return number_of_dropped_records_; }
+
+ private:
+  std::ofstream file_;                    //!< Output file stream
+  bool is_file_opened_;                   //!< Is the output file opened?
+  LogWriterSetting setting_;              //!< Writer setting
+  std::vector<std::vector<char>> ring_;   //!< Ring of record buffers
+  size_t write_index_ = 0;                //!< Index of the buffer filled by the caller thread
+  size_t read_index_ = 0;                 //!< Index of the next buffer written by the writer thread
+  size_t number_of_filled_buffers_ = 0;   //!< Number of buffers waiting for or under writing
+  size_t record_start_position_ = 0;      //!< Start position of the current record in the current buffer
+  size_t number_of_dropped_records_ = 0;  //!< Number of dropped records
+
+  std::thread writer_thread_;            //!< Background writer thread
+  std::mutex mutex_;                     //!< Mutex for the ring indexes
+  std::condition_variable filled_cv_;    //!< Notified when a buffer is filled
+  std::condition_variable released_cv_;  //!< Notified when a buffer is written
+  bool is_stop_requested_ = false;       //!< Request to stop the writer thread
+
+  /**
+   * @fn SubmitCurrentBuffer
+   * @brief Hand the current buffer to the file
+   * @param [in] is_blocking: Wait for a free buffer regardless of the policy
+   * @return False when the current record is dropped
+   */
+  bool SubmitCurrentBuffer(const bool is_blocking);
+  /**
+   * @fn WriterThread
+   * @brief Main routine of the writer thread
+   */
+  void WriterThread();
+};
+
+#endif  // S2E_LIBRARY_LOGGER_LOG_FILE_WRITER_HPP_
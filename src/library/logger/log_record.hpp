@@ -0,0 +1,164 @@
+/**
+ * @file log_record.hpp
+ * @brief Typed log values of a loggable for binary log output
+ */
+
+#ifndef S2E_LIBRARY_LOGGER_LOG_RECORD_HPP_
+#define S2E_LIBRARY_LOGGER_LOG_RECORD_HPP_
+
+#include <cstdint>
+#include <iomanip>
+#include <library/math/matrix.hpp>
+#include <library/math/quaternion.hpp>
+#include <library/math/vector.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * @enum LogColumnType
+ * @brief Type of a column in the binary log
+ */
+enum class LogColumnType : uint8_t {
+  kDouble = 0,  //!< Raw double value
+  kText = 1,    //!< Pre-formatted CSV text (may include several CSV columns)
+};
+
+/**
+ * @struct LogColumn
+ * @brief Type information of a column in the binary log
+ */
+struct LogColumn {
+  LogColumnType type;  //!< Column type
+  uint8_t precision;   //!< Precision (number of digit) used when the value is converted to CSV
+};
+
+/**
+ * @class LogRecord
+ * @brief Typed log values of a loggable for binary log output
+ * @note Clear keeps the allocated memory, so the same record can be reused every log step without allocation
+ */
+class LogRecord {
+ public:
+  /**
+   * @fn Clear
+   * @brief Clear the stored values while keeping the allocated memory
+   */
+  inline void Clear() {
+    columns_.clear();
+    values_.clear();
+    number_of_texts_ = 0;
+  }
+
+  /**
+   * @fn AddScalar
+   * @brief Add scalar value
+   * @param [in] scalar: Scalar value
+   * @param [in] precision: Precision for the value when converted to CSV (number of digit)
+   */
+  inline void AddScalar(const double scalar, const int precision = 6) {
+    columns_.push_back({LogColumnType::kDouble, static_cast<uint8_t>(precision)});
+    values_.push_back(scalar);
+  }
+  /**
+   * @fn AddVector
+   * @brief Add vector value
+   * @param [in] vector: Vector value
+   * @param [in] precision: Precision for the value when converted to CSV (number of digit)
+   */
+  template <size_t NUM>
+  inline void AddVector(const libra::Vector<NUM, double>& vector, const int precision = 6) {
+    for (size_t i = 0; i < NUM; i++) AddScalar(vector[i], precision);
+  }
+  /**
+   * @fn AddMatrix
+   * @brief Add matrix value
+   * @param [in] matrix: Matrix value
+   * @param [in] precision: Precision for the value when converted to CSV (number of digit)
+   */
+  template <size_t ROW, size_t COLUMN>
+  inline void AddMatrix(const libra::Matrix<ROW, COLUMN, double>& matrix, const int precision = 6) {
+    for (size_t i = 0; i < ROW; i++) {
+      for (size_t j = 0; j < COLUMN; j++) AddScalar(matrix[i][j], precision);
+    }
+  }
+  /**
+   * @fn AddQuaternion
+   * @brief Add quaternion value
+   * @param [in] quaternion: Quaternion
+   * @param [in] precision: Precision for the value when converted to CSV (number of digit)
+   */
+  inline void AddQuaternion(const libra::Quaternion& quaternion, const int precision = 6) {
+    for (size_t i = 0; i < 4; i++) AddScalar(quaternion[i], precision);
+  }
+  /**
+   * @fn AddText
+   * @brief Add pre-formatted CSV text
+   * @note The text is written to the CSV file as it is, so it must include the trailing comma
+   * @param [in] text: CSV text
+   */
+  inline void AddText(const char* text) {
+    columns_.push_back({LogColumnType::kText, 0});
+    if (number_of_texts_ < texts_.size()) {
+      texts_[number_of_texts_] = text;  // Reuse the allocated string
+    } else {
+      texts_.push_back(text);
+    }
+    number_of_texts_++;
+  }
+  /**
+   * @fn AddText
+   * @brief Add pre-formatted CSV text
+   * @param [in] text: CSV text
+   */
+  inline void AddText(const std::string& text) { AddText(text.c_str()); }
+
+  // Getter
+  /**
+   * @fn GetColumns
+   * @brief Return type information of the stored columns
+   */
+  inline const std::vector<LogColumn>& GetColumns() const { return columns_; }
+  /**
+   * @fn GetValues
+   * @brief Return the stored double values in the column order
+   */
+  inline const std::vector<double>& GetValues() const { return values_; }
+  /**
+   * @fn GetNumberOfTexts
+   * @brief Return the number of the stored texts
+   */
+  inline size_t GetNumberOfTexts() const { return number_of_texts_; }
+  /**
+   * @fn GetText
+   * @brief Return the stored text in the column order
+   * @param [in] index: Index of the text
+   */
+  inline const std::string& GetText(const size_t index) const { return texts_[index]; }
+  /**
+   * @fn GetCsvText
+   * @brief Return the stored values as CSV text
+   * @note The double values are formatted in the same way as WriteScalar with the precision of each column
+   */
+  inline std::string GetCsvText() const {
+    std::stringstream str_tmp;
+    size_t value_index = 0;
+    size_t text_index = 0;
+    for (const LogColumn& column : columns_) {
+      if (column.type == LogColumnType::kDouble) {
+        str_tmp << std::setprecision(column.precision) << values_[value_index++] << ",";
+      } else {
+        str_tmp << texts_[text_index++];
+      }
+    }
+    return str_tmp.str();
+  }
+
+ private:
+  std::vector<LogColumn> columns_;  //!< Column type information
+  std::vector<double> values_;      //!< Double values
+  std::vector<std::string> texts_;  //!< Text values (the size is kept to reuse the allocated memory)
+  size_t number_of_texts_ = 0;      //!< Number of valid texts
+};
+
+#endif  // S2E_LIBRARY_LOGGER_LOG_RECORD_HPP_
@@ -0,0 +1,74 @@
+/**
+ * @file log_sink.hpp
+ * @brief Interface class for log output destination
+ */
+
+#ifndef S2E_LIBRARY_LOGGER_LOG_SINK_HPP_
+#define S2E_LIBRARY_LOGGER_LOG_SINK_HPP_
+
+#include <string>
+
+#include "loggable.hpp"
+
+/**
+ * @enum LogFileFormat
+ * @brief Format of the log output file
+ */
+enum class LogFileFormat {
+  kCsv,     //!< CSV text file
+  kBinary,  //!< Binary columnar file
+};
+
+/**
+ * @class ILogSink
+ * @brief Interface class for log output destination
+ * @note The header and the values are written loggable by loggable, and closed by EndHeader and EndRecord.
+ */
+class ILogSink {
+ public:
+  /**
+   * @fn ~ILogSink
+   * @brief Destructor
+   */
+  virtual ~ILogSink() {}
+
+  /**
+   * @fn IsOpened
+   * @brief Return true when the output file is opened
+   */
+  virtual bool IsOpened() const = 0;
+
+  /**
+   * @fn WriteHeader
+   * @brief Write the header of a loggable
+   * @param [in] loggable: Target loggable
+   */
+  virtual void WriteHeader(const ILoggable& loggable) = 0;
+  /**
+   * @fn EndHeader
+   * @brief Finish the header
+   * @param [in] add_newline: Add newline or not
+   */
+  virtual void EndHeader(const bool add_newline) = 0;
+
+  /**
+   * @fn WriteValue
+   * @brief Write the values of a loggable
+   * @param [in] loggable: Target loggable
+   */
+  virtual void WriteValue(const ILoggable& loggable) = 0;
+  /**
+   * @fn EndRecord
+   * @brief Finish the values of the current log step
+   * @param [in] add_newline: Add newline or not
+   */
+  virtual void EndRecord(const bool add_newline) = 0;
+
+  /**
+   * @fn Flush
+   * @brief Flush the buffered data into the file
+   */
+  virtual void Flush() = 0;
+};
+
+#endif  // S2E_LIBRARY_LOGGER_LOG_SINK_HPP_
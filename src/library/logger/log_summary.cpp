@@ -0,0 +1,294 @@
+/**
+ * @file log_summary.cpp
+ * @brief Online reducers of log columns to summarize a simulation case
+ */
+
+#include "log_summary.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <sstream>
+
+LogSummary::LogSummary(const std::string time_column_name) : time_column_name_(time_column_name) {
+  // The time is always the first slot
+  slot_column_names_.push_back(time_column_name_);
+}
+
+void LogSummary::AddReducer(const std::string column_name, const LogSummaryReducerType type, const double threshold) {
+  Reducer reducer;
+  reducer.column_name = column_name;
+  reducer.type = type;
+  reducer.threshold = threshold;
+  reducer.slot = FindSlot(column_name);
+  reducer.crossing_time = std::numeric_limits<double>::quiet_NaN();
+  reducers_.push_back(reducer);
+}
+
+bool LogSummary::AddReducer(const std::string setting) {
+  std::vector<std::string> items;
+  std::stringstream stream(setting);
+  std::string item;
+  while (std::getline(stream, item, ',')) {
+    // Trim spaces around the item
+    const size_t first = item.find_first_not_of(" \t");
+    const size_t last = item.find_last_not_of(" \t\r");
+    items.push_back(first == std::string::npos ? "" : item.substr(first, last - first + 1));
+  }
+  if (items.size() < 2 || items[0].empty()) {
+    std::cerr << "Error: Invalid log summary setting: " << setting << std::endl;
+    return false;
+  }
+
+  LogSummaryReducerType type;
+  if (items[1] == "MIN") {
+    type = LogSummaryReducerType::kMin;
+  } else if (items[1] == "MAX") {
+    type = LogSummaryReducerType::kMax;
+  } else if (items[1] == "MEAN") {
+    type = LogSummaryReducerType::kMean;
+  } else if (items[1] == "RMS") {
+    type = LogSummaryReducerType::kRms;
+  } else if (items[1] == "FINAL") {
+    type = LogSummaryReducerType::kFinal;
+  } else if (items[1] == "THRESHOLD_CROSSING_TIME") {
+    type = LogSummaryReducerType::kThresholdCrossingTime;
+  } else {
+    std::cerr << "Error: Invalid log summary reducer: " << items[1] << std::endl;
+    return false;
+  }
+
+  double threshold = 0.0;
+  if (type == LogSummaryReducerType::kThresholdCrossingTime) {
+    char* end = nullptr;
+    if (items.size() >= 3) threshold = strtod(items[2].c_str(), &end);
+    if (items.size() < 3 || end == items[2].c_str() || *end != '\0') {
+      std::cerr << "Error: Threshold is required for THRESHOLD_CROSSING_TIME: " << setting << std::endl;
+      return false;
+    }
+  }
+
+  AddReducer(items[0], type, threshold);
+  return true;
+}
+
+void LogSummary::ReadHeader(const std::vector<ILoggable*>& log_list) {
+  loggable_list_.clear();
+  std::vector<bool> is_slot_found(slot_column_names_.size(), false);
+  // The time is evaluated only when it is used
+  bool is_time_used = false;
+  for (const Reducer& reducer : reducers_) {
+    if (reducer.type == LogSummaryReducerType::kThresholdCrossingTime || reducer.slot == 0) is_time_used = true;
+  }
+  is_slot_found[0] = !is_time_used;
+  for (const ILoggable* loggable : log_list) {
+    if (loggable == this) continue;
+
+    LoggableColumns loggable_columns;
+    loggable_columns.loggable = loggable;
+    std::stringstream stream(loggable->GetLogHeader());
+    std::string column_name;
+    for (size_t column_index = 0; std::getline(stream, column_name, ','); column_index++) {
+      for (size_t slot = 0; slot < slot_column_names_.size(); slot++) {
+        // The first column is used when the same name is found in several loggables
+        if (is_slot_found[slot] || slot_column_names_[slot] != column_name) continue;
+        loggable_columns.column_indices.push_back(column_index);
+        loggable_columns.slots.push_back(slot);
+        is_slot_found[slot] = true;
+      }
+    }
+    if (!loggable_columns.slots.empty()) loggable_list_.push_back(loggable_columns);
+  }
+
+  for (const Reducer& reducer : reducers_) {
+    if (!is_slot_found[reducer.slot]) {
+      std::cerr << "Warning: Log column for the summary is not found: " << reducer.column_name << std::endl;
+    } else if (reducer.type == LogSummaryReducerType::kThresholdCrossingTime && !is_slot_found[0]) {
+      std::cerr << "Warning: Log column of the time for the summary is not found: " << time_column_name_ << std::endl;
+    }
+  }
+
+  slot_values_.assign(slot_column_names_.size(), std::numeric_limits<double>::quiet_NaN());
+  previous_slot_values_ = slot_values_;
+  is_first_step_ = true;
+}
+
+void LogSummary::Update() {
+  if (reducers_.empty()) return;
+
+  for (const LoggableColumns& loggable_columns : loggable_list_) {
+    record_.Clear();
+    loggable_columns.loggable->AppendLogValue(record_);
+
+    // Expand the typed values and the CSV texts into the column values
+    column_values_.clear();
+    size_t value_index = 0;
+    size_t text_index = 0;
+    for (const LogColumn& column : record_.GetColumns()) {
+      if (column.type == LogColumnType::kDouble) {
+        column_values_.push_back(record_.GetValues()[value_index++]);
+        continue;
+      }
+      const char* text = record_.GetText(text_index++).c_str();
+      while (*text != '\0') {
+        char* end = nullptr;
+        const double value = strtod(text, &end);
+        const char* separator = text;
+        while (*separator != ',' && *separator != '\0') separator++;
+        // A field which is not a number is treated as NaN
+        column_values_.push_back((end == separator && end != text) ? value : std::numeric_limits<double>::quiet_NaN());
+        text = (*separator == ',') ? separator + 1 : separator;
+      }
+    }
+
+    for (size_t i = 0; i < loggable_columns.slots.size(); i++) {
+      const size_t column_index = loggable_columns.column_indices[i];
+      slot_values_[loggable_columns.slots[i]] =
+          column_index < column_values_.size() ? column_values_[column_index] : std::numeric_limits<double>::quiet_NaN();
+    }
+  }
+
+  const double time = slot_values_[0];
+  for (Reducer& reducer : reducers_) {
+    const double value = slot_values_[reducer.slot];
+    reducer.final = value;
+    if (!std::isfinite(value)) continue;
+
+    reducer.count++;
+    if (reducer.count == 1 || value < reducer.min) reducer.min = value;
+    if (reducer.count == 1 || value > reducer.max) reducer.max = value;
+    reducer.sum += value;
+    reducer.sum_of_squares += value * value;
+
+    const double previous_value = previous_slot_values_[reducer.slot];
+    if (reducer.type == LogSummaryReducerType::kThresholdCrossingTime && std::isnan(reducer.crossing_time) && !is_first_step_ &&
+        std::isfinite(previous_value) && ((previous_value < reducer.threshold) != (value < reducer.threshold))) {
+      reducer.crossing_time = time;
+    }
+  }
+  previous_slot_values_.swap(slot_values_);
+  is_first_step_ = false;
+}
+
+void LogSummary::SaveSnapshot(Snapshot& snapshot) const {
+  snapshot.Write(previous_slot_values_);
+  snapshot.Write(is_first_step_);
+  for (const Reducer& reducer : reducers_) {
+    snapshot.Write(reducer.count);
+    snapshot.Write(reducer.min);
+    snapshot.Write(reducer.max);
+    snapshot.Write(reducer.sum);
+    snapshot.Write(reducer.sum_of_squares);
+    snapshot.Write(reducer.final);
+    snapshot.Write(reducer.crossing_time);
+  }
+}
+
+void LogSummary::RestoreSnapshot(Snapshot& snapshot) {
+  snapshot.Read(previous_slot_values_);
+  snapshot.Read(is_first_step_);
+  for (Reducer& reducer : reducers_) {
+    snapshot.Read(reducer.count);
+    snapshot.Read(reducer.min);
+    snapshot.Read(reducer.max);
+    snapshot.Read(reducer.sum);
+    snapshot.Read(reducer.sum_of_squares);
+    snapshot.Read(reducer.final);
+    snapshot.Read(reducer.crossing_time);
+  }
+}
+
+std::string LogSummary::GetLogHeader() const {
+  std::string str_tmp = "";
+
+  for (const std::string& name : GetNames()) {
+    str_tmp += name + ",";
+  }
+
+  return str_tmp;
+}
+
+std::string LogSummary::GetLogValue() const {
+  std::string str_tmp = "";
+
+  char buffer[32];
+  for (const Reducer& reducer : reducers_) {
+    snprintf(buffer, sizeof(buffer), "%.10g,", GetReducedValue(reducer));
+    str_tmp += buffer;
+  }
+
+  return str_tmp;
+}
+
+void LogSummary::AppendLogValue(LogRecord& record) const {
+  for (const Reducer& reducer : reducers_) {
+    record.AddScalar(GetReducedValue(reducer), 10);
+  }
+}
+
+std::vector<std::string> LogSummary::GetNames() const {
+  std::vector<std::string> names;
+  for (const Reducer& reducer : reducers_) {
+    names.push_back(reducer.column_name + ":" + GetReducerName(reducer));
+  }
+  return names;
+}
+
+std::vector<double> LogSummary::GetValues() const {
+  std::vector<double> values;
+  for (const Reducer& reducer : reducers_) {
+    values.push_back(GetReducedValue(reducer));
+  }
+  return values;
+}
+
+size_t LogSummary::FindSlot(const std::string& column_name) {
+  for (size_t slot = 0; slot < slot_column_names_.size(); slot++) {
+    if (slot_column_names_[slot] == column_name) return slot;
+  }
+  slot_column_names_.push_back(column_name);
+  return slot_column_names_.size() - 1;
+}
+
+double LogSummary::GetReducedValue(const Reducer& reducer) {
+  if (reducer.type == LogSummaryReducerType::kFinal) return reducer.final;
+  if (reducer.type == LogSummaryReducerType::kThresholdCrossingTime) return reducer.crossing_time;
+  if (reducer.count == 0) return std::numeric_limits<double>::quiet_NaN();
+
+  switch (reducer.type) {
+    case LogSummaryReducerType::kMin:
+      return reducer.min;
+    case LogSummaryReducerType::kMax:
+      return reducer.max;
+    case LogSummaryReducerType::kMean:
+      return reducer.sum / (double)reducer.count;
+    case LogSummaryReducerType::kRms:
+      return sqrt(reducer.sum_of_squares / (double)reducer.count);
+    default:
+      return std::numeric_limits<double>::quiet_NaN();
+  }
+}
+
+std::string LogSummary::GetReducerName(const Reducer& reducer) {
+  switch (reducer.type) {
+    case LogSummaryReducerType::kMin:
+      return "min";
+    case LogSummaryReducerType::kMax:
+      return "max";
+    case LogSummaryReducerType::kMean:
+      return "mean";
+    case LogSummaryReducerType::kRms:
+      return "rms";
+    case LogSummaryReducerType::kFinal:
+      return "final";
+    case LogSummaryReducerType::kThresholdCrossingTime: {
+      char buffer[64];
+      snprintf(buffer, sizeof(buffer), "threshold_crossing_time(%g)[s]", reducer.threshold);
+      return buffer;
+    }
+    default:
+      return "";
+  }
+}
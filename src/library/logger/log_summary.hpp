@@ -0,0 +1,182 @@
+/**
+ * @file log_summary.hpp
+ * @brief Online reducers of log columns to summarize a simulation case
+ */
+
+#ifndef S2E_LIBRARY_LOGGER_LOG_SUMMARY_HPP_
+#define S2E_LIBRARY_LOGGER_LOG_SUMMARY_HPP_
+
+#include <library/utilities/snapshot.hpp>
+#include <string>
+#include <vector>
+
+#include "log_record.hpp"
+#include "loggable.hpp"
+
+/**
+ * @enum LogSummaryReducerType
+ * @brief Type of the reducer of a log column
+ */
+enum class LogSummaryReducerType {
+  kMin,                    //!< Minimum value
+  kMax,                    //!< Maximum value
+  kMean,                   //!< Mean value of the log steps
+  kRms,                    //!< Root mean square value of the log steps
+  kFinal,                  //!< Value at the last log step
+  kThresholdCrossingTime,  //!< Time of the first log step at which the value crosses the threshold
+};
+
+/**
+ * @class LogSummary
+ * @brief Online reducers of log columns to summarize a simulation case
+ * @details The reducers are registered with the column names in the log header, and updated incrementally every log step by the Logger.
+ *          Only the loggables which have the reduced columns are evaluated. The values are output as a loggable with one column per
+ *          reducer, so a simulation case can write them as one row of the Monte-Carlo result log instead of the full time series.
+ *          Non-finite values are skipped. The reducers of the columns not found in the header output NaN.
+ */
+class LogSummary : public ILoggable {
+ public:
+  /**
+   * @fn LogSummary
+   * @brief Constructor
+   * @param [in] time_column_name: Column name of the time used by the threshold crossing time
+   */
+  LogSummary(const std::string time_column_name = "elapsed_time[s]");
+  /**
+   * @fn ~LogSummary
+   * @brief Destructor
+   */
+  virtual ~LogSummary() {}
+
+  /**
+   * @fn AddReducer
+   * @brief Add a reducer of a log column
+   * @param [in] column_name: Column name in the log header (e.g. spacecraft_angular_velocity_b_x[rad/s])
+   * @param [in] type: Type of the reducer
+   * @param [in] threshold: Threshold for kThresholdCrossingTime
+   */
+  void AddReducer(const std::string column_name, const LogSummaryReducerType type, const double threshold = 0.0);
+  /**
+   * @fn AddReducer
+   * @brief Add a reducer of a log column from a setting text
+   * @param [in] setting: <column name>,<MIN, MAX, MEAN, RMS, FINAL, or THRESHOLD_CROSSING_TIME>[,<threshold>]
+   * @return False when the setting is invalid
+   */
+  bool AddReducer(const std::string setting);
+
+  /**
+   * @fn ReadHeader
+   * @brief Find the reduced columns in the headers of the loggables
+   * @param [in] log_list: Enabled loggables in the order of the log output
+   */
+  void ReadHeader(const std::vector<ILoggable*>& log_list);
+  /**
+   * @fn Update
+   * @brief Update the reducers with the values of the current log step
+   */
+  void Update();
+
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the states of the reducers into the snapshot
+   */
+  void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the states of the reducers from the snapshot
+   * @note The reducers and the columns must be same as the saved summary
+   */
+  void RestoreSnapshot(Snapshot& snapshot);
+
+  // Override ILoggable
+  /**
+   * @fn GetLogHeader
+   * @brief Override GetLogHeader function of ILoggable
+   */
+  virtual std::string GetLogHeader() const;
+  /**
+   * @fn GetLogValue
+   * @brief Override GetLogValue function of ILoggable
+   */
+  virtual std::string GetLogValue() const;
+  /**
+   * @fn AppendLogValue
+   * @brief Override AppendLogValue function of ILoggable
+   */
+  virtual void AppendLogValue(LogRecord& record) const;
+
+  // Getter
+  /**
+   * @fn GetNumberOfReducers
+   * @brief Return number of the reducers
+   */
+  inline size_t GetNumberOfReducers() const { return reducers_.size(); }
+  /**
+   * @fn GetNames
+   * @brief Return names of the reduced values: <column name>:<reducer>
+   */
+  std::vector<std::string> GetNames() const;
+  /**
+   * @fn GetValues
+   * @brief Return the reduced values
+   */
+  std::vector<double> GetValues() const;
+
+ private:
+  /**
+   * @struct Reducer
+   * @brief Setting and state of a reducer
+   */
+  struct Reducer {
+    std::string column_name;     //!< Column name in the log header
+    LogSummaryReducerType type;  //!< Type of the reducer
+    double threshold;            //!< Threshold for kThresholdCrossingTime
+    size_t slot;                 //!< Index of the column value in slot_values_
+
+    unsigned long long count = 0;  //!< Number of the finite values
+    double min = 0.0;              //!< Minimum value
+    double max = 0.0;              //!< Maximum value
+    double sum = 0.0;              //!< Sum of the values
+    double sum_of_squares = 0.0;   //!< Sum of the squared values
+    double final = 0.0;            //!< Last value
+    double crossing_time = 0.0;    //!< Time of the first threshold crossing (NaN: not crossed)
+  };
+
+  /**
+   * @struct LoggableColumns
+   * @brief Reduced columns of a loggable
+   */
+  struct LoggableColumns {
+    const ILoggable* loggable;           //!< Loggable
+    std::vector<size_t> column_indices;  //!< Column indices in the loggable
+    std::vector<size_t> slots;           //!< Indices in slot_values_
+  };
+
+  std::string time_column_name_;                //!< Column name of the time
+  std::vector<Reducer> reducers_;               //!< Reducers
+  std::vector<std::string> slot_column_names_;  //!< Column names of the slots (the time is the first slot)
+  std::vector<LoggableColumns> loggable_list_;  //!< Loggables which have the reduced columns
+  std::vector<double> slot_values_;             //!< Values of the reduced columns at the current log step
+  std::vector<double> previous_slot_values_;    //!< Values of the reduced columns at the previous log step
+  bool is_first_step_ = true;                   //!< Is the current log step the first one?
+  LogRecord record_;                            //!< Reused record of a loggable
+  std::vector<double> column_values_;           //!< Reused values of all columns of a loggable
+
+  /**
+   * @fn FindSlot
+   * @brief Return the slot index of a column name, and add a slot if not found
+   */
+  size_t FindSlot(const std::string& column_name);
+  /**
+   * @fn GetReducedValue
+   * @brief Return the reduced value of a reducer
+   */
+  static double GetReducedValue(const Reducer& reducer);
+  /**
+   * @fn GetReducerName
+   * @brief Return the name of a reducer type
+   */
+  static std::string GetReducerName(const Reducer& reducer);
+};
+
+#endif  // S2E_LIBRARY_LOGGER_LOG_SUMMARY_HPP_
@@ -8,6 +8,7 @@
 
 #include <string>
 
+#include "log_record.hpp"
 #include "log_utility.hpp"  // This is not necessary but include here for convenience
 
 /**
@@ -31,7 +32,28 @@ class ILoggable {
    */
   virtual std::string GetLogValue() const = 0;
 
+  /**
+   * @fn AppendLogValue
+   * @brief Append values to the typed log record for binary log output
+   * @note The default implementation stores the CSV text of GetLogValue. Override this to store raw values without string formatting.
+   * @param [out] record: Log record
+   */
+  virtual void AppendLogValue(LogRecord& record) const { record.AddText(GetLogValue()); }
+
   bool is_log_enabled_ = true;  //!< Log enable flag
+
+ protected:
+  /**
+   * @fn FormatLogValue
+   * @brief Format the values appended by AppendLogValue as CSV text
+   * @note Use this in GetLogValue of the loggable which overrides AppendLogValue, so that the CSV and binary outputs share one column list
+   * @return The output values
+   */
+  std::string FormatLogValue() const {
+    LogRecord record;
+    AppendLogValue(record);
+    return record.GetCsvText();
+  }
 };
 
 #endif  // S2E_LIBRARY_LOGGER_LOGGABLE_HPP_
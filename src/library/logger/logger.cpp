@@ -5,7 +5,11 @@
 
 #include "logger.hpp"
 
+#include <cerrno>
 #include <ctime>
+#include <fstream>
+#include <iostream>
+#include <mutex>
 #include <sstream>
 #ifdef _WIN32
 #include <direct.h>
@@ -13,35 +17,48 @@
 #include <sys/stat.h>
 #endif
 
-std::vector<ILoggable *> log_list_;
+#include "binary_log_sink.hpp"
+#include "csv_log_sink.hpp"
+
 bool Logger::is_directory_created_ = false;
+static std::mutex directory_mutex;  //!< Mutex to create the log directory from the simulation cases executed in parallel
 
 Logger::Logger(const std::string &file_name, const std::string &data_path, const std::string &ini_file_name, const bool is_ini_save_enabled,
-               const bool is_enabled)
+               const bool is_enabled, const LogFileFormat log_file_format, const LogWriterSetting &log_writer_setting)
     : is_enabled_(is_enabled), is_ini_save_enabled_(is_ini_save_enabled) {
-  is_file_opened_ = false;
   if (is_enabled_ == false) return;
 
-  // Get current time to append it to the filename
-  time_t timer = time(NULL);
-  struct tm *now;
-  now = localtime(&timer);
   char start_time_c[64];
-  strftime(start_time_c, 64, "%y%m%d_%H%M%S", now);
-
-  // Create directory
-  if (is_ini_save_enabled_ == true || is_directory_created_ == false) {
-    directory_path_ = CreateDirectory(data_path, start_time_c);
-  } else {
-    directory_path_ = data_path;
+  {
+    std::lock_guard<std::mutex> lock(directory_mutex);
+    // Get current time to append it to the filename
+    time_t timer = time(NULL);
+    struct tm *now;
+    now = localtime(&timer);
+    strftime(start_time_c, 64, "%y%m%d_%H%M%S", now);
+
+    // Create directory
+    if (is_ini_save_enabled_ == true || is_directory_created_ == false) {
+      directory_path_ = CreateDirectory(data_path, start_time_c);
+    } else {
+      directory_path_ = data_path;
+    }
   }
   // Create File
   std::stringstream file_path;
-  file_path << directory_path_ << start_time_c << "_" << file_name;
-  if (is_enabled_) {
-    csv_file_.open(file_path.str());
-    is_file_opened_ = csv_file_.is_open();
-    if (!is_file_opened_) std::cerr << "Error opening log file: " << file_path.str() << std::endl;
+  file_path << directory_path_ << start_time_c << "_";
+  if (log_file_format == LogFileFormat::kBinary) {
+    // Replace the extension of the CSV file name
+    const size_t extension_position = file_name.rfind(".csv");
+    if (extension_position != std::string::npos && extension_position + 4 == file_name.size()) {
+      file_path << file_name.substr(0, extension_position) << ".bin";
+    } else {
+      file_path << file_name;
+    }
+    log_sink_ = new BinaryLogSink(file_path.str(), log_writer_setting);
+  } else {
+    file_path << file_name;
+    log_sink_ = new CsvLogSink(file_path.str(), log_writer_setting);
   }
 
   // Copy SimBase.ini
@@ -49,33 +66,44 @@ Logger::Logger(const std::string &file_name, const std::string &data_path, const
 }
 
 Logger::~Logger(void) {
-  if (is_file_opened_) {
-    csv_file_.close();
-  }
+  delete log_sink_;
+  delete log_summary_;
 }
 
 void Logger::WriteHeaders(const bool add_newline) {
+  if (log_summary_ != nullptr) {
+    std::vector<ILoggable *> enabled_log_list;
+    for (ILoggable *loggable : log_list_) {
+      if (loggable->is_log_enabled_) enabled_log_list.push_back(loggable);
+    }
+    log_summary_->ReadHeader(enabled_log_list);
+  }
+  if (!is_enabled_ || log_sink_ == nullptr) return;
   for (auto itr = log_list_.begin(); itr != log_list_.end(); ++itr) {
     if (!((*itr)->is_log_enabled_)) continue;
-    Write((*itr)->GetLogHeader());
+    log_sink_->WriteHeader(**itr);
   }
-  if (add_newline) WriteNewLine();
+  log_sink_->EndHeader(add_newline);
 }
 
 void Logger::WriteValues(const bool add_newline) {
+  if (log_summary_ != nullptr) log_summary_->Update();
+  if (!is_enabled_ || log_sink_ == nullptr) return;
   for (auto itr = log_list_.begin(); itr != log_list_.end(); ++itr) {
     if (!((*itr)->is_log_enabled_)) continue;
-    Write((*itr)->GetLogValue());
+    log_sink_->WriteValue(**itr);
   }
-  if (add_newline) WriteNewLine();
+  log_sink_->EndRecord(add_newline);
 }
 
-void Logger::WriteNewLine() { Write("\n"); }
+void Logger::Flush() {
+  if (log_sink_ == nullptr) return;
+  log_sink_->Flush();
+}
 
-void Logger::Write(const std::string log, const bool flag) {
-  if (flag && is_enabled_) {
-    csv_file_ << log;
-  }
+void Logger::SetLogSummary(LogSummary *log_summary) {
+  delete log_summary_;
+  log_summary_ = log_summary;
 }
 
 void Logger::AddLogList(ILoggable *loggable) { log_list_.push_back(loggable); }
@@ -91,7 +119,8 @@ std::string Logger::CreateDirectory(const std::string &data_path, const std::str
 #else
   rtn_mkdir = mkdir(directory_path_tmp_.c_str(), 0777);
 #endif
-  if (rtn_mkdir == 0) {
+  // The directory is already created by another simulation case started at the same time
+  if (rtn_mkdir == 0 || errno == EEXIST) {
   } else {
     std::cerr << "Error making directory: " << directory_path_tmp_ << std::endl;
     return data_path;
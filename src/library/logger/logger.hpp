@@ -8,10 +8,12 @@
 
 #define _CRT_SECURE_NO_WARNINGS
 
-#include <fstream>
 #include <string>
 #include <vector>
 
+#include "log_file_writer.hpp"
+#include "log_sink.hpp"
+#include "log_summary.hpp"
 #include "loggable.hpp"
 
 /**
@@ -28,12 +30,15 @@ class Logger {
    * @param [in] ini_file_name: Initialize file name
    * @param [in] is_ini_save_enabled: Enable flag to save ini files
    * @param [in] is_enabled: Enable flag for logging
+   * @param [in] log_file_format: Format of the log output file
+   * @param [in] log_writer_setting: Setting of the log file writer
    */
   Logger(const std::string &file_name, const std::string &data_path, const std::string &ini_file_name, const bool is_ini_save_enabled,
-         const bool is_enabled = true);
+         const bool is_enabled = true, const LogFileFormat log_file_format = LogFileFormat::kCsv,
+         const LogWriterSetting &log_writer_setting = LogWriterSetting());
   /**
    * @fn ~Logger
-   * @brief Destructor
+   * @brief Destructor: all buffered logs are written into the file
    */
   ~Logger(void);
 
@@ -61,6 +66,18 @@ class Logger {
    * @param add_newline: Add newline or not
    */
   void WriteValues(const bool add_newline = true);
+  /**
+   * @fn Flush
+   * @brief Write all buffered logs into the file and wait for the completion
+   */
+  void Flush();
+
+  /**
+   * @fn SetLogSummary
+   * @brief Set the summary of the log columns. The summary is updated every WriteValues even when the log output is disabled.
+   * @param [in] log_summary: Log summary (the ownership is moved to the logger, nullptr: no summary)
+   */
+  void SetLogSummary(LogSummary *log_summary);
 
   /**
    * @fn Enabled
@@ -85,31 +102,27 @@ class Logger {
    * @brief Return the path to the directory for log files
    */
   inline std::string GetLogPath() const { return directory_path_; }
+  /**
+   * @fn GetLogSummary
+   * @brief Return the summary of the log columns (nullptr: no summary)
+   */
+  inline const LogSummary *GetLogSummary() const { return log_summary_; }
+  /**
+   * @fn GetLogSummary
+   * @brief Return the summary of the log columns (nullptr: no summary)
+   */
+  inline LogSummary *GetLogSummary() { return log_summary_; }
 
  private:
-  std::ofstream csv_file_;             //!< CSV file stream
+  ILogSink *log_sink_ = nullptr;       //!< Log output destination
+  LogSummary *log_summary_ = nullptr;  //!< Summary of the log columns
   bool is_enabled_;                    //!< Enable flag for logging
-  bool is_file_opened_;                //!< Is the CSV file opened?
   static bool is_directory_created_;   //!< Is the log output directory is created in the scenario
   std::vector<ILoggable *> log_list_;  //!< Log list
 
   bool is_ini_save_enabled_;    //!< Enable flag to save ini files
   std::string directory_path_;  //!< Path to the directory for log files
 
-  /**
-   * @fn Write
-   * @brief Write string to the log
-   * @param [in] log: Write target
-   * @param [in] flag: Enable flag to write
-   */
-  void Write(const std::string log, const bool flag = true);
-
-  /**
-   * @fn WriteNewline
-   * @brief Write newline
-   */
-  void WriteNewLine();
-
   /**
    * @fn CreateDirectory
    * @brief Create a directory to store the log files
@@ -0,0 +1,125 @@
+/**
+ * @file test_binary_log_sink.cpp
+ * @brief Test codes for BinaryLogSink class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#include "binary_log_sink.hpp"
+
+/**
+ * @class TypedLoggable
+ * @brief Loggable which stores raw values into the binary log
+ */
+class TypedLoggable : public ILoggable {
+ public:
+  std::string GetLogHeader() const { return WriteScalar("time", "s") + WriteVector("position", "i", "m", 3); }
+  std::string GetLogValue() const { return WriteScalar(time_s_) + WriteVector(position_i_m_, 10); }
+  void AppendLogValue(LogRecord& record) const {
+    record.AddScalar(time_s_);
+    record.AddVector(position_i_m_, 10);
+  }
+
+  double time_s_ = 0.0;
+  libra::Vector<3> position_i_m_{0.0};
+};
+
+/**
+ * @class TextLoggable
+ * @brief Loggable which uses the default text fallback
+ */
+class TextLoggable : public ILoggable {
+ public:
+  std::string GetLogHeader() const { return WriteScalar("mode", ""); }
+  std::string GetLogValue() const { return "MODE" + std::to_string(mode_) + ","; }
+
+  int mode_ = 0;
+};
+
+/**
+ * @brief Read all bytes of a file
+ */
+static std::vector<char> ReadAllBytes(const std::string& file_path) {
+  std::ifstream file(file_path, std::ios::in | std::ios::binary);
+  return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+/**
+ * @brief Read a value from the byte array and advance the position
+ */
+template <typename T>
+static T ReadValue(const std::vector<char>& bytes, size_t& position) {
+  T value;
+  memcpy(&value, &bytes[position], sizeof(T));
+  position += sizeof(T);
+  return value;
+}
+
+/**
+ * @brief Test for header and record layout
+ */
+TEST(BinaryLogSink, Layout) {
+  const std::string file_path = "test_binary_log_sink.bin";
+  TypedLoggable typed;
+  TextLoggable text;
+  {
+    BinaryLogSink sink(file_path);
+    ASSERT_TRUE(sink.IsOpened());
+    sink.WriteHeader(typed);
+    sink.WriteHeader(text);
+    sink.EndHeader(true);
+    for (int step = 0; step < 3; step++) {
+      typed.time_s_ = 0.1 * step;
+      typed.position_i_m_[0] = 7.0e6 + step;
+      text.mode_ = step;
+      sink.WriteValue(typed);
+      sink.WriteValue(text);
+      sink.EndRecord(true);
+    }
+  }
+
+  const std::vector<char> bytes = ReadAllBytes(file_path);
+  std::remove(file_path.c_str());
+  size_t position = 0;
+
+  // Header
+  ASSERT_GE(bytes.size(), sizeof(BinaryLogSink::kMagic));
+  EXPECT_EQ(0, memcmp(&bytes[0], BinaryLogSink::kMagic, sizeof(BinaryLogSink::kMagic)));
+  position += sizeof(BinaryLogSink::kMagic);
+  EXPECT_EQ(BinaryLogSink::kVersion, ReadValue<uint32_t>(bytes, position));
+  EXPECT_EQ(2u, ReadValue<uint32_t>(bytes, position));
+
+  const uint32_t typed_header_length = ReadValue<uint32_t>(bytes, position);
+  EXPECT_EQ(typed.GetLogHeader(), std::string(&bytes[position], typed_header_length));
+  position += typed_header_length;
+  EXPECT_EQ(4u, ReadValue<uint32_t>(bytes, position));
+  EXPECT_EQ(static_cast<uint8_t>(LogColumnType::kDouble), ReadValue<uint8_t>(bytes, position));
+  EXPECT_EQ(6, ReadValue<uint8_t>(bytes, position));
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_EQ(static_cast<uint8_t>(LogColumnType::kDouble), ReadValue<uint8_t>(bytes, position));
+    EXPECT_EQ(10, ReadValue<uint8_t>(bytes, position));
+  }
+
+  const uint32_t text_header_length = ReadValue<uint32_t>(bytes, position);
+  EXPECT_EQ(text.GetLogHeader(), std::string(&bytes[position], text_header_length));
+  position += text_header_length;
+  EXPECT_EQ(1u, ReadValue<uint32_t>(bytes, position));
+  EXPECT_EQ(static_cast<uint8_t>(LogColumnType::kText), ReadValue<uint8_t>(bytes, position));
+  EXPECT_EQ(0, ReadValue<uint8_t>(bytes, position));
+
+  // Records
+  for (int step = 0; step < 3; step++) {
+    EXPECT_DOUBLE_EQ(0.1 * step, ReadValue<double>(bytes, position));
+    EXPECT_DOUBLE_EQ(7.0e6 + step, ReadValue<double>(bytes, position));
+    EXPECT_DOUBLE_EQ(0.0, ReadValue<double>(bytes, position));
+    EXPECT_DOUBLE_EQ(0.0, ReadValue<double>(bytes, position));
+    const uint32_t text_length = ReadValue<uint32_t>(bytes, position);
+    EXPECT_EQ("MODE" + std::to_string(step) + ",", std::string(&bytes[position], text_length));
+    position += text_length;
+  }
+  EXPECT_EQ(bytes.size(), position);
+}
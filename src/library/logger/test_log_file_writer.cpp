@@ -0,0 +1,128 @@
+/**
+ * @file test_log_file_writer.cpp
+ * @brief Test codes for LogFileWriter class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+
+#include "log_file_writer.hpp"
+
+/**
+ * @brief Read all text of a file
+ */
+static std::string ReadAllText(const std::string& file_path) {
+  std::ifstream file(file_path, std::ios::in | std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+/**
+ * @brief Write records with the setting and return the expected file content
+ */
+static std::string WriteRecords(const std::string& file_path, const LogWriterSetting& setting, const size_t number_of_records) {
+  std::string expected = "";
+  LogFileWriter writer(file_path, setting, true);
+  for (size_t i = 0; i < number_of_records; i++) {
+    const std::string record = std::to_string(i) + "," + std::to_string(i * i) + ",\n";
+    writer.Write(record);
+    writer.EndRecord();
+    expected += record;
+  }
+  return expected;
+}
+
+/**
+ * @brief Test for synchronous writing
+ */
+TEST(LogFileWriter, Synchronous) {
+  const std::string file_path = "test_log_file_writer_sync.csv";
+  LogWriterSetting setting;
+  setting.buffer_size_byte = 64;
+
+  const std::string expected = WriteRecords(file_path, setting, 1000);
+  EXPECT_EQ(expected, ReadAllText(file_path));
+  std::remove(file_path.c_str());
+}
+
+/**
+ * @brief Test for asynchronous writing with the blocking policy
+ */
+TEST(LogFileWriter, AsynchronousBlock) {
+  const std::string file_path = "test_log_file_writer_block.csv";
+  LogWriterSetting setting;
+  setting.is_asynchronous = true;
+  setting.buffer_full_policy = LogBufferFullPolicy::kBlock;
+  setting.number_of_buffers = 2;
+  setting.buffer_size_byte = 64;
+
+  const std::string expected = WriteRecords(file_path, setting, 10000);
+  EXPECT_EQ(expected, ReadAllText(file_path));
+  std::remove(file_path.c_str());
+}
+
+/**
+ * @brief Test for flush in the middle of asynchronous writing
+ */
+TEST(LogFileWriter, AsynchronousFlush) {
+  const std::string file_path = "test_log_file_writer_flush.csv";
+  LogWriterSetting setting;
+  setting.is_asynchronous = true;
+  setting.buffer_size_byte = 1024;
+
+  LogFileWriter writer(file_path, setting, true);
+  writer.Write("header,\n");
+  writer.EndRecord();
+  writer.Flush();
+  EXPECT_EQ("header,\n", ReadAllText(file_path));
+
+  writer.Write("value,\n");
+  writer.EndRecord();
+  writer.Flush();
+  EXPECT_EQ("header,\nvalue,\n", ReadAllText(file_path));
+  std::remove(file_path.c_str());
+}
+
+/**
+ * @brief Test for asynchronous writing with the drop policy
+ * @note Whole records are dropped, so the written file consists of complete lines
+ */
+TEST(LogFileWriter, AsynchronousDrop) {
+  const std::string file_path = "test_log_file_writer_drop.csv";
+  LogWriterSetting setting;
+  setting.is_asynchronous = true;
+  setting.buffer_full_policy = LogBufferFullPolicy::kDrop;
+  setting.number_of_buffers = 2;
+  setting.buffer_size_byte = 16;
+
+  const size_t number_of_records = 10000;
+  size_t number_of_dropped_records = 0;
+  {
+    LogFileWriter writer(file_path, setting, true);
+    for (size_t i = 0; i < number_of_records; i++) {
+      writer.Write(std::to_string(i) + ",\n");
+      writer.EndRecord();
+    }
+    writer.Flush();
+    number_of_dropped_records = writer.GetNumberOfDroppedRecords();
+  }
+
+  const std::string text = ReadAllText(file_path);
+  std::remove(file_path.c_str());
+  size_t number_of_lines = 0;
+  long previous = -1;
+  size_t line_start = 0;
+  for (size_t i = 0; i < text.size(); i++) {
+    if (text[i] != '\n') continue;
+    const std::string line = text.substr(line_start, i - line_start);
+    ASSERT_EQ(',', line.back());
+    const long value = std::stol(line.substr(0, line.size() - 1));
+    EXPECT_LT(previous, value);
+    previous = value;
+    number_of_lines++;
+    line_start = i + 1;
+  }
+  EXPECT_EQ(text.size(), line_start);
+  EXPECT_EQ(number_of_records, number_of_lines + number_of_dropped_records);
+}
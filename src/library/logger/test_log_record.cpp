@@ -0,0 +1,71 @@
+/**
+ * @file test_log_record.cpp
+ * @brief Test codes for LogRecord class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include "loggable.hpp"
+
+/**
+ * @class RecordLoggable
+ * @brief Loggable which formats the CSV values from the log record
+ */
+class RecordLoggable : public ILoggable {
+ public:
+  std::string GetLogHeader() const {
+    return WriteScalar("time", "s") + WriteVector("position", "i", "m", 3) + WriteQuaternion("quaternion", "i2b") + WriteScalar("date", "");
+  }
+  std::string GetLogValue() const { return FormatLogValue(); }
+  void AppendLogValue(LogRecord& record) const {
+    record.AddScalar(time_s_);
+    record.AddVector(position_i_m_, 16);
+    record.AddQuaternion(quaternion_i2b_);
+    record.AddText("2024/01/01 00:00:00.000,");
+  }
+
+  double time_s_ = 12.3456789;
+  libra::Vector<3> position_i_m_{6378137.123456789};
+  libra::Quaternion quaternion_i2b_{0.1, -0.2, 0.3, 0.9273618495495704};
+};
+
+/**
+ * @brief Test for the CSV text compared with the log utility functions
+ */
+TEST(LogRecord, CsvText) {
+  libra::Matrix<2, 2> matrix;
+  matrix[0][0] = 1.0 / 3.0;
+  matrix[0][1] = -2.0e-8;
+  matrix[1][0] = 1.0e12;
+  matrix[1][1] = 0.0;
+
+  LogRecord record;
+  record.AddScalar(M_PI);
+  record.AddScalar(-1.0e-5 / 3.0, 12);
+  record.AddMatrix(matrix, 3);
+  record.AddText("MODE1,");
+  record.AddScalar(42.0);
+  const std::string expected = WriteScalar(M_PI) + WriteScalar(-1.0e-5 / 3.0, 12) + WriteMatrix(matrix, 3) + "MODE1," + WriteScalar(42.0);
+  EXPECT_EQ(expected, record.GetCsvText());
+
+  // The texts are reused after clearing
+  record.Clear();
+  record.AddText("MODE2,");
+  EXPECT_EQ("MODE2,", record.GetCsvText());
+}
+
+/**
+ * @brief Test for the CSV values and the binary log values made from the same column list
+ */
+TEST(LogRecord, FormatLogValue) {
+  RecordLoggable loggable;
+  const std::string expected = WriteScalar(loggable.time_s_) + WriteVector(loggable.position_i_m_, 16) +
+                               WriteQuaternion(loggable.quaternion_i2b_) + "2024/01/01 00:00:00.000,";
+  EXPECT_EQ(expected, loggable.GetLogValue());
+
+  // The number of the CSV columns is the same as the header
+  const std::string header = loggable.GetLogHeader();
+  const std::string value = loggable.GetLogValue();
+  EXPECT_EQ(std::count(header.begin(), header.end(), ','), std::count(value.begin(), value.end(), ','));
+}
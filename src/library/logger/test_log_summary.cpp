@@ -0,0 +1,85 @@
+/**
+ * @file test_log_summary.cpp
+ * @brief Test codes for LogSummary class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "log_summary.hpp"
+
+/**
+ * @class SummaryTypedLoggable
+ * @brief Loggable which stores raw values
+ */
+class SummaryTypedLoggable : public ILoggable {
+ public:
+  std::string GetLogHeader() const { return WriteScalar("elapsed_time", "s") + WriteVector("velocity", "b", "m/s", 3); }
+  std::string GetLogValue() const { return WriteScalar(time_s_) + WriteVector(velocity_b_m_s_); }
+  void AppendLogValue(LogRecord& record) const {
+    record.AddScalar(time_s_);
+    record.AddVector(velocity_b_m_s_);
+  }
+
+  double time_s_ = 0.0;
+  libra::Vector<3> velocity_b_m_s_{0.0};
+};
+
+/**
+ * @class SummaryTextLoggable
+ * @brief Loggable which uses the default text fallback
+ */
+class SummaryTextLoggable : public ILoggable {
+ public:
+  std::string GetLogHeader() const { return WriteScalar("mode", "") + WriteScalar("error", "m"); }
+  std::string GetLogValue() const { return "MODE," + WriteScalar(error_m_); }
+
+  double error_m_ = 0.0;
+};
+
+/**
+ * @brief Test for the reducers of the typed and text values
+ */
+TEST(LogSummary, Reducers) {
+  SummaryTypedLoggable time;
+  SummaryTextLoggable text;
+  LogSummary summary;
+  summary.AddReducer("velocity_b_y[m/s]", LogSummaryReducerType::kMin);
+  summary.AddReducer("velocity_b_y[m/s]", LogSummaryReducerType::kMax);
+  summary.AddReducer("velocity_b_y[m/s]", LogSummaryReducerType::kMean);
+  EXPECT_TRUE(summary.AddReducer("error[m], RMS"));
+  EXPECT_TRUE(summary.AddReducer("error[m],FINAL"));
+  EXPECT_TRUE(summary.AddReducer("velocity_b_y[m/s],THRESHOLD_CROSSING_TIME,2.5"));
+  EXPECT_TRUE(summary.AddReducer("mode[],MAX"));
+  EXPECT_TRUE(summary.AddReducer("unknown[m],MAX"));
+  EXPECT_FALSE(summary.AddReducer("error[m],MEDIAN"));
+  EXPECT_FALSE(summary.AddReducer("error[m],THRESHOLD_CROSSING_TIME"));
+  ASSERT_EQ(8u, summary.GetNumberOfReducers());
+
+  summary.ReadHeader({&time, &text, &summary});
+  const double velocity[5] = {1.0, 2.0, 3.0, -1.0, 4.0};
+  for (int step = 0; step < 5; step++) {
+    time.time_s_ = 10.0 * step;
+    time.velocity_b_m_s_[1] = velocity[step];
+    text.error_m_ = (step == 2) ? NAN : 1.0 + step;
+    summary.Update();
+  }
+
+  const std::vector<std::string> names = summary.GetNames();
+  const std::vector<double> values = summary.GetValues();
+  ASSERT_EQ(8u, names.size());
+  EXPECT_EQ("velocity_b_y[m/s]:min", names[0]);
+  EXPECT_EQ("velocity_b_y[m/s]:threshold_crossing_time(2.5)[s]", names[5]);
+  EXPECT_DOUBLE_EQ(-1.0, values[0]);
+  EXPECT_DOUBLE_EQ(4.0, values[1]);
+  EXPECT_DOUBLE_EQ(1.8, values[2]);
+  // The NaN of the step 2 is skipped
+  EXPECT_DOUBLE_EQ(sqrt((1.0 + 4.0 + 16.0 + 25.0) / 4.0), values[3]);
+  EXPECT_DOUBLE_EQ(5.0, values[4]);
+  EXPECT_DOUBLE_EQ(20.0, values[5]);
+  // A field which is not a number is NaN
+  EXPECT_TRUE(std::isnan(values[6]));
+  EXPECT_TRUE(std::isnan(values[7]));
+
+  EXPECT_EQ(std::string("velocity_b_y[m/s]:min,velocity_b_y[m/s]:max,"), summary.GetLogHeader().substr(0, 44));
+}
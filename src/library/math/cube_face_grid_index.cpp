@@ -0,0 +1,129 @@
+/**
+ * @file cube_face_grid_index.cpp
+ * @brief Spatial index of directions on the unit sphere with the cube-face grid
+ */
+
+#include "cube_face_grid_index.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include "constants.hpp"
+
+namespace libra {
+
+CubeFaceGridIndex::CubeFaceGridIndex(const std::vector<Vector<3>>& directions, const size_t grid_size)
+    : grid_size_(std::max(grid_size, (size_t)1)), directions_(directions) {
+  InitializeCellGeometry();
+
+  // Sort the directions by cell (counting sort keeps the ascending order in each cell)
+  const size_t number_of_cells = 6 * grid_size_ * grid_size_;
+  std::vector<size_t> cell_of_directions(directions_.size());
+  cell_offsets_.assign(number_of_cells + 1, 0);
+  for (size_t n = 0; n < directions_.size(); n++) {
+    cell_of_directions[n] = CalcCellIndex(directions_[n]);
+    cell_offsets_[cell_of_directions[n] + 1]++;
+  }
+  for (size_t cell = 0; cell < number_of_cells; cell++) {
+    cell_offsets_[cell + 1] += cell_offsets_[cell];
+  }
+  cell_items_.resize(directions_.size());
+  std::vector<size_t> positions(cell_offsets_.begin(), cell_offsets_.end() - 1);
+  for (size_t n = 0; n < directions_.size(); n++) {
+    cell_items_[positions[cell_of_directions[n]]++] = n;
+  }
+}
+
+CubeFaceGridIndex::CubeFaceGridIndex(std::vector<Vector<3>> directions, const size_t grid_size, std::vector<size_t> cell_offsets,
+                                     std::vector<size_t> cell_items)
+    : grid_size_(std::max(grid_size, (size_t)1)),
+      directions_(std::move(directions)),
+      cell_offsets_(std::move(cell_offsets)),
+      cell_items_(std::move(cell_items)) {
+  InitializeCellGeometry();
+}
+
+void CubeFaceGridIndex::InitializeCellGeometry() {
+  const size_t number_of_cells = 6 * grid_size_ * grid_size_;
+  cell_centers_.resize(number_of_cells);
+  cell_radius_rad_.resize(number_of_cells);
+  cell_cos_radius_.resize(number_of_cells);
+  cell_sin_radius_.resize(number_of_cells);
+  for (size_t face = 0; face < 6; face++) {
+    for (size_t i = 0; i < grid_size_; i++) {
+      for (size_t j = 0; j < grid_size_; j++) {
+        const size_t cell = (face * grid_size_ + i) * grid_size_ + j;
+        cell_centers_[cell] = CalcFaceDirection(face, (double)i + 0.5, (double)j + 0.5);
+
+        double min_cos = 1.0;
+        for (size_t corner = 0; corner < 4; corner++) {
+          const Vector<3> corner_direction = CalcFaceDirection(face, (double)(i + corner / 2), (double)(j + corner % 2));
+          min_cos = std::min(min_cos, InnerProduct(cell_centers_[cell], corner_direction));
+        }
+        cell_radius_rad_[cell] = acos(std::max(-1.0, min_cos));
+        cell_cos_radius_[cell] = cos(cell_radius_rad_[cell]);
+        cell_sin_radius_[cell] = sin(cell_radius_rad_[cell]);
+      }
+    }
+  }
+}
+
+std::vector<size_t> CubeFaceGridIndex::FindInCone(const Vector<3>& axis, const double half_angle_rad) const {
+  // Tolerance to include the directions on the boundary
+  const double kCosTolerance = 1.0e-12;
+
+  std::vector<size_t> found;
+  if (half_angle_rad >= pi) {
+    found.resize(directions_.size());
+    for (size_t n = 0; n < directions_.size(); n++) found[n] = n;
+    return found;
+  }
+
+  const double cos_half_angle = cos(half_angle_rad);
+  const double sin_half_angle = sin(half_angle_rad);
+  for (size_t cell = 0; cell + 1 < cell_offsets_.size(); cell++) {
+    if (cell_offsets_[cell] == cell_offsets_[cell + 1]) continue;
+
+    // The cell overlaps the cone when the angle to the cell center is smaller than the sum of the half angle and the cell radius
+    if (half_angle_rad + cell_radius_rad_[cell] < pi) {
+      const double cos_limit = cos_half_angle * cell_cos_radius_[cell] - sin_half_angle * cell_sin_radius_[cell];
+      if (InnerProduct(axis, cell_centers_[cell]) < cos_limit - kCosTolerance) continue;
+    }
+
+    for (size_t k = cell_offsets_[cell]; k < cell_offsets_[cell + 1]; k++) {
+      const size_t n = cell_items_[k];
+      if (InnerProduct(axis, directions_[n]) >= cos_half_angle - kCosTolerance) found.push_back(n);
+    }
+  }
+  std::sort(found.begin(), found.end());
+  return found;
+}
+
+size_t CubeFaceGridIndex::CalcCellIndex(const Vector<3>& direction) const {
+  // The face is selected by the axis of the largest component
+  size_t axis = 0;
+  for (size_t k = 1; k < 3; k++) {
+    if (fabs(direction[k]) > fabs(direction[axis])) axis = k;
+  }
+  const size_t face = 2 * axis + (direction[axis] < 0.0 ? 1 : 0);
+  const double denominator = fabs(direction[axis]);
+
+  const double u_angle_rad = atan(direction[(axis + 1) % 3] / denominator);
+  const double v_angle_rad = atan(direction[(axis + 2) % 3] / denominator);
+  const size_t i = std::min((size_t)((u_angle_rad / (pi / 4.0) + 1.0) * 0.5 * (double)grid_size_), grid_size_ - 1);
+  const size_t j = std::min((size_t)((v_angle_rad / (pi / 4.0) + 1.0) * 0.5 * (double)grid_size_), grid_size_ - 1);
+
+  return (face * grid_size_ + i) * grid_size_ + j;
+}
+
+Vector<3> CubeFaceGridIndex::CalcFaceDirection(const size_t face, const double u, const double v) const {
+  const size_t axis = face / 2;
+  Vector<3> point;
+  point[axis] = (face % 2 == 0) ? 1.0 : -1.0;
+  point[(axis + 1) % 3] = tan((2.0 * u / (double)grid_size_ - 1.0) * pi / 4.0);
+  point[(axis + 2) % 3] = tan((2.0 * v / (double)grid_size_ - 1.0) * pi / 4.0);
+  return point.CalcNormalizedVector();
+}
+
+}  // namespace libra
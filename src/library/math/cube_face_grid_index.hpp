@@ -0,0 +1,113 @@
+/**
+ * @file cube_face_grid_index.hpp
+ * @brief Spatial index of directions on the unit sphere with the cube-face grid
+ */
+
+#ifndef S2E_LIBRARY_MATH_CUBE_FACE_GRID_INDEX_HPP_
+#define S2E_LIBRARY_MATH_CUBE_FACE_GRID_INDEX_HPP_
+
+#include <vector>
+
+#include "vector.hpp"
+
+namespace libra {
+
+/**
+ * @class CubeFaceGridIndex
+ * @brief Spatial index of directions on the unit sphere with the cube-face grid
+ * @details The unit sphere is projected onto the six faces of the cube, and each face is divided into the grid of equal angle. A cone query
+ *          checks the angular distance between the cone axis and the center of each cell, and tests only the directions in the cells which
+ *          overlap the cone.
+ */
+class CubeFaceGridIndex {
+ public:
+  /**
+   * @fn CubeFaceGridIndex
+   * @brief Constructor
+   * @param [in] directions: Unit vectors of the indexed directions
+   * @param [in] grid_size: Number of the cells along an edge of a cube face
+   */
+  CubeFaceGridIndex(const std::vector<Vector<3>>& directions = std::vector<Vector<3>>(), const size_t grid_size = kDefaultGridSize);
+  /**
+   * @fn CubeFaceGridIndex
+   * @brief Constructor with the precomputed cells (e.g. read from a file)
+   * @note The cells must be the ones made by the other constructor with the same directions and grid size
+   * @param [in] directions: Unit vectors of the indexed directions
+   * @param [in] grid_size: Number of the cells along an edge of a cube face
+   * @param [in] cell_offsets: Offsets of the cells in cell_items (the number of the cells + 1)
+   * @param [in] cell_items: Indices of the directions sorted by cell and in ascending order in each cell
+   */
+  CubeFaceGridIndex(std::vector<Vector<3>> directions, const size_t grid_size, std::vector<size_t> cell_offsets, std::vector<size_t> cell_items);
+
+  /**
+   * @fn FindInCone
+   * @brief Return the indices of the directions inside the cone (including the boundary) in ascending order
+   * @param [in] axis: Unit vector of the cone axis
+   * @param [in] half_angle_rad: Half angle of the cone [rad]
+   */
+  std::vector<size_t> FindInCone(const Vector<3>& axis, const double half_angle_rad) const;
+
+  // Getter
+  /**
+   * @fn GetNumberOfDirections
+   * @brief Return number of the indexed directions
+   */
+  inline size_t GetNumberOfDirections() const { return directions_.size(); }
+  /**
+   * @fn GetDirection
+   * @brief Return the indexed direction
+   * @param [in] index: Index of the direction
+   */
+  inline const Vector<3>& GetDirection(const size_t index) const { return directions_[index]; }
+  /**
+   * @fn GetGridSize
+   * @brief Return number of the cells along an edge of a cube face
+   */
+  inline size_t GetGridSize() const { return grid_size_; }
+  /**
+   * @fn GetCellOffsets
+   * @brief Return offsets of the cells in the cell items (the number of the cells + 1)
+   */
+  inline const std::vector<size_t>& GetCellOffsets() const { return cell_offsets_; }
+  /**
+   * @fn GetCellItems
+   * @brief Return indices of the directions sorted by cell and in ascending order in each cell
+   */
+  inline const std::vector<size_t>& GetCellItems() const { return cell_items_; }
+
+  static constexpr size_t kDefaultGridSize = 16;  //!< Default number of the cells along an edge of a cube face
+
+ private:
+  size_t grid_size_;                     //!< Number of the cells along an edge of a cube face
+  std::vector<Vector<3>> directions_;    //!< Indexed directions
+  std::vector<size_t> cell_offsets_;     //!< Offsets of the cells in cell_items_ (the number of the cells + 1)
+  std::vector<size_t> cell_items_;       //!< Indices of the directions sorted by cell and in ascending order in each cell
+  std::vector<Vector<3>> cell_centers_;  //!< Unit vectors to the center of the cells
+  std::vector<double> cell_radius_rad_;  //!< Angular distance from the center to the farthest corner of the cells [rad]
+  std::vector<double> cell_cos_radius_;  //!< Cosine of the cell radius
+  std::vector<double> cell_sin_radius_;  //!< Sine of the cell radius
+
+  /**
+   * @fn InitializeCellGeometry
+   * @brief Calculate the center and the radius of the cells
+   */
+  void InitializeCellGeometry();
+  /**
+   * @fn CalcCellIndex
+   * @brief Return the index of the cell which includes the direction
+   * @param [in] direction: Unit vector
+   */
+  size_t CalcCellIndex(const Vector<3>& direction) const;
+  /**
+   * @fn CalcFaceDirection
+   * @brief Return the unit vector of a point on a cube face
+   * @param [in] face: Face index (0: +X, 1: -X, 2: +Y, 3: -Y, 4: +Z, 5: -Z)
+   * @param [in] u: Grid coordinate along the first axis of the face [0, grid_size]
+   * @param [in] v: Grid coordinate along the second axis of the face [0, grid_size]
+   */
+  Vector<3> CalcFaceDirection(const size_t face, const double u, const double v) const;
+};
+
+}  // namespace libra
+
+#endif  // S2E_LIBRARY_MATH_CUBE_FACE_GRID_INDEX_HPP_
@@ -0,0 +1,163 @@
+/**
+ * @file simd.hpp
+ * @brief Thin wrapper of SIMD instructions for packed double values
+ * @note AVX2 is used when the compiler enables it (e.g. USE_AVX2 option), SSE2 on x86-64, NEON on AArch64, and scalar otherwise.
+ */
+
+#ifndef S2E_LIBRARY_MATH_SIMD_HPP_
+#define S2E_LIBRARY_MATH_SIMD_HPP_
+
+#include <cstddef>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define S2E_SIMD_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define S2E_SIMD_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define S2E_SIMD_NEON
+#endif
+
+namespace libra {
+
+/**
+ * @class PackedDouble
+ * @brief Packed double values processed by a SIMD instruction at once
+ */
+class PackedDouble {
+ public:
+#if defined(S2E_SIMD_AVX2)
+  static const size_t kNumberOfLanes = 4;  //!< Number of double values in a pack
+  using Register = __m256d;                //!< Register type
+#elif defined(S2E_SIMD_SSE2)
+  static const size_t kNumberOfLanes = 2;  //!< Number of double values in a pack
+  using Register = __m128d;                //!< Register type
+#elif defined(S2E_SIMD_NEON)
+  static const size_t kNumberOfLanes = 2;  //!< Number of double values in a pack
+  using Register = float64x2_t;            //!< Register type
+#else
+  static const size_t kNumberOfLanes = 1;  //!< Number of double values in a pack
+  using Register = double;                 //!< Register type
+#endif
+
+  /**
+   * @fn PackedDouble
+   * @brief Constructor
+   * @param [in] value: Register value
+   */
+  inline PackedDouble(const Register value) : value_(value) {}
+
+  /**
+   * @fn Load
+   * @brief Load packed values from an unaligned array
+   * @param [in] array: Head of the values
+   */
+  static inline PackedDouble Load(const double* array) {
+#if defined(S2E_SIMD_AVX2)
+    return _mm256_loadu_pd(array);
+#elif defined(S2E_SIMD_SSE2)
+    return _mm_loadu_pd(array);
+#elif defined(S2E_SIMD_NEON)
+    return vld1q_f64(array);
+#else
+    return *array;
+#endif
+  }
+  /**
+   * @fn Store
+   * @brief Store packed values into an unaligned array
+   * @param [out] array: Head of the values
+   */
+  inline void Store(double* array) const {
+#if defined(S2E_SIMD_AVX2)
+    _mm256_storeu_pd(array, value_);
+#elif defined(S2E_SIMD_SSE2)
+    _mm_storeu_pd(array, value_);
+#elif defined(S2E_SIMD_NEON)
+    vst1q_f64(array, value_);
+#else
+    *array = value_;
+#endif
+  }
+  /**
+   * @fn Broadcast
+   * @brief Set a value to all lanes
+   * @param [in] value: Value
+   */
+  static inline PackedDouble Broadcast(const double value) {
+#if defined(S2E_SIMD_AVX2)
+    return _mm256_set1_pd(value);
+#elif defined(S2E_SIMD_SSE2)
+    return _mm_set1_pd(value);
+#elif defined(S2E_SIMD_NEON)
+    return vdupq_n_f64(value);
+#else
+    return value;
+#endif
+  }
+
+  /**
+   * @fn Sum
+   * @brief Return the summation of all lanes
+   */
+  inline double Sum() const {
+#if defined(S2E_SIMD_AVX2)
+    const __m128d sum = _mm_add_pd(_mm256_castpd256_pd128(value_), _mm256_extractf128_pd(value_, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+#elif defined(S2E_SIMD_SSE2)
+    return _mm_cvtsd_f64(_mm_add_sd(value_, _mm_unpackhi_pd(value_, value_)));
+#elif defined(S2E_SIMD_NEON)
+    return vaddvq_f64(value_);
+#else
+    return value_;
+#endif
+  }
+
+  // Operators
+  inline PackedDouble operator+(const PackedDouble& rhs) const {
+#if defined(S2E_SIMD_AVX2)
+    return _mm256_add_pd(value_, rhs.value_);
+#elif defined(S2E_SIMD_SSE2)
+    return _mm_add_pd(value_, rhs.value_);
+#elif defined(S2E_SIMD_NEON)
+    return vaddq_f64(value_, rhs.value_);
+#else
+    return value_ + rhs.value_;
+#endif
+  }
+  inline PackedDouble operator-(const PackedDouble& rhs) const {
+#if defined(S2E_SIMD_AVX2)
+    return _mm256_sub_pd(value_, rhs.value_);
+#elif defined(S2E_SIMD_SSE2)
+    return _mm_sub_pd(value_, rhs.value_);
+#elif defined(S2E_SIMD_NEON)
+    return vsubq_f64(value_, rhs.value_);
+#else
+    return value_ - rhs.value_;
+#endif
+  }
+  inline PackedDouble operator*(const PackedDouble& rhs) const {
+#if defined(S2E_SIMD_AVX2)
+    return _mm256_mul_pd(value_, rhs.value_);
+#elif defined(S2E_SIMD_SSE2)
+    return _mm_mul_pd(value_, rhs.value_);
+#elif defined(S2E_SIMD_NEON)
+    return vmulq_f64(value_, rhs.value_);
+#else
+    return value_ * rhs.value_;
+#endif
+  }
+  inline PackedDouble& operator+=(const PackedDouble& rhs) {
+    *this = *this + rhs;
+    return *this;
+  }
+
+ private:
+  Register value_;  //!< Packed values
+};
+
+}  // namespace libra
+
+#endif  // S2E_LIBRARY_MATH_SIMD_HPP_
@@ -0,0 +1,92 @@
+/**
+ * @file test_cube_face_grid_index.cpp
+ * @brief Test codes for CubeFaceGridIndex class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+
+#include "constants.hpp"
+#include "cube_face_grid_index.hpp"
+
+/**
+ * @brief Generate uniformly distributed unit vectors
+ */
+static std::vector<libra::Vector<3>> GenerateDirections(const size_t number, const unsigned int seed) {
+  std::mt19937 generator(seed);
+  std::normal_distribution<double> distribution(0.0, 1.0);
+  std::vector<libra::Vector<3>> directions(number);
+  for (auto& direction : directions) {
+    for (size_t i = 0; i < 3; i++) direction[i] = distribution(generator);
+    direction = direction.CalcNormalizedVector();
+  }
+  return directions;
+}
+
+/**
+ * @brief Test for the cone query compared with the linear search
+ */
+TEST(CubeFaceGridIndex, FindInCone) {
+  const std::vector<libra::Vector<3>> directions = GenerateDirections(20000, 1);
+  const std::vector<libra::Vector<3>> axes = GenerateDirections(50, 2);
+  libra::CubeFaceGridIndex index(directions);
+  EXPECT_EQ(directions.size(), index.GetNumberOfDirections());
+
+  const double half_angles_rad[] = {0.5 * libra::deg_to_rad, 3.0 * libra::deg_to_rad, 20.0 * libra::deg_to_rad, 90.0 * libra::deg_to_rad,
+                                    175.0 * libra::deg_to_rad};
+  for (const auto& axis : axes) {
+    for (const double half_angle_rad : half_angles_rad) {
+      std::vector<size_t> expected;
+      for (size_t n = 0; n < directions.size(); n++) {
+        if (InnerProduct(axis, directions[n]) >= cos(half_angle_rad)) expected.push_back(n);
+      }
+      EXPECT_EQ(expected, index.FindInCone(axis, half_angle_rad));
+    }
+  }
+
+  EXPECT_EQ(directions.size(), index.FindInCone(axes[0], libra::pi).size());
+}
+
+/**
+ * @brief Test for the index restored from the precomputed cells
+ */
+TEST(CubeFaceGridIndex, PrecomputedCells) {
+  const std::vector<libra::Vector<3>> directions = GenerateDirections(5000, 3);
+  const std::vector<libra::Vector<3>> axes = GenerateDirections(20, 4);
+  libra::CubeFaceGridIndex index(directions, 8);
+  libra::CubeFaceGridIndex restored(directions, index.GetGridSize(), index.GetCellOffsets(), index.GetCellItems());
+
+  EXPECT_EQ(8u, restored.GetGridSize());
+  EXPECT_EQ(6u * 8u * 8u + 1u, restored.GetCellOffsets().size());
+  EXPECT_EQ(directions.size(), restored.GetCellItems().size());
+  for (const auto& axis : axes) {
+    EXPECT_EQ(index.FindInCone(axis, 10.0 * libra::deg_to_rad), restored.FindInCone(axis, 10.0 * libra::deg_to_rad));
+  }
+}
+
+/**
+ * @brief Test for the directions on the cube edges and corners
+ */
+TEST(CubeFaceGridIndex, Edges) {
+  std::vector<libra::Vector<3>> directions;
+  for (int x = -1; x <= 1; x++) {
+    for (int y = -1; y <= 1; y++) {
+      for (int z = -1; z <= 1; z++) {
+        if (x == 0 && y == 0 && z == 0) continue;
+        libra::Vector<3> direction;
+        direction[0] = x;
+        direction[1] = y;
+        direction[2] = z;
+        directions.push_back(direction.CalcNormalizedVector());
+      }
+    }
+  }
+  libra::CubeFaceGridIndex index(directions, 4);
+
+  for (size_t n = 0; n < directions.size(); n++) {
+    const std::vector<size_t> found = index.FindInCone(directions[n], 1.0e-6);
+    ASSERT_EQ(1u, found.size());
+    EXPECT_EQ(n, found[0]);
+  }
+}
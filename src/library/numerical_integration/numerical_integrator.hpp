@@ -50,11 +50,28 @@ class NumericalIntegrator {
     previous_state_ = state;
   }
 
+  /**
+   * @fn SetStepWidth
+   * @brief Set step width
+   * @param [in] step_width: Step width. The unit is depending on the independent variable
+   */
+  inline void SetStepWidth(const double step_width) { step_width_ = step_width; }
+
   /**
    * @fn GetState
    * @brief Return current state vector
    */
   inline const Vector<N>& GetState() const { return current_state_; }
+  /**
+   * @fn GetStepWidth
+   * @brief Return step width
+   */
+  inline double GetStepWidth() const { return step_width_; }
+  /**
+   * @fn GetCurrentIndependentVariable
+   * @brief Return latest value of independent variable
+   */
+  inline double GetCurrentIndependentVariable() const { return current_independent_variable_; }
 
   /**
    * @fn CalcInterpolationState
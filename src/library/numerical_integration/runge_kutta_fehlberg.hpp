@@ -23,6 +23,11 @@ class RungeKuttaFehlberg : public EmbeddedRungeKutta<N> {
    * @param [in] step_width: Step width
    */
   RungeKuttaFehlberg(const double step_width, const InterfaceOde<N>& ode);
+  /**
+   * @fn Integrate
+   * @brief Update the state vector with the numerical integration
+   */
+  void Integrate() override;
   /**
    * @fn CalcInterpolationState
    * @brief Calculate interpolation state
@@ -32,6 +37,9 @@ class RungeKuttaFehlberg : public EmbeddedRungeKutta<N> {
   Vector<N> CalcInterpolationState(const double sigma) const override;
 
  private:
+  mutable Vector<N> interpolation_slope_;                   //!< Slope for the interpolation (k7), calculated once per step
+  mutable bool is_interpolation_slope_calculated_ = false;  //!< Flag to show the interpolation slope of the latest step is calculated
+
   /**
    * @fn CalcInterpolationWeights
    * @brief Calculate weights for interpolation
@@ -61,12 +61,22 @@ RungeKuttaFehlberg<N>::RungeKuttaFehlberg(const double step_width, const Interfa
   this->rk_matrix_[5][4] = -11.0 / 40.0;
 }
 
+template <size_t N>
+void RungeKuttaFehlberg<N>::Integrate() {
+  EmbeddedRungeKutta<N>::Integrate();
+  is_interpolation_slope_calculated_ = false;
+}
+
 template <size_t N>
 Vector<N> RungeKuttaFehlberg<N>::CalcInterpolationState(const double sigma) const {
-  // Calc k7 (slope after state update)
-  Vector<N> state_7 =
-      this->previous_state_ + this->step_width_ * (1.0 / 6.0 * this->slope_[0] + 1.0 / 6.0 * this->slope_[4] + 2.0 / 3.0 * this->slope_[5]);
-  Vector<N> k7 = this->ode_.DerivativeFunction(this->current_independent_variable_, state_7);
+  // Calc k7 (slope after state update) once per step since the interpolation can be requested many times in a step
+  if (!is_interpolation_slope_calculated_) {
+    Vector<N> state_7 =
+        this->previous_state_ + this->step_width_ * (1.0 / 6.0 * this->slope_[0] + 1.0 / 6.0 * this->slope_[4] + 2.0 / 3.0 * this->slope_[5]);
+    interpolation_slope_ = this->ode_.DerivativeFunction(this->current_independent_variable_, state_7);
+    is_interpolation_slope_calculated_ = true;
+  }
+  const Vector<N>& k7 = interpolation_slope_;
 
   std::vector<double> interpolation_weights = CalcInterpolationWeights(sigma);
 
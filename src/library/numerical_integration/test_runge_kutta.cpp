@@ -425,3 +425,60 @@ TEST(NUMERICAL_INTEGRATION, Interpolation2dTwoBodyOrbitSmallEccentricity) {
   EXPECT_NEAR(kepler.GetVelocity_i_m_s()[0], state_rkf[2], error_tolerance);
   EXPECT_NEAR(kepler.GetVelocity_i_m_s()[1], state_rkf[3], error_tolerance);
 }
+
+/**
+ * @brief Test for adaptive step width control and dense output with RKF for 2D two body orbit with small eccentricity
+ */
+TEST(NUMERICAL_INTEGRATION, DenseOutput2dTwoBodyOrbitAdaptiveStep) {
+  libra::numerical_integration::Example2dTwoBodyOrbitOde ode;
+  libra::numerical_integration::RungeKuttaFehlberg<4> rkf_ode(0.01, ode);
+
+  libra::Vector<4> initial_state(0.0);
+  const double eccentricity = 0.1;
+  initial_state[0] = 1.0 - eccentricity;
+  initial_state[3] = sqrt((1.0 + eccentricity) / (1.0 - eccentricity));
+  rkf_ode.SetState(0.0, initial_state);
+
+  libra::Vector<3> initial_position(0.0);
+  libra::Vector<3> initial_velocity(0.0);
+  initial_position[0] = initial_state[0];
+  initial_velocity[1] = initial_state[3];
+  OrbitalElements oe(1.0, 0.0, initial_position, initial_velocity);
+  KeplerOrbit kepler(1.0, oe);
+
+  // Integrate with the step width control and evaluate the state at the output time with the interpolation
+  const double error_tolerance = 1e-9;
+  double step_start_time = 0.0;
+  double next_step_width = 0.01;
+  size_t step_num = 0;
+  const size_t output_num = 1000;
+  const double output_step = 0.01;
+  for (size_t i = 1; i <= output_num; i++) {
+    const double output_time = output_step * (double)i;
+    while (rkf_ode.GetCurrentIndependentVariable() < output_time) {
+      const libra::Vector<4> start_state = rkf_ode.GetState();
+      step_start_time = rkf_ode.GetCurrentIndependentVariable();
+      rkf_ode.SetStepWidth(next_step_width);
+      rkf_ode.Integrate();
+      const double scale = 0.9 * pow(error_tolerance / rkf_ode.GetLocalTruncationError(), 0.2);
+      next_step_width = rkf_ode.GetStepWidth() * std::min(5.0, std::max(0.2, scale));
+      if (rkf_ode.GetLocalTruncationError() > error_tolerance) {
+        rkf_ode.SetState(step_start_time, start_state);  // Reject
+      } else {
+        step_num++;
+      }
+    }
+
+    const double sigma = (output_time - step_start_time) / rkf_ode.GetStepWidth();
+    libra::Vector<4> state_rkf = rkf_ode.CalcInterpolationState(sigma);
+    kepler.CalcOrbit(output_time / (24.0 * 60.0 * 60.0));
+
+    const double accuracy = 2e-5;
+    EXPECT_NEAR(kepler.GetPosition_i_m()[0], state_rkf[0], accuracy);
+    EXPECT_NEAR(kepler.GetPosition_i_m()[1], state_rkf[1], accuracy);
+    EXPECT_NEAR(kepler.GetVelocity_i_m_s()[0], state_rkf[2], accuracy);
+    EXPECT_NEAR(kepler.GetVelocity_i_m_s()[1], state_rkf[3], accuracy);
+  }
+  // The step width is not restricted by the output time
+  EXPECT_LT(step_num, output_num);
+}
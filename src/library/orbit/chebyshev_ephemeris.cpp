@@ -0,0 +1,267 @@
+/**
+ * @file chebyshev_ephemeris.cpp
+ * @brief Classes to write and read the precomputed ephemeris file with Chebyshev coefficients
+ */
+
+#include "chebyshev_ephemeris.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <locale>
+
+#include "../math/constants.hpp"
+
+static const char kMagic[8] = {'S', '2', 'E', 'E', 'P', 'H', '0', '1'};  //!< Magic of the file
+
+/**
+ * @fn EvaluateChebyshev
+ * @brief Evaluate the Chebyshev series and its derivative
+ * @param [in] coefficients: Chebyshev coefficients
+ * @param [in] number_of_coefficients: Number of coefficients
+ * @param [in] x: Normalized time (-1 to 1)
+ * @param [out] value: Value of the series
+ * @param [out] derivative: Derivative of the series with respect to x
+ */
+static void EvaluateChebyshev(const double* coefficients, const size_t number_of_coefficients, const double x, double& value, double& derivative) {
+  double t_prev = 1.0, t = x;      // T_0, T_1
+  double dt_prev = 0.0, dt = 1.0;  // T_0', T_1'
+  value = coefficients[0];
+  derivative = 0.0;
+  if (number_of_coefficients < 2) return;
+  value += coefficients[1] * t;
+  derivative += coefficients[1] * dt;
+  for (size_t k = 2; k < number_of_coefficients; k++) {
+    const double t_next = 2.0 * x * t - t_prev;
+    const double dt_next = 2.0 * t + 2.0 * x * dt - dt_prev;
+    value += coefficients[k] * t_next;
+    derivative += coefficients[k] * dt_next;
+    t_prev = t;
+    t = t_next;
+    dt_prev = dt;
+    dt = dt_next;
+  }
+}
+
+/**
+ * @fn CopyName
+ * @brief Copy a name into the fixed length field of the file
+ */
+static void CopyName(char* destination, const std::string source) {
+  memset(destination, 0, ChebyshevEphemeris::kMaxNameLength);
+  strncpy(destination, source.c_str(), ChebyshevEphemeris::kMaxNameLength - 1);
+}
+
+ChebyshevEphemerisWriter::ChebyshevEphemerisWriter(const double start_time_s, const double end_time_s, const std::string inertial_frame_name,
+                                                   const std::string aberration_correction_setting, const std::string center_body_name,
+                                                   const ChebyshevEphemerisTimeSystem& time_system)
+    : start_time_s_(start_time_s),
+      end_time_s_(end_time_s),
+      inertial_frame_name_(inertial_frame_name),
+      aberration_correction_setting_(aberration_correction_setting),
+      center_body_name_(center_body_name),
+      time_system_(time_system) {}
+
+double ChebyshevEphemerisWriter::AddBody(const int id, const std::string name, const double gravity_constant_m3_s2, const double radii_m[3],
+                                         const SampleFunction& sample_function, const double tolerance_m, const size_t number_of_coefficients,
+                                         const double max_interval_s) {
+  const double kMinInterval_s = 60.0;
+
+  Body body;
+  body.id = id;
+  body.name = name;
+  std::locale loc = std::locale::classic();
+  std::transform(body.name.begin(), body.name.end(), body.name.begin(), [loc](char c) { return std::toupper(c, loc); });
+  body.gravity_constant_m3_s2 = gravity_constant_m3_s2;
+  for (size_t i = 0; i < 3; i++) body.radii_m[i] = radii_m[i];
+  body.number_of_coefficients = std::max(number_of_coefficients, (size_t)2);
+  body.interval_s = std::min(max_interval_s, std::max(end_time_s_ - start_time_s_, kMinInterval_s));
+
+  double error_m = FitBody(sample_function, body);
+  while (error_m > tolerance_m && body.interval_s * 0.5 >= kMinInterval_s) {
+    body.interval_s *= 0.5;
+    error_m = FitBody(sample_function, body);
+  }
+  if (error_m > tolerance_m) {
+    std::cerr << "Warning: Fitting error of " << name << " (" << error_m << " m) is larger than the tolerance." << std::endl;
+  }
+  bodies_.push_back(body);
+  return error_m;
+}
+
+double ChebyshevEphemerisWriter::FitBody(const SampleFunction& sample_function, Body& body) const {
+  const size_t n = body.number_of_coefficients;
+  body.number_of_intervals = (size_t)std::max(1.0, ceil((end_time_s_ - start_time_s_) / body.interval_s));
+  body.coefficients.assign(body.number_of_intervals * 3 * n, 0.0);
+
+  double max_error_m = 0.0;
+  double state[6];
+  std::vector<double> values(3 * n);
+  for (size_t interval = 0; interval < body.number_of_intervals; interval++) {
+    const double interval_start_s = start_time_s_ + body.interval_s * (double)interval;
+    const double half_interval_s = 0.5 * body.interval_s;
+    double* coefficients = &body.coefficients[interval * 3 * n];
+
+    // Fit with the values at the Chebyshev nodes
+    for (size_t j = 0; j < n; j++) {
+      const double x = cos(libra::pi * ((double)j + 0.5) / (double)n);
+      sample_function(interval_start_s + half_interval_s * (x + 1.0), state);
+      for (size_t axis = 0; axis < 3; axis++) values[axis * n + j] = state[axis];
+    }
+    for (size_t axis = 0; axis < 3; axis++) {
+      for (size_t k = 0; k < n; k++) {
+        double sum = 0.0;
+        for (size_t j = 0; j < n; j++) {
+          sum += values[axis * n + j] * cos(libra::pi * (double)k * ((double)j + 0.5) / (double)n);
+        }
+        coefficients[axis * n + k] = (k == 0 ? 1.0 : 2.0) * sum / (double)n;
+      }
+    }
+
+    // Check the error between the nodes
+    for (size_t j = 0; j <= n; j++) {
+      const double x = cos(libra::pi * (double)j / (double)n);
+      sample_function(interval_start_s + half_interval_s * (x + 1.0), state);
+      double error_m2 = 0.0;
+      for (size_t axis = 0; axis < 3; axis++) {
+        double position_m, derivative;
+        EvaluateChebyshev(&coefficients[axis * n], n, x, position_m, derivative);
+        error_m2 += pow(position_m - state[axis], 2.0);
+      }
+      max_error_m = std::max(max_error_m, sqrt(error_m2));
+    }
+  }
+  return max_error_m;
+}
+
+bool ChebyshevEphemerisWriter::Write(const std::string file_path) const {
+  using Header = ChebyshevEphemeris::Header;
+  using BodyEntry = ChebyshevEphemeris::BodyEntry;
+
+  Header header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.byte_order_mark = ChebyshevEphemeris::kByteOrderMark;
+  header.number_of_bodies = (uint32_t)bodies_.size();
+  header.start_time_s = start_time_s_;
+  header.end_time_s = end_time_s_;
+  CopyName(header.inertial_frame_name, inertial_frame_name_);
+  CopyName(header.aberration_correction_setting, aberration_correction_setting_);
+  CopyName(header.center_body_name, center_body_name_);
+  header.delta_t_a_s = time_system_.delta_t_a_s;
+  header.k_s = time_system_.k_s;
+  header.eb = time_system_.eb;
+  header.m_rad[0] = time_system_.m_rad[0];
+  header.m_rad[1] = time_system_.m_rad[1];
+  header.number_of_leap_seconds = time_system_.leap_seconds.size() / 2;
+
+  std::vector<BodyEntry> entries(bodies_.size());
+  uint64_t offset_byte = sizeof(Header) + sizeof(BodyEntry) * bodies_.size() + sizeof(double) * header.number_of_leap_seconds * 2;
+  for (size_t i = 0; i < bodies_.size(); i++) {
+    memset(&entries[i], 0, sizeof(BodyEntry));
+    CopyName(entries[i].name, bodies_[i].name);
+    entries[i].id = bodies_[i].id;
+    entries[i].number_of_coefficients = (uint32_t)bodies_[i].number_of_coefficients;
+    entries[i].number_of_intervals = bodies_[i].number_of_intervals;
+    entries[i].interval_s = bodies_[i].interval_s;
+    entries[i].gravity_constant_m3_s2 = bodies_[i].gravity_constant_m3_s2;
+    for (size_t j = 0; j < 3; j++) entries[i].radii_m[j] = bodies_[i].radii_m[j];
+    entries[i].coefficients_offset_byte = offset_byte;
+    offset_byte += sizeof(double) * bodies_[i].coefficients.size();
+  }
+
+  std::ofstream file(file_path, std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!file.is_open()) {
+    std::cerr << "Error: Cannot open the ephemeris file: " << file_path << std::endl;
+    return false;
+  }
+  file.write((const char*)&header, sizeof(header));
+  file.write((const char*)entries.data(), sizeof(BodyEntry) * entries.size());
+  file.write((const char*)time_system_.leap_seconds.data(), sizeof(double) * header.number_of_leap_seconds * 2);
+  for (size_t i = 0; i < bodies_.size(); i++) {
+    file.write((const char*)bodies_[i].coefficients.data(), sizeof(double) * bodies_[i].coefficients.size());
+  }
+  return file.good();
+}
+
+ChebyshevEphemeris::ChebyshevEphemeris(const std::string file_path) : mapped_file_(file_path) {
+  if (!mapped_file_.IsMapped()) {
+    std::cerr << "Error: Cannot map the ephemeris file: " << file_path << std::endl;
+    return;
+  }
+  data_ = mapped_file_.GetData();
+  size_byte_ = mapped_file_.GetSize_byte();
+
+  // Check the contents
+  const Header* header = (const Header*)data_;
+  bool is_valid = size_byte_ >= sizeof(Header) && memcmp(header->magic, kMagic, sizeof(kMagic)) == 0 && header->byte_order_mark == kByteOrderMark;
+  size_t tables_end_byte = 0;
+  if (is_valid) {
+    tables_end_byte = sizeof(Header) + sizeof(BodyEntry) * header->number_of_bodies + sizeof(double) * header->number_of_leap_seconds * 2;
+    is_valid = tables_end_byte <= size_byte_;
+  }
+  const BodyEntry* bodies = (const BodyEntry*)(data_ + sizeof(Header));
+  for (size_t i = 0; is_valid && i < header->number_of_bodies; i++) {
+    const uint64_t coefficients_size_byte = sizeof(double) * 3 * bodies[i].number_of_coefficients * bodies[i].number_of_intervals;
+    is_valid = bodies[i].number_of_coefficients >= 1 && bodies[i].number_of_intervals >= 1 && bodies[i].interval_s > 0.0 &&
+               bodies[i].coefficients_offset_byte >= tables_end_byte && bodies[i].coefficients_offset_byte % sizeof(double) == 0 &&
+               bodies[i].coefficients_offset_byte + coefficients_size_byte <= size_byte_;
+  }
+  if (!is_valid) {
+    std::cerr << "Error: Invalid ephemeris file: " << file_path << std::endl;
+    return;
+  }
+
+  header_ = header;
+  bodies_ = bodies;
+  leap_seconds_ = (const double*)(data_ + sizeof(Header) + sizeof(BodyEntry) * header->number_of_bodies);
+}
+
+bool ChebyshevEphemeris::CalcState(const size_t index, const double ephemeris_time_s, double state[6]) const {
+  const BodyEntry& body = bodies_[index];
+  const size_t n = body.number_of_coefficients;
+
+  const double elapsed_time_s = ephemeris_time_s - header_->start_time_s;
+  long interval = (long)floor(elapsed_time_s / body.interval_s);
+  interval = std::max(0L, std::min(interval, (long)body.number_of_intervals - 1));
+  const double half_interval_s = 0.5 * body.interval_s;
+  const double x = (elapsed_time_s - body.interval_s * (double)interval) / half_interval_s - 1.0;
+
+  const double* coefficients = (const double*)(data_ + body.coefficients_offset_byte) + interval * 3 * n;
+  for (size_t axis = 0; axis < 3; axis++) {
+    double derivative;
+    EvaluateChebyshev(&coefficients[axis * n], n, x, state[axis], derivative);
+    state[axis + 3] = derivative / half_interval_s;
+  }
+  return ephemeris_time_s >= header_->start_time_s && ephemeris_time_s <= header_->end_time_s;
+}
+
+double ChebyshevEphemeris::ConvertUtcToEphemerisTime_s(const double utc_s) const {
+  // Difference between TAI and UTC
+  double delta_at_s = header_->number_of_leap_seconds > 0 ? leap_seconds_[0] : 0.0;
+  for (size_t i = 0; i < header_->number_of_leap_seconds; i++) {
+    if (utc_s < leap_seconds_[i * 2 + 1]) break;
+    delta_at_s = leap_seconds_[i * 2];
+  }
+
+  // Periodic term depends on the ephemeris time itself
+  double ephemeris_time_s = utc_s + delta_at_s + header_->delta_t_a_s;
+  for (size_t i = 0; i < 3; i++) {
+    const double mean_anomaly_rad = header_->m_rad[0] + header_->m_rad[1] * ephemeris_time_s;
+    const double eccentric_anomaly_rad = mean_anomaly_rad + header_->eb * sin(mean_anomaly_rad);
+    ephemeris_time_s = utc_s + delta_at_s + header_->delta_t_a_s + header_->k_s * sin(eccentric_anomaly_rad);
+  }
+  return ephemeris_time_s;
+}
+
+int ChebyshevEphemeris::FindBody(const std::string name) const {
+  std::locale loc = std::locale::classic();
+  std::string upper_name = name;
+  std::transform(upper_name.begin(), upper_name.end(), upper_name.begin(), [loc](char c) { return std::toupper(c, loc); });
+  for (size_t i = 0; i < header_->number_of_bodies; i++) {
+    if (upper_name == bodies_[i].name) return (int)i;
+  }
+  return -1;
+}
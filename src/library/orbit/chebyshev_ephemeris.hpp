@@ -0,0 +1,281 @@
+/**
+ * @file chebyshev_ephemeris.hpp
+ * @brief Classes to write and read the precomputed ephemeris file with Chebyshev coefficients
+ */
+
+#ifndef S2E_LIBRARY_ORBIT_CHEBYSHEV_EPHEMERIS_HPP_
+#define S2E_LIBRARY_ORBIT_CHEBYSHEV_EPHEMERIS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "../utilities/memory_mapped_file.hpp"
+
+/**
+ * @struct ChebyshevEphemerisTimeSystem
+ * @brief Parameters to convert UTC to the ephemeris time (same definition with the DELTET variables of the SPICE leapseconds kernel)
+ */
+struct ChebyshevEphemerisTimeSystem {
+  double delta_t_a_s = 32.184;                  //!< Difference between TDT and TAI [s]
+  double k_s = 1.657e-3;                        //!< Amplitude of the periodic term [s]
+  double eb = 1.671e-2;                         //!< Eccentricity of the Earth-Moon barycenter orbit [-]
+  double m_rad[2] = {6.239996, 1.99096871e-7};  //!< Mean anomaly at J2000 [rad] and its rate [rad/s]
+  std::vector<double> leap_seconds;             //!< Pairs of the difference between TAI and UTC [s] and its UTC epoch from J2000 [s]
+};
+
+/**
+ * @class ChebyshevEphemerisWriter
+ * @brief Class to fit ephemerides with Chebyshev polynomials and write them into the precomputed ephemeris file
+ */
+class ChebyshevEphemerisWriter {
+ public:
+  /**
+   * @brief Function to sample the ephemeris
+   * @param [in] ephemeris_time_s: Ephemeris time from J2000 [s]
+   * @param [out] state: Position [m] and velocity [m/s]
+   */
+  using SampleFunction = std::function<void(const double ephemeris_time_s, double state[6])>;
+
+  /**
+   * @fn ChebyshevEphemerisWriter
+   * @brief Constructor
+   * @param [in] start_time_s: Start ephemeris time from J2000 [s]
+   * @param [in] end_time_s: End ephemeris time from J2000 [s]
+   * @param [in] inertial_frame_name: Definition of inertial frame
+   * @param [in] aberration_correction_setting: Stellar aberration correction
+   * @param [in] center_body_name: Center object name of inertial frame
+   * @param [in] time_system: Parameters to convert UTC to the ephemeris time
+   */
+  ChebyshevEphemerisWriter(const double start_time_s, const double end_time_s, const std::string inertial_frame_name,
+                           const std::string aberration_correction_setting, const std::string center_body_name,
+                           const ChebyshevEphemerisTimeSystem& time_system);
+
+  /**
+   * @fn AddBody
+   * @brief Fit the ephemeris of a body and add it
+   * @note The interval is halved from the maximum interval until the fitting error becomes smaller than the tolerance.
+   * @param [in] id: SPICE ID of the body
+   * @param [in] name: Name of the body
+   * @param [in] gravity_constant_m3_s2: Gravity constant [m^3/s^2]
+   * @param [in] radii_m: Planetographic radii [m]
+   * @param [in] sample_function: Function to sample the ephemeris
+   * @param [in] tolerance_m: Tolerance of the fitting error of position [m]
+   * @param [in] number_of_coefficients: Number of Chebyshev coefficients per axis and interval
+   * @param [in] max_interval_s: Maximum interval of a polynomial [s]
+   * @return Maximum fitting error of position [m]
+   */
+  double AddBody(const int id, const std::string name, const double gravity_constant_m3_s2, const double radii_m[3],
+                 const SampleFunction& sample_function, const double tolerance_m, const size_t number_of_coefficients = 12,
+                 const double max_interval_s = 32.0 * 86400.0);
+
+  /**
+   * @fn Write
+   * @brief Write the file
+   * @param [in] file_path: Path to the file
+   * @return True when the file is written
+   */
+  bool Write(const std::string file_path) const;
+
+  // Getter
+  /**
+   * @fn GetInterval_s
+   * @brief Return interval of the polynomials of a body [s]
+   * @param [in] index: Index of the body
+   */
+  inline double GetInterval_s(const size_t index) const { return bodies_[index].interval_s; }
+
+ private:
+  /**
+   * @struct Body
+   * @brief Fitted ephemeris of a body
+   */
+  struct Body {
+    int id;                            //!< SPICE ID
+    std::string name;                  //!< Name
+    double gravity_constant_m3_s2;     //!< Gravity constant [m^3/s^2]
+    double radii_m[3];                 //!< Planetographic radii [m]
+    size_t number_of_coefficients;     //!< Number of Chebyshev coefficients per axis and interval
+    size_t number_of_intervals;        //!< Number of intervals
+    double interval_s;                 //!< Interval of a polynomial [s]
+    std::vector<double> coefficients;  //!< Coefficients ordered by interval, axis, and degree [m]
+  };
+
+  double start_time_s_;                        //!< Start ephemeris time from J2000 [s]
+  double end_time_s_;                          //!< End ephemeris time from J2000 [s]
+  std::string inertial_frame_name_;            //!< Definition of inertial frame
+  std::string aberration_correction_setting_;  //!< Stellar aberration correction
+  std::string center_body_name_;               //!< Center object name of inertial frame
+  ChebyshevEphemerisTimeSystem time_system_;   //!< Parameters to convert UTC to the ephemeris time
+  std::vector<Body> bodies_;                   //!< Fitted bodies
+
+  /**
+   * @fn FitBody
+   * @brief Fit the ephemeris with the interval
+   * @param [in] sample_function: Function to sample the ephemeris
+   * @param [in/out] body: Body with the number of coefficients and the interval
+   * @return Maximum fitting error of position [m]
+   */
+  double FitBody(const SampleFunction& sample_function, Body& body) const;
+};
+
+/**
+ * @class ChebyshevEphemeris
+ * @brief Class to read the precomputed ephemeris file and evaluate the ephemerides without SPICE
+ * @details The file is mapped into the memory, so the pages are shared between the processes reading the same file.
+ *          All values are stored in the byte order of the writing machine, which is checked with the byte order mark.
+ *          - Header: magic "S2EEPH01", byte order mark, number of bodies, start and end ephemeris time, frame, aberration correction,
+ *            center body, and the time system parameters
+ *          - Body table: name, ID, number of coefficients, number of intervals, interval, gravity constant, radii, and offset of the coefficients
+ *          - Leap seconds table
+ *          - Coefficients of the position [m] ordered by body, interval, axis, and degree
+ */
+class ChebyshevEphemeris {
+ public:
+  /**
+   * @fn ChebyshevEphemeris
+   * @brief Constructor
+   * @param [in] file_path: Path to the file
+   */
+  ChebyshevEphemeris(const std::string file_path);
+  // The mapped memory is owned by this object
+  ChebyshevEphemeris(const ChebyshevEphemeris&) = delete;
+  ChebyshevEphemeris& operator=(const ChebyshevEphemeris&) = delete;
+
+  /**
+   * @fn CalcState
+   * @brief Calculate position and velocity of a body
+   * @note The polynomial of the edge interval is extrapolated when the time is out of the span of the file.
+   * @param [in] index: Index of the body in the file
+   * @param [in] ephemeris_time_s: Ephemeris time from J2000 [s]
+   * @param [out] state: Position [m] and velocity [m/s]
+   * @return False when the time is out of the span of the file
+   */
+  bool CalcState(const size_t index, const double ephemeris_time_s, double state[6]) const;
+  /**
+   * @fn ConvertUtcToEphemerisTime_s
+   * @brief Convert UTC to the ephemeris time in the same way with deltet_c of SPICE
+   * @param [in] utc_s: UTC from J2000 [s]
+   * @return Ephemeris time from J2000 [s]
+   */
+  double ConvertUtcToEphemerisTime_s(const double utc_s) const;
+  /**
+   * @fn FindBody
+   * @brief Return index of the body in the file
+   * @param [in] name: Name of the body (case insensitive)
+   * @return Index of the body, or -1 when the body is not found
+   */
+  int FindBody(const std::string name) const;
+
+  // Getter
+  /**
+   * @fn IsLoaded
+   * @brief Return true when the file is loaded
+   */
+  inline bool IsLoaded() const { return header_ != nullptr; }
+  /**
+   * @fn GetNumberOfBodies
+   * @brief Return number of the bodies in the file
+   */
+  inline size_t GetNumberOfBodies() const { return header_->number_of_bodies; }
+  /**
+   * @fn GetStartTime_s
+   * @brief Return start ephemeris time from J2000 [s]
+   */
+  inline double GetStartTime_s() const { return header_->start_time_s; }
+  /**
+   * @fn GetEndTime_s
+   * @brief Return end ephemeris time from J2000 [s]
+   */
+  inline double GetEndTime_s() const { return header_->end_time_s; }
+  /**
+   * @fn GetInertialFrameName
+   * @brief Return definition of inertial frame
+   */
+  inline std::string GetInertialFrameName() const { return header_->inertial_frame_name; }
+  /**
+   * @fn GetAberrationCorrectionSetting
+   * @brief Return stellar aberration correction setting
+   */
+  inline std::string GetAberrationCorrectionSetting() const { return header_->aberration_correction_setting; }
+  /**
+   * @fn GetCenterBodyName
+   * @brief Return center object name of inertial frame
+   */
+  inline std::string GetCenterBodyName() const { return header_->center_body_name; }
+  /**
+   * @fn GetBodyId
+   * @brief Return SPICE ID of a body
+   * @param [in] index: Index of the body
+   */
+  inline int GetBodyId(const size_t index) const { return bodies_[index].id; }
+  /**
+   * @fn GetBodyName
+   * @brief Return name of a body
+   * @param [in] index: Index of the body
+   */
+  inline std::string GetBodyName(const size_t index) const { return bodies_[index].name; }
+  /**
+   * @fn GetGravityConstant_m3_s2
+   * @brief Return gravity constant of a body [m^3/s^2]
+   * @param [in] index: Index of the body
+   */
+  inline double GetGravityConstant_m3_s2(const size_t index) const { return bodies_[index].gravity_constant_m3_s2; }
+  /**
+   * @fn GetRadii_m
+   * @brief Return planetographic radii of a body [m]
+   * @param [in] index: Index of the body
+   */
+  inline const double* GetRadii_m(const size_t index) const { return bodies_[index].radii_m; }
+
+  static const size_t kMaxNameLength = 32;  //!< Maximum length of the names including the null character
+
+ private:
+  /**
+   * @struct Header
+   * @brief Header of the file
+   */
+  struct Header {
+    char magic[8];                                        //!< Magic "S2EEPH01"
+    uint32_t byte_order_mark;                            //!< Byte order mark
+    uint32_t number_of_bodies;                           //!< Number of bodies
+    double start_time_s;                                 //!< Start ephemeris time from J2000 [s]
+    double end_time_s;                                   //!< End ephemeris time from J2000 [s]
+    char inertial_frame_name[kMaxNameLength];            //!< Definition of inertial frame
+    char aberration_correction_setting[kMaxNameLength];  //!< Stellar aberration correction
+    char center_body_name[kMaxNameLength];               //!< Center object name of inertial frame
+    double delta_t_a_s;                                  //!< Difference between TDT and TAI [s]
+    double k_s;                                          //!< Amplitude of the periodic term [s]
+    double eb;                                           //!< Eccentricity of the Earth-Moon barycenter orbit [-]
+    double m_rad[2];                                     //!< Mean anomaly at J2000 [rad] and its rate [rad/s]
+    uint64_t number_of_leap_seconds;                     //!< Number of the leap seconds table entries
+  };
+  /**
+   * @struct BodyEntry
+   * @brief Entry of the body table
+   */
+  struct BodyEntry {
+    char name[kMaxNameLength];          //!< Name
+    int32_t id;                         //!< SPICE ID
+    uint32_t number_of_coefficients;    //!< Number of Chebyshev coefficients per axis and interval
+    uint64_t number_of_intervals;       //!< Number of intervals
+    double interval_s;                  //!< Interval of a polynomial [s]
+    double gravity_constant_m3_s2;      //!< Gravity constant [m^3/s^2]
+    double radii_m[3];                  //!< Planetographic radii [m]
+    uint64_t coefficients_offset_byte;  //!< Offset of the coefficients from the head of the file [byte]
+  };
+  friend class ChebyshevEphemerisWriter;
+
+  static const uint32_t kByteOrderMark = 0x01020304;  //!< Byte order mark
+
+  MemoryMappedFile mapped_file_;          //!< Mapped file
+  const unsigned char* data_ = nullptr;   //!< Head of the mapped file
+  size_t size_byte_ = 0;                  //!< File size [byte]
+  const Header* header_ = nullptr;        //!< Header
+  const BodyEntry* bodies_ = nullptr;     //!< Body table
+  const double* leap_seconds_ = nullptr;  //!< Leap seconds table
+};
+
+#endif  // S2E_LIBRARY_ORBIT_CHEBYSHEV_EPHEMERIS_HPP_
@@ -0,0 +1,259 @@
+/**
+ * @file eclipse_prediction.cpp
+ * @brief Functions and class to calculate the shadow coefficient and to predict the eclipse events
+ */
+
+#include "eclipse_prediction.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "../math/constants.hpp"
+#include "../numerical_integration/runge_kutta_4.hpp"
+#include "../utilities/macros.hpp"
+
+/**
+ * @fn CalcShadowBoundaryFunctions
+ * @brief Calculate the boundary functions of the occultation without trigonometric functions
+ * @details The angle c between the shadow source and the sun is compared with the sum and the difference of the apparent radii a (sun) and b
+ *          (shadow source) through their cosines. cos(a) and cos(b) are calculated from sin(a) = R_sun / d_sun and sin(b) = R_source / d_source.
+ * @param [in] r_sc2sun_i_m: Position vector of the sun from the spacecraft [m]
+ * @param [in] r_sc2source_i_m: Position vector of the shadow source from the spacecraft [m]
+ * @param [in] sun_radius_m: Radius of the sun [m]
+ * @param [in] source_radius_m: Radius of the shadow source [m]
+ * @param [out] penumbra: cos(c) - cos(a + b), which is positive when the sun is occulted
+ * @param [out] umbra: cos(c) - cos(b - a), which is positive when the sun is totally occulted. -1 when the sun is larger than the shadow source.
+ */
+static void CalcShadowBoundaryFunctions(const libra::Vector<3>& r_sc2sun_i_m, const libra::Vector<3>& r_sc2source_i_m, const double sun_radius_m,
+                                        const double source_radius_m, double& penumbra, double& umbra) {
+  const libra::Vector<3> r_source2sun_i_m = r_sc2sun_i_m - r_sc2source_i_m;
+  const double distance_sc2source_m = r_sc2source_i_m.CalcNorm();
+
+  const double sin_a = std::min(sun_radius_m / r_sc2sun_i_m.CalcNorm(), 1.0);
+  const double sin_b = std::min(source_radius_m / distance_sc2source_m, 1.0);
+  const double cos_a = sqrt(1.0 - sin_a * sin_a);
+  const double cos_b = sqrt(1.0 - sin_b * sin_b);
+  const double cos_c = InnerProduct(r_sc2source_i_m, r_source2sun_i_m) / distance_sc2source_m / r_source2sun_i_m.CalcNorm();
+
+  penumbra = cos_c - (cos_a * cos_b - sin_a * sin_b);
+  if (sin_a <= sin_b) {
+    umbra = cos_c - (cos_a * cos_b + sin_a * sin_b);
+  } else {
+    umbra = -1.0;
+  }
+}
+
+EclipseState JudgeEclipseState(const libra::Vector<3>& r_sc2sun_i_m, const libra::Vector<3>& r_sc2source_i_m, const double sun_radius_m,
+                               const double source_radius_m) {
+  double penumbra, umbra;
+  CalcShadowBoundaryFunctions(r_sc2sun_i_m, r_sc2source_i_m, sun_radius_m, source_radius_m, penumbra, umbra);
+  if (umbra > 0.0) return EclipseState::kUmbra;
+  if (penumbra >= 0.0) return EclipseState::kPenumbra;
+  return EclipseState::kSunlit;
+}
+
+double CalcShadowCoefficient(const libra::Vector<3>& r_sc2sun_i_m, const libra::Vector<3>& r_sc2source_i_m, const double sun_radius_m,
+                             const double source_radius_m) {
+  double penumbra, umbra;
+  CalcShadowBoundaryFunctions(r_sc2sun_i_m, r_sc2source_i_m, sun_radius_m, source_radius_m, penumbra, umbra);
+  if (penumbra < 0.0) return 1.0;  // no occultation takes place
+  if (umbra > 0.0) return 0.0;     // The occultation is total (spacecraft is in umbra)
+
+  const double distance_sat_to_sun = r_sc2sun_i_m.CalcNorm();
+  const double sd_sun = asin(sun_radius_m / distance_sat_to_sun);               // Apparent radius of the sun
+  const double sd_source = asin(source_radius_m / r_sc2source_i_m.CalcNorm());  // Apparent radius of the shadow source
+
+  // Angle of deviation from shadow source center to sun center
+  libra::Vector<3> r_source2sun_i_m = r_sc2sun_i_m - r_sc2source_i_m;
+  const double delta = acos(InnerProduct(r_sc2source_i_m, r_source2sun_i_m) / r_sc2source_i_m.CalcNorm() / r_source2sun_i_m.CalcNorm());
+  // The angle between the center of the sun and the common chord
+  const double x = (delta * delta + sd_sun * sd_sun - sd_source * sd_source) / (2.0 * delta);
+  // The length of the common chord of the apparent solar disk and apparent telestial disk
+  const double y = sqrt(std::max(sd_sun * sd_sun - x * x, 0.0));
+
+  const double a = sd_sun;
+  const double b = sd_source;
+  const double c = delta;
+
+  if (c < fabs(a - b) && a <= b)  // The occultation is total (spacecraft is in umbra)
+  {
+    return 0.0;
+  } else if (c < fabs(a - b) && a > b)  // The occultation is partial but maximum
+  {
+    return 1.0 - (b * b) / (a * a);
+  } else if (fabs(a - b) <= c && c <= (a + b))  // spacecraft is in penumbra
+  {
+    double A = a * a * acos(x / a) + b * b * acos((c - x) / b) - c * y;  // The area of the occulted segment of the apparent solar disk
+    return 1.0 - A / (libra::pi * a * a);
+  }
+  // no occultation takes place
+  return 1.0;
+}
+
+/**
+ * @fn GetStateAfterEvent
+ * @brief Return occultation state after the event
+ */
+static EclipseState GetStateAfterEvent(const EclipseEventType type) {
+  switch (type) {
+    case EclipseEventType::kPenumbraEntry:
+    case EclipseEventType::kUmbraExit:
+      return EclipseState::kPenumbra;
+    case EclipseEventType::kUmbraEntry:
+      return EclipseState::kUmbra;
+    default:
+      return EclipseState::kSunlit;
+  }
+}
+
+EclipsePredictor::EclipsePredictor(const double gravity_constant_m3_s2, const double sun_radius_m, const double source_radius_m,
+                                   const double horizon_s, const double sampling_step_s)
+    : gravity_constant_m3_s2_(gravity_constant_m3_s2),
+      sun_radius_m_(sun_radius_m),
+      source_radius_m_(source_radius_m),
+      horizon_s_(horizon_s),
+      sampling_step_s_(sampling_step_s),
+      sun_position_i_m_(0.0),
+      sun_velocity_i_m_s_(0.0) {}
+
+void EclipsePredictor::Predict(const double time_s, const libra::Vector<3>& position_i_m, const libra::Vector<3>& velocity_i_m_s,
+                               const libra::Vector<3>& sun_position_i_m, const libra::Vector<3>& sun_velocity_i_m_s) {
+  start_time_s_ = time_s;
+  sun_position_i_m_ = sun_position_i_m;
+  sun_velocity_i_m_s_ = sun_velocity_i_m_s;
+  events_.clear();
+
+  // Sample the orbit
+  const size_t number_of_intervals = (size_t)std::max(1.0, ceil(horizon_s_ / sampling_step_s_));
+  libra::Vector<6> state;
+  for (size_t i = 0; i < 3; i++) {
+    state[i] = position_i_m[i];
+    state[i + 3] = velocity_i_m_s[i];
+  }
+  libra::numerical_integration::RungeKutta4<6> numerical_integrator(sampling_step_s_, *this);
+  numerical_integrator.SetState(0.0, state);
+  samples_.resize(number_of_intervals + 1);
+  samples_[0] = state;
+  for (size_t i = 1; i <= number_of_intervals; i++) {
+    numerical_integrator.Integrate();
+    samples_[i] = numerical_integrator.GetState();
+  }
+
+  // Evaluate the boundary functions at all samples
+  std::vector<double> penumbra(number_of_intervals + 1), umbra(number_of_intervals + 1);
+  for (size_t i = 0; i <= number_of_intervals; i++) {
+    libra::Vector<3> position_sample_i_m;
+    for (size_t j = 0; j < 3; j++) position_sample_i_m[j] = samples_[i][j];
+    CalcBoundaryFunctions(sampling_step_s_ * (double)i, position_sample_i_m, penumbra[i], umbra[i]);
+  }
+
+  if (umbra[0] > 0.0) {
+    initial_state_ = EclipseState::kUmbra;
+  } else if (penumbra[0] >= 0.0) {
+    initial_state_ = EclipseState::kPenumbra;
+  } else {
+    initial_state_ = EclipseState::kSunlit;
+  }
+
+  // Find the sign changes
+  for (size_t i = 0; i < number_of_intervals; i++) {
+    if ((penumbra[i] >= 0.0) != (penumbra[i + 1] >= 0.0)) {
+      const EclipseEventType type = penumbra[i + 1] >= 0.0 ? EclipseEventType::kPenumbraEntry : EclipseEventType::kPenumbraExit;
+      events_.push_back(EclipseEvent{start_time_s_ + FindRoot(i, false), type});
+    }
+    if ((umbra[i] > 0.0) != (umbra[i + 1] > 0.0)) {
+      const EclipseEventType type = umbra[i + 1] > 0.0 ? EclipseEventType::kUmbraEntry : EclipseEventType::kUmbraExit;
+      events_.push_back(EclipseEvent{start_time_s_ + FindRoot(i, true), type});
+    }
+  }
+  std::stable_sort(events_.begin(), events_.end(), [](const EclipseEvent& lhs, const EclipseEvent& rhs) { return lhs.time_s < rhs.time_s; });
+  events_.erase(std::remove_if(events_.begin(), events_.end(), [this](const EclipseEvent& event) { return event.time_s > GetEndTime_s(); }),
+                events_.end());
+
+  is_predicted_ = true;
+}
+
+libra::Vector<6> EclipsePredictor::DerivativeFunction(const double time_s, const libra::Vector<6>& state) const {
+  UNUSED(time_s);
+
+  const double r3 = pow(state[0] * state[0] + state[1] * state[1] + state[2] * state[2], 1.5);
+
+  libra::Vector<6> rhs;
+  for (size_t i = 0; i < 3; i++) {
+    rhs[i] = state[i + 3];
+    rhs[i + 3] = -gravity_constant_m3_s2_ / r3 * state[i];
+  }
+  return rhs;
+}
+
+EclipseState EclipsePredictor::GetPredictedState(const double time_s) const {
+  EclipseState state = initial_state_;
+  for (const auto& event : events_) {
+    if (event.time_s > time_s) break;
+    state = GetStateAfterEvent(event.type);
+  }
+  return state;
+}
+
+double EclipsePredictor::GetNextEventTime_s(const double time_s) const {
+  for (const auto& event : events_) {
+    if (event.time_s > time_s) return event.time_s;
+  }
+  return GetEndTime_s();
+}
+
+double EclipsePredictor::GetPreviousEventTime_s(const double time_s) const {
+  double previous_time_s = start_time_s_;
+  for (const auto& event : events_) {
+    if (event.time_s > time_s) break;
+    previous_time_s = event.time_s;
+  }
+  return previous_time_s;
+}
+
+void EclipsePredictor::CalcBoundaryFunctions(const double elapsed_time_s, const libra::Vector<3>& position_i_m, double& penumbra,
+                                             double& umbra) const {
+  const libra::Vector<3> sun_position_i_m = sun_position_i_m_ + elapsed_time_s * sun_velocity_i_m_s_;
+  CalcShadowBoundaryFunctions(sun_position_i_m - position_i_m, -1.0 * position_i_m, sun_radius_m_, source_radius_m_, penumbra, umbra);
+}
+
+libra::Vector<3> EclipsePredictor::InterpolatePosition(const double elapsed_time_s) const {
+  const size_t index = std::min((size_t)(elapsed_time_s / sampling_step_s_), samples_.size() - 2);
+  const double s = elapsed_time_s / sampling_step_s_ - (double)index;
+  const libra::Vector<6>& begin = samples_[index];
+  const libra::Vector<6>& end = samples_[index + 1];
+
+  // Cubic Hermite basis functions
+  const double h00 = (2.0 * s - 3.0) * s * s + 1.0;
+  const double h10 = ((s - 2.0) * s + 1.0) * s;
+  const double h01 = (3.0 - 2.0 * s) * s * s;
+  const double h11 = (s - 1.0) * s * s;
+
+  libra::Vector<3> position_i_m;
+  for (size_t i = 0; i < 3; i++) {
+    position_i_m[i] = h00 * begin[i] + h10 * sampling_step_s_ * begin[i + 3] + h01 * end[i] + h11 * sampling_step_s_ * end[i + 3];
+  }
+  return position_i_m;
+}
+
+double EclipsePredictor::FindRoot(const size_t sample_index, const bool is_umbra) const {
+  double lower_s = sampling_step_s_ * (double)sample_index;
+  double upper_s = lower_s + sampling_step_s_;
+
+  auto is_inside = [this, is_umbra](const double elapsed_time_s) {
+    double penumbra, umbra;
+    CalcBoundaryFunctions(elapsed_time_s, InterpolatePosition(elapsed_time_s), penumbra, umbra);
+    return is_umbra ? umbra > 0.0 : penumbra >= 0.0;
+  };
+
+  const bool is_inside_lower = is_inside(lower_s);
+  while (upper_s - lower_s > kTimeTolerance_s) {
+    const double middle_s = 0.5 * (lower_s + upper_s);
+    if (is_inside(middle_s) == is_inside_lower) {
+      lower_s = middle_s;
+    } else {
+      upper_s = middle_s;
+    }
+  }
+  return 0.5 * (lower_s + upper_s);
+}
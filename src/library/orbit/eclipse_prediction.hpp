@@ -0,0 +1,208 @@
+/**
+ * @file eclipse_prediction.hpp
+ * @brief Functions and class to calculate the shadow coefficient and to predict the eclipse events
+ */
+
+#ifndef S2E_LIBRARY_ORBIT_ECLIPSE_PREDICTION_HPP_
+#define S2E_LIBRARY_ORBIT_ECLIPSE_PREDICTION_HPP_
+
+#include <vector>
+
+#include "../math/vector.hpp"
+#include "../numerical_integration/interface_ode.hpp"
+
+/**
+ * @enum EclipseState
+ * @brief Occultation state of the sun seen from the spacecraft
+ */
+enum class EclipseState {
+  kSunlit,    //!< No occultation
+  kPenumbra,  //!< Partial occultation including the annular occultation
+  kUmbra,     //!< Total occultation
+};
+
+/**
+ * @enum EclipseEventType
+ * @brief Type of the eclipse event
+ */
+enum class EclipseEventType {
+  kPenumbraEntry,  //!< Sunlit to penumbra
+  kUmbraEntry,     //!< Penumbra to umbra
+  kUmbraExit,      //!< Umbra to penumbra
+  kPenumbraExit,   //!< Penumbra to sunlit
+};
+
+/**
+ * @struct EclipseEvent
+ * @brief Predicted eclipse event
+ */
+struct EclipseEvent {
+  double time_s;          //!< Time of the event [s]
+  EclipseEventType type;  //!< Type of the event
+};
+
+/**
+ * @fn JudgeEclipseState
+ * @brief Judge the occultation state without trigonometric functions
+ * @param [in] r_sc2sun_i_m: Position vector of the sun from the spacecraft [m]
+ * @param [in] r_sc2source_i_m: Position vector of the shadow source from the spacecraft [m]
+ * @param [in] sun_radius_m: Radius of the sun [m]
+ * @param [in] source_radius_m: Radius of the shadow source [m]
+ * @return Occultation state
+ */
+EclipseState JudgeEclipseState(const libra::Vector<3>& r_sc2sun_i_m, const libra::Vector<3>& r_sc2source_i_m, const double sun_radius_m,
+                               const double source_radius_m);
+
+/**
+ * @fn CalcShadowCoefficient
+ * @brief Calculate the shadow coefficient (ratio of the visible area of the solar disk)
+ * @note The state is judged without trigonometric functions first, and the overlap area of the apparent disks is calculated only in penumbra
+ * @param [in] r_sc2sun_i_m: Position vector of the sun from the spacecraft [m]
+ * @param [in] r_sc2source_i_m: Position vector of the shadow source from the spacecraft [m]
+ * @param [in] sun_radius_m: Radius of the sun [m]
+ * @param [in] source_radius_m: Radius of the shadow source [m]
+ * @return Shadow coefficient (0: umbra, 1: sunlit)
+ */
+double CalcShadowCoefficient(const libra::Vector<3>& r_sc2sun_i_m, const libra::Vector<3>& r_sc2source_i_m, const double sun_radius_m,
+                             const double source_radius_m);
+
+/**
+ * @class EclipsePredictor
+ * @brief Class to predict the eclipse events of a spacecraft ahead from its orbit
+ * @details The orbit is propagated with the two-body problem around the shadow source, and the sun moves linearly from the shadow source. The
+ *          boundary functions of the penumbra and the umbra are evaluated at equally spaced samples, and the events are found by bisection between
+ *          the samples of the different signs. The orbit between the samples is interpolated with the cubic Hermite polynomial.
+ *          The perturbations are not considered, so the prediction error grows with the horizon. An event shorter than the sampling step
+ *          (e.g. a grazing penumbra) can be missed.
+ */
+class EclipsePredictor : public libra::numerical_integration::InterfaceOde<6> {
+ public:
+  /**
+   * @fn EclipsePredictor
+   * @brief Constructor
+   * @param [in] gravity_constant_m3_s2: Gravity constant of the shadow source [m3/s2]
+   * @param [in] sun_radius_m: Radius of the sun [m]
+   * @param [in] source_radius_m: Radius of the shadow source [m]
+   * @param [in] horizon_s: Time span of the prediction [s]
+   * @param [in] sampling_step_s: Sampling step of the boundary functions [s]
+   */
+  EclipsePredictor(const double gravity_constant_m3_s2, const double sun_radius_m, const double source_radius_m, const double horizon_s,
+                   const double sampling_step_s = kDefaultSamplingStep_s);
+
+  /**
+   * @fn Predict
+   * @brief Predict the eclipse events from the current state
+   * @param [in] time_s: Current time [s]
+   * @param [in] position_i_m: Position of the spacecraft from the shadow source [m]
+   * @param [in] velocity_i_m_s: Velocity of the spacecraft from the shadow source [m/s]
+   * @param [in] sun_position_i_m: Position of the sun from the shadow source [m]
+   * @param [in] sun_velocity_i_m_s: Velocity of the sun from the shadow source [m/s]
+   */
+  void Predict(const double time_s, const libra::Vector<3>& position_i_m, const libra::Vector<3>& velocity_i_m_s,
+               const libra::Vector<3>& sun_position_i_m, const libra::Vector<3>& sun_velocity_i_m_s);
+  /**
+   * @fn Reset
+   * @brief Discard the prediction
+   */
+  inline void Reset() {
+    is_predicted_ = false;
+    events_.clear();
+  }
+
+  // Override InterfaceOde
+  /**
+   * @fn DerivativeFunction
+   * @brief Two-body problem around the shadow source
+   * @param [in] time_s: Time as independent variable [sec]
+   * @param [in] state: Position and velocity as state vector
+   * @return Differentiated value of state vector
+   */
+  virtual libra::Vector<6> DerivativeFunction(const double time_s, const libra::Vector<6>& state) const;
+
+  // Getter
+  /**
+   * @fn GetIsPredicted
+   * @brief Return true when the prediction has been executed
+   */
+  inline bool GetIsPredicted() const { return is_predicted_; }
+  /**
+   * @fn GetStartTime_s
+   * @brief Return start time of the prediction [s]
+   */
+  inline double GetStartTime_s() const { return start_time_s_; }
+  /**
+   * @fn GetEndTime_s
+   * @brief Return end time of the prediction [s]
+   */
+  inline double GetEndTime_s() const { return start_time_s_ + horizon_s_; }
+  /**
+   * @fn GetEvents
+   * @brief Return predicted events in chronological order
+   */
+  inline const std::vector<EclipseEvent>& GetEvents() const { return events_; }
+  /**
+   * @fn GetPredictedState
+   * @brief Return predicted occultation state at the time
+   * @param [in] time_s: Time [s]
+   */
+  EclipseState GetPredictedState(const double time_s) const;
+  /**
+   * @fn GetNextEventTime_s
+   * @brief Return time of the first event after the time, or the end time of the prediction when no event is predicted [s]
+   * @param [in] time_s: Time [s]
+   */
+  double GetNextEventTime_s(const double time_s) const;
+  /**
+   * @fn GetPreviousEventTime_s
+   * @brief Return time of the last event at or before the time, or the start time of the prediction when no event is predicted [s]
+   * @param [in] time_s: Time [s]
+   */
+  double GetPreviousEventTime_s(const double time_s) const;
+
+  static constexpr double kDefaultSamplingStep_s = 10.0;  //!< Default sampling step [s]
+  static constexpr double kTimeTolerance_s = 1.0e-3;      //!< Tolerance of the event time [s]
+
+ private:
+  double gravity_constant_m3_s2_;  //!< Gravity constant of the shadow source [m3/s2]
+  double sun_radius_m_;            //!< Radius of the sun [m]
+  double source_radius_m_;         //!< Radius of the shadow source [m]
+  double horizon_s_;               //!< Time span of the prediction [s]
+  double sampling_step_s_;         //!< Sampling step of the boundary functions [s]
+
+  bool is_predicted_ = false;                           //!< Flag of the prediction
+  double start_time_s_ = 0.0;                           //!< Start time of the prediction [s]
+  EclipseState initial_state_ = EclipseState::kSunlit;  //!< Occultation state at the start time
+  std::vector<EclipseEvent> events_;                    //!< Predicted events
+
+  // Work area of the prediction
+  std::vector<libra::Vector<6>> samples_;  //!< Sampled position and velocity of the spacecraft
+  libra::Vector<3> sun_position_i_m_;      //!< Position of the sun from the shadow source at the start time [m]
+  libra::Vector<3> sun_velocity_i_m_s_;    //!< Velocity of the sun from the shadow source [m/s]
+
+  /**
+   * @fn CalcBoundaryFunctions
+   * @brief Calculate the boundary functions which are positive in penumbra (or umbra) and in umbra
+   * @param [in] elapsed_time_s: Elapsed time from the start time [s]
+   * @param [in] position_i_m: Position of the spacecraft from the shadow source [m]
+   * @param [out] penumbra: Boundary function of the penumbra
+   * @param [out] umbra: Boundary function of the umbra
+   */
+  void CalcBoundaryFunctions(const double elapsed_time_s, const libra::Vector<3>& position_i_m, double& penumbra, double& umbra) const;
+  /**
+   * @fn InterpolatePosition
+   * @brief Interpolate the sampled positions with the cubic Hermite polynomial
+   * @param [in] elapsed_time_s: Elapsed time from the start time [s]
+   * @return Position of the spacecraft from the shadow source [m]
+   */
+  libra::Vector<3> InterpolatePosition(const double elapsed_time_s) const;
+  /**
+   * @fn FindRoot
+   * @brief Find the time where the boundary function changes its sign by bisection
+   * @param [in] sample_index: Index of the sample before the sign change
+   * @param [in] is_umbra: Use the boundary function of the umbra when true
+   * @return Elapsed time from the start time [s]
+   */
+  double FindRoot(const size_t sample_index, const bool is_umbra) const;
+};
+
+#endif  // S2E_LIBRARY_ORBIT_ECLIPSE_PREDICTION_HPP_
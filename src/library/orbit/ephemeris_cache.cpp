@@ -0,0 +1,131 @@
+/**
+ * @file ephemeris_cache.cpp
+ * @brief Class to cache the ephemeris of a body and interpolate it between sampled nodes
+ */
+
+#include "ephemeris_cache.hpp"
+
+#include <cmath>
+
+EphemerisCache::EphemerisCache(const SampleFunction& sample_function, const double tolerance_m, const size_t number_of_nodes,
+                               const size_t number_of_prefetch_nodes)
+    : sample_function_(sample_function),
+      tolerance_m_(tolerance_m),
+      number_of_nodes_(number_of_nodes),
+      number_of_prefetch_nodes_(number_of_prefetch_nodes) {
+  // The interpolation interval and the prefetched nodes must be kept in the cache
+  if (number_of_nodes_ < number_of_prefetch_nodes_ + 3) number_of_nodes_ = number_of_prefetch_nodes_ + 3;
+  states_.assign(number_of_nodes_ * 6, 0.0);
+}
+
+void EphemerisCache::GetState(const double time_s, double state[6]) {
+  if (!is_initialized_ || is_reset_requested_) Reset(time_s);
+
+  long node_index = (long)floor((time_s - origin_s_) / step_s_);
+  if (node_index < first_node_index_ || node_index > last_node_index_ + (long)number_of_nodes_) {
+    // Out of the cache window
+    Reset(time_s);
+    node_index = (long)floor((time_s - origin_s_) / step_s_);
+  }
+
+  // Nodes for the interpolation
+  while (last_node_index_ < node_index + 1) AppendNode();
+  // Nodes ahead of the time, one node per request to spread the sampling cost
+  if (last_node_index_ < node_index + 1 + (long)number_of_prefetch_nodes_) AppendNode();
+
+  const double tau = (time_s - origin_s_) / step_s_ - (double)node_index;
+  const double* state_0 = &states_[(node_index % number_of_nodes_) * 6];
+  const double* state_1 = &states_[((node_index + 1) % number_of_nodes_) * 6];
+  InterpolateHermite(state_0, state_1, step_s_, tau, state);
+}
+
+void EphemerisCache::Reset(const double time_s) {
+  double state_0[6], state_1[6], state_tmp[6];
+  Sample(time_s, state_0);
+
+  // The error of the cubic Hermite interpolation is proportional to step^4.
+  // A half of the tolerance is used as the target since the error changes along the orbit.
+  const double target_error_m = 0.5 * tolerance_m_;
+  double step_s = is_initialized_ ? step_s_ : kInitialStep_s;
+  Sample(time_s + step_s, state_1);
+  double error_m = CalcMidpointError_m(time_s, step_s, state_0, state_1);
+  if (error_m > target_error_m) {
+    while (error_m > target_error_m && step_s * 0.5 >= kMinStep_s) {
+      step_s *= 0.5;
+      Sample(time_s + step_s, state_1);
+      error_m = CalcMidpointError_m(time_s, step_s, state_0, state_1);
+    }
+  } else {
+    while (step_s * 2.0 <= kMaxStep_s) {
+      Sample(time_s + step_s * 2.0, state_tmp);
+      if (CalcMidpointError_m(time_s, step_s * 2.0, state_0, state_tmp) > target_error_m) break;
+      step_s *= 2.0;
+      for (size_t i = 0; i < 6; i++) state_1[i] = state_tmp[i];
+    }
+  }
+
+  step_s_ = step_s;
+  origin_s_ = time_s;
+  first_node_index_ = 0;
+  last_node_index_ = 1;
+  for (size_t i = 0; i < 6; i++) {
+    states_[i] = state_0[i];
+    states_[6 + i] = state_1[i];
+  }
+  nodes_since_check_ = 0;
+  is_initialized_ = true;
+  is_reset_requested_ = false;
+}
+
+void EphemerisCache::Sample(const double time_s, double state[6]) {
+  sample_function_(time_s, state);
+  number_of_samples_++;
+}
+
+void EphemerisCache::AppendNode() {
+  const long node_index = last_node_index_ + 1;
+  double* state = &states_[(node_index % number_of_nodes_) * 6];
+  Sample(origin_s_ + step_s_ * (double)node_index, state);
+  last_node_index_ = node_index;
+  if (last_node_index_ - first_node_index_ >= (long)number_of_nodes_) first_node_index_++;
+
+  // Check the interpolation error once per cache window.
+  // The node spacing is chosen again at the next request when it is not suitable.
+  nodes_since_check_++;
+  if (nodes_since_check_ < number_of_nodes_) return;
+  nodes_since_check_ = 0;
+  const double* state_0 = &states_[((node_index - 1) % number_of_nodes_) * 6];
+  const double error_m = CalcMidpointError_m(origin_s_ + step_s_ * (double)(node_index - 1), step_s_, state_0, state);
+  const bool is_too_large = error_m > tolerance_m_ && step_s_ * 0.5 >= kMinStep_s;
+  const bool is_too_small = error_m < tolerance_m_ / 64.0 && step_s_ * 2.0 <= kMaxStep_s;
+  if (is_too_large || is_too_small) is_reset_requested_ = true;
+}
+
+double EphemerisCache::CalcMidpointError_m(const double time_s, const double step_s, const double state_0[6], const double state_1[6]) {
+  double sampled[6], interpolated[6];
+  Sample(time_s + 0.5 * step_s, sampled);
+  InterpolateHermite(state_0, state_1, step_s, 0.5, interpolated);
+  double error_m2 = 0.0;
+  for (size_t i = 0; i < 3; i++) error_m2 += pow(sampled[i] - interpolated[i], 2.0);
+  return sqrt(error_m2);
+}
+
+void EphemerisCache::InterpolateHermite(const double state_0[6], const double state_1[6], const double step_s, const double tau, double state[6]) {
+  const double tau2 = tau * tau;
+  const double tau3 = tau2 * tau;
+  // Basis functions and their derivatives
+  const double h00 = 2.0 * tau3 - 3.0 * tau2 + 1.0;
+  const double h10 = tau3 - 2.0 * tau2 + tau;
+  const double h01 = -2.0 * tau3 + 3.0 * tau2;
+  const double h11 = tau3 - tau2;
+  const double dh00 = 6.0 * tau2 - 6.0 * tau;
+  const double dh10 = 3.0 * tau2 - 4.0 * tau + 1.0;
+  const double dh01 = -6.0 * tau2 + 6.0 * tau;
+  const double dh11 = 3.0 * tau2 - 2.0 * tau;
+
+  for (size_t i = 0; i < 3; i++) {
+    const double p0 = state_0[i], v0 = state_0[i + 3], p1 = state_1[i], v1 = state_1[i + 3];
+    state[i] = h00 * p0 + h10 * step_s * v0 + h01 * p1 + h11 * step_s * v1;
+    state[i + 3] = (dh00 * p0 + dh01 * p1) / step_s + dh10 * v0 + dh11 * v1;
+  }
+}
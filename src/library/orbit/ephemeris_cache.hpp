@@ -0,0 +1,118 @@
+/**
+ * @file ephemeris_cache.hpp
+ * @brief Class to cache the ephemeris of a body and interpolate it between sampled nodes
+ */
+
+#ifndef S2E_LIBRARY_ORBIT_EPHEMERIS_CACHE_HPP_
+#define S2E_LIBRARY_ORBIT_EPHEMERIS_CACHE_HPP_
+
+#include <functional>
+#include <vector>
+
+/**
+ * @class EphemerisCache
+ * @brief Class to cache the ephemeris of a body and interpolate it between sampled nodes
+ * @details The ephemeris is sampled at equally spaced nodes, and the position and velocity are interpolated with the cubic Hermite polynomial
+ *          of the positions and velocities of the neighboring nodes. The node spacing is chosen so that the interpolation error of the position is
+ *          smaller than the tolerance. The nodes ahead of the requested time are sampled in advance, one node per request.
+ */
+class EphemerisCache {
+ public:
+  /**
+   * @brief Function to sample the ephemeris
+   * @param [in] time_s: Time [s]
+   * @param [out] state: Position [m] and velocity [m/s]
+   */
+  using SampleFunction = std::function<void(const double time_s, double state[6])>;
+
+  /**
+   * @fn EphemerisCache
+   * @brief Constructor
+   * @param [in] sample_function: Function to sample the ephemeris
+   * @param [in] tolerance_m: Tolerance of the interpolation error of position [m]
+   * @param [in] number_of_nodes: Number of nodes kept in the cache
+   * @param [in] number_of_prefetch_nodes: Number of nodes sampled ahead of the requested time
+   */
+  EphemerisCache(const SampleFunction& sample_function, const double tolerance_m, const size_t number_of_nodes = 16,
+                 const size_t number_of_prefetch_nodes = 4);
+
+  /**
+   * @fn GetState
+   * @brief Return interpolated position and velocity
+   * @param [in] time_s: Time [s]
+   * @param [out] state: Position [m] and velocity [m/s]
+   */
+  void GetState(const double time_s, double state[6]);
+
+  // Getter
+  /**
+   * @fn GetStep_s
+   * @brief Return node spacing [s]
+   */
+  inline double GetStep_s() const { return step_s_; }
+  /**
+   * @fn GetNumberOfSamples
+   * @brief Return number of sampling executed since the construction
+   */
+  inline size_t GetNumberOfSamples() const { return number_of_samples_; }
+
+  static constexpr double kInitialStep_s = 3600.0;  //!< Initial node spacing for the step size search [s]
+  static constexpr double kMinStep_s = 1.0;         //!< Minimum node spacing [s]
+  static constexpr double kMaxStep_s = 86400.0;     //!< Maximum node spacing [s]
+
+ private:
+  SampleFunction sample_function_;   //!< Function to sample the ephemeris
+  double tolerance_m_;               //!< Tolerance of the interpolation error of position [m]
+  size_t number_of_nodes_;           //!< Number of nodes kept in the cache
+  size_t number_of_prefetch_nodes_;  //!< Number of nodes sampled ahead of the requested time
+
+  bool is_initialized_ = false;      //!< Flag of the cache initialization
+  bool is_reset_requested_ = false;  //!< Flag to choose the node spacing again at the next request
+  double step_s_ = kInitialStep_s;   //!< Node spacing [s]
+  double origin_s_ = 0.0;            //!< Time of the node index 0 [s]
+  long first_node_index_ = 0;        //!< Index of the oldest node in the cache
+  long last_node_index_ = -1;        //!< Index of the newest node in the cache
+  std::vector<double> states_;       //!< Ring buffer of the node states
+  size_t number_of_samples_ = 0;     //!< Number of sampling
+  size_t nodes_since_check_ = 0;     //!< Number of nodes sampled since the last check of the interpolation error
+
+  /**
+   * @fn Reset
+   * @brief Choose the node spacing around the time and clear the nodes
+   * @param [in] time_s: Time [s]
+   */
+  void Reset(const double time_s);
+  /**
+   * @fn Sample
+   * @brief Sample the ephemeris
+   * @param [in] time_s: Time [s]
+   * @param [out] state: Position [m] and velocity [m/s]
+   */
+  void Sample(const double time_s, double state[6]);
+  /**
+   * @fn AppendNode
+   * @brief Sample the next node and append it into the ring buffer
+   */
+  void AppendNode();
+  /**
+   * @fn CalcMidpointError_m
+   * @brief Return the interpolation error of the position at the midpoint of the nodes [m]
+   * @param [in] time_s: Time of the first node [s]
+   * @param [in] step_s: Node spacing [s]
+   * @param [in] state_0: State of the first node
+   * @param [in] state_1: State of the second node
+   */
+  double CalcMidpointError_m(const double time_s, const double step_s, const double state_0[6], const double state_1[6]);
+  /**
+   * @fn InterpolateHermite
+   * @brief Interpolate the state with the cubic Hermite polynomial
+   * @param [in] state_0: State of the first node
+   * @param [in] state_1: State of the second node
+   * @param [in] step_s: Node spacing [s]
+   * @param [in] tau: Normalized time from the first node (0 to 1)
+   * @param [out] state: Interpolated state
+   */
+  static void InterpolateHermite(const double state_0[6], const double state_1[6], const double step_s, const double tau, double state[6]);
+};
+
+#endif  // S2E_LIBRARY_ORBIT_EPHEMERIS_CACHE_HPP_
@@ -0,0 +1,138 @@
+/**
+ * @file test_chebyshev_ephemeris.cpp
+ * @brief Test codes for ChebyshevEphemeris class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdio>
+
+#include "chebyshev_ephemeris.hpp"
+
+/**
+ * @brief Circular orbit similar to the Moon around the Earth
+ */
+static void SampleCircularOrbit(const double time_s, double state[6]) {
+  const double radius_m = 3.844e8;
+  const double angular_velocity_rad_s = 2.6617e-6;
+  const double angle_rad = angular_velocity_rad_s * time_s;
+  state[0] = radius_m * cos(angle_rad);
+  state[1] = radius_m * sin(angle_rad);
+  state[2] = 0.1 * radius_m * sin(angle_rad);
+  state[3] = -radius_m * angular_velocity_rad_s * sin(angle_rad);
+  state[4] = radius_m * angular_velocity_rad_s * cos(angle_rad);
+  state[5] = 0.1 * radius_m * angular_velocity_rad_s * cos(angle_rad);
+}
+
+/**
+ * @brief Test for writing, mapping, and evaluating the file
+ */
+TEST(ChebyshevEphemeris, WriteAndRead) {
+  const std::string file_path = "test_chebyshev_ephemeris.bin";
+  const double start_time_s = 6.3e8;
+  const double end_time_s = start_time_s + 30.0 * 86400.0;
+  const double tolerance_m = 0.1;
+  const double radii_m[3] = {1738.1e3, 1738.1e3, 1736.0e3};
+
+  ChebyshevEphemerisTimeSystem time_system;
+  time_system.leap_seconds = {36.0, 4.3e8, 37.0, 5.36e8};
+  ChebyshevEphemerisWriter writer(start_time_s, end_time_s, "J2000", "NONE", "EARTH", time_system);
+  const double fitting_error_m = writer.AddBody(301, "moon", 4.9028e12, radii_m, SampleCircularOrbit, tolerance_m);
+  EXPECT_LT(fitting_error_m, tolerance_m);
+  EXPECT_LT(writer.GetInterval_s(0), end_time_s - start_time_s);
+  ASSERT_TRUE(writer.Write(file_path));
+
+  {
+    ChebyshevEphemeris ephemeris(file_path);
+    ASSERT_TRUE(ephemeris.IsLoaded());
+    EXPECT_EQ(1u, ephemeris.GetNumberOfBodies());
+    EXPECT_EQ("J2000", ephemeris.GetInertialFrameName());
+    EXPECT_EQ("NONE", ephemeris.GetAberrationCorrectionSetting());
+    EXPECT_EQ("EARTH", ephemeris.GetCenterBodyName());
+    EXPECT_EQ(0, ephemeris.FindBody("Moon"));
+    EXPECT_EQ(-1, ephemeris.FindBody("SUN"));
+    EXPECT_EQ(301, ephemeris.GetBodyId(0));
+    EXPECT_DOUBLE_EQ(4.9028e12, ephemeris.GetGravityConstant_m3_s2(0));
+    EXPECT_DOUBLE_EQ(radii_m[2], ephemeris.GetRadii_m(0)[2]);
+
+    for (size_t i = 0; i <= 1000; i++) {
+      const double time_s = start_time_s + (end_time_s - start_time_s) * (double)i / 1000.0;
+      double state[6], reference[6];
+      EXPECT_TRUE(ephemeris.CalcState(0, time_s, state));
+      SampleCircularOrbit(time_s, reference);
+      for (size_t j = 0; j < 3; j++) {
+        EXPECT_NEAR(reference[j], state[j], tolerance_m);
+        EXPECT_NEAR(reference[j + 3], state[j + 3], 1.0e-4);
+      }
+    }
+    double state[6];
+    EXPECT_FALSE(ephemeris.CalcState(0, end_time_s + 100.0, state));
+
+    // ET - UTC = 69.184 s (+- periodic term smaller than 2 ms) after 2017
+    EXPECT_NEAR(start_time_s + 69.184, ephemeris.ConvertUtcToEphemerisTime_s(start_time_s), 2.0e-3);
+    EXPECT_NEAR(5.0e8 + 68.184, ephemeris.ConvertUtcToEphemerisTime_s(5.0e8), 2.0e-3);
+  }
+  std::remove(file_path.c_str());
+}
+
+/**
+ * @brief Position of SampleCircularOrbit without the velocity, which is not used by the fitting
+ */
+static void SampleCircularOrbitPosition(const double time_s, double state[6]) {
+  SampleCircularOrbit(time_s, state);
+  for (size_t i = 3; i < 6; i++) state[i] = 0.0;
+}
+
+/**
+ * @brief Test for the velocity compared with the derivative of the fitted position
+ */
+TEST(ChebyshevEphemeris, Velocity) {
+  const std::string file_path = "test_chebyshev_ephemeris_velocity.bin";
+  const double start_time_s = 6.3e8;
+  const double end_time_s = start_time_s + 30.0 * 86400.0;
+  const double radii_m[3] = {1738.1e3, 1738.1e3, 1736.0e3};
+
+  ChebyshevEphemerisTimeSystem time_system;
+  ChebyshevEphemerisWriter writer(start_time_s, end_time_s, "J2000", "NONE", "EARTH", time_system);
+  writer.AddBody(301, "MOON", 4.9028e12, radii_m, SampleCircularOrbitPosition, 0.01);
+  const double interval_s = writer.GetInterval_s(0);
+  ASSERT_TRUE(writer.Write(file_path));
+
+  {
+    ChebyshevEphemeris ephemeris(file_path);
+    ASSERT_TRUE(ephemeris.IsLoaded());
+    // The central difference is evaluated in the middle of each polynomial interval
+    const double step_s = 10.0;
+    size_t number_of_checked_times = 0;
+    for (double time_s = start_time_s + 0.5 * interval_s; time_s < end_time_s; time_s += interval_s) {
+      double state[6], forward_state[6], backward_state[6], reference[6];
+      ASSERT_TRUE(ephemeris.CalcState(0, time_s, state));
+      ASSERT_TRUE(ephemeris.CalcState(0, time_s + step_s, forward_state));
+      ASSERT_TRUE(ephemeris.CalcState(0, time_s - step_s, backward_state));
+      SampleCircularOrbit(time_s, reference);
+      for (size_t j = 0; j < 3; j++) {
+        EXPECT_NEAR((forward_state[j] - backward_state[j]) / (2.0 * step_s), state[j + 3], 1.0e-6);
+        EXPECT_NEAR(reference[j + 3], state[j + 3], 1.0e-4);
+      }
+      number_of_checked_times++;
+    }
+    EXPECT_GT(number_of_checked_times, 1u);
+  }
+  std::remove(file_path.c_str());
+}
+
+/**
+ * @brief Test for invalid files
+ */
+TEST(ChebyshevEphemeris, InvalidFile) {
+  ChebyshevEphemeris not_found("test_chebyshev_ephemeris_not_found.bin");
+  EXPECT_FALSE(not_found.IsLoaded());
+
+  const std::string file_path = "test_chebyshev_ephemeris_invalid.bin";
+  FILE* file = fopen(file_path.c_str(), "wb");
+  fputs("This is not an ephemeris file.", file);
+  fclose(file);
+  ChebyshevEphemeris invalid(file_path);
+  EXPECT_FALSE(invalid.IsLoaded());
+  std::remove(file_path.c_str());
+}
@@ -0,0 +1,117 @@
+/**
+ * @file test_eclipse_prediction.cpp
+ * @brief Test codes for the shadow coefficient and EclipsePredictor class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "eclipse_prediction.hpp"
+
+static const double kSunRadius_m = 6.96e8;
+static const double kEarthRadius_m = 6.378137e6;
+static const double kEarthGravityConstant_m3_s2 = 3.986004418e14;
+static const double kAstronomicalUnit_m = 1.495978707e11;
+static const double kOrbitRadius_m = 7.0e6;
+
+/**
+ * @brief Position of a spacecraft on the circular equatorial orbit from the Earth
+ */
+static libra::Vector<3> CalcCircularOrbitPosition(const double time_s) {
+  const double angular_velocity_rad_s = sqrt(kEarthGravityConstant_m3_s2 / pow(kOrbitRadius_m, 3.0));
+  libra::Vector<3> position_i_m(0.0);
+  position_i_m[0] = kOrbitRadius_m * cos(angular_velocity_rad_s * time_s);
+  position_i_m[1] = kOrbitRadius_m * sin(angular_velocity_rad_s * time_s);
+  return position_i_m;
+}
+
+/**
+ * @brief Occultation state of the spacecraft on the circular orbit when the sun is on the +X axis
+ */
+static EclipseState JudgeCircularOrbitState(const double time_s) {
+  libra::Vector<3> sun_position_i_m(0.0);
+  sun_position_i_m[0] = kAstronomicalUnit_m;
+  const libra::Vector<3> position_i_m = CalcCircularOrbitPosition(time_s);
+  return JudgeEclipseState(sun_position_i_m - position_i_m, -1.0 * position_i_m, kSunRadius_m, kEarthRadius_m);
+}
+
+/**
+ * @brief Test for the shadow coefficient along the orbit
+ */
+TEST(EclipsePrediction, ShadowCoefficient) {
+  libra::Vector<3> sun_position_i_m(0.0);
+  sun_position_i_m[0] = kAstronomicalUnit_m;
+
+  double previous_coefficient = 1.0;
+  size_t number_of_penumbra_samples = 0;
+  for (size_t i = 0; i <= 5800; i++) {
+    // From the sunlit side to the center of the shadow
+    const double time_s = 0.5 * (double)i;
+    const libra::Vector<3> position_i_m = CalcCircularOrbitPosition(time_s);
+    const double coefficient = CalcShadowCoefficient(sun_position_i_m - position_i_m, -1.0 * position_i_m, kSunRadius_m, kEarthRadius_m);
+    const EclipseState state = JudgeCircularOrbitState(time_s);
+
+    EXPECT_LE(coefficient, previous_coefficient);
+    if (state == EclipseState::kSunlit) {
+      EXPECT_DOUBLE_EQ(1.0, coefficient);
+    } else if (state == EclipseState::kUmbra) {
+      EXPECT_DOUBLE_EQ(0.0, coefficient);
+    } else {
+      EXPECT_LE(0.0, coefficient);
+      EXPECT_GE(1.0, coefficient);
+      number_of_penumbra_samples++;
+    }
+    previous_coefficient = coefficient;
+  }
+  EXPECT_DOUBLE_EQ(0.0, previous_coefficient);
+  // The penumbra of LEO lasts several seconds
+  EXPECT_LT(0u, number_of_penumbra_samples);
+  EXPECT_GT(60u, number_of_penumbra_samples);
+}
+
+/**
+ * @brief Test for the predicted events
+ */
+TEST(EclipsePrediction, Events) {
+  const double orbit_period_s = 2.0 * M_PI * sqrt(pow(kOrbitRadius_m, 3.0) / kEarthGravityConstant_m3_s2);
+  const double start_time_s = 100.0;
+  EclipsePredictor predictor(kEarthGravityConstant_m3_s2, kSunRadius_m, kEarthRadius_m, orbit_period_s);
+  EXPECT_FALSE(predictor.GetIsPredicted());
+
+  const double angular_velocity_rad_s = 2.0 * M_PI / orbit_period_s;
+  libra::Vector<3> velocity_i_m_s(0.0);
+  velocity_i_m_s[1] = kOrbitRadius_m * angular_velocity_rad_s;
+  libra::Vector<3> sun_position_i_m(0.0);
+  sun_position_i_m[0] = kAstronomicalUnit_m;
+  predictor.Predict(start_time_s, CalcCircularOrbitPosition(0.0), velocity_i_m_s, sun_position_i_m, libra::Vector<3>(0.0));
+  EXPECT_TRUE(predictor.GetIsPredicted());
+
+  const std::vector<EclipseEvent>& events = predictor.GetEvents();
+  ASSERT_EQ(4u, events.size());
+  EXPECT_EQ(EclipseEventType::kPenumbraEntry, events[0].type);
+  EXPECT_EQ(EclipseEventType::kUmbraEntry, events[1].type);
+  EXPECT_EQ(EclipseEventType::kUmbraExit, events[2].type);
+  EXPECT_EQ(EclipseEventType::kPenumbraExit, events[3].type);
+
+  // Compare with the state on the analytical orbit around the event
+  const double margin_s = 0.05;
+  for (const auto& event : events) {
+    const double elapsed_time_s = event.time_s - start_time_s;
+    EXPECT_EQ(predictor.GetPredictedState(event.time_s - margin_s), JudgeCircularOrbitState(elapsed_time_s - margin_s));
+    EXPECT_EQ(predictor.GetPredictedState(event.time_s + margin_s), JudgeCircularOrbitState(elapsed_time_s + margin_s));
+  }
+  // The events are symmetric with respect to the anti-sun direction
+  EXPECT_NEAR(0.5 * orbit_period_s, 0.5 * (events[0].time_s + events[3].time_s) - start_time_s, margin_s);
+  EXPECT_NEAR(0.5 * orbit_period_s, 0.5 * (events[1].time_s + events[2].time_s) - start_time_s, margin_s);
+
+  EXPECT_EQ(EclipseState::kSunlit, predictor.GetPredictedState(start_time_s));
+  EXPECT_DOUBLE_EQ(events[0].time_s, predictor.GetNextEventTime_s(start_time_s));
+  EXPECT_DOUBLE_EQ(events[2].time_s, predictor.GetNextEventTime_s(events[1].time_s));
+  EXPECT_DOUBLE_EQ(predictor.GetEndTime_s(), predictor.GetNextEventTime_s(events[3].time_s));
+  EXPECT_DOUBLE_EQ(start_time_s, predictor.GetPreviousEventTime_s(start_time_s));
+  EXPECT_DOUBLE_EQ(events[1].time_s, predictor.GetPreviousEventTime_s(events[1].time_s));
+
+  predictor.Reset();
+  EXPECT_FALSE(predictor.GetIsPredicted());
+  EXPECT_EQ(0u, predictor.GetEvents().size());
+}
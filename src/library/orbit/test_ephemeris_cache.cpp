@@ -0,0 +1,69 @@
+/**
+ * @file test_ephemeris_cache.cpp
+ * @brief Test codes for EphemerisCache class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "ephemeris_cache.hpp"
+
+/**
+ * @brief Circular orbit similar to the Moon around the Earth
+ */
+static void SampleCircularOrbit(const double time_s, double state[6]) {
+  const double radius_m = 3.844e8;
+  const double angular_velocity_rad_s = 2.6617e-6;
+  const double angle_rad = angular_velocity_rad_s * time_s;
+  state[0] = radius_m * cos(angle_rad);
+  state[1] = radius_m * sin(angle_rad);
+  state[2] = 0.1 * radius_m * sin(angle_rad);
+  state[3] = -radius_m * angular_velocity_rad_s * sin(angle_rad);
+  state[4] = radius_m * angular_velocity_rad_s * cos(angle_rad);
+  state[5] = 0.1 * radius_m * angular_velocity_rad_s * cos(angle_rad);
+}
+
+/**
+ * @brief Test for interpolation accuracy and number of sampling
+ */
+TEST(EphemerisCache, Accuracy) {
+  const double tolerance_m = 1.0;
+  EphemerisCache cache(SampleCircularOrbit, tolerance_m);
+
+  const double step_s = 60.0;
+  const size_t number_of_steps = 30 * 24 * 60;  // 30 days
+  double max_position_error_m = 0.0;
+  double max_velocity_error_m_s = 0.0;
+  for (size_t i = 0; i < number_of_steps; i++) {
+    const double time_s = 1.0e8 + step_s * (double)i;
+    double state[6], reference[6];
+    cache.GetState(time_s, state);
+    SampleCircularOrbit(time_s, reference);
+    const double position_error_m = sqrt(pow(state[0] - reference[0], 2.0) + pow(state[1] - reference[1], 2.0) + pow(state[2] - reference[2], 2.0));
+    const double velocity_error_m_s = sqrt(pow(state[3] - reference[3], 2.0) + pow(state[4] - reference[4], 2.0) + pow(state[5] - reference[5], 2.0));
+    max_position_error_m = fmax(max_position_error_m, position_error_m);
+    max_velocity_error_m_s = fmax(max_velocity_error_m_s, velocity_error_m_s);
+  }
+  EXPECT_LT(max_position_error_m, tolerance_m);
+  EXPECT_LT(max_velocity_error_m_s, 1.0e-3);
+  EXPECT_GT(cache.GetStep_s(), step_s);
+  EXPECT_LT(cache.GetNumberOfSamples(), number_of_steps / 10);
+}
+
+/**
+ * @brief Test for requests out of the cache window
+ */
+TEST(EphemerisCache, Jump) {
+  const double tolerance_m = 1.0;
+  EphemerisCache cache(SampleCircularOrbit, tolerance_m);
+
+  const double times_s[] = {0.0, 100.0, 1.0e7, 50.0, -1.0e6, 1.0e7 + 10.0};
+  for (double time_s : times_s) {
+    double state[6], reference[6];
+    cache.GetState(time_s, state);
+    SampleCircularOrbit(time_s, reference);
+    for (size_t i = 0; i < 3; i++) {
+      EXPECT_NEAR(reference[i], state[i], tolerance_m);
+    }
+  }
+}
@@ -5,7 +5,7 @@
 
 #include "global_randomization.hpp"
 
-GlobalRandomization global_randomization;
+thread_local GlobalRandomization global_randomization;
 
 GlobalRandomization::GlobalRandomization() { seed_ = 0xdeadbeef; }
 
@@ -21,4 +21,14 @@ long GlobalRandomization::MakeSeed() {
     seed = 0xdeadbeef;
   }
   return seed;
-}
\ No newline at end of file
+}
+
+void GlobalRandomization::SaveSnapshot(Snapshot& snapshot) const {
+  snapshot.Write(base_randomizer_);
+  snapshot.Write(seed_);
+}
+
+void GlobalRandomization::RestoreSnapshot(Snapshot& snapshot) {
+  snapshot.Read(base_randomizer_);
+  snapshot.Read(seed_);
+}
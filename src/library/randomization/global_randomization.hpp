@@ -6,6 +6,8 @@
 #ifndef S2E_LIBRARY_RANDOMIZATION_GLOBAL_RANDOMIZATION_HPP_
 #define S2E_LIBRARY_RANDOMIZATION_GLOBAL_RANDOMIZATION_HPP_
 
+#include <library/utilities/snapshot.hpp>
+
 #include "./minimal_standard_linear_congruential_generator.hpp"
 
 /**
@@ -31,12 +33,23 @@ class GlobalRandomization {
    */
   long MakeSeed();
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the state of the randomization into the snapshot
+   */
+  void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the state of the randomization from the snapshot
+   */
+  void RestoreSnapshot(Snapshot& snapshot);
+
  private:
   static const unsigned int kMaxSeed = 0xffffffff;  //!< Maximum value of seed
   libra::MinimalStandardLcg base_randomizer_;       //!< Base of global randomization
   long seed_;                                       //!< Seed of global randomization
 };
 
-extern GlobalRandomization global_randomization;  //!< Global randomization
+extern thread_local GlobalRandomization global_randomization;  //!< Global randomization (owned by each thread for parallel simulation cases)
 
 #endif  // S2E_LIBRARY_RANDOMIZATION_GLOBAL_RANDOMIZATION_HPP_
@@ -8,6 +8,7 @@
 
 #include "../math/ordinary_differential_equation.hpp"
 #include "../math/vector.hpp"
+#include "../utilities/snapshot.hpp"
 #include "./normal_randomization.hpp"
 
 /**
@@ -35,6 +36,17 @@ class RandomWalk : public libra::OrdinaryDifferentialEquation<N> {
    */
   virtual void DerivativeFunction(double x, const libra::Vector<N>& state, libra::Vector<N>& rhs);
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the random walk state and the excitation noise state into the snapshot
+   */
+  void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the random walk state and the excitation noise state from the snapshot
+   */
+  void RestoreSnapshot(Snapshot& snapshot);
+
  private:
   libra::Vector<N> limit_;                  //!< Limit of random walk
   libra::NormalRand normal_randomizer_[N];  //!< Random walk excitation noise
@@ -32,4 +32,21 @@ void RandomWalk<N>::DerivativeFunction(double x, const libra::Vector<N>& state,
   }
 }
 
+template <size_t N>
+void RandomWalk<N>::SaveSnapshot(Snapshot& snapshot) const {
+  snapshot.Write(this->GetIndependentVariable());
+  snapshot.Write(this->GetState());
+  snapshot.WriteArray(normal_randomizer_, N);
+}
+
+template <size_t N>
+void RandomWalk<N>::RestoreSnapshot(Snapshot& snapshot) {
+  double independent_variable = this->GetIndependentVariable();
+  libra::Vector<N> state = this->GetState();
+  snapshot.Read(independent_variable);
+  snapshot.Read(state);
+  this->Setup(independent_variable, state);
+  snapshot.ReadArray(normal_randomizer_, N);
+}
+
 #endif  // S2E_LIBRARY_RANDOMIZATION_RANDOM_WALK_TEMPLATE_FUNCTIONS_HPP_
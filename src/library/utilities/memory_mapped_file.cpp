@@ -0,0 +1,68 @@
+/**
+ * @file memory_mapped_file.cpp
+ * @brief Class to map a file into the memory read-only
+ */
+
+#include "memory_mapped_file.hpp"
+
+#ifdef WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MemoryMappedFile::MemoryMappedFile(const std::string file_path) {
+#ifdef WIN32
+  HANDLE file_handle = CreateFileA(file_path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (file_handle == INVALID_HANDLE_VALUE) return;
+  file_handle_ = file_handle;
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file_handle, &size) || size.QuadPart == 0) {
+    Unmap();
+    return;
+  }
+  HANDLE mapping_handle = CreateFileMappingA(file_handle, NULL, PAGE_READONLY, 0, 0, NULL);
+  if (mapping_handle == NULL) {
+    Unmap();
+    return;
+  }
+  mapping_handle_ = mapping_handle;
+  data_ = (const unsigned char*)MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0);
+  if (data_ == nullptr) {
+    Unmap();
+    return;
+  }
+  size_byte_ = (size_t)size.QuadPart;
+#else
+  const int file_descriptor = open(file_path.c_str(), O_RDONLY);
+  if (file_descriptor < 0) return;
+  struct stat file_status;
+  if (fstat(file_descriptor, &file_status) == 0 && file_status.st_size > 0) {
+    void* data = mmap(NULL, (size_t)file_status.st_size, PROT_READ, MAP_SHARED, file_descriptor, 0);
+    if (data != MAP_FAILED) {
+      data_ = (const unsigned char*)data;
+      size_byte_ = (size_t)file_status.st_size;
+    }
+  }
+  close(file_descriptor);
+#endif
+}
+
+MemoryMappedFile::~MemoryMappedFile() { Unmap(); }
+
+void MemoryMappedFile::Unmap() {
+#ifdef WIN32
+  if (data_ != nullptr) UnmapViewOfFile(data_);
+  if (mapping_handle_ != nullptr) CloseHandle((HANDLE)mapping_handle_);
+  if (file_handle_ != nullptr) CloseHandle((HANDLE)file_handle_);
+  mapping_handle_ = nullptr;
+  file_handle_ = nullptr;
+#else
+  if (data_ != nullptr) munmap((void*)data_, size_byte_);
+#endif
+  data_ = nullptr;
+  size_byte_ = 0;
+}
@@ -0,0 +1,65 @@
+/**
+ * @file memory_mapped_file.hpp
+ * @brief Class to map a file into the memory read-only
+ */
+
+#ifndef S2E_LIBRARY_UTILITIES_MEMORY_MAPPED_FILE_HPP_
+#define S2E_LIBRARY_UTILITIES_MEMORY_MAPPED_FILE_HPP_
+
+#include <cstddef>
+#include <string>
+
+/**
+ * @class MemoryMappedFile
+ * @brief Class to map a file into the memory read-only
+ * @details The file is mapped with mmap or MapViewOfFile, so the pages are loaded on demand and shared between the processes.
+ */
+class MemoryMappedFile {
+ public:
+  /**
+   * @fn MemoryMappedFile
+   * @brief Constructor
+   * @param [in] file_path: Path to the file
+   */
+  MemoryMappedFile(const std::string file_path);
+  /**
+   * @fn ~MemoryMappedFile
+   * @brief Destructor
+   */
+  ~MemoryMappedFile();
+
+  MemoryMappedFile(const MemoryMappedFile&) = delete;
+  MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+  /**
+   * @fn IsMapped
+   * @brief Return true when the file is mapped. An empty file is not mapped.
+   */
+  inline bool IsMapped() const { return data_ != nullptr; }
+  /**
+   * @fn GetData
+   * @brief Return head of the mapped file
+   */
+  inline const unsigned char* GetData() const { return data_; }
+  /**
+   * @fn GetSize_byte
+   * @brief Return file size [byte]
+   */
+  inline size_t GetSize_byte() const { return size_byte_; }
+
+ private:
+  const unsigned char* data_ = nullptr;  //!< Head of the mapped file
+  size_t size_byte_ = 0;                 //!< File size [byte]
+#ifdef WIN32
+  void* file_handle_ = nullptr;     //!< File handle
+  void* mapping_handle_ = nullptr;  //!< File mapping handle
+#endif
+
+  /**
+   * @fn Unmap
+   * @brief Release the mapped file
+   */
+  void Unmap();
+};
+
+#endif  // S2E_LIBRARY_UTILITIES_MEMORY_MAPPED_FILE_HPP_
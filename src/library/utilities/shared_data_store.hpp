@@ -0,0 +1,97 @@
+/**
+ * @file shared_data_store.hpp
+ * @brief Process wide store of read-only data shared by simulation instances
+ */
+
+#ifndef S2E_LIBRARY_UTILITIES_SHARED_DATA_STORE_HPP_
+#define S2E_LIBRARY_UTILITIES_SHARED_DATA_STORE_HPP_
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+/**
+ * @class SharedDataStore
+ * @brief Process wide store of read-only data shared by simulation instances
+ * @details The data is identified by a key which includes every parameter used to load it (e.g. the file path and the maximum degree), and it
+ *          is loaded only once in a process. The data is immutable after the loading, so the simulation cases executed in parallel can read
+ *          it without locks. The data is held until Clear is called, so the cases executed one after another share it too.
+ * @note The files read by MemoryMappedFile are shared between processes by the operating system.
+ */
+template <typename T>
+class SharedDataStore {
+ public:
+  /**
+   * @fn GetOrLoad
+   * @brief Return the data of the key, and load it when the key is not found
+   * @note The loader is executed once for a key even when the data is requested by multiple threads at the same time. The other threads wait
+   *       for the loading. Different keys are loaded in parallel.
+   * @param [in] key: Key of the data
+   * @param [in] loader: Function to load the data. Return nullptr when the loading failed, and the loader is executed again at the next call.
+   * @return Loaded data or nullptr
+   */
+  static std::shared_ptr<const T> GetOrLoad(const std::string& key, const std::function<std::shared_ptr<const T>()>& loader) {
+    std::shared_ptr<Entry> entry;
+    {
+      Registry& registry = GetRegistry();
+      std::lock_guard<std::mutex> lock(registry.mutex);
+      std::shared_ptr<Entry>& found = registry.entries[key];
+      if (found == nullptr) found = std::make_shared<Entry>();
+      entry = found;
+    }
+
+    std::lock_guard<std::mutex> lock(entry->mutex);
+    if (entry->data == nullptr) entry->data = loader();
+    return entry->data;
+  }
+  /**
+   * @fn Clear
+   * @brief Release the data held by the store
+   * @note The data is freed when the objects using it are destructed
+   */
+  static void Clear() {
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.entries.clear();
+  }
+  /**
+   * @fn GetNumberOfEntries
+   * @brief Return the number of the keys in the store
+   */
+  static size_t GetNumberOfEntries() {
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    return registry.entries.size();
+  }
+
+ private:
+  /**
+   * @struct Entry
+   * @brief Data of a key
+   */
+  struct Entry {
+    std::mutex mutex;               //!< Mutex for the loading
+    std::shared_ptr<const T> data;  //!< Loaded data
+  };
+  /**
+   * @struct Registry
+   * @brief Entries of all keys
+   */
+  struct Registry {
+    std::mutex mutex;                                       //!< Mutex for the entries
+    std::map<std::string, std::shared_ptr<Entry>> entries;  //!< Entries of all keys
+  };
+
+  /**
+   * @fn GetRegistry
+   * @brief Return the registry of the data type
+   */
+  static Registry& GetRegistry() {
+    static Registry registry;
+    return registry;
+  }
+};
+
+#endif  // S2E_LIBRARY_UTILITIES_SHARED_DATA_STORE_HPP_
@@ -0,0 +1,51 @@
+/**
+ * @file snapshot.cpp
+ * @brief Serialized simulation state to restore a simulation at a branch time
+ */
+
+#include "snapshot.hpp"
+
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+
+const char Snapshot::kMagic[8] = {'S', '2', 'E', 'S', 'N', 'A', 'P', '\0'};
+
+bool Snapshot::WriteFile(const std::string file_path) const {
+  std::ofstream file(file_path, std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!file.is_open()) {
+    std::cerr << "Error: Cannot open the snapshot file: " << file_path << std::endl;
+    return false;
+  }
+  const uint64_t size = data_.size();
+  file.write(kMagic, sizeof(kMagic));
+  file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+  file.write(data_.data(), data_.size());
+  return file.good();
+}
+
+bool Snapshot::ReadFile(const std::string file_path) {
+  std::ifstream file(file_path, std::ios::in | std::ios::binary);
+  if (!file.is_open()) {
+    std::cerr << "Error: Cannot open the snapshot file: " << file_path << std::endl;
+    return false;
+  }
+  char magic[sizeof(kMagic)];
+  uint64_t size = 0;
+  file.read(magic, sizeof(magic));
+  file.read(reinterpret_cast<char*>(&size), sizeof(size));
+  if (!file.good() || memcmp(magic, kMagic, sizeof(kMagic)) != 0) {
+    std::cerr << "Error: Invalid snapshot file: " << file_path << std::endl;
+    return false;
+  }
+
+  std::vector<char> data(size);
+  file.read(data.data(), size);
+  if ((uint64_t)file.gcount() != size) {
+    std::cerr << "Error: Snapshot file is truncated: " << file_path << std::endl;
+    return false;
+  }
+  data_.swap(data);
+  Rewind();
+  return true;
+}
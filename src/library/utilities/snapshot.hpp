@@ -0,0 +1,179 @@
+/**
+ * @file snapshot.hpp
+ * @brief Serialized simulation state to restore a simulation at a branch time
+ */
+
+#ifndef S2E_LIBRARY_UTILITIES_SNAPSHOT_HPP_
+#define S2E_LIBRARY_UTILITIES_SNAPSHOT_HPP_
+
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @class Snapshot
+ * @brief Serialized simulation state to restore a simulation at a branch time
+ * @details The objects write their states in order with Write, and read them in the same order with Read after Rewind.
+ *          Only trivially copyable values are stored, so the data can be saved into a file and restored in the same build of the simulator.
+ *          Read beyond the end or with a different size marks the snapshot as broken, and the read values are not changed.
+ */
+class Snapshot {
+ public:
+  /**
+   * @fn Clear
+   * @brief Clear the stored data
+   */
+  inline void Clear() {
+    data_.clear();
+    read_position_ = 0;
+    is_broken_ = false;
+  }
+  /**
+   * @fn Rewind
+   * @brief Move the read position to the beginning of the data
+   */
+  inline void Rewind() {
+    read_position_ = 0;
+    is_broken_ = false;
+  }
+
+  /**
+   * @fn Write
+   * @brief Write a value
+   * @param [in] value: Trivially copyable value
+   */
+  template <typename T>
+  inline void Write(const T& value) {
+    static_assert(std::is_trivially_copyable<T>::value, "Snapshot can store only trivially copyable values");
+    WriteBytes(&value, sizeof(T));
+  }
+  /**
+   * @fn Write
+   * @brief Write a vector of values with its size
+   * @param [in] values: Vector of trivially copyable values
+   */
+  template <typename T>
+  inline void Write(const std::vector<T>& values) {
+    static_assert(std::is_trivially_copyable<T>::value, "Snapshot can store only trivially copyable values");
+    const size_t size = values.size();
+    WriteBytes(&size, sizeof(size));
+    WriteBytes(values.data(), sizeof(T) * size);
+  }
+
+  /**
+   * @fn WriteArray
+   * @brief Write an array of values
+   * @param [in] values: Array
+   * @param [in] size: Number of the elements
+   */
+  template <typename T>
+  inline void WriteArray(const T* values, const size_t size) {
+    static_assert(std::is_trivially_copyable<T>::value, "Snapshot can store only trivially copyable values");
+    WriteBytes(values, sizeof(T) * size);
+  }
+
+  /**
+   * @fn Read
+   * @brief Read a value
+   * @param [out] value: Trivially copyable value
+   * @return False when the snapshot is broken
+   */
+  template <typename T>
+  inline bool Read(T& value) {
+    static_assert(std::is_trivially_copyable<T>::value, "Snapshot can store only trivially copyable values");
+    return ReadBytes(&value, sizeof(T));
+  }
+  /**
+   * @fn Read
+   * @brief Read a vector of values. The size must be same as the written vector.
+   * @param [in/out] values: Vector of trivially copyable values
+   * @return False when the snapshot is broken
+   */
+  template <typename T>
+  inline bool Read(std::vector<T>& values) {
+    static_assert(std::is_trivially_copyable<T>::value, "Snapshot can store only trivially copyable values");
+    size_t size = 0;
+    if (!ReadBytes(&size, sizeof(size))) return false;
+    if (size != values.size()) {
+      is_broken_ = true;
+      return false;
+    }
+    return ReadBytes(values.data(), sizeof(T) * size);
+  }
+  /**
+   * @fn ReadArray
+   * @brief Read an array of values written with WriteArray
+   * @param [out] values: Array
+   * @param [in] size: Number of the elements
+   * @return False when the snapshot is broken
+   */
+  template <typename T>
+  inline bool ReadArray(T* values, const size_t size) {
+    static_assert(std::is_trivially_copyable<T>::value, "Snapshot can store only trivially copyable values");
+    return ReadBytes(values, sizeof(T) * size);
+  }
+
+  /**
+   * @fn WriteFile
+   * @brief Save the data into a file
+   * @param [in] file_path: Path to the file
+   * @return False when the file cannot be written
+   */
+  bool WriteFile(const std::string file_path) const;
+  /**
+   * @fn ReadFile
+   * @brief Load the data from a file written by WriteFile
+   * @param [in] file_path: Path to the file
+   * @return False when the file cannot be read
+   */
+  bool ReadFile(const std::string file_path);
+
+  // Getter
+  /**
+   * @fn IsBroken
+   * @brief Return true when a read is failed after the last Rewind
+   */
+  inline bool IsBroken() const { return is_broken_; }
+  /**
+   * @fn IsEnd
+   * @brief Return true when all data is read without failure
+   */
+  inline bool IsEnd() const { return !is_broken_ && read_position_ == data_.size(); }
+  /**
+   * @fn GetSize
+   * @brief Return size of the data [Byte]
+   */
+  inline size_t GetSize() const { return data_.size(); }
+
+  static const char kMagic[8];  //!< Magic number at the head of the file
+
+ private:
+  std::vector<char> data_;    //!< Serialized data
+  size_t read_position_ = 0;  //!< Read position in the data
+  bool is_broken_ = false;    //!< Flag of read failure
+
+  /**
+   * @fn WriteBytes
+   * @brief Append raw bytes
+   */
+  inline void WriteBytes(const void* data, const size_t size) {
+    const char* bytes = static_cast<const char*>(data);
+    data_.insert(data_.end(), bytes, bytes + size);
+  }
+  /**
+   * @fn ReadBytes
+   * @brief Read raw bytes and advance the read position
+   */
+  inline bool ReadBytes(void* data, const size_t size) {
+    if (is_broken_ || read_position_ + size > data_.size()) {
+      is_broken_ = true;
+      return false;
+    }
+    if (size > 0) memcpy(data, &data_[read_position_], size);
+    read_position_ += size;
+    return true;
+  }
+};
+
+#endif  // S2E_LIBRARY_UTILITIES_SNAPSHOT_HPP_
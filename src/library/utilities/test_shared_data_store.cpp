@@ -0,0 +1,121 @@
+/**
+ * @file test_shared_data_store.cpp
+ * @brief Test codes for SharedDataStore class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "../gravity/gravity_potential.hpp"
+#include "shared_data_store.hpp"
+
+/**
+ * @brief Test that the data is loaded once for a key
+ */
+TEST(SharedDataStore, LoadOnce) {
+  int number_of_loads = 0;
+  auto loader = [&number_of_loads]() {
+    number_of_loads++;
+    return std::make_shared<const std::vector<int>>(3, number_of_loads);
+  };
+
+  std::shared_ptr<const std::vector<int>> data_1 = SharedDataStore<std::vector<int>>::GetOrLoad("test_load_once_1", loader);
+  std::shared_ptr<const std::vector<int>> data_2 = SharedDataStore<std::vector<int>>::GetOrLoad("test_load_once_1", loader);
+  std::shared_ptr<const std::vector<int>> data_3 = SharedDataStore<std::vector<int>>::GetOrLoad("test_load_once_2", loader);
+  EXPECT_EQ(2, number_of_loads);
+  EXPECT_EQ(data_1.get(), data_2.get());
+  EXPECT_NE(data_1.get(), data_3.get());
+  EXPECT_EQ(1, (*data_2)[0]);
+  EXPECT_EQ(2, (*data_3)[0]);
+
+  // The data is held by the users after Clear
+  SharedDataStore<std::vector<int>>::Clear();
+  EXPECT_EQ(0u, SharedDataStore<std::vector<int>>::GetNumberOfEntries());
+  EXPECT_EQ(1, (*data_1)[2]);
+  std::shared_ptr<const std::vector<int>> data_4 = SharedDataStore<std::vector<int>>::GetOrLoad("test_load_once_1", loader);
+  EXPECT_EQ(3, number_of_loads);
+  EXPECT_EQ(3, (*data_4)[0]);
+}
+
+/**
+ * @brief Test that a failed loading is not stored
+ */
+TEST(SharedDataStore, LoadFailure) {
+  int number_of_loads = 0;
+  auto loader = [&number_of_loads]() -> std::shared_ptr<const double> {
+    number_of_loads++;
+    if (number_of_loads == 1) return nullptr;
+    return std::make_shared<const double>(1.5);
+  };
+
+  EXPECT_EQ(nullptr, SharedDataStore<double>::GetOrLoad("test_load_failure", loader));
+  std::shared_ptr<const double> data = SharedDataStore<double>::GetOrLoad("test_load_failure", loader);
+  ASSERT_NE(nullptr, data);
+  EXPECT_DOUBLE_EQ(1.5, *data);
+  EXPECT_EQ(2, number_of_loads);
+}
+
+/**
+ * @brief Test that the threads requesting the same key share one loading
+ */
+TEST(SharedDataStore, Threads) {
+  std::atomic<int> number_of_loads(0);
+  auto loader = [&number_of_loads]() {
+    number_of_loads++;
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    return std::make_shared<const int>(7);
+  };
+
+  const size_t number_of_threads = 8;
+  std::vector<std::shared_ptr<const int>> results(number_of_threads);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < number_of_threads; i++) {
+    threads.emplace_back([&results, &loader, i]() { results[i] = SharedDataStore<int>::GetOrLoad("test_threads", loader); });
+  }
+  for (std::thread& thread : threads) thread.join();
+
+  EXPECT_EQ(1, number_of_loads.load());
+  for (size_t i = 0; i < number_of_threads; i++) {
+    EXPECT_EQ(results[0].get(), results[i].get());
+  }
+}
+
+/**
+ * @brief Test that the copies of a shared GravityPotential calculate the same result independently
+ */
+TEST(SharedDataStore, GravityPotentialCopy) {
+  const size_t degree = 10;
+  std::vector<std::vector<double>> c(degree + 1, std::vector<double>(degree + 1, 0.0));
+  std::vector<std::vector<double>> s(degree + 1, std::vector<double>(degree + 1, 0.0));
+  for (size_t n = 2; n <= degree; n++) {
+    for (size_t m = 0; m <= n; m++) {
+      c[n][m] = 1e-6 / (double)(n + m);
+      s[n][m] = m == 0 ? 0.0 : 2e-6 / (double)(n + m);
+    }
+  }
+  std::shared_ptr<const GravityPotential> prototype = SharedDataStore<GravityPotential>::GetOrLoad(
+      "test_gravity_potential_copy", [&]() { return std::make_shared<const GravityPotential>(degree, c, s); });
+
+  GravityPotential copy_1 = *prototype;
+  GravityPotential copy_2 = *prototype;
+  GravityPotential original(degree, c, s);
+  libra::Vector<3> position_1_m, position_2_m;
+  position_1_m[0] = 7000e3;
+  position_1_m[1] = 100e3;
+  position_1_m[2] = -200e3;
+  position_2_m[0] = -3000e3;
+  position_2_m[1] = 5000e3;
+  position_2_m[2] = 4000e3;
+
+  const libra::Vector<3> acceleration_1 = copy_1.CalcAcceleration_xcxf_m_s2(position_1_m);
+  const libra::Vector<3> acceleration_2 = copy_2.CalcAcceleration_xcxf_m_s2(position_2_m);
+  const libra::Vector<3> expected_1 = original.CalcAcceleration_xcxf_m_s2(position_1_m);
+  const libra::Vector<3> expected_2 = original.CalcAcceleration_xcxf_m_s2(position_2_m);
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_DOUBLE_EQ(expected_1[i], acceleration_1[i]);
+    EXPECT_DOUBLE_EQ(expected_2[i], acceleration_2[i]);
+  }
+}
@@ -0,0 +1,117 @@
+/**
+ * @file test_snapshot.cpp
+ * @brief Test codes for Snapshot class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cstdio>
+
+#include "../randomization/random_walk.hpp"
+#include "snapshot.hpp"
+
+/**
+ * @brief Test for writing and reading values, arrays, and vectors
+ */
+TEST(Snapshot, WriteRead) {
+  Snapshot snapshot;
+  const double array[3] = {1.0, 2.0, 3.0};
+  snapshot.Write(12.5);
+  snapshot.Write(libra::Vector<3>(4.0));
+  snapshot.WriteArray(array, 3);
+  snapshot.Write(std::vector<int>{1, 2, 3, 4});
+  EXPECT_EQ(sizeof(double) * 7 + sizeof(size_t) + sizeof(int) * 4, snapshot.GetSize());
+
+  snapshot.Rewind();
+  double value = 0.0;
+  libra::Vector<3> vector(0.0);
+  double read_array[3] = {0.0, 0.0, 0.0};
+  std::vector<int> values(4, 0);
+  EXPECT_TRUE(snapshot.Read(value));
+  EXPECT_TRUE(snapshot.Read(vector));
+  EXPECT_TRUE(snapshot.ReadArray(read_array, 3));
+  EXPECT_TRUE(snapshot.Read(values));
+  EXPECT_TRUE(snapshot.IsEnd());
+  EXPECT_DOUBLE_EQ(12.5, value);
+  EXPECT_DOUBLE_EQ(4.0, vector[2]);
+  EXPECT_DOUBLE_EQ(3.0, read_array[2]);
+  EXPECT_EQ(4, values[3]);
+
+  // Read beyond the end
+  EXPECT_FALSE(snapshot.Read(value));
+  EXPECT_TRUE(snapshot.IsBroken());
+  EXPECT_DOUBLE_EQ(12.5, value);
+}
+
+/**
+ * @brief Test for reading a vector with a different size
+ */
+TEST(Snapshot, SizeMismatch) {
+  Snapshot snapshot;
+  snapshot.Write(std::vector<double>{1.0, 2.0});
+  snapshot.Write(5.0);
+
+  snapshot.Rewind();
+  std::vector<double> values(3, 0.0);
+  double value = 0.0;
+  EXPECT_FALSE(snapshot.Read(values));
+  EXPECT_FALSE(snapshot.Read(value));
+  EXPECT_TRUE(snapshot.IsBroken());
+  EXPECT_DOUBLE_EQ(0.0, values[0]);
+
+  // Rewind clears the failure
+  snapshot.Rewind();
+  values.resize(2);
+  EXPECT_TRUE(snapshot.Read(values));
+  EXPECT_TRUE(snapshot.Read(value));
+  EXPECT_TRUE(snapshot.IsEnd());
+}
+
+/**
+ * @brief Test for saving into a file and loading it
+ */
+TEST(Snapshot, File) {
+  const std::string file_path = "test_snapshot.bin";
+  Snapshot snapshot;
+  snapshot.Write(7.0);
+  snapshot.Write(3u);
+  ASSERT_TRUE(snapshot.WriteFile(file_path));
+
+  Snapshot loaded;
+  ASSERT_TRUE(loaded.ReadFile(file_path));
+  double value = 0.0;
+  unsigned int count = 0;
+  EXPECT_TRUE(loaded.Read(value));
+  EXPECT_TRUE(loaded.Read(count));
+  EXPECT_TRUE(loaded.IsEnd());
+  EXPECT_DOUBLE_EQ(7.0, value);
+  EXPECT_EQ(3u, count);
+
+  EXPECT_FALSE(loaded.ReadFile("not_found_snapshot.bin"));
+  remove(file_path.c_str());
+}
+
+/**
+ * @brief Test that a restored random walk reproduces the same sequence
+ */
+TEST(Snapshot, RandomWalk) {
+  RandomWalk<3> random_walk(0.1, libra::Vector<3>(1.0), libra::Vector<3>(10.0));
+  for (int i = 0; i < 10; i++) ++random_walk;
+
+  Snapshot snapshot;
+  random_walk.SaveSnapshot(snapshot);
+  libra::Vector<3> expected[5];
+  for (int i = 0; i < 5; i++) {
+    ++random_walk;
+    for (size_t j = 0; j < 3; j++) expected[i][j] = random_walk[j];
+  }
+
+  snapshot.Rewind();
+  random_walk.RestoreSnapshot(snapshot);
+  EXPECT_TRUE(snapshot.IsEnd());
+  for (int i = 0; i < 5; i++) {
+    ++random_walk;
+    for (size_t j = 0; j < 3; j++) {
+      EXPECT_DOUBLE_EQ(expected[i][j], random_walk[j]);
+    }
+  }
+}
@@ -9,17 +9,23 @@
 #include <windows.h>
 #endif
 
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <iostream>
+#include <memory>
 #include <string>
 
 // Simulator includes
+#include "library/initialize/initialize_file_access.hpp"
 #include "library/logger/logger.hpp"
+#include "simulation/monte_carlo_simulation/initialize_monte_carlo_simulation.hpp"
+#include "simulation/monte_carlo_simulation/monte_carlo_shard.hpp"
+#include "simulation/monte_carlo_simulation/parallel_monte_carlo_simulation_executor.hpp"
+#include "simulation/monte_carlo_simulation/simulation_object.hpp"
 
 // Add custom include files
 #include "simulation_sample/case/sample_case.hpp"
-// #include "simulation/monte_carlo_simulation/monte_carlo_simulation_executor.hpp"
 // #include "interface/hils/COSMOSWrapper.h"
 // #include "interface/hils/HardwareMessage.h"
 
@@ -50,9 +56,12 @@ int main(int argc, char *argv[])
   std::string ini_path = INI_FILE_DIR_FROM_EXE;
   std::string ini_file = ini_path + "/sample_simulation_base.ini";
 
-  // Parsing arguments:  SatAttSim <data_path> [ini_file]
-  if (argc == 0) {
-    std::cout << "Usage: SatAttSim <data_path> [ini file path]" << std::endl;
+  // Parsing arguments:  SatAttSim <data_path> [ini_file] [--monte_carlo_shard=<i>/<n>] [--monte_carlo_summary=<file path>]
+  MonteCarloShard shard;
+  if (argc == 0 || !ReadMonteCarloShardArguments(argc, argv, shard)) {
+    std::cout << "Usage: SatAttSim <data_path> [ini file path] [--monte_carlo_shard=<shard index>/<number of shards>] "
+                 "[--monte_carlo_summary=<summary file path>]"
+              << std::endl;
     return EXIT_FAILURE;
   }
   if (argc > 1) {
@@ -69,9 +78,44 @@ int main(int argc, char *argv[])
   std::cout << "\tIni file: ";
   print_path(ini_file);
 
-  auto simulation_case = SampleCase(ini_file);
-  simulation_case.Initialize();
-  simulation_case.Main();
+  std::unique_ptr<MonteCarloSimulationExecutor> monte_carlo_simulator(InitMonteCarloSimulation(ini_file));
+  const bool is_sharded = shard.number_of_shards > 1 || !shard.summary_file_path.empty();
+  if (monte_carlo_simulator->IsEnabled() || is_sharded) {
+    // Monte-Carlo simulation: the cases of the shard are executed by the worker threads
+    IniAccess ini_access(ini_file);
+    const unsigned long seed = (unsigned long)ini_access.ReadInt("RANDOMIZE", "rand_seed");
+    const size_t number_of_threads = (size_t)std::max(0, ini_access.ReadInt("MONTE_CARLO_EXECUTION", "number_of_threads"));
+    const std::string log_path = ini_access.ReadString("SIMULATION_SETTINGS", "log_file_save_directory");
+
+    ParallelMonteCarloSimulationExecutor parallel_executor(*monte_carlo_simulator, seed, number_of_threads);
+    std::cout << "\tMonte-Carlo threads: " << parallel_executor.GetNumberOfThreads() << std::endl;
+    if (!parallel_executor.SetShard(shard)) return EXIT_FAILURE;
+    if (is_sharded) {
+      const unsigned long long number_of_cases = monte_carlo_simulator->IsEnabled() ? monte_carlo_simulator->GetTotalNumberOfExecutions() : 1;
+      std::cout << "\tMonte-Carlo shard: " << shard.shard_index << "/" << shard.number_of_shards << " (cases ["
+                << shard.GetFirstCaseIndex(number_of_cases) << ", " << shard.GetEndCaseIndex(number_of_cases) << ") of " << number_of_cases
+                << ")" << std::endl;
+      if (!shard.summary_file_path.empty()) {
+        std::cout << "\tMonte-Carlo summary: ";
+        print_path(shard.summary_file_path);
+      }
+    }
+
+    parallel_executor.Execute([&](MonteCarloSimulationExecutor& case_monte_carlo_simulator) {
+      SampleCase simulation_case(ini_file, case_monte_carlo_simulator, log_path);
+      simulation_case.Initialize();
+      // Overwrite the initial values with the randomized parameters
+      SimulationObject::SetAllParameters(case_monte_carlo_simulator);
+      simulation_case.Main();
+
+      const LogSummary *log_summary = simulation_case.GetSimulationConfiguration().main_logger_->GetLogSummary();
+      if (log_summary != nullptr) case_monte_carlo_simulator.AddSummaryValues(*log_summary);
+    });
+  } else {
+    auto simulation_case = SampleCase(ini_file);
+    simulation_case.Initialize();
+    simulation_case.Main();
+  }
 
   end = system_clock::now();
   double time = static_cast<double>(duration_cast<microseconds>(end - start).count() / 1000000.0);
@@ -7,6 +7,8 @@
 
 #include <library/initialize/initialize_file_access.hpp>
 #include <library/logger/initialize_log.hpp>
+#include <library/randomization/global_randomization.hpp>
+#include <limits>
 #include <string>
 
 SimulationCase::SimulationCase(const std::string initialize_base_file) {
@@ -24,13 +26,16 @@ SimulationCase::SimulationCase(const std::string initialize_base_file, const Mon
     simulation_configuration_.main_logger_ = InitLog(initialize_base_file);
   } else {
     // Monte Carlo Simulation is enabled
-    std::string log_file_name = "default" + std::to_string(monte_carlo_simulator.GetNumberOfExecutionsDone()) + ".csv";
+    std::string log_file_name = monte_carlo_simulator.GetCaseLogFileName();
 
     IniAccess ini_file(initialize_base_file);
     bool save_ini_files = ini_file.ReadEnable("SIMULATION_SETTINGS", "save_initialize_files");
 
     simulation_configuration_.main_logger_ =
-        new Logger(log_file_name, log_path, initialize_base_file, save_ini_files, monte_carlo_simulator.GetSaveLogHistoryFlag());
+        new Logger(log_file_name, log_path, initialize_base_file, save_ini_files, monte_carlo_simulator.GetSaveLogHistoryFlag(),
+                   ReadLogFileFormat(initialize_base_file), ReadLogWriterSetting(initialize_base_file));
+    // The summary is evaluated even when the log history is not saved
+    simulation_configuration_.main_logger_->SetLogSummary(InitLogSummary(initialize_base_file));
   }
   // Initialize Simulation Configuration
   InitializeSimulationConfiguration(initialize_base_file);
@@ -52,7 +57,14 @@ void SimulationCase::Initialize() {
 
 void SimulationCase::Main() {
   global_environment_->Reset();  // for MonteCarlo Simulation
-  while (!global_environment_->GetSimulationTime().GetState().finish) {
+  RunUntil(std::numeric_limits<double>::max());
+
+  // Write all buffered logs at the end of the case
+  simulation_configuration_.main_logger_->Flush();
+}
+
+void SimulationCase::RunUntil(const double end_time_s) {
+  while (!global_environment_->GetSimulationTime().GetState().finish && global_environment_->GetSimulationTime().GetElapsedTime_s() < end_time_s) {
     // Logging
     if (global_environment_->GetSimulationTime().GetState().log_output) {
       simulation_configuration_.main_logger_->WriteValues();
@@ -71,15 +83,35 @@ void SimulationCase::Main() {
   }
 }
 
+void SimulationCase::SaveSnapshot(Snapshot& snapshot) const {
+  global_randomization.SaveSnapshot(snapshot);
+  global_environment_->SaveSnapshot(snapshot);
+  const LogSummary* log_summary = simulation_configuration_.main_logger_->GetLogSummary();
+  if (log_summary != nullptr) log_summary->SaveSnapshot(snapshot);
+}
+
+void SimulationCase::RestoreSnapshot(Snapshot& snapshot) {
+  global_randomization.RestoreSnapshot(snapshot);
+  global_environment_->RestoreSnapshot(snapshot);
+  LogSummary* log_summary = simulation_configuration_.main_logger_->GetLogSummary();
+  if (log_summary != nullptr) log_summary->RestoreSnapshot(snapshot);
+}
+
 std::string SimulationCase::GetLogHeader() const {
   std::string str_tmp = "";
 
+  const LogSummary* log_summary = simulation_configuration_.main_logger_->GetLogSummary();
+  if (log_summary != nullptr) str_tmp += log_summary->GetLogHeader();
+
   return str_tmp;
 }
 
 std::string SimulationCase::GetLogValue() const {
   std::string str_tmp = "";
 
+  const LogSummary* log_summary = simulation_configuration_.main_logger_->GetLogSummary();
+  if (log_summary != nullptr) str_tmp += log_summary->GetLogValue();
+
   return str_tmp;
 }
 
@@ -16,6 +16,10 @@ class Logger;
 /**
  * @class SimulationCase
  * @brief Base class to define simulation scenario
+ * @details Cases which share a common prefix can be branched from a snapshot instead of simulating the prefix again:
+ *          call Initialize, RunUntil the branch time, and SaveSnapshot once. For each branch, Rewind the snapshot, RestoreSnapshot,
+ *          change the parameters or the seed which differ, and RunUntil the end time.
+ *          The log files are not rewound, so the log of a branch continues after the log written before the restore.
  */
 class SimulationCase : public ILoggable {
  public:
@@ -51,14 +55,36 @@ class SimulationCase : public ILoggable {
    */
   virtual void Main();
 
+  /**
+   * @fn RunUntil
+   * @brief Run the simulation loop without resetting the time
+   * @param [in] end_time_s: The loop stops when the elapsed time reaches this time or the simulation finishes [sec]
+   */
+  void RunUntil(const double end_time_s);
+
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the states of the randomization, the global environment, and the log summary into the snapshot
+   * @note Users need to override this function to add the target objects
+   */
+  virtual void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the states of the randomization, the global environment, and the log summary from the snapshot
+   * @note Check Snapshot::IsBroken after the restore, since the snapshot of another configuration cannot be restored
+   */
+  virtual void RestoreSnapshot(Snapshot& snapshot);
+
   /**
    * @fn GetLogHeader
    * @brief Virtual function of Log header settings for Monte-Carlo Simulation result
+   * @note The default implementation writes the summary of the log columns set by log_summary in the initialize file
    */
   virtual std::string GetLogHeader() const;
   /**
    * @fn GetLogValue
    * @brief Virtual function of Log value settings for Monte-Carlo Simulation result
+   * @note The default implementation writes the summary of the log columns set by log_summary in the initialize file
    */
   virtual std::string GetLogValue() const;
 
@@ -0,0 +1,365 @@
+/**
+ * @file test_simulation_case.cpp
+ * @brief Test codes for the snapshot of SimulationCase class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <library/orbit/chebyshev_ephemeris.hpp>
+#include <library/randomization/global_randomization.hpp>
+#include <library/utilities/macros.hpp>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "../spacecraft/spacecraft.hpp"
+#include "simulation_case.hpp"
+
+static const char kBaseFile[] = "test_simulation_case_base.ini";
+static const char kGnssFile[] = "test_simulation_case_gnss.ini";
+static const char kSatelliteFile[] = "test_simulation_case_satellite.ini";
+static const char kLocalEnvironmentFile[] = "test_simulation_case_local_environment.ini";
+static const char kDisturbanceFile[] = "test_simulation_case_disturbance.ini";
+static const char kStructureFile[] = "test_simulation_case_structure.ini";
+static const char kIgrfFile[] = "test_simulation_case_igrf.coef";
+static const char kEphemerisFile[] = "test_simulation_case_ephemeris.bin";
+
+/**
+ * @brief Write a file
+ */
+static void WriteFile(const std::string& file_path, const std::string& contents) {
+  std::ofstream file(file_path, std::ios::out | std::ios::binary | std::ios::trunc);
+  file << contents;
+}
+
+/**
+ * @brief Ephemeris of the Earth, which stays at the origin
+ */
+static void SampleEarth(const double time_s, double state[6]) {
+  UNUSED(time_s);
+  for (size_t i = 0; i < 6; i++) state[i] = 0.0;
+}
+
+/**
+ * @brief Ephemeris of the Sun on a circular orbit of 1 AU
+ */
+static void SampleSun(const double time_s, double state[6]) {
+  const double radius_m = 1.496e11;
+  const double angular_velocity_rad_s = 1.991e-7;
+  const double angle_rad = angular_velocity_rad_s * time_s;
+  state[0] = radius_m * cos(angle_rad);
+  state[1] = radius_m * sin(angle_rad);
+  state[2] = 0.0;
+  state[3] = -radius_m * angular_velocity_rad_s * sin(angle_rad);
+  state[4] = radius_m * angular_velocity_rad_s * cos(angle_rad);
+  state[5] = 0.0;
+}
+
+/**
+ * @class TestSpacecraft
+ * @brief Spacecraft without components
+ */
+class TestSpacecraft : public Spacecraft {
+ public:
+  TestSpacecraft(const SimulationConfiguration* simulation_configuration, const GlobalEnvironment* global_environment)
+      : Spacecraft(simulation_configuration, global_environment, 0) {
+    components_ = new InstalledComponents();
+  }
+};
+
+/**
+ * @class TestCase
+ * @brief Simulation case with a spacecraft, which does not write the log files
+ */
+class TestCase : public SimulationCase {
+ public:
+  TestCase(const MonteCarloSimulationExecutor& monte_carlo_simulator) : SimulationCase(kBaseFile, monte_carlo_simulator, "") {}
+  ~TestCase() { delete spacecraft_; }
+
+  void SaveSnapshot(Snapshot& snapshot) const {
+    SimulationCase::SaveSnapshot(snapshot);
+    spacecraft_->SaveSnapshot(snapshot);
+  }
+  void RestoreSnapshot(Snapshot& snapshot) {
+    SimulationCase::RestoreSnapshot(snapshot);
+    spacecraft_->RestoreSnapshot(snapshot);
+  }
+
+  /**
+   * @brief Return the spacecraft states and the log summary values
+   */
+  std::vector<double> GetStates() {
+    std::vector<double> states;
+    const Dynamics& dynamics = spacecraft_->GetDynamics();
+    for (size_t i = 0; i < 3; i++) {
+      states.push_back(dynamics.GetOrbit().GetPosition_i_m()[i]);
+      states.push_back(dynamics.GetOrbit().GetVelocity_i_m_s()[i]);
+      states.push_back(dynamics.GetAttitude().GetAngularVelocity_b_rad_s()[i]);
+      states.push_back(spacecraft_->GetLocalEnvironment().GetGeomagneticField().GetGeomagneticField_b_nT()[i]);
+    }
+    for (size_t i = 0; i < 4; i++) states.push_back(dynamics.GetAttitude().GetQuaternion_i2b()[i]);
+    const std::vector<double> summary_values = GetSimulationConfiguration().main_logger_->GetLogSummary()->GetValues();
+    states.insert(states.end(), summary_values.begin(), summary_values.end());
+    return states;
+  }
+
+ private:
+  TestSpacecraft* spacecraft_ = nullptr;  //!< Spacecraft
+
+  void InitializeTargetObjects() {
+    spacecraft_ = new TestSpacecraft(&simulation_configuration_, global_environment_);
+    spacecraft_->LogSetup(*(simulation_configuration_.main_logger_));
+  }
+  void UpdateTargetObjects() { spacecraft_->Update(&(global_environment_->GetSimulationTime())); }
+};
+
+/**
+ * @class SimulationCaseFixture
+ * @brief Initialize files of a spacecraft with the precomputed ephemeris and the magnetic field noises
+ */
+class SimulationCaseFixture : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    WriteFile(kBaseFile,
+              "[TIME]\n"
+              "simulation_start_time_utc = 2020/01/01 12:00:00.0\n"
+              "simulation_duration_s = 60\n"
+              "simulation_step_s = 0.1\n"
+              "attitude_update_period_s = 0.1\n"
+              "attitude_integral_step_s = 0.01\n"
+              "orbit_update_period_s = 0.1\n"
+              "orbit_integral_step_s = 0.1\n"
+              "thermal_update_period_s = 1\n"
+              "thermal_integral_step_s = 1\n"
+              "component_update_period_s = 0.1\n"
+              "log_output_period_s = 0.5\n"
+              "simulation_speed_setting = 0\n"
+              "[CELESTIAL_INFORMATION]\n"
+              "logging = ENABLE\n"
+              "rotation_mode = Idle\n"
+              "number_of_selected_body = 2\n"
+              "selected_body_name(0) = EARTH\n"
+              "selected_body_name(1) = SUN\n"
+              "chebyshev_ephemeris = ENABLE\n"
+              "chebyshev_ephemeris_file = " +
+                  std::string(kEphemerisFile) +
+                  "\n"
+                  "[HIPPARCOS_CATALOGUE]\n"
+                  "calculation = DISABLE\n"
+                  "logging = DISABLE\n"
+                  "[SIMULATION_SETTINGS]\n"
+                  "save_initialize_files = DISABLE\n"
+                  "number_of_simulated_spacecraft = 1\n"
+                  "number_of_simulated_ground_station = 0\n"
+                  "spacecraft_file(0) = " +
+                  kSatelliteFile + "\ngnss_file = " + kGnssFile +
+                  "\n"
+                  "log_file_format = CSV\n"
+                  "log_asynchronous_writing = DISABLE\n"
+                  "log_buffer_full_policy = BLOCK\n"
+                  "log_summary(0) = spacecraft_angular_velocity_b_x[rad/s],MAX\n"
+                  "log_summary(1) = geomagnetic_field_at_spacecraft_position_b_y[nT],MEAN\n"
+                  "log_summary(2) = geomagnetic_field_at_spacecraft_position_b_z[nT],RMS\n"
+                  "log_summary(3) = spacecraft_position_i_x[m],FINAL\n"
+                  "log_summary(4) = spacecraft_quaternion_i2b_w,THRESHOLD_CROSSING_TIME,0.0\n");
+    WriteFile(kGnssFile,
+              "[GNSS_SATELLIES]\n"
+              "calculation = DISABLE\n");
+    WriteFile(kSatelliteFile,
+              "[ATTITUDE]\n"
+              "propagate_mode = RK4\n"
+              "initialize_mode = MANUAL\n"
+              "initial_angular_velocity_b_rad_s(0) = 0.1\n"
+              "initial_angular_velocity_b_rad_s(1) = 0.002\n"
+              "initial_angular_velocity_b_rad_s(2) = -0.001\n"
+              "initial_quaternion_i2b(0) = 0.0\n"
+              "initial_quaternion_i2b(1) = 0.0\n"
+              "initial_quaternion_i2b(2) = 0.0\n"
+              "initial_quaternion_i2b(3) = 1.0\n"
+              "initial_torque_b_Nm(0) = 0.0\n"
+              "initial_torque_b_Nm(1) = 0.0\n"
+              "initial_torque_b_Nm(2) = 0.0\n"
+              "[ORBIT]\n"
+              "calculation = ENABLE\n"
+              "logging = ENABLE\n"
+              "propagate_mode = RK4\n"
+              "initialize_mode = POSITION_VELOCITY_I\n"
+              "initial_position_i_m(0) = -2111769.7723711144\n"
+              "initial_position_i_m(1) = -5360353.2254375768\n"
+              "initial_position_i_m(2) = 3596181.6497774957\n"
+              "initial_velocity_i_m_s(0) = 4200.4344740455268\n"
+              "initial_velocity_i_m_s(1) = -4637.540129059361\n"
+              "initial_velocity_i_m_s(2) = -4429.2361258448807\n"
+              "[THERMAL]\n"
+              "calculation = DISABLE\n"
+              "[SETTING_FILES]\n"
+              "local_environment_file = " +
+                  std::string(kLocalEnvironmentFile) + "\ndisturbance_file = " + kDisturbanceFile + "\nstructure_file = " + kStructureFile +
+                  "\n");
+    WriteFile(kLocalEnvironmentFile,
+              "[MAGNETIC_FIELD_ENVIRONMENT]\n"
+              "calculation = ENABLE\n"
+              "logging = ENABLE\n"
+              "coefficient_file = " +
+                  std::string(kIgrfFile) +
+                  "\n"
+                  "magnetic_field_random_walk_standard_deviation_nT = 10.0\n"
+                  "magnetic_field_random_walk_limit_nT = 400.0\n"
+                  "magnetic_field_white_noise_standard_deviation_nT = 50.0\n"
+                  "[SOLAR_RADIATION_PRESSURE_ENVIRONMENT]\n"
+                  "calculation = ENABLE\n"
+                  "logging = ENABLE\n"
+                  "eclipse_prediction_calculation = DISABLE\n"
+                  "[ATMOSPHERE]\n"
+                  "calculation = ENABLE\n"
+                  "logging = ENABLE\n"
+                  "model = STANDARD\n"
+                  "is_manual_parameter_used = ENABLE\n"
+                  "manual_daily_f107 = 150.0\n"
+                  "manual_average_f107 = 150.0\n"
+                  "manual_ap = 3.0\n"
+                  "air_density_standard_deviation = 0.1\n"
+                  "nrlmsise00_density_grid = DISABLE\n"
+                  "[LOCAL_CELESTIAL_INFORMATION]\n"
+                  "logging = ENABLE\n");
+    WriteFile(kDisturbanceFile,
+              "[GEOPOTENTIAL]\n"
+              "calculation = DISABLE\n"
+              "[LUNAR_GRAVITY_FIELD]\n"
+              "calculation = DISABLE\n"
+              "[MAGNETIC_DISTURBANCE]\n"
+              "calculation = ENABLE\n"
+              "logging = ENABLE\n"
+              "[AIR_DRAG]\n"
+              "calculation = ENABLE\n"
+              "logging = ENABLE\n"
+              "wall_temperature_degC = 30\n"
+              "molecular_temperature_degC = 3\n"
+              "molecular_weight_g_mol = 18.0\n"
+              "[SOLAR_RADIATION_PRESSURE_DISTURBANCE]\n"
+              "calculation = ENABLE\n"
+              "logging = ENABLE\n"
+              "[GRAVITY_GRADIENT]\n"
+              "calculation = ENABLE\n"
+              "logging = ENABLE\n"
+              "[THIRD_BODY_GRAVITY]\n"
+              "calculation = DISABLE\n");
+    std::string structure =
+        "[KINEMATIC_PARAMETERS]\n"
+        "inertia_tensor_kgm2(0) = 0.1\n"
+        "inertia_tensor_kgm2(1) = 0.0\n"
+        "inertia_tensor_kgm2(2) = 0.0\n"
+        "inertia_tensor_kgm2(3) = 0.0\n"
+        "inertia_tensor_kgm2(4) = 0.12\n"
+        "inertia_tensor_kgm2(5) = 0.0\n"
+        "inertia_tensor_kgm2(6) = 0.0\n"
+        "inertia_tensor_kgm2(7) = 0.0\n"
+        "inertia_tensor_kgm2(8) = 0.08\n"
+        "mass_kg = 14\n"
+        "center_of_gravity_b_m(0) = 0.01\n"
+        "center_of_gravity_b_m(1) = 0.01\n"
+        "center_of_gravity_b_m(2) = 0.01\n"
+        "[SURFACES]\n"
+        "number_of_surfaces = 6\n";
+    // Surfaces of a cube
+    for (size_t i = 0; i < 6; i++) {
+      const std::string index = std::to_string(i);
+      structure += "area_" + index + "_m2 = 0.25\n";
+      structure += "reflectivity_" + index + " = 0.4\n";
+      structure += "specularity_" + index + " = 0.4\n";
+      structure += "air_specularity_" + index + " = 0.4\n";
+      for (size_t axis = 0; axis < 3; axis++) {
+        const double direction = axis == i / 2 ? (i % 2 == 0 ? 1.0 : -1.0) : 0.0;
+        const std::string element = "(" + std::to_string(axis) + ") = ";
+        structure += "position_" + index + "_b_m" + element + std::to_string(0.25 * direction) + "\n";
+        structure += "normal_vector_" + index + "_b" + element + std::to_string(direction) + "\n";
+      }
+    }
+    structure +=
+        "[RESIDUAL_MAGNETIC_MOMENT]\n"
+        "rmm_constant_b_Am2(0) = 0.04\n"
+        "rmm_constant_b_Am2(1) = 0.04\n"
+        "rmm_constant_b_Am2(2) = 0.04\n"
+        "rmm_random_walk_speed_Am2 = 1.0E-5\n"
+        "rmm_random_walk_limit_Am2 = 1.0E-3\n"
+        "rmm_white_noise_standard_deviation_Am2 = 5.0E-5\n";
+    WriteFile(kStructureFile, structure);
+    WriteFile(kIgrfFile,
+              "   2  3 2000 2025\n"
+              "y  0  0 2000.0 2010.0 2010-15\n"
+              "g  1  0 -30000 -29000 10.0\n"
+              "g  1  1  -2000  -1800  4.0\n"
+              "h  1  1   5000   4800 -6.0\n"
+              "g  2  0  -2000  -2400  2.0\n"
+              "g  2  1   3000   3100 -1.0\n"
+              "h  2  1  -2000  -2200  3.0\n"
+              "g  2  2   1600   1700  0.5\n"
+              "h  2  2   -400   -500 -0.5\n");
+
+    // The simulation starts at 631152000 sec of UTC from J2000
+    ChebyshevEphemerisTimeSystem time_system;
+    time_system.leap_seconds = {36.0, 4.3e8, 37.0, 5.36e8};
+    ChebyshevEphemerisWriter writer(6.3115e8, 6.3115e8 + 86400.0, "J2000", "NONE", "EARTH", time_system);
+    const double earth_radii_m[3] = {6378137.0, 6378137.0, 6356752.0};
+    const double sun_radii_m[3] = {6.96e8, 6.96e8, 6.96e8};
+    writer.AddBody(399, "EARTH", 3.986004418e14, earth_radii_m, SampleEarth, 1.0);
+    writer.AddBody(10, "SUN", 1.32712440018e20, sun_radii_m, SampleSun, 1.0);
+    ASSERT_TRUE(writer.Write(kEphemerisFile));
+
+    monte_carlo_simulator_.SetEnable(true);
+    monte_carlo_simulator_.SetSaveLogHistoryFlag(false);
+  }
+  void TearDown() override {
+    const char* const file_paths[] = {kBaseFile,  kGnssFile, kSatelliteFile, kLocalEnvironmentFile, kDisturbanceFile, kStructureFile,
+                                      kIgrfFile, kEphemerisFile};
+    for (const char* file_path : file_paths) std::remove(file_path);
+  }
+
+  MonteCarloSimulationExecutor monte_carlo_simulator_{1};  //!< Executor which disables the log files
+};
+
+/**
+ * @brief Test for the case restored from the snapshot compared with the uninterrupted run
+ */
+TEST_F(SimulationCaseFixture, Snapshot) {
+  const double branch_time_s = 25.0;
+  const double end_time_s = std::numeric_limits<double>::max();
+
+  // The cases are made one by one, since the simulation objects of a case are registered with the names in a thread
+  std::vector<double> expected_states;
+  {
+    global_randomization.SetSeed(0x11223344);
+    TestCase reference_case(monte_carlo_simulator_);
+    reference_case.Initialize();
+    reference_case.RunUntil(end_time_s);
+    expected_states = reference_case.GetStates();
+    EXPECT_NEAR(60.0, reference_case.GetGlobalEnvironment().GetSimulationTime().GetElapsedTime_s(), 1.0e-6);
+  }
+
+  Snapshot snapshot;
+  {
+    global_randomization.SetSeed(0x11223344);
+    TestCase branch_case(monte_carlo_simulator_);
+    branch_case.Initialize();
+    branch_case.RunUntil(branch_time_s);
+    branch_case.SaveSnapshot(snapshot);
+  }
+
+  // The case initialized with another seed continues the same as the reference case
+  global_randomization.SetSeed(0x55667788);
+  TestCase restored_case(monte_carlo_simulator_);
+  restored_case.Initialize();
+  snapshot.Rewind();
+  restored_case.RestoreSnapshot(snapshot);
+  EXPECT_TRUE(snapshot.IsEnd());
+  EXPECT_NEAR(branch_time_s, restored_case.GetGlobalEnvironment().GetSimulationTime().GetElapsedTime_s(), 1.0e-6);
+  restored_case.RunUntil(end_time_s);
+
+  // The threshold of the quaternion is crossed after the branch
+  const std::vector<double> states = restored_case.GetStates();
+  ASSERT_EQ(expected_states.size(), states.size());
+  EXPECT_GT(expected_states.back(), branch_time_s);
+  for (size_t i = 0; i < states.size(); i++) EXPECT_EQ(expected_states[i], states[i]) << "index " << i;
+}
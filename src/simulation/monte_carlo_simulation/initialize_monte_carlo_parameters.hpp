@@ -45,6 +45,7 @@ class InitializedMonteCarloParameters {
   /**
    * @fn SetSeed
    * @brief Set seed of randomization. Use time infomation when is_deterministic = false.
+   * @note The seed is set for the calling thread only
    */
   static void SetSeed(unsigned long seed = 0, bool is_deterministic = false);
   /**
@@ -87,11 +88,13 @@ class InitializedMonteCarloParameters {
   std::vector<double> sigma_or_max_;  //!< standard deviation or maximum value. Refer comment in Generate[RandomizationType] function.
 
   // For randomization
-  RandomizationType randomization_type_;                           //!< Randomization type
-  static std::random_device randomizer_;                           //!< Non-deterministic random number generator with time information
-  static std::mt19937 mt_;                                         //!< Deterministic random number generator
-  static std::uniform_real_distribution<>* uniform_distribution_;  //!< Uniform random number generator
-  static std::normal_distribution<>* normal_distribution_;         //!< Normal random number generator
+  RandomizationType randomization_type_;  //!< Randomization type
+  // The generators are owned by each thread to execute the simulation cases in parallel
+  static thread_local std::random_device randomizer_;                          //!< Non-deterministic random number generator with time information
+  static thread_local std::mt19937 mt_;                                        //!< Deterministic random number generator
+  static thread_local std::uniform_real_distribution<> uniform_distribution_;  //!< Uniform random number generator
+  static thread_local std::normal_distribution<> normal_distribution_;         //!< Normal random number generator
+  static thread_local bool is_seed_set_;                                       //!< Flag to show the seed is already set in the thread
 
   /**
    * @fn Generate1dUniform
@@ -0,0 +1,57 @@
+/**
+ * @file merge_monte_carlo_summary.cpp
+ * @brief Tool to merge the summary files of a distributed Monte-Carlo simulation into the aggregated statistics
+ * @details Usage: merge_monte_carlo_summary <output file> <summary files...> --number_of_cases=<number of all cases>
+ *          The summary files written by the shards are read row by row, and the statistics of each summary value are written into the output
+ *          file. The per-case log files are not read. The rows of the case indices out of the number of all cases are rejected, and the
+ *          missing cases are reported.
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "monte_carlo_summary.hpp"
+
+int main(int argc, char* argv[]) {
+  const std::string number_of_cases_option = "--number_of_cases=";
+  std::string output_file_path;
+  std::vector<std::string> summary_file_paths;
+  unsigned long long number_of_all_cases = 0;
+  for (int i = 1; i < argc; i++) {
+    const std::string argument = argv[i];
+    if (argument.compare(0, number_of_cases_option.size(), number_of_cases_option) == 0) {
+      number_of_all_cases = strtoull(argument.c_str() + number_of_cases_option.size(), nullptr, 10);
+    } else if (output_file_path.empty()) {
+      output_file_path = argument;
+    } else {
+      summary_file_paths.push_back(argument);
+    }
+  }
+  if (summary_file_paths.empty() || number_of_all_cases == 0) {
+    std::cerr << "Usage: " << argv[0] << " <output file> <summary files...> " << number_of_cases_option << "<number of all cases>" << std::endl;
+    return 1;
+  }
+
+  MonteCarloSummaryStatistics statistics(number_of_all_cases);
+  for (const std::string& summary_file_path : summary_file_paths) {
+    if (!statistics.ReadFile(summary_file_path)) return 1;
+  }
+
+  if (!statistics.WriteFile(output_file_path)) return 1;
+  std::cout << "Merged " << statistics.GetNumberOfCases() << " cases from " << summary_file_paths.size() << " files: " << output_file_path
+            << std::endl;
+  if (statistics.GetNumberOfDuplicatedCases() > 0) {
+    std::cout << "Duplicated cases: " << statistics.GetNumberOfDuplicatedCases() << std::endl;
+  }
+  if (statistics.GetNumberOfRejectedRows() > 0) {
+    std::cerr << "Warning: Rejected rows: " << statistics.GetNumberOfRejectedRows() << std::endl;
+  }
+  const unsigned long long number_of_missing_cases = statistics.CountMissingCases();
+  if (number_of_missing_cases > 0) {
+    std::cerr << "Warning: Missing cases: " << number_of_missing_cases << " of " << number_of_all_cases << std::endl;
+    return 2;
+  }
+  return 0;
+}
@@ -0,0 +1,44 @@
+/**
+ * @file monte_carlo_shard.cpp
+ * @brief Shard of the case index space to execute Monte-Carlo simulation in multiple processes
+ */
+
+#include "monte_carlo_shard.hpp"
+
+#include <cstdlib>
+#include <iostream>
+
+bool ReadMonteCarloShardArguments(int& argc, char* argv[], MonteCarloShard& shard) {
+  const std::string shard_option = "--monte_carlo_shard=";
+  const std::string summary_option = "--monte_carlo_summary=";
+
+  shard = MonteCarloShard();
+  bool is_valid = true;
+  int number_of_kept_arguments = 0;
+  for (int i = 0; i < argc; i++) {
+    const std::string argument = argv[i];
+    if (i > 0 && argument.compare(0, shard_option.size(), shard_option) == 0) {
+      const std::string value = argument.substr(shard_option.size());
+      const size_t separator = value.find('/');
+      char* index_end = nullptr;
+      char* number_end = nullptr;
+      if (separator != std::string::npos) {
+        shard.shard_index = strtoull(value.c_str(), &index_end, 10);
+        shard.number_of_shards = strtoull(value.c_str() + separator + 1, &number_end, 10);
+      }
+      if (separator == std::string::npos || index_end != value.c_str() + separator || *number_end != '\0' || shard.number_of_shards == 0 ||
+          shard.shard_index >= shard.number_of_shards) {
+        std::cerr << "Error: Invalid Monte-Carlo shard: " << value << " (usage: " << shard_option << "<shard index>/<number of shards>)" << std::endl;
+        shard.shard_index = 0;
+        shard.number_of_shards = 1;
+        is_valid = false;
+      }
+    } else if (i > 0 && argument.compare(0, summary_option.size(), summary_option) == 0) {
+      shard.summary_file_path = argument.substr(summary_option.size());
+    } else {
+      argv[number_of_kept_arguments++] = argv[i];
+    }
+  }
+  argc = number_of_kept_arguments;
+  return is_valid;
+}
@@ -0,0 +1,54 @@
+/**
+ * @file monte_carlo_shard.hpp
+ * @brief Shard of the case index space to execute Monte-Carlo simulation in multiple processes
+ */
+
+#ifndef S2E_SIMULATION_MONTE_CARLO_SIMULATION_MONTE_CARLO_SHARD_HPP_
+#define S2E_SIMULATION_MONTE_CARLO_SIMULATION_MONTE_CARLO_SHARD_HPP_
+
+#include <string>
+
+/**
+ * @struct MonteCarloShard
+ * @brief Shard of the case index space
+ * @details The cases are divided into contiguous blocks. The shard i of n executes the cases [N * i / n, N * (i + 1) / n) of all N cases.
+ *          Since the seed of each case is calculated from the base seed and the case index, the result of a case does not depend on the
+ *          number of shards.
+ */
+struct MonteCarloShard {
+  unsigned long long shard_index = 0;       //!< Index of the shard
+  unsigned long long number_of_shards = 1;  //!< Number of the shards
+  std::string summary_file_path;            //!< Path to the summary file of the shard (empty: the summary is not written)
+
+  /**
+   * @fn GetFirstCaseIndex
+   * @brief Return the first case index of the shard
+   * @param [in] number_of_cases: Number of all cases
+   */
+  inline unsigned long long GetFirstCaseIndex(const unsigned long long number_of_cases) const {
+    return number_of_cases * shard_index / number_of_shards;
+  }
+  /**
+   * @fn GetEndCaseIndex
+   * @brief Return the case index after the last case of the shard
+   * @param [in] number_of_cases: Number of all cases
+   */
+  inline unsigned long long GetEndCaseIndex(const unsigned long long number_of_cases) const {
+    return number_of_cases * (shard_index + 1) / number_of_shards;
+  }
+};
+
+/**
+ * @fn ReadMonteCarloShardArguments
+ * @brief Read the shard setting from the command line arguments and remove them from the arguments
+ * @details The following arguments are read. The other arguments are kept in the original order.
+ *          --monte_carlo_shard=<shard index>/<number of shards> : e.g. --monte_carlo_shard=2/8 executes the third of the eight shards
+ *          --monte_carlo_summary=<file path> : summary file of the shard
+ * @param [in/out] argc: Number of the arguments
+ * @param [in/out] argv: Arguments
+ * @param [out] shard: Shard setting (default: a shard with all cases)
+ * @return False when the arguments are invalid
+ */
+bool ReadMonteCarloShardArguments(int& argc, char* argv[], MonteCarloShard& shard);
+
+#endif  // S2E_SIMULATION_MONTE_CARLO_SIMULATION_MONTE_CARLO_SHARD_HPP_
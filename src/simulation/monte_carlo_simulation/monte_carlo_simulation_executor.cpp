@@ -14,6 +14,25 @@ MonteCarloSimulationExecutor::MonteCarloSimulationExecutor(unsigned long long to
   save_log_history_flag_ = !enabled_;
 }
 
+MonteCarloSimulationExecutor::MonteCarloSimulationExecutor(const MonteCarloSimulationExecutor& obj)
+    : total_number_of_executions_(obj.total_number_of_executions_),
+      number_of_executions_done_(obj.number_of_executions_done_),
+      enabled_(obj.enabled_),
+      save_log_history_flag_(obj.save_log_history_flag_),
+      case_seed_(obj.case_seed_),
+      summary_writer_(obj.summary_writer_),
+      case_summary_(obj.case_summary_) {
+  for (auto ip : obj.init_parameter_list_) {
+    init_parameter_list_[ip.first] = new InitializedMonteCarloParameters(*ip.second);
+  }
+}
+
+MonteCarloSimulationExecutor::~MonteCarloSimulationExecutor() {
+  for (auto ip : init_parameter_list_) {
+    delete ip.second;
+  }
+}
+
 bool MonteCarloSimulationExecutor::WillExecuteNextCase() {
   if (!enabled_) {
     return (number_of_executions_done_ < 1);
@@ -27,8 +46,18 @@ void MonteCarloSimulationExecutor::AtTheBeginningOfEachCase() {
   ;
 }
 
+void MonteCarloSimulationExecutor::AddSummaryValues(const LogSummary& log_summary) {
+  const std::vector<std::string> names = log_summary.GetNames();
+  const std::vector<double> values = log_summary.GetValues();
+  for (size_t i = 0; i < names.size(); i++) {
+    case_summary_.Add(names[i], values[i]);
+  }
+}
+
 void MonteCarloSimulationExecutor::AtTheEndOfEachCase() {
   // Write CSV output of the simulation results
+  if (summary_writer_ != nullptr) summary_writer_->Write(number_of_executions_done_, case_seed_, case_summary_);
+  case_summary_.Clear();
   number_of_executions_done_++;
 }
 
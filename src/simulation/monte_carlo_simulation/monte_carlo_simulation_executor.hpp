@@ -6,11 +6,13 @@
 #ifndef S2E_SIMULATION_MONTE_CARLO_SIMULATION_MONTE_CARLO_SIMULATION_EXECUTOR_HPP_
 #define S2E_SIMULATION_MONTE_CARLO_SIMULATION_MONTE_CARLO_SIMULATION_EXECUTOR_HPP_
 
+#include <library/logger/log_summary.hpp>
 #include <library/math/vector.hpp>
 #include <map>
 #include <string>
 // #include "simulation_object.hpp"
 #include "initialize_monte_carlo_parameters.hpp"
+#include "monte_carlo_summary.hpp"
 
 /**
  * @class MonteCarloSimulationExecutor
@@ -22,6 +24,10 @@ class MonteCarloSimulationExecutor {
   unsigned long long number_of_executions_done_;   //!< Number of executed case
   bool enabled_;                                   //!< Flag to execute Monte-Carlo Simulation or not
   bool save_log_history_flag_;                     //!< Flag to store the log for each case or not
+  unsigned long case_seed_ = 0;                    //!< Seed of randomization of the current case (written in the summary)
+
+  MonteCarloSummaryWriter* summary_writer_ = nullptr;  //!< Writer of the case summaries (not owned, nullptr: the summary is not written)
+  MonteCarloCaseSummary case_summary_;                 //!< Summary of the current case
 
   std::map<std::string, InitializedMonteCarloParameters*> init_parameter_list_;  //!< List of InitializedMonteCarloParameters read from MCSim.ini
 
@@ -33,6 +39,18 @@ class MonteCarloSimulationExecutor {
    * @brief Constructor
    */
   MonteCarloSimulationExecutor(unsigned long long total_num_of_executions);
+  /**
+   * @fn MonteCarloSimulationExecutor
+   * @brief Copy constructor to execute the simulation cases in parallel
+   * @note The initialized parameters are copied, so the randomization does not affect the original executor.
+   */
+  MonteCarloSimulationExecutor(const MonteCarloSimulationExecutor& obj);
+  /**
+   * @fn ~MonteCarloSimulationExecutor
+   * @brief Destructor
+   */
+  ~MonteCarloSimulationExecutor();
+  MonteCarloSimulationExecutor& operator=(const MonteCarloSimulationExecutor&) = delete;
 
   // Setter
   /**
@@ -50,11 +68,40 @@ class MonteCarloSimulationExecutor {
    * @brief Set log history flag
    */
   inline void SetSaveLogHistoryFlag(bool set) { save_log_history_flag_ = set; }
+  /**
+   * @fn SetNumberOfExecutionsDone
+   * @brief Set number of executed case (used as the index of the case executed in parallel)
+   */
+  inline void SetNumberOfExecutionsDone(unsigned long long number_of_executions_done) { number_of_executions_done_ = number_of_executions_done; }
   /**
    * @fn SetSeed
    * @brief Set seed of randomization. Use time infomation when is_deterministic = false.
    */
   static void SetSeed(unsigned long seed = 0, bool is_deterministic = false);
+  /**
+   * @fn SetCaseSeed
+   * @brief Set seed of the current case written in the summary
+   */
+  inline void SetCaseSeed(unsigned long case_seed) { case_seed_ = case_seed; }
+  /**
+   * @fn SetSummaryWriter
+   * @brief Set writer of the case summaries. The summary of each case is written at AtTheEndOfEachCase.
+   * @param [in] summary_writer: Writer shared by the copies of this executor (nullptr: the summary is not written)
+   */
+  inline void SetSummaryWriter(MonteCarloSummaryWriter* summary_writer) { summary_writer_ = summary_writer; }
+  /**
+   * @fn AddSummaryValue
+   * @brief Add a value to the summary of the current case
+   * @param [in] name: Name of the value
+   * @param [in] value: Value
+   */
+  inline void AddSummaryValue(const std::string name, const double value) { case_summary_.Add(name, value); }
+  /**
+   * @fn AddSummaryValues
+   * @brief Add the reduced values of the log columns to the summary of the current case
+   * @param [in] log_summary: Summary of the log columns of the case
+   */
+  void AddSummaryValues(const LogSummary& log_summary);
 
   // Getter
   /**
@@ -72,6 +119,21 @@ class MonteCarloSimulationExecutor {
    * @brief Return number of executed case
    */
   inline unsigned long long GetNumberOfExecutionsDone() const { return number_of_executions_done_; }
+  /**
+   * @fn GetCaseSeed
+   * @brief Return seed of randomization of the current case
+   */
+  inline unsigned long GetCaseSeed() const { return case_seed_; }
+  /**
+   * @fn GetCaseLogFileName
+   * @brief Return log file name of the current case
+   */
+  inline std::string GetCaseLogFileName() const { return "default" + std::to_string(number_of_executions_done_) + ".csv"; }
+  /**
+   * @fn GetCaseSummary
+   * @brief Return summary of the current case
+   */
+  inline const MonteCarloCaseSummary& GetCaseSummary() const { return case_summary_; }
   /**
    * @fn GetSaveLogHistoryFlag
    * @brief Return log history flag
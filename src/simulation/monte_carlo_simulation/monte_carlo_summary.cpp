@@ -0,0 +1,182 @@
+/**
+ * @file monte_carlo_summary.cpp
+ * @brief Per-case summary of Monte-Carlo simulation and its aggregation
+ */
+
+#include "monte_carlo_summary.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+/**
+ * @fn SplitCsvLine
+ * @brief Split a line of CSV file with comma
+ */
+static std::vector<std::string> SplitCsvLine(const std::string& line) {
+  std::vector<std::string> items;
+  std::stringstream stream(line);
+  std::string item;
+  while (std::getline(stream, item, ',')) {
+    if (!item.empty() && item.back() == '\r') item.pop_back();
+    items.push_back(item);
+  }
+  return items;
+}
+
+void MonteCarloCaseSummary::Add(const std::string name, const double value) {
+  const auto itr = std::find(names_.begin(), names_.end(), name);
+  if (itr != names_.end()) {
+    values_[itr - names_.begin()] = value;
+    return;
+  }
+  names_.push_back(name);
+  values_.push_back(value);
+}
+
+MonteCarloSummaryWriter::MonteCarloSummaryWriter(const std::string file_path) {
+  file_.open(file_path, std::ios::out | std::ios::trunc);
+  if (!file_.is_open()) {
+    std::cerr << "Error: Cannot open the Monte-Carlo summary file: " << file_path << std::endl;
+  }
+}
+
+void MonteCarloSummaryWriter::Write(const unsigned long long case_index, const unsigned long seed, const MonteCarloCaseSummary& summary) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!file_.is_open()) return;
+
+  if (!is_header_written_) {
+    names_ = summary.GetNames();
+    file_ << "case_index,seed";
+    for (const std::string& name : names_) file_ << "," << name;
+    file_ << std::endl;
+    is_header_written_ = true;
+  } else if (summary.GetNames() != names_) {
+    throw std::runtime_error("Names of the Monte-Carlo summary values differ between the cases.");
+  }
+
+  // The row is flushed at the end of each case, so the finished cases remain when the process is stopped
+  char buffer[32];
+  file_ << case_index << "," << seed;
+  for (const double value : summary.GetValues()) {
+    snprintf(buffer, sizeof(buffer), "%.17g", value);
+    file_ << "," << buffer;
+  }
+  file_ << std::endl;
+}
+
+double MonteCarloSummaryStatistics::Statistics::GetStandardDeviation() const {
+  if (count < 2) return 0.0;
+  return sqrt(sum_of_squared_deviation / (double)(count - 1));
+}
+
+MonteCarloSummaryStatistics::MonteCarloSummaryStatistics(const unsigned long long number_of_cases) : number_of_all_cases_(number_of_cases) {}
+
+bool MonteCarloSummaryStatistics::ReadFile(const std::string file_path) {
+  std::ifstream file(file_path);
+  if (!file.is_open()) {
+    std::cerr << "Error: Cannot open the Monte-Carlo summary file: " << file_path << std::endl;
+    return false;
+  }
+
+  std::string line;
+  if (!std::getline(file, line)) return true;  // No case is finished
+  const std::vector<std::string> header = SplitCsvLine(line);
+  if (header.size() < 2 || header[0] != "case_index" || header[1] != "seed") {
+    std::cerr << "Error: Invalid header of the Monte-Carlo summary file: " << file_path << std::endl;
+    return false;
+  }
+  if (!is_header_read_) {
+    for (size_t i = 2; i < header.size(); i++) {
+      Statistics statistics;
+      statistics.name = header[i];
+      statistics_.push_back(statistics);
+    }
+    is_header_read_ = true;
+  } else {
+    bool is_same_header = (header.size() == statistics_.size() + 2);
+    for (size_t i = 2; i < header.size() && is_same_header; i++) {
+      is_same_header = (header[i] == statistics_[i - 2].name);
+    }
+    if (!is_same_header) {
+      std::cerr << "Error: Header of the Monte-Carlo summary file differs from the other files: " << file_path << std::endl;
+      return false;
+    }
+  }
+
+  while (std::getline(file, line)) {
+    const std::vector<std::string> items = SplitCsvLine(line);
+    // A row without all values is skipped (e.g. the last row of a stopped process)
+    if (items.size() != statistics_.size() + 2) continue;
+
+    // The case index is checked before the flags are extended, so a broken row cannot make a huge allocation
+    char* end = nullptr;
+    const unsigned long long case_index = strtoull(items[0].c_str(), &end, 10);
+    if (items[0].empty() || *end != '\0' || case_index >= number_of_all_cases_) {
+      std::cerr << "Error: Invalid case index " << items[0] << " in the Monte-Carlo summary file: " << file_path << std::endl;
+      number_of_rejected_rows_++;
+      continue;
+    }
+    if (case_index >= is_case_found_.size()) {
+      const unsigned long long size = std::max<unsigned long long>(case_index + 1, is_case_found_.size() * 2);
+      is_case_found_.resize(std::min(size, number_of_all_cases_), false);
+    }
+    if (is_case_found_[case_index]) {
+      number_of_duplicated_cases_++;
+      continue;
+    }
+    is_case_found_[case_index] = true;
+    number_of_cases_++;
+
+    for (size_t i = 0; i < statistics_.size(); i++) {
+      AddValue(statistics_[i], case_index, strtod(items[i + 2].c_str(), nullptr));
+    }
+  }
+  return true;
+}
+
+bool MonteCarloSummaryStatistics::WriteFile(const std::string file_path) const {
+  std::ofstream file(file_path, std::ios::out | std::ios::trunc);
+  if (!file.is_open()) {
+    std::cerr << "Error: Cannot open the output file: " << file_path << std::endl;
+    return false;
+  }
+
+  file << "name,count,invalid_count,mean,standard_deviation,min,min_case_index,max,max_case_index" << std::endl;
+  char buffer[128];
+  for (const Statistics& statistics : statistics_) {
+    snprintf(buffer, sizeof(buffer), "%.17g,%.17g,%.17g", statistics.mean, statistics.GetStandardDeviation(), statistics.min);
+    file << statistics.name << "," << statistics.count << "," << statistics.invalid_count << "," << buffer << "," << statistics.min_case_index;
+    snprintf(buffer, sizeof(buffer), "%.17g", statistics.max);
+    file << "," << buffer << "," << statistics.max_case_index << std::endl;
+  }
+  return file.good();
+}
+
+unsigned long long MonteCarloSummaryStatistics::CountMissingCases() const { return number_of_all_cases_ - number_of_cases_; }
+
+void MonteCarloSummaryStatistics::AddValue(Statistics& statistics, const unsigned long long case_index, const double value) {
+  if (!std::isfinite(value)) {
+    statistics.invalid_count++;
+    return;
+  }
+
+  // Welford's online algorithm
+  statistics.count++;
+  const double delta = value - statistics.mean;
+  statistics.mean += delta / (double)statistics.count;
+  statistics.sum_of_squared_deviation += delta * (value - statistics.mean);
+
+  if (statistics.count == 1 || value < statistics.min) {
+    statistics.min = value;
+    statistics.min_case_index = case_index;
+  }
+  if (statistics.count == 1 || value > statistics.max) {
+    statistics.max = value;
+    statistics.max_case_index = case_index;
+  }
+}
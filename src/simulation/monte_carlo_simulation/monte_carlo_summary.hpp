@@ -0,0 +1,164 @@
+/**
+ * @file monte_carlo_summary.hpp
+ * @brief Per-case summary of Monte-Carlo simulation and its aggregation
+ */
+
+#ifndef S2E_SIMULATION_MONTE_CARLO_SIMULATION_MONTE_CARLO_SUMMARY_HPP_
+#define S2E_SIMULATION_MONTE_CARLO_SIMULATION_MONTE_CARLO_SUMMARY_HPP_
+
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @class MonteCarloCaseSummary
+ * @brief Named scalar values which summarize a Monte-Carlo simulation case
+ */
+class MonteCarloCaseSummary {
+ public:
+  /**
+   * @fn Add
+   * @brief Add a value. The value is overwritten when the name is already added.
+   * @param [in] name: Name of the value
+   * @param [in] value: Value
+   */
+  void Add(const std::string name, const double value);
+  /**
+   * @fn Clear
+   * @brief Clear all values
+   */
+  inline void Clear() {
+    names_.clear();
+    values_.clear();
+  }
+
+  // Getter
+  inline const std::vector<std::string>& GetNames() const { return names_; }
+  inline const std::vector<double>& GetValues() const { return values_; }
+
+ private:
+  std::vector<std::string> names_;  //!< Names of the values in the added order
+  std::vector<double> values_;      //!< Values
+};
+
+/**
+ * @class MonteCarloSummaryWriter
+ * @brief Writer of the case summaries into a CSV file
+ * @details The file has a header row "case_index,seed,<names>" and one row per case. The rows are written in the finished order of the cases.
+ *          A writer is shared by the threads of a process, and each process of a distributed run writes its own file.
+ */
+class MonteCarloSummaryWriter {
+ public:
+  /**
+   * @fn MonteCarloSummaryWriter
+   * @brief Constructor
+   * @param [in] file_path: Path to the summary file. The file is overwritten.
+   */
+  MonteCarloSummaryWriter(const std::string file_path);
+  MonteCarloSummaryWriter(const MonteCarloSummaryWriter&) = delete;
+  MonteCarloSummaryWriter& operator=(const MonteCarloSummaryWriter&) = delete;
+
+  /**
+   * @fn Write
+   * @brief Write the summary of a case
+   * @note All cases must have the same names in the same order as the first written case. Otherwise std::runtime_error is thrown.
+   * @param [in] case_index: Index of the case
+   * @param [in] seed: Seed of randomization of the case
+   * @param [in] summary: Summary of the case
+   */
+  void Write(const unsigned long long case_index, const unsigned long seed, const MonteCarloCaseSummary& summary);
+
+  /**
+   * @fn IsOpen
+   * @brief Return true when the file is opened
+   */
+  inline bool IsOpen() const { return file_.is_open(); }
+
+ private:
+  std::mutex mutex_;                //!< Mutex for the threads
+  std::ofstream file_;              //!< Summary file
+  std::vector<std::string> names_;  //!< Names written in the header
+  bool is_header_written_ = false;  //!< Flag of the header
+};
+
+/**
+ * @class MonteCarloSummaryStatistics
+ * @brief Aggregated statistics of the summary files of a Monte-Carlo simulation
+ * @details The files written by the processes are read row by row, and the statistics are updated incrementally without keeping the rows.
+ *          A case index found twice is counted only once, and a row whose case index is not in the Monte-Carlo simulation is rejected.
+ */
+class MonteCarloSummaryStatistics {
+ public:
+  /**
+   * @struct Statistics
+   * @brief Statistics of a summary value
+   */
+  struct Statistics {
+    std::string name;                       //!< Name of the value
+    unsigned long long count = 0;           //!< Number of the finite values
+    unsigned long long invalid_count = 0;   //!< Number of the non-finite values
+    double mean = 0.0;                      //!< Mean
+    double sum_of_squared_deviation = 0.0;  //!< Sum of the squared deviation from the mean
+    double min = 0.0;                       //!< Minimum value
+    double max = 0.0;                       //!< Maximum value
+    unsigned long long min_case_index = 0;  //!< Case index of the minimum value
+    unsigned long long max_case_index = 0;  //!< Case index of the maximum value
+
+    /**
+     * @fn GetStandardDeviation
+     * @brief Return the sample standard deviation
+     */
+    double GetStandardDeviation() const;
+  };
+
+  /**
+   * @fn MonteCarloSummaryStatistics
+   * @brief Constructor
+   * @param [in] number_of_cases: Number of all cases of the Monte-Carlo simulation
+   */
+  MonteCarloSummaryStatistics(const unsigned long long number_of_cases);
+
+  /**
+   * @fn ReadFile
+   * @brief Read a summary file and update the statistics
+   * @param [in] file_path: Path to the summary file
+   * @return False when the file cannot be read or the header differs from the previous files
+   */
+  bool ReadFile(const std::string file_path);
+  /**
+   * @fn WriteFile
+   * @brief Write the statistics into a CSV file
+   * @param [in] file_path: Path to the output file
+   * @return False when the file cannot be written
+   */
+  bool WriteFile(const std::string file_path) const;
+  /**
+   * @fn CountMissingCases
+   * @brief Return number of the cases which are not found in the read files
+   */
+  unsigned long long CountMissingCases() const;
+
+  // Getter
+  inline const std::vector<Statistics>& GetStatistics() const { return statistics_; }
+  inline unsigned long long GetNumberOfCases() const { return number_of_cases_; }
+  inline unsigned long long GetNumberOfDuplicatedCases() const { return number_of_duplicated_cases_; }
+  inline unsigned long long GetNumberOfRejectedRows() const { return number_of_rejected_rows_; }
+
+ private:
+  std::vector<Statistics> statistics_;                 //!< Statistics of the values
+  std::vector<bool> is_case_found_;                    //!< Flags of the found case indices
+  unsigned long long number_of_all_cases_;             //!< Number of all cases of the Monte-Carlo simulation
+  unsigned long long number_of_cases_ = 0;             //!< Number of the read cases
+  unsigned long long number_of_duplicated_cases_ = 0;  //!< Number of the skipped rows of the duplicated case indices
+  unsigned long long number_of_rejected_rows_ = 0;     //!< Number of the skipped rows of the invalid case indices
+  bool is_header_read_ = false;                        //!< Flag of the header
+
+  /**
+   * @fn AddValue
+   * @brief Update the statistics with a value
+   */
+  static void AddValue(Statistics& statistics, const unsigned long long case_index, const double value);
+};
+
+#endif  // S2E_SIMULATION_MONTE_CARLO_SIMULATION_MONTE_CARLO_SUMMARY_HPP_
@@ -0,0 +1,116 @@
+/**
+ * @file parallel_monte_carlo_simulation_executor.cpp
+ * @brief Monte-Carlo Simulation Executor class to execute the simulation cases in parallel
+ */
+
+#include "parallel_monte_carlo_simulation_executor.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <library/randomization/global_randomization.hpp>
+#include <thread>
+
+ParallelMonteCarloSimulationExecutor::ParallelMonteCarloSimulationExecutor(const MonteCarloSimulationExecutor& monte_carlo_simulator,
+                                                                           const unsigned long seed, const size_t number_of_threads)
+    : base_monte_carlo_simulator_(monte_carlo_simulator), seed_(seed), number_of_threads_(number_of_threads) {
+  if (number_of_threads_ == 0) number_of_threads_ = std::thread::hardware_concurrency();
+  if (number_of_threads_ == 0) number_of_threads_ = 1;
+}
+
+void ParallelMonteCarloSimulationExecutor::Execute(const CaseFunction& case_function) {
+  // Same number of cases with MonteCarloSimulationExecutor::WillExecuteNextCase
+  const unsigned long long number_of_all_cases =
+      base_monte_carlo_simulator_.IsEnabled() ? base_monte_carlo_simulator_.GetTotalNumberOfExecutions() : 1;
+  const unsigned long long first_case_index = shard_.GetFirstCaseIndex(number_of_all_cases);
+  const unsigned long long number_of_cases = shard_.GetEndCaseIndex(number_of_all_cases) - first_case_index;
+  const size_t number_of_threads = (size_t)std::min<unsigned long long>(number_of_threads_, number_of_cases);
+  if (number_of_threads == 0) return;
+
+  // Distribute the cases in contiguous blocks
+  std::vector<CaseQueue> queues(number_of_threads);
+  for (unsigned long long i = 0; i < number_of_cases; i++) {
+    queues[i * number_of_threads / number_of_cases].case_list.push_back(first_case_index + i);
+  }
+
+  std::mutex exception_mutex;
+  std::exception_ptr exception = nullptr;
+  auto worker = [&](const size_t worker_index) {
+    unsigned long long case_index;
+    while (PopCase(queues, worker_index, case_index)) {
+      try {
+        ExecuteCase(case_index, case_function);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(exception_mutex);
+        if (exception == nullptr) exception = std::current_exception();
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < number_of_threads; i++) {
+    threads.emplace_back(worker, i);
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  if (exception != nullptr) std::rethrow_exception(exception);
+}
+
+bool ParallelMonteCarloSimulationExecutor::SetShard(const MonteCarloShard& shard) {
+  shard_ = shard;
+  summary_writer_.reset();
+  if (shard_.summary_file_path.empty()) return true;
+  summary_writer_.reset(new MonteCarloSummaryWriter(shard_.summary_file_path));
+  return summary_writer_->IsOpen();
+}
+
+unsigned long ParallelMonteCarloSimulationExecutor::CalcCaseSeed(const unsigned long seed, const unsigned long long case_index) {
+  // SplitMix64 to decorrelate the seeds of the neighboring cases
+  unsigned long long z = (unsigned long long)seed + (case_index + 1) * 0x9e3779b97f4a7c15ULL;
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  z = z ^ (z >> 31);
+  // Seeds of std::mt19937 and GlobalRandomization are 32 bit
+  return (unsigned long)(z & 0xffffffffULL);
+}
+
+bool ParallelMonteCarloSimulationExecutor::PopCase(std::vector<CaseQueue>& queues, const size_t worker_index, unsigned long long& case_index) {
+  // Own queue from the front
+  {
+    std::lock_guard<std::mutex> lock(queues[worker_index].mutex);
+    if (!queues[worker_index].case_list.empty()) {
+      case_index = queues[worker_index].case_list.front();
+      queues[worker_index].case_list.pop_front();
+      return true;
+    }
+  }
+  // Steal from the back of the other queues
+  for (size_t i = 1; i < queues.size(); i++) {
+    CaseQueue& victim = queues[(worker_index + i) % queues.size()];
+    std::lock_guard<std::mutex> lock(victim.mutex);
+    if (!victim.case_list.empty()) {
+      case_index = victim.case_list.back();
+      victim.case_list.pop_back();
+      return true;
+    }
+  }
+  return false;
+}
+
+void ParallelMonteCarloSimulationExecutor::ExecuteCase(const unsigned long long case_index, const CaseFunction& case_function) const {
+  MonteCarloSimulationExecutor monte_carlo_simulator(base_monte_carlo_simulator_);
+  monte_carlo_simulator.SetNumberOfExecutionsDone(case_index);
+
+  // Deterministic seed of the case for the initialized parameters and the noise of the components
+  const unsigned long case_seed = CalcCaseSeed(seed_, case_index);
+  MonteCarloSimulationExecutor::SetSeed(case_seed, true);
+  monte_carlo_simulator.SetCaseSeed(case_seed);
+  if (summary_writer_ != nullptr) monte_carlo_simulator.SetSummaryWriter(summary_writer_.get());
+  // The seed of the minimal standard generator has to be in [1, 2^31 - 2]
+  global_randomization.SetSeed((long)(1 + case_seed % 2147483646UL));
+
+  monte_carlo_simulator.RandomizeAllParameters();
+  monte_carlo_simulator.AtTheBeginningOfEachCase();
+  case_function(monte_carlo_simulator);
+  monte_carlo_simulator.AtTheEndOfEachCase();
+}
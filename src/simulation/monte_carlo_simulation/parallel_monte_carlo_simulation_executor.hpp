@@ -0,0 +1,115 @@
+/**
+ * @file parallel_monte_carlo_simulation_executor.hpp
+ * @brief Monte-Carlo Simulation Executor class to execute the simulation cases in parallel
+ */
+
+#ifndef S2E_SIMULATION_MONTE_CARLO_SIMULATION_PARALLEL_MONTE_CARLO_SIMULATION_EXECUTOR_HPP_
+#define S2E_SIMULATION_MONTE_CARLO_SIMULATION_PARALLEL_MONTE_CARLO_SIMULATION_EXECUTOR_HPP_
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "monte_carlo_shard.hpp"
+#include "monte_carlo_simulation_executor.hpp"
+
+/**
+ * @class ParallelMonteCarloSimulationExecutor
+ * @brief Monte-Carlo Simulation Executor class to execute the simulation cases in parallel
+ * @details The cases are distributed to the queues of the worker threads, and an idle worker steals the cases from the other queues.
+ *          Each case is executed on one worker thread with a copy of the base executor, so the SimulationObject list and the randomization
+ *          are isolated in the thread. The seed of each case is calculated from the base seed and the case index,
+ *          so the result of a case does not depend on the number of threads and the execution order.
+ *          The case index is used as the number of executed cases in the copied executor, so the log file of each case is named with it.
+ *          For a distributed run, each process executes a shard of the case index space set by SetShard, and writes the summaries of its
+ *          cases into its own file. The files are merged by the merge_monte_carlo_summary tool.
+ * @note The SPICE calls are serialized between the threads. Use the precomputed ephemeris file to scale with the number of threads.
+ */
+class ParallelMonteCarloSimulationExecutor {
+ public:
+  /**
+   * @brief Function to execute a simulation case
+   * @param [in] monte_carlo_simulator: Executor of the case with the randomized parameters
+   */
+  using CaseFunction = std::function<void(MonteCarloSimulationExecutor& monte_carlo_simulator)>;
+
+  /**
+   * @fn ParallelMonteCarloSimulationExecutor
+   * @brief Constructor
+   * @param [in] monte_carlo_simulator: Base executor with the initialized parameters
+   * @param [in] seed: Base seed of randomization
+   * @param [in] number_of_threads: Number of worker threads (0: number of hardware threads)
+   */
+  ParallelMonteCarloSimulationExecutor(const MonteCarloSimulationExecutor& monte_carlo_simulator, const unsigned long seed,
+                                       const size_t number_of_threads = 0);
+
+  /**
+   * @fn Execute
+   * @brief Execute all simulation cases of the shard
+   * @note The first exception thrown in the cases is rethrown after all threads are finished.
+   * @param [in] case_function: Function to execute a simulation case
+   */
+  void Execute(const CaseFunction& case_function);
+
+  /**
+   * @fn SetShard
+   * @brief Execute only the cases of the shard, and write the summaries of the cases when the summary file is set
+   * @param [in] shard: Shard of the case index space
+   * @return False when the summary file cannot be opened
+   */
+  bool SetShard(const MonteCarloShard& shard);
+
+  /**
+   * @fn CalcCaseSeed
+   * @brief Calculate seed of a simulation case
+   * @param [in] seed: Base seed of randomization
+   * @param [in] case_index: Index of the simulation case
+   * @return Seed of the simulation case
+   */
+  static unsigned long CalcCaseSeed(const unsigned long seed, const unsigned long long case_index);
+
+  // Getter
+  /**
+   * @fn GetNumberOfThreads
+   * @brief Return number of worker threads
+   */
+  inline size_t GetNumberOfThreads() const { return number_of_threads_; }
+
+ private:
+  /**
+   * @struct CaseQueue
+   * @brief Queue of the case indices owned by a worker thread
+   */
+  struct CaseQueue {
+    std::mutex mutex;                          //!< Mutex for the queue
+    std::deque<unsigned long long> case_list;  //!< Indices of the simulation cases
+  };
+
+  const MonteCarloSimulationExecutor& base_monte_carlo_simulator_;  //!< Base executor with the initialized parameters
+  unsigned long seed_;                                              //!< Base seed of randomization
+  size_t number_of_threads_;                                        //!< Number of worker threads
+  MonteCarloShard shard_;                                           //!< Shard of the case index space executed in this process
+  std::unique_ptr<MonteCarloSummaryWriter> summary_writer_;         //!< Writer of the case summaries shared by the threads
+
+  /**
+   * @fn PopCase
+   * @brief Pop a case from the own queue, or steal a case from the other queues
+   * @param [in] queues: Queues of all worker threads
+   * @param [in] worker_index: Index of the worker thread
+   * @param [out] case_index: Index of the simulation case
+   * @return False when no case remains
+   */
+  static bool PopCase(std::vector<CaseQueue>& queues, const size_t worker_index, unsigned long long& case_index);
+  /**
+   * @fn ExecuteCase
+   * @brief Execute a simulation case on the current thread
+   * @param [in] case_index: Index of the simulation case
+   * @param [in] case_function: Function to execute a simulation case
+   */
+  void ExecuteCase(const unsigned long long case_index, const CaseFunction& case_function) const;
+};
+
+#endif  // S2E_SIMULATION_MONTE_CARLO_SIMULATION_PARALLEL_MONTE_CARLO_SIMULATION_EXECUTOR_HPP_
@@ -0,0 +1,131 @@
+/**
+ * @file test_monte_carlo_shard.cpp
+ * @brief Test codes for MonteCarloShard struct with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "monte_carlo_shard.hpp"
+#include "parallel_monte_carlo_simulation_executor.hpp"
+
+/**
+ * @brief Test for the case index ranges of the shards which cover all cases without gaps and overlaps
+ */
+TEST(MonteCarloShard, CaseIndexRange) {
+  const unsigned long long numbers_of_cases[] = {0, 1, 5, 7, 13, 100, 1001};
+  const unsigned long long numbers_of_shards[] = {1, 2, 3, 4, 6, 8, 16};
+  for (const unsigned long long number_of_cases : numbers_of_cases) {
+    for (const unsigned long long number_of_shards : numbers_of_shards) {
+      SCOPED_TRACE(std::to_string(number_of_cases) + " cases in " + std::to_string(number_of_shards) + " shards");
+      std::vector<int> executed_counts(number_of_cases, 0);
+      unsigned long long end_of_previous_shard = 0;
+      for (unsigned long long shard_index = 0; shard_index < number_of_shards; shard_index++) {
+        MonteCarloShard shard;
+        shard.shard_index = shard_index;
+        shard.number_of_shards = number_of_shards;
+        const unsigned long long first_case_index = shard.GetFirstCaseIndex(number_of_cases);
+        const unsigned long long end_case_index = shard.GetEndCaseIndex(number_of_cases);
+        // Contiguous blocks with the sizes different at most by one
+        EXPECT_EQ(end_of_previous_shard, first_case_index);
+        EXPECT_LE(first_case_index, end_case_index);
+        EXPECT_LE(end_case_index - first_case_index, number_of_cases / number_of_shards + 1);
+        EXPECT_GE(end_case_index - first_case_index, number_of_cases / number_of_shards);
+        for (unsigned long long case_index = first_case_index; case_index < end_case_index && case_index < number_of_cases; case_index++) {
+          executed_counts[case_index]++;
+        }
+        end_of_previous_shard = end_case_index;
+      }
+      EXPECT_EQ(number_of_cases, end_of_previous_shard);
+      for (unsigned long long case_index = 0; case_index < number_of_cases; case_index++) {
+        EXPECT_EQ(1, executed_counts[case_index]) << "case " << case_index;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Test for the cases executed by the shards of the parallel executor
+ */
+TEST(MonteCarloShard, ParallelExecutor) {
+  const unsigned long long number_of_cases = 13;
+  const unsigned long long number_of_shards = 4;
+  MonteCarloSimulationExecutor monte_carlo_simulator(number_of_cases);
+
+  std::mutex mutex;
+  std::vector<int> executed_counts(number_of_cases, 0);
+  std::vector<unsigned long> seeds(number_of_cases, 0);
+  for (unsigned long long shard_index = 0; shard_index < number_of_shards; shard_index++) {
+    MonteCarloShard shard;
+    shard.shard_index = shard_index;
+    shard.number_of_shards = number_of_shards;
+    ParallelMonteCarloSimulationExecutor executor(monte_carlo_simulator, 0x5eed, 3);
+    ASSERT_TRUE(executor.SetShard(shard));
+    executor.Execute([&](MonteCarloSimulationExecutor& case_monte_carlo_simulator) {
+      const unsigned long long case_index = case_monte_carlo_simulator.GetNumberOfExecutionsDone();
+      std::lock_guard<std::mutex> lock(mutex);
+      ASSERT_LT(case_index, number_of_cases);
+      EXPECT_GE(case_index, shard.GetFirstCaseIndex(number_of_cases));
+      EXPECT_LT(case_index, shard.GetEndCaseIndex(number_of_cases));
+      executed_counts[case_index]++;
+      seeds[case_index] = case_monte_carlo_simulator.GetCaseSeed();
+    });
+  }
+  for (unsigned long long case_index = 0; case_index < number_of_cases; case_index++) {
+    EXPECT_EQ(1, executed_counts[case_index]) << "case " << case_index;
+    // The seed does not depend on the shard
+    EXPECT_EQ(ParallelMonteCarloSimulationExecutor::CalcCaseSeed(0x5eed, case_index), seeds[case_index]);
+  }
+
+  // More shards than the cases
+  MonteCarloShard shard;
+  shard.shard_index = 5;
+  shard.number_of_shards = 20;
+  ParallelMonteCarloSimulationExecutor executor(monte_carlo_simulator, 0x5eed, 3);
+  ASSERT_TRUE(executor.SetShard(shard));
+  size_t number_of_executed_cases = 0;
+  executor.Execute([&](MonteCarloSimulationExecutor&) { number_of_executed_cases++; });
+  EXPECT_EQ(0u, number_of_executed_cases);
+}
+
+/**
+ * @brief Test for the command line arguments of the shard
+ */
+TEST(MonteCarloShard, ReadArguments) {
+  std::string arguments[] = {"s2e", "../../data/", "--monte_carlo_shard=2/7", "sample.ini", "--monte_carlo_summary=out/summary_2.csv"};
+  char* argv[] = {&arguments[0][0], &arguments[1][0], &arguments[2][0], &arguments[3][0], &arguments[4][0]};
+  int argc = 5;
+  MonteCarloShard shard;
+  ASSERT_TRUE(ReadMonteCarloShardArguments(argc, argv, shard));
+  EXPECT_EQ(2u, shard.shard_index);
+  EXPECT_EQ(7u, shard.number_of_shards);
+  EXPECT_EQ("out/summary_2.csv", shard.summary_file_path);
+  // The other arguments are kept in the order
+  ASSERT_EQ(3, argc);
+  EXPECT_STREQ("s2e", argv[0]);
+  EXPECT_STREQ("../../data/", argv[1]);
+  EXPECT_STREQ("sample.ini", argv[2]);
+
+  // Without the shard arguments
+  argc = 2;
+  ASSERT_TRUE(ReadMonteCarloShardArguments(argc, argv, shard));
+  EXPECT_EQ(2, argc);
+  EXPECT_EQ(0u, shard.shard_index);
+  EXPECT_EQ(1u, shard.number_of_shards);
+  EXPECT_TRUE(shard.summary_file_path.empty());
+
+  // Invalid shards
+  const std::string invalid_shards[] = {"--monte_carlo_shard=7/7", "--monte_carlo_shard=1/0", "--monte_carlo_shard=1", "--monte_carlo_shard=a/2",
+                                        "--monte_carlo_shard=1/2x"};
+  for (std::string invalid_shard : invalid_shards) {
+    SCOPED_TRACE(invalid_shard);
+    char* invalid_argv[] = {&arguments[0][0], &invalid_shard[0]};
+    argc = 2;
+    EXPECT_FALSE(ReadMonteCarloShardArguments(argc, invalid_argv, shard));
+    EXPECT_EQ(1, argc);
+    EXPECT_EQ(0u, shard.shard_index);
+    EXPECT_EQ(1u, shard.number_of_shards);
+  }
+}
@@ -0,0 +1,145 @@
+/**
+ * @file test_monte_carlo_summary.cpp
+ * @brief Test codes for the Monte-Carlo summary files and their aggregation with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "monte_carlo_summary.hpp"
+#include "parallel_monte_carlo_simulation_executor.hpp"
+
+/**
+ * @brief Summary value of a case
+ */
+static double CalcTestValue(const unsigned long long case_index) { return 1.5 * (double)case_index - 4.0; }
+
+/**
+ * @brief Test for merging the summary files written by two shards
+ */
+TEST(MonteCarloSummary, MergeShards) {
+  const unsigned long long number_of_cases = 11;
+  const std::string file_paths[] = {"test_monte_carlo_summary_0.csv", "test_monte_carlo_summary_1.csv"};
+  MonteCarloSimulationExecutor monte_carlo_simulator(number_of_cases);
+  for (unsigned long long shard_index = 0; shard_index < 2; shard_index++) {
+    MonteCarloShard shard;
+    shard.shard_index = shard_index;
+    shard.number_of_shards = 2;
+    shard.summary_file_path = file_paths[shard_index];
+    ParallelMonteCarloSimulationExecutor executor(monte_carlo_simulator, 7, 2);
+    ASSERT_TRUE(executor.SetShard(shard));
+    executor.Execute([](MonteCarloSimulationExecutor& case_monte_carlo_simulator) {
+      const unsigned long long case_index = case_monte_carlo_simulator.GetNumberOfExecutionsDone();
+      case_monte_carlo_simulator.AddSummaryValue("value", CalcTestValue(case_index));
+      // A non-finite value of a case is counted separately
+      case_monte_carlo_simulator.AddSummaryValue("error", case_index == 3 ? NAN : 0.5);
+    });
+  }
+
+  MonteCarloSummaryStatistics statistics(number_of_cases);
+  ASSERT_TRUE(statistics.ReadFile(file_paths[0]));
+  EXPECT_EQ(5u, statistics.GetNumberOfCases());
+  EXPECT_EQ(6u, statistics.CountMissingCases());
+  ASSERT_TRUE(statistics.ReadFile(file_paths[1]));
+  EXPECT_EQ(number_of_cases, statistics.GetNumberOfCases());
+  EXPECT_EQ(0u, statistics.CountMissingCases());
+  EXPECT_EQ(0u, statistics.GetNumberOfDuplicatedCases());
+
+  // Statistics of all cases
+  double mean = 0.0;
+  for (unsigned long long case_index = 0; case_index < number_of_cases; case_index++) mean += CalcTestValue(case_index);
+  mean /= (double)number_of_cases;
+  double sum_of_squared_deviation = 0.0;
+  for (unsigned long long case_index = 0; case_index < number_of_cases; case_index++) {
+    sum_of_squared_deviation += pow(CalcTestValue(case_index) - mean, 2.0);
+  }
+
+  const std::vector<MonteCarloSummaryStatistics::Statistics>& results = statistics.GetStatistics();
+  ASSERT_EQ(2u, results.size());
+  EXPECT_EQ("value", results[0].name);
+  EXPECT_EQ(number_of_cases, results[0].count);
+  EXPECT_EQ(0u, results[0].invalid_count);
+  EXPECT_NEAR(mean, results[0].mean, 1.0e-12);
+  EXPECT_NEAR(sqrt(sum_of_squared_deviation / (double)(number_of_cases - 1)), results[0].GetStandardDeviation(), 1.0e-12);
+  EXPECT_DOUBLE_EQ(CalcTestValue(0), results[0].min);
+  EXPECT_EQ(0u, results[0].min_case_index);
+  EXPECT_DOUBLE_EQ(CalcTestValue(number_of_cases - 1), results[0].max);
+  EXPECT_EQ(number_of_cases - 1, results[0].max_case_index);
+  EXPECT_EQ("error", results[1].name);
+  EXPECT_EQ(number_of_cases - 1, results[1].count);
+  EXPECT_EQ(1u, results[1].invalid_count);
+  EXPECT_DOUBLE_EQ(0.5, results[1].mean);
+
+  // A file read twice does not change the statistics
+  ASSERT_TRUE(statistics.ReadFile(file_paths[1]));
+  EXPECT_EQ(number_of_cases, statistics.GetNumberOfCases());
+  EXPECT_EQ(number_of_cases - 5, statistics.GetNumberOfDuplicatedCases());
+  EXPECT_NEAR(mean, statistics.GetStatistics()[0].mean, 1.0e-12);
+
+  // Output file
+  const std::string output_file_path = "test_monte_carlo_summary_statistics.csv";
+  ASSERT_TRUE(statistics.WriteFile(output_file_path));
+  std::ifstream output_file(output_file_path);
+  std::string line;
+  ASSERT_TRUE(std::getline(output_file, line));
+  EXPECT_EQ("name,count,invalid_count,mean,standard_deviation,min,min_case_index,max,max_case_index", line);
+  ASSERT_TRUE(std::getline(output_file, line));
+  EXPECT_EQ("value,11,0,", line.substr(0, 11));
+  ASSERT_TRUE(std::getline(output_file, line));
+  EXPECT_EQ("error,10,1,", line.substr(0, 11));
+  output_file.close();
+
+  std::remove(file_paths[0].c_str());
+  std::remove(file_paths[1].c_str());
+  std::remove(output_file_path.c_str());
+}
+
+/**
+ * @brief Test for the cases with the different names of the summary values
+ */
+TEST(MonteCarloSummary, DifferentNames) {
+  const std::string file_path = "test_monte_carlo_summary_names.csv";
+  {
+    MonteCarloSummaryWriter writer(file_path);
+    MonteCarloCaseSummary summary;
+    summary.Add("value", 1.0);
+    writer.Write(0, 1, summary);
+    summary.Clear();
+    summary.Add("other", 2.0);
+    EXPECT_THROW(writer.Write(1, 1, summary), std::runtime_error);
+  }
+  std::remove(file_path.c_str());
+}
+
+/**
+ * @brief Test for the summary files with the different headers, the invalid case indices, and the stopped process
+ */
+TEST(MonteCarloSummary, InvalidFiles) {
+  const std::string file_paths[] = {"test_monte_carlo_summary_a.csv", "test_monte_carlo_summary_b.csv"};
+  {
+    std::ofstream file(file_paths[0]);
+    file << "case_index,seed,value\n0,1,2.0\n18446744073709551615,1,5.0\n4,1,6.0\nx,1,7.0\n2,1,4.0\n1,1,";
+  }
+  {
+    std::ofstream file(file_paths[1]);
+    file << "case_index,seed,other\n1,1,3.0\n";
+  }
+
+  MonteCarloSummaryStatistics statistics(4);
+  ASSERT_TRUE(statistics.ReadFile(file_paths[0]));
+  // The rows of the case indices out of the simulation and the incomplete last row are skipped
+  EXPECT_EQ(2u, statistics.GetNumberOfCases());
+  EXPECT_EQ(3u, statistics.GetNumberOfRejectedRows());
+  EXPECT_EQ(2u, statistics.CountMissingCases());
+  EXPECT_DOUBLE_EQ(3.0, statistics.GetStatistics()[0].mean);
+  EXPECT_FALSE(statistics.ReadFile(file_paths[1]));
+  EXPECT_FALSE(statistics.ReadFile("test_monte_carlo_summary_missing.csv"));
+
+  std::remove(file_paths[0].c_str());
+  std::remove(file_paths[1].c_str());
+}
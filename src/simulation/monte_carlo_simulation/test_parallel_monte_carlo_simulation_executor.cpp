@@ -0,0 +1,106 @@
+/**
+ * @file test_parallel_monte_carlo_simulation_executor.cpp
+ * @brief Test codes for ParallelMonteCarloSimulationExecutor class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <library/randomization/global_randomization.hpp>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+
+#include "parallel_monte_carlo_simulation_executor.hpp"
+
+/**
+ * @struct CaseResult
+ * @brief Result of a simulation case observed in the case function
+ */
+struct CaseResult {
+  unsigned long seed;
+  std::string log_file_name;
+  libra::Vector<3> parameter;
+  long global_seed;
+};
+
+/**
+ * @brief Execute the cases with the number of threads, and return the results in the order of the case index
+ */
+static std::map<unsigned long long, CaseResult> ExecuteCases(const MonteCarloSimulationExecutor& monte_carlo_simulator,
+                                                             const size_t number_of_threads) {
+  ParallelMonteCarloSimulationExecutor executor(monte_carlo_simulator, 0x11223344, number_of_threads);
+  EXPECT_EQ(number_of_threads, executor.GetNumberOfThreads());
+
+  std::mutex mutex;
+  std::map<unsigned long long, CaseResult> results;
+  executor.Execute([&](MonteCarloSimulationExecutor& case_monte_carlo_simulator) {
+    CaseResult result;
+    result.seed = case_monte_carlo_simulator.GetCaseSeed();
+    result.log_file_name = case_monte_carlo_simulator.GetCaseLogFileName();
+    result.parameter = libra::Vector<3>(0.0);
+    case_monte_carlo_simulator.GetInitializedMonteCarloParameterVector("object", "parameter", result.parameter);
+    // The noise of the components is seeded by the global randomization
+    result.global_seed = global_randomization.MakeSeed();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    EXPECT_TRUE(results.emplace(case_monte_carlo_simulator.GetNumberOfExecutionsDone(), result).second);
+  });
+  return results;
+}
+
+/**
+ * @brief Test for the independence of the case results from the number of threads
+ */
+TEST(ParallelMonteCarloSimulationExecutor, NumberOfThreads) {
+  const unsigned long long number_of_cases = 13;
+  MonteCarloSimulationExecutor monte_carlo_simulator(number_of_cases);
+  monte_carlo_simulator.AddInitializedMonteCarloParameter("object", "parameter", libra::Vector<3>(-1.0), libra::Vector<3>(1.0),
+                                                          InitializedMonteCarloParameters::kCartesianUniform);
+
+  const std::map<unsigned long long, CaseResult> single_thread_results = ExecuteCases(monte_carlo_simulator, 1);
+  const std::map<unsigned long long, CaseResult> multi_thread_results = ExecuteCases(monte_carlo_simulator, 4);
+
+  ASSERT_EQ(number_of_cases, single_thread_results.size());
+  ASSERT_EQ(number_of_cases, multi_thread_results.size());
+  for (unsigned long long case_index = 0; case_index < number_of_cases; case_index++) {
+    const CaseResult& single = single_thread_results.at(case_index);
+    const CaseResult& multi = multi_thread_results.at(case_index);
+    EXPECT_EQ(ParallelMonteCarloSimulationExecutor::CalcCaseSeed(0x11223344, case_index), single.seed);
+    EXPECT_EQ(single.seed, multi.seed);
+    EXPECT_EQ("default" + std::to_string(case_index) + ".csv", single.log_file_name);
+    EXPECT_EQ(single.log_file_name, multi.log_file_name);
+    EXPECT_EQ(single.global_seed, multi.global_seed);
+    for (size_t i = 0; i < 3; i++) {
+      EXPECT_DOUBLE_EQ(single.parameter[i], multi.parameter[i]);
+      EXPECT_LE(-1.0, single.parameter[i]);
+      EXPECT_GE(1.0, single.parameter[i]);
+    }
+  }
+  // The neighboring cases are randomized differently
+  EXPECT_NE(single_thread_results.at(0).seed, single_thread_results.at(1).seed);
+  EXPECT_NE(single_thread_results.at(0).parameter[0], single_thread_results.at(1).parameter[0]);
+
+  // The base executor is not changed by the cases
+  EXPECT_EQ(0u, monte_carlo_simulator.GetNumberOfExecutionsDone());
+}
+
+/**
+ * @brief Test for the exception thrown in a case
+ */
+TEST(ParallelMonteCarloSimulationExecutor, Exception) {
+  MonteCarloSimulationExecutor monte_carlo_simulator(8);
+  ParallelMonteCarloSimulationExecutor executor(monte_carlo_simulator, 1, 3);
+
+  std::mutex mutex;
+  size_t number_of_executed_cases = 0;
+  auto case_function = [&](MonteCarloSimulationExecutor& case_monte_carlo_simulator) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      number_of_executed_cases++;
+    }
+    if (case_monte_carlo_simulator.GetNumberOfExecutionsDone() == 5) throw std::runtime_error("case 5");
+  };
+  EXPECT_THROW(executor.Execute(case_function), std::runtime_error);
+  // The other cases are executed
+  EXPECT_EQ(8u, number_of_executed_cases);
+}
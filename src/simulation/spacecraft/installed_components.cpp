@@ -18,3 +18,7 @@ libra::Vector<3> InstalledComponents::GenerateTorque_b_Nm() {
 }
 
 void InstalledComponents::LogSetup(Logger& logger) { UNUSED(logger); }
+
+void InstalledComponents::SaveSnapshot(Snapshot& snapshot) const { UNUSED(snapshot); }
+
+void InstalledComponents::RestoreSnapshot(Snapshot& snapshot) { UNUSED(snapshot); }
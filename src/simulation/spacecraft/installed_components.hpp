@@ -8,6 +8,7 @@
 
 #include <library/logger/logger.hpp>
 #include <library/math/vector.hpp>
+#include <library/utilities/snapshot.hpp>
 
 /**
  * @class InstalledComponents
@@ -47,6 +48,20 @@ class InstalledComponents {
    * @details Users need to override this function to add logger for components
    */
   virtual void LogSetup(Logger& logger);
+
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the states of the components into the snapshot
+   * @details Users need to override this function to branch the simulation with the component states.
+   *          Every component with states (noises, outputs, delay buffers, power switches) needs to be saved,
+   *          otherwise a restored branch continues with the states left by the previous branch.
+   */
+  virtual void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the states of the components from the snapshot in the same order as SaveSnapshot
+   */
+  virtual void RestoreSnapshot(Snapshot& snapshot);
 };
 
 #endif  // S2E_SIMULATION_SPACECRAFT_INSTALLED_COMPONENTS_HPP_
@@ -49,6 +49,22 @@ void Spacecraft::LogSetup(Logger& logger) {
   components_->LogSetup(logger);
 }
 
+void Spacecraft::SaveSnapshot(Snapshot& snapshot) const {
+  clock_generator_.SaveSnapshot(snapshot);
+  dynamics_->SaveSnapshot(snapshot);
+  local_environment_->SaveSnapshot(snapshot);
+  disturbances_->SaveSnapshot(snapshot);
+  components_->SaveSnapshot(snapshot);
+}
+
+void Spacecraft::RestoreSnapshot(Snapshot& snapshot) {
+  clock_generator_.RestoreSnapshot(snapshot);
+  dynamics_->RestoreSnapshot(snapshot);
+  local_environment_->RestoreSnapshot(snapshot);
+  disturbances_->RestoreSnapshot(snapshot);
+  components_->RestoreSnapshot(snapshot);
+}
+
 void Spacecraft::Update(const SimulationTime* simulation_time) {
   dynamics_->ClearForceTorque();
 
@@ -69,6 +85,12 @@ void Spacecraft::Update(const SimulationTime* simulation_time) {
   dynamics_->AddTorque_b_Nm(components_->GenerateTorque_b_Nm());
   dynamics_->AddForce_b_N(components_->GenerateForce_b_N());
 
+  // Stop the orbit integration step at the next predicted eclipse event where the solar radiation pressure changes rapidly
+  const SolarRadiationPressureEnvironment& srp_environment = local_environment_->GetSolarRadiationPressure();
+  if (srp_environment.GetIsEclipsePredictionEnabled()) {
+    dynamics_->SetOrbit().SetStepLimitTime_s(srp_environment.GetEclipsePredictor().GetNextEventTime_s(simulation_time->GetElapsedTime_s()));
+  }
+
   // Propagate dynamics
   dynamics_->Update(simulation_time, &(local_environment_->GetCelestialInformation()));
 }
@@ -64,6 +64,17 @@ class Spacecraft {
    */
   virtual void LogSetup(Logger& logger);
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the states of the dynamics, local environment, disturbances, and components into the snapshot
+   */
+  virtual void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the states of the dynamics, local environment, disturbances, and components from the snapshot
+   */
+  virtual void RestoreSnapshot(Snapshot& snapshot);
+
   // Getters
   /**
    * @fn GetDynamics
@@ -7,6 +7,9 @@
 
 SampleCase::SampleCase(std::string initialise_base_file) : SimulationCase(initialise_base_file) {}
 
+SampleCase::SampleCase(const std::string initialise_base_file, const MonteCarloSimulationExecutor& monte_carlo_simulator, const std::string log_path)
+    : SimulationCase(initialise_base_file, monte_carlo_simulator, log_path) {}
+
 SampleCase::~SampleCase() {
   delete sample_spacecraft_;
   delete sample_ground_station_;
@@ -32,6 +35,16 @@ void SampleCase::UpdateTargetObjects() {
   sample_ground_station_->Update(global_environment_->GetCelestialInformation().GetEarthRotation(), *sample_spacecraft_);
 }
 
+void SampleCase::SaveSnapshot(Snapshot& snapshot) const {
+  SimulationCase::SaveSnapshot(snapshot);
+  sample_spacecraft_->SaveSnapshot(snapshot);
+}
+
+void SampleCase::RestoreSnapshot(Snapshot& snapshot) {
+  SimulationCase::RestoreSnapshot(snapshot);
+  sample_spacecraft_->RestoreSnapshot(snapshot);
+}
+
 std::string SampleCase::GetLogHeader() const {
   std::string str_tmp = "";
 
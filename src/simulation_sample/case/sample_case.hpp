@@ -22,6 +22,14 @@ class SampleCase : public SimulationCase {
    * @brief Constructor
    */
   SampleCase(const std::string initialise_base_file);
+  /**
+   * @fn SampleCase
+   * @brief Constructor for Monte-Carlo Simulation
+   * @param[in] initialise_base_file: File path to initialize base file
+   * @param[in] monte_carlo_simulator: Monte-Carlo simulator
+   * @param[in] log_path: Log output file path for Monte-Carlo simulation
+   */
+  SampleCase(const std::string initialise_base_file, const MonteCarloSimulationExecutor& monte_carlo_simulator, const std::string log_path);
 
   /**
    * @fn ~SampleCase
@@ -40,6 +48,17 @@ class SampleCase : public SimulationCase {
    */
   virtual std::string GetLogValue() const;
 
+  /**
+   * @fn SaveSnapshot
+   * @brief Override function of SaveSnapshot to add the spacecraft
+   */
+  virtual void SaveSnapshot(Snapshot& snapshot) const;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Override function of RestoreSnapshot to add the spacecraft
+   */
+  virtual void RestoreSnapshot(Snapshot& snapshot);
+
  private:
   SampleSpacecraft* sample_spacecraft_;         //!< Instance of spacecraft
   SampleGroundStation* sample_ground_station_;  //!< Instance of ground station
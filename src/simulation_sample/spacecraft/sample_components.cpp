@@ -194,3 +194,34 @@ void SampleComponents::LogSetup(Logger& logger) {
   logger.AddLogList(force_generator_);
   logger.AddLogList(torque_generator_);
 }
+
+void SampleComponents::SaveSnapshot(Snapshot& snapshot) const {
+  // The OBC and the antenna have no state to be saved
+  pcu_->SaveSnapshot(snapshot);
+  gyro_sensor_->SaveSnapshot(snapshot);
+  magnetometer_->SaveSnapshot(snapshot);
+  star_sensor_->SaveSnapshot(snapshot);
+  sun_sensor_->SaveSnapshot(snapshot);
+  gnss_receiver_->SaveSnapshot(snapshot);
+  magnetorquer_->SaveSnapshot(snapshot);
+  reaction_wheel_->SaveSnapshot(snapshot);
+  thruster_->SaveSnapshot(snapshot);
+  force_generator_->SaveSnapshot(snapshot);
+  torque_generator_->SaveSnapshot(snapshot);
+  mtq_magnetometer_interference_->SaveSnapshot(snapshot);
+}
+
+void SampleComponents::RestoreSnapshot(Snapshot& snapshot) {
+  pcu_->RestoreSnapshot(snapshot);
+  gyro_sensor_->RestoreSnapshot(snapshot);
+  magnetometer_->RestoreSnapshot(snapshot);
+  star_sensor_->RestoreSnapshot(snapshot);
+  sun_sensor_->RestoreSnapshot(snapshot);
+  gnss_receiver_->RestoreSnapshot(snapshot);
+  magnetorquer_->RestoreSnapshot(snapshot);
+  reaction_wheel_->RestoreSnapshot(snapshot);
+  thruster_->RestoreSnapshot(snapshot);
+  force_generator_->RestoreSnapshot(snapshot);
+  torque_generator_->RestoreSnapshot(snapshot);
+  mtq_magnetometer_interference_->RestoreSnapshot(snapshot);
+}
@@ -84,6 +84,16 @@ class SampleComponents : public InstalledComponents {
    * @brief Setup the logger for components
    */
   void LogSetup(Logger& logger);
+  /**
+   * @fn SaveSnapshot
+   * @brief Write the states of the components into the snapshot
+   */
+  void SaveSnapshot(Snapshot& snapshot) const override;
+  /**
+   * @fn RestoreSnapshot
+   * @brief Read the states of the components from the snapshot
+   */
+  void RestoreSnapshot(Snapshot& snapshot) override;
 
   // Getter
   inline Antenna& GetAntenna() const { return *antenna_; }